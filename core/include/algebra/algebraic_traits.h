@@ -3,9 +3,11 @@
 #include "algebra/basic_algebraic_traits.h"
 #include "algebra/binary_expr_algebraic_traits.h"
 #include "algebra/scalar_expr_algebraic_traits.h"
+#include "algebra/unary_expr_algebraic_traits.h"
 #include "algebra/fused_tensor_algebraic_traits.h"
 #include "algebra/fused_matrix_algebraic_traits.h"
 #include "algebra/fused_vector_algebraic_traits.h"
 #include "algebra/permuted_view_algebraic_traits.h"
 #include "algebra/permuted_view_constexpr_algebraic_traits.h"
+#include "algebra/broadcast_view_constexpr_algebraic_traits.h"
 #include "algebra/fma_expr_algebraic_traits.h"
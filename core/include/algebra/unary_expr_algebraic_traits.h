@@ -0,0 +1,24 @@
+#pragma once
+
+/*
+    An elementwise function of a tensor is a tensor of the same shape:
+        ✔ exp(x) + y, sqrt(x) * 2 → tensor arithmetic as usual
+        ✘ algebra: exp of a quaternion is not the elementwise exp
+ */
+template <typename EXPR,
+          template <typename, my_size_t, typename> class Op>
+class UnaryExpr;
+
+namespace algebra
+{
+    template <typename EXPR,
+              template <typename, my_size_t, typename> class Op>
+    struct algebraic_traits<UnaryExpr<EXPR, Op>>
+    {
+        static constexpr bool vector_space = is_vector_space_v<EXPR>;
+        static constexpr bool algebra = false;
+        static constexpr bool lie_group = false;
+        static constexpr bool metric = is_metric_v<EXPR>;
+        static constexpr bool tensor = is_tensor_v<EXPR>;
+    };
+} // namespace algebra
@@ -6,6 +6,7 @@
 #include "matrix_traits.h"
 #include "fused/fused_matrix.h"
 #include "algorithms/operations/inverse.h"
+#include "algorithms/operations/matrix_chain.h"
 
 /**
  * @file kalman.h
@@ -37,7 +38,9 @@
  *
  * Numerically more stable than the standard P' = P - K·S·Kᵀ form.
  * Guarantees symmetry and positive semi-definiteness of the result,
- * even with floating-point rounding.
+ * even with floating-point rounding. Both outer products are symmetric,
+ * so only their lower triangle is computed (KernelGemm::gemmt) and then
+ * mirrored, which is exactly symmetric by construction.
  *
  * ============================================================================
  * FAILURE MODES
@@ -75,11 +78,10 @@ namespace matrix_algorithms
         static_assert(is_floating_point_v<T>,
                       "kalman_gain requires a floating-point scalar type");
 
-        // S = H·P·Hᵀ + R  (M×M)
+        // S = H·P·Hᵀ + R  (M×M), + R fused into the GEMM epilogue
         auto HP = FusedMatrix<T, M, N>::matmul(H, P);
 
-        FusedMatrix<T, M, M> S;
-        S = FusedMatrix<T, M, M>::matmul(HP, H.transpose_view()) + R;
+        auto S = FusedMatrix<T, M, M>::matmul(HP, H.transpose_view(), GemmEpilogue<T>{}.add(R));
 
         // S⁻¹
         auto S_inv_result = inverse(S);
@@ -91,9 +93,8 @@ namespace matrix_algorithms
 
         auto &S_inv = S_inv_result.value();
 
-        // K = P·Hᵀ·S⁻¹  (N×M)
-        auto PHt = FusedMatrix<T, N, M>::matmul(P, H.transpose_view());
-        auto K = FusedMatrix<T, N, M>::matmul(PHt, S_inv);
+        // K = P·Hᵀ·S⁻¹  (N×M), association chosen at compile time
+        auto K = prod(P, H.transpose_view(), S_inv);
 
         return move(K);
     }
@@ -131,16 +132,27 @@ namespace matrix_algorithms
         FusedMatrix<T, N, N> IKH;
         IKH = I - KH;
 
-        // (I-K·H)·P·(I-K·H)ᵀ
-        auto tmp = FusedMatrix<T, N, N>::matmul(IKH, P);
-        auto term1 = FusedMatrix<T, N, N>::matmul(tmp, IKH.transpose_view());
+        // Both terms are symmetric: compute (I-K·H)·P · (I-K·H)ᵀ and
+        // (K·R) · Kᵀ on the lower triangle only, accumulating into one
+        // buffer, then mirror once.
+        using Gemm = ::detail::KernelGemm<T, BITS, DefaultArch>;
+        using ::detail::GemmUplo;
+        constexpr my_size_t ldN = FusedMatrix<T, N, N>::Layout::stride(0);
+        constexpr my_size_t ldM = FusedMatrix<T, N, M>::Layout::stride(0);
 
-        // K·R·Kᵀ
+        auto IKHP = FusedMatrix<T, N, N>::matmul(IKH, P);
         auto KR = FusedMatrix<T, N, M>::matmul(K, R);
-        auto term2 = FusedMatrix<T, N, N>::matmul(KR, K.transpose_view());
 
-        FusedMatrix<T, N, N> result(T(0));
-        result = term1 + term2;
+        // Zeroed so the second pass never reads uninitialized entries
+        // where its diagonal tiles overhang the first pass's.
+        FusedMatrix<T, N, N> result;
+        result.setToZero();
+        Gemm::template gemmt<GemmUplo::Lower, false, true>(
+            IKHP.data(), N, N, ldN, IKH.data(), ldN, result.data(), ldN);
+        Gemm::template gemmt<GemmUplo::Lower, false, true>(
+            KR.data(), N, M, ldM, K.data(), ldM, result.data(), ldN,
+            GemmEpilogue<T>{}.scale(T{1}, T{1}));
+        Gemm::template symmetrize<GemmUplo::Lower>(result.data(), N, ldN);
         return result;
     }
 
@@ -0,0 +1,287 @@
+#ifndef FUSED_ALGORITHMS_MATRIX_CHAIN_H
+#define FUSED_ALGORITHMS_MATRIX_CHAIN_H
+
+#include "config.h"
+#include "helper_traits.h"
+#include "fused/fused_matrix.h"
+#include "fused/kernel_ops/kernel_gemm.h"
+
+/**
+ * @file matrix_chain.h
+ * @brief Chained matrix product with compile-time optimal parenthesization.
+ *
+ * prod(A₀, A₁, …, Aₙ₋₁) evaluates A₀·A₁·…·Aₙ₋₁ in the association that
+ * minimizes multiply-adds. All shapes are template parameters, so the
+ * classic matrix-chain dynamic program runs entirely at compile time:
+ *
+ * ============================================================================
+ * ALGORITHM
+ * ============================================================================
+ *
+ *   Aᵢ is d[i] × d[i+1]
+ *
+ *   cost(i, i) = 0
+ *   cost(i, j) = min_{i ≤ k < j}  cost(i, k) + cost(k+1, j) + d[i]·d[k+1]·d[j+1]
+ *
+ *   split(i, j) = the minimizing k; evaluation recurses on (i, k) and (k+1, j).
+ *
+ * Example (N = 15 state, M = 3 measurement):
+ *
+ *   K·R·Kᵀ  as (K·R)·Kᵀ : 15·3·3 + 15·3·15 =  810
+ *           as K·(R·Kᵀ) :  3·3·15 + 15·3·15 =  810
+ *   Hᵀ·H·P  as (Hᵀ·H)·P : 15·3·15 + 15·15·15 = 4050
+ *           as Hᵀ·(H·P) :  3·15·15 + 15·3·15 = 1350   ← chosen
+ *
+ * ============================================================================
+ * MEMORY
+ * ============================================================================
+ *
+ * Intermediates live in one stack-allocated scratch buffer, carved up
+ * stack-wise as the recursion descends; its size is also computed at
+ * compile time. Physical operands — matrices and their transpose_views —
+ * are read in place (the GEMM reads a transpose_view transposed); lazy
+ * expressions are evaluated into the scratch buffer first (as matmul
+ * does). The outermost product is written straight into the result.
+ *
+ * @code
+ *   auto KRKt = prod(K, R, K.transpose_view());
+ *   auto Q    = prod(G, Qc, G.transpose_view());
+ * @endcode
+ *
+ * ============================================================================
+ */
+
+namespace matrix_algorithms
+{
+    namespace detail
+    {
+
+        /// Compile-time matrix-chain plan for N operands.
+        template <my_size_t N>
+        struct MatrixChainPlan
+        {
+            my_size_t cost[N][N]{};  ///< Minimal multiply-adds for the sub-chain i..j
+            my_size_t split[N][N]{}; ///< Last operand of the left factor in the optimal split
+        };
+
+        /// Classic O(N³) matrix-chain dynamic program over extents d[0..N].
+        template <my_size_t N>
+        consteval MatrixChainPlan<N> matrix_chain_order(const my_size_t (&d)[N + 1])
+        {
+            MatrixChainPlan<N> p{};
+            for (my_size_t len = 2; len <= N; ++len)
+            {
+                for (my_size_t i = 0; i + len <= N; ++i)
+                {
+                    const my_size_t j = i + len - 1;
+                    p.cost[i][j] = ~my_size_t{0};
+                    for (my_size_t k = i; k < j; ++k)
+                    {
+                        const my_size_t c = p.cost[i][k] + p.cost[k + 1][j] + d[i] * d[k + 1] * d[j + 1];
+                        if (c < p.cost[i][j])
+                        {
+                            p.cost[i][j] = c;
+                            p.split[i][j] = k;
+                        }
+                    }
+                }
+            }
+            return p;
+        }
+
+        /// I-th element of a parameter pack.
+        template <my_size_t I, typename First, typename... Rest>
+        FORCE_INLINE constexpr const auto &chain_operand(const First &first, const Rest &...rest) noexcept
+        {
+            if constexpr (I == 0)
+                return first;
+            else
+                return chain_operand<I - 1>(rest...);
+        }
+
+        /// Operand exposes physical storage (a matrix or a view of one).
+        template <typename Op>
+        consteval bool chain_has_data()
+        {
+            return requires(const Op &o) { o.data(); };
+        }
+
+        /// Physical operand whose storage is its transpose (e.g. a transpose_view).
+        template <typename Op>
+        consteval bool chain_stored_transposed()
+        {
+            if constexpr (chain_has_data<Op>())
+                return Op::Layout::stride(1) != 1;
+            else
+                return false;
+        }
+
+        template <typename T, typename... Ops>
+        struct MatrixChain
+        {
+            static constexpr my_size_t N = sizeof...(Ops);
+
+            static constexpr my_size_t rows[N] = {Ops::Dim[0]...};
+            static constexpr my_size_t cols[N] = {Ops::Dim[1]...};
+
+            /// Chain extents: operand i is d[i] × d[i+1].
+            static constexpr auto make_extents()
+            {
+                struct
+                {
+                    my_size_t v[N + 1];
+                } e{};
+                for (my_size_t i = 0; i < N; ++i)
+                    e.v[i] = rows[i];
+                e.v[N] = cols[N - 1];
+                return e;
+            }
+            static constexpr bool extents_match()
+            {
+                for (my_size_t i = 0; i + 1 < N; ++i)
+                    if (cols[i] != rows[i + 1])
+                        return false;
+                return true;
+            }
+
+            static constexpr auto d = make_extents();
+            static constexpr MatrixChainPlan<N> plan = matrix_chain_order<N>(d.v);
+
+            /// Operand can be handed to the GEMM as a raw pointer.
+            static constexpr bool in_place[N] = {chain_has_data<Ops>()...};
+
+            /// In-place operand is read transposed by the GEMM.
+            static constexpr bool trans[N] = {chain_stored_transposed<Ops>()...};
+
+            /// Row stride of an in-place operand as stored.
+            template <typename Op>
+            static constexpr my_size_t stored_stride()
+            {
+                return Op::Layout::stride(Op::Layout::stride(1) == 1 ? 0 : 1);
+            }
+
+            /// Padded row stride of an intermediate with d[c] columns.
+            template <my_size_t... Is>
+            static constexpr auto make_padded(index_seq<Is...>)
+            {
+                struct
+                {
+                    my_size_t v[N + 1];
+                } p{{FusedTensorND<T, 1, d.v[Is]>::Layout::stride(0)...}};
+                return p;
+            }
+            static constexpr auto padded = make_padded(typename make_index_seq<N + 1>::type{});
+
+            /// Scratch elements held by the (materialized) result of sub-chain i..j.
+            static constexpr my_size_t result_size(my_size_t i, my_size_t j)
+            {
+                return (i == j && in_place[i]) ? 0 : d.v[i] * padded.v[j + 1];
+            }
+
+            /// Scratch needed below the result of sub-chain i..j while computing it.
+            static constexpr my_size_t scratch_need(my_size_t i, my_size_t j)
+            {
+                if (i == j)
+                    return 0;
+                const my_size_t k = plan.split[i][j];
+                const my_size_t sL = result_size(i, k);
+                const my_size_t sR = result_size(k + 1, j);
+                const my_size_t left = sL + scratch_need(i, k);
+                const my_size_t right = sL + sR + scratch_need(k + 1, j);
+                return left > right ? left : right;
+            }
+
+            static constexpr my_size_t scratch_size = scratch_need(0, N - 1);
+
+            /// Evaluate sub-chain I..J into dst (row stride ld), using scratch beyond it.
+            template <my_size_t I, my_size_t J>
+            static void eval(T *dst, my_size_t ld, T *scratch, const Ops &...ops) noexcept
+            {
+                if constexpr (I == J)
+                {
+                    KernelOps<T, BITS, DefaultArch>::eval(dst, chain_operand<I>(ops...));
+                }
+                else
+                {
+                    constexpr my_size_t K = plan.split[I][J];
+                    constexpr my_size_t sL = result_size(I, K);
+                    constexpr my_size_t sR = result_size(K + 1, J);
+
+                    constexpr bool ta = I == K && trans[I];
+                    constexpr bool tb = K + 1 == J && trans[J];
+
+                    const T *a;
+                    my_size_t lda;
+                    if constexpr (I == K && in_place[I])
+                    {
+                        a = chain_operand<I>(ops...).data();
+                        lda = stored_stride<remove_cvref_t<decltype(chain_operand<I>(ops...))>>();
+                    }
+                    else
+                    {
+                        eval<I, K>(scratch, padded.v[K + 1], scratch + sL, ops...);
+                        a = scratch;
+                        lda = padded.v[K + 1];
+                    }
+
+                    const T *b;
+                    my_size_t ldb;
+                    if constexpr (K + 1 == J && in_place[J])
+                    {
+                        b = chain_operand<J>(ops...).data();
+                        ldb = stored_stride<remove_cvref_t<decltype(chain_operand<J>(ops...))>>();
+                    }
+                    else
+                    {
+                        eval<K + 1, J>(scratch + sL, padded.v[J + 1], scratch + sL + sR, ops...);
+                        b = scratch + sL;
+                        ldb = padded.v[J + 1];
+                    }
+
+                    ::detail::KernelGemm<T, BITS, DefaultArch>::template gemm<ta, tb>(
+                        a, d.v[I], d.v[K + 1], lda,
+                        b, d.v[J + 1], ldb,
+                        dst, ld);
+                }
+            }
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief Chained product A₀·A₁·…·Aₙ₋₁ in FLOP-optimal association.
+     *
+     * @tparam Ops 2-D expressions (matrices, views or lazy expressions) with
+     *             chain-compatible shapes (checked at compile time).
+     * @return FusedMatrix<T, rows(A₀), cols(Aₙ₋₁)>.
+     */
+    template <typename First, typename... Rest>
+    auto prod(const BaseExpr<First> &first, const BaseExpr<Rest> &...rest)
+    {
+        using T = typename First::value_type;
+        using Chain = detail::MatrixChain<T, First, Rest...>;
+
+        static_assert(((First::NumDims == 2) && ... && (Rest::NumDims == 2)),
+                      "prod operands must be 2-dimensional");
+        static_assert(((is_same_v<T, typename Rest::value_type>) && ...),
+                      "prod operands must have the same value type");
+        static_assert(Chain::extents_match(), "prod: inner dimensions of consecutive operands differ");
+
+        FusedMatrix<T, First::Dim[0], Chain::d.v[Chain::N]> result;
+
+        if constexpr (Chain::N == 1)
+        {
+            result = first.derived();
+        }
+        else
+        {
+            alignas(DATA_ALIGNAS) T scratch[Chain::scratch_size > 0 ? Chain::scratch_size : 1];
+            Chain::template eval<0, Chain::N - 1>(result.data(), result.getStride(0), scratch,
+                                                  first.derived(), rest.derived()...);
+        }
+        return result;
+    }
+
+} // namespace matrix_algorithms
+
+#endif // FUSED_ALGORITHMS_MATRIX_CHAIN_H
@@ -3,6 +3,7 @@
 
 #include "config.h"
 #include "fused/fused_matrix.h"
+#include "fused/kernel_ops/kernel_gemm.h"
 
 /**
  * @file rank_update.h
@@ -17,11 +18,16 @@
  *
  *   P' = F · P · Fᵀ + Q
  *
- * Computed as two matrix multiplications and one addition:
+ * Computed as two matrix multiplications, with the addition fused into
+ * the second one's GEMM epilogue (Q is added while the tile is in registers):
  *   1. tmp = F · P          (N×N · N×N → N×N)
- *   2. P'  = tmp · Fᵀ + Q  (N×N · N×N + N×N → N×N)
+ *   2. P'  = tmp · Fᵀ + Q  (one triangle only, see KernelGemm::gemmt)
+ *   3. mirror the triangle onto the other half
  *
- * Complexity: O(2N³) for the two multiplications, O(N²) for the addition.
+ * The second product is symmetric, so only its lower triangle is
+ * computed: N³ + N³/2 multiply-adds instead of 2N³, and + Q is only
+ * evaluated on the computed entries. Callers that read a single triangle
+ * (e.g. a following Cholesky) can skip step 3 with Fill = Lower / Upper.
  *
  * @note For Kalman filters where F is sparse or structured (e.g. identity
  * plus small perturbation), specialized implementations can exploit that
@@ -35,10 +41,37 @@
 
 namespace matrix_algorithms
 {
+    namespace detail
+    {
+
+        /// ep(F·P·Fᵀ) with the second product restricted to one triangle.
+        template <::detail::GemmUplo Fill, typename T, my_size_t N, typename Ep>
+        FusedMatrix<T, N, N> symmetric_product(
+            const FusedMatrix<T, N, N> &F,
+            const FusedMatrix<T, N, N> &P,
+            const Ep &ep)
+        {
+            using Gemm = ::detail::KernelGemm<T, BITS, DefaultArch>;
+            using ::detail::GemmUplo;
+            constexpr GemmUplo Tri = (Fill == GemmUplo::Upper) ? GemmUplo::Upper : GemmUplo::Lower;
+            constexpr my_size_t ld = FusedMatrix<T, N, N>::Layout::stride(0);
+
+            auto FP = FusedMatrix<T, N, N>::matmul(F, P);
+
+            FusedMatrix<T, N, N> result;
+            Gemm::template gemmt<Tri, false, true>(FP.data(), N, N, ld, F.data(), ld, result.data(), ld, ep);
+            if constexpr (Fill == GemmUplo::Full)
+                Gemm::template symmetrize<Tri>(result.data(), N, ld);
+            return result;
+        }
+
+    } // namespace detail
 
     /**
      * @brief Compute the symmetric rank-k update P' = F·P·Fᵀ + Q.
      *
+     * @tparam Fill Full (default): the whole matrix. Lower / Upper: only that
+     *              triangle is guaranteed; the rest is unspecified.
      * @tparam T  Scalar type (deduced).
      * @tparam N  Matrix dimension (deduced).
      * @param  F  State transition matrix (N×N).
@@ -46,17 +79,13 @@ namespace matrix_algorithms
      * @param  Q  Process noise matrix (N×N), symmetric positive (semi-)definite.
      * @return P' = F·P·Fᵀ + Q.
      */
-    template <typename T, my_size_t N>
+    template <::detail::GemmUplo Fill = ::detail::GemmUplo::Full, typename T, my_size_t N>
     FusedMatrix<T, N, N> symmetric_rank_k_update(
         const FusedMatrix<T, N, N> &F,
         const FusedMatrix<T, N, N> &P,
         const FusedMatrix<T, N, N> &Q)
     {
-        FusedMatrix<T, N, N> result;
-
-        auto tmp = FusedMatrix<T, N, N>::matmul(F, P);
-        result = FusedMatrix<T, N, N>::matmul(tmp, F.transpose_view()) + Q;
-        return result;
+        return detail::symmetric_product<Fill>(F, P, GemmEpilogue<T>{}.add(Q));
     }
 
     /**
@@ -64,22 +93,19 @@ namespace matrix_algorithms
      *
      * Useful when process noise is added separately or is zero.
      *
+     * @tparam Fill Full (default), or Lower / Upper for a single triangle.
      * @tparam T  Scalar type (deduced).
      * @tparam N  Matrix dimension (deduced).
      * @param  F  State transition matrix (N×N).
      * @param  P  Covariance matrix (N×N), symmetric.
      * @return P' = F·P·Fᵀ.
      */
-    template <typename T, my_size_t N>
+    template <::detail::GemmUplo Fill = ::detail::GemmUplo::Full, typename T, my_size_t N>
     FusedMatrix<T, N, N> symmetric_rank_k_update(
         const FusedMatrix<T, N, N> &F,
         const FusedMatrix<T, N, N> &P)
     {
-        FusedMatrix<T, N, N> result;
-
-        auto tmp = FusedMatrix<T, N, N>::matmul(F, P);
-        result = FusedMatrix<T, N, N>::matmul(tmp, F.transpose_view());
-        return result;
+        return detail::symmetric_product<Fill>(F, P, GemmEpilogue<T>{});
     }
 
 } // namespace matrix_algorithms
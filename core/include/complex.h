@@ -0,0 +1,115 @@
+#ifndef COMPLEX_H
+#define COMPLEX_H
+
+#include "simple_type_traits.h"
+
+/**
+ * @file complex.h
+ * @brief STL-free complex number type for complex tensors.
+ *
+ * Complex<T> is two T's, real part first, with no other state: an array
+ * of Complex<T> is the interleaved [re, im, re, im, ...] layout the
+ * complex microkernels load directly into SIMD registers (the same layout
+ * as std::complex<T> and C99 _Complex). Used as the element type of
+ * FusedTensorND / FusedMatrix:
+ *
+ *   FusedMatrix<Complex<float>, 8, 8> H, X, Y;
+ *   Y = H * X + conj(X);   // fused, complex multiply in SIMD
+ */
+
+/**
+ * @brief Complex number with real and imaginary parts of type T.
+ * @tparam T float or double.
+ */
+template <typename T>
+struct Complex
+{
+    static_assert(is_floating_point_v<T>, "Complex<T>: T must be float or double");
+
+    using value_type = T;
+
+    T re;
+    T im;
+
+    constexpr Complex() noexcept : re(T{0}), im(T{0}) {}
+
+    /// Real numbers convert implicitly, so T{0}, T(1) and scalar literals work
+    /// wherever the library writes them for a generic element type.
+    constexpr Complex(T real, T imag = T{0}) noexcept : re(real), im(imag) {}
+
+    constexpr T real() const noexcept { return re; }
+    constexpr T imag() const noexcept { return im; }
+
+    constexpr Complex &operator+=(const Complex &o) noexcept
+    {
+        re += o.re;
+        im += o.im;
+        return *this;
+    }
+    constexpr Complex &operator-=(const Complex &o) noexcept
+    {
+        re -= o.re;
+        im -= o.im;
+        return *this;
+    }
+    constexpr Complex &operator*=(const Complex &o) noexcept { return *this = *this * o; }
+    constexpr Complex &operator/=(const Complex &o) noexcept { return *this = *this / o; }
+
+    friend constexpr Complex operator+(const Complex &a, const Complex &b) noexcept { return {a.re + b.re, a.im + b.im}; }
+    friend constexpr Complex operator-(const Complex &a, const Complex &b) noexcept { return {a.re - b.re, a.im - b.im}; }
+    friend constexpr Complex operator-(const Complex &a) noexcept { return {-a.re, -a.im}; }
+
+    friend constexpr Complex operator*(const Complex &a, const Complex &b) noexcept
+    {
+        return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+    }
+
+    /// a·conj(b) / |b|², the same formula as the vector kernels (no rescaling
+    /// for |b| near the overflow / underflow limits).
+    friend constexpr Complex operator/(const Complex &a, const Complex &b) noexcept
+    {
+        const T d = b.re * b.re + b.im * b.im;
+        return {(a.re * b.re + a.im * b.im) / d, (a.im * b.re - a.re * b.im) / d};
+    }
+
+    friend constexpr bool operator==(const Complex &a, const Complex &b) noexcept { return a.re == b.re && a.im == b.im; }
+    friend constexpr bool operator!=(const Complex &a, const Complex &b) noexcept { return !(a == b); }
+};
+
+/// Complex conjugate.
+template <typename T>
+constexpr Complex<T> conj(const Complex<T> &z) noexcept
+{
+    return {z.re, -z.im};
+}
+
+/// Squared magnitude |z|².
+template <typename T>
+constexpr T norm(const Complex<T> &z) noexcept
+{
+    return z.re * z.re + z.im * z.im;
+}
+
+/**
+ * @brief Compile-time check for Complex<T>.
+ * @tparam T Type to test.
+ */
+template <typename T>
+struct is_complex
+{
+    static constexpr bool value = false;
+};
+
+/// @cond
+template <typename T>
+struct is_complex<Complex<T>>
+{
+    static constexpr bool value = true;
+};
+/// @endcond
+
+/** @brief Helper variable template for is_complex. */
+template <typename T>
+inline constexpr bool is_complex_v = is_complex<T>::value;
+
+#endif // COMPLEX_H
@@ -26,6 +26,22 @@
 #define FORCE_INLINE inline
 #endif
 
+/**
+ * @def FORCE_INLINE_LAMBDA
+ * @brief FORCE_INLINE for lambdas, placed after the parameter list.
+ *
+ * Needed where nested lambdas are expanded at compile time (e.g. the
+ * unrolled small GEMM) and the inliner's budget would otherwise stop
+ * short, leaving the accumulators in memory.
+ */
+#ifdef __GNUC__
+#define FORCE_INLINE_LAMBDA __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define FORCE_INLINE_LAMBDA [[msvc::forceinline]]
+#else
+#define FORCE_INLINE_LAMBDA
+#endif
+
 /**
  * @def DEFINE_TYPE_ALIAS(type, name)
  * @brief Portable type alias macro.
@@ -131,4 +147,28 @@ using MyErrorHandler = ErrorHandler<PCErrorHandler>;
  */
 #define TESSERACT_USE_FMAD
 
+/**
+ * @def TESSERACT_NO_PADDING
+ * @brief Store tensors compact (NoPaddingPolicy) instead of padding the last
+ * dimension to a multiple of the SIMD width.
+ *
+ * Saves up to simdWidth − 1 elements per row. Kernels finish each row with
+ * one masked vector (Microkernel::maskload / maskstore) and read rows with
+ * unaligned loads.
+ */
+// #define TESSERACT_NO_PADDING
+
+/**
+ * @def TESSERACT_RUNTIME_DISPATCH
+ * @brief Compile the x86 kernels for SSE2, AVX2 + FMA and AVX-512 in every
+ * translation unit and pick one with cpuid at start-up.
+ *
+ * The compile flags set the baseline (e.g. -mavx2 -mfma for a Haswell
+ * floor). KernelGemm::gemm and large contiguous KernelEval / KernelReduce
+ * calls then run on the widest family the CPU supports; everything else
+ * stays on the baseline. Tensors are padded and aligned for AVX-512.
+ * GCC / Clang on x86 only (see fused/microkernels/x86_dispatch.h).
+ */
+// #define TESSERACT_RUNTIME_DISPATCH
+
 #endif // CONFIG_H
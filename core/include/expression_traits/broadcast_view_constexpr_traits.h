@@ -0,0 +1,15 @@
+#pragma once
+
+template <typename Tensor, my_size_t... Dims>
+class BroadcastViewConstExpr; // forward declarations
+
+namespace expression
+{
+    template <typename Tensor, my_size_t... Dims>
+    struct traits<BroadcastViewConstExpr<Tensor, Dims...>>
+    {
+        static constexpr bool IsPermuted = false;
+        static constexpr bool IsContiguous = true;
+        static constexpr bool IsPhysical = false; // no target-shaped buffer behind it
+    };
+} // namespace expression
@@ -3,9 +3,11 @@
 #include "expression_traits/basic_expr_traits.h"
 #include "expression_traits/binary_expr_traits.h"
 #include "expression_traits/scalar_expr_traits.h"
+#include "expression_traits/unary_expr_traits.h"
 #include "expression_traits/fused_tensor_traits.h"
 #include "expression_traits/fused_matrix_traits.h"
 #include "expression_traits/fused_vector_traits.h"
 #include "expression_traits/permuted_view_traits.h"
 #include "expression_traits/permuted_view_constexpr_traits.h"
+#include "expression_traits/broadcast_view_constexpr_traits.h"
 #include "expression_traits/fma_expr_traits.h"
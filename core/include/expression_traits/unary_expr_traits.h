@@ -0,0 +1,17 @@
+#pragma once
+
+template <typename EXPR,
+          template <typename, my_size_t, typename> class Op>
+class UnaryExpr;
+
+namespace expression
+{
+    template <typename EXPR,
+              template <typename, my_size_t, typename> class Op>
+    struct traits<UnaryExpr<EXPR, Op>>
+    {
+        static constexpr bool IsPermuted = traits<EXPR>::IsPermuted;
+        static constexpr bool IsContiguous = traits<EXPR>::IsContiguous;
+        static constexpr bool IsPhysical = false;
+    };
+} // namespace expression
@@ -0,0 +1,214 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include "simple_type_traits.h"
+#include "numeric_limits.h"
+
+/**
+ * @file fixed_point.h
+ * @brief Q15 / Q31 fixed-point types for targets without an FPU.
+ *
+ * FixedPoint<Raw, F> stores a signed integer q and stands for q · 2^-F,
+ * a value in [-1, 1). Arithmetic follows the CMSIS-DSP conventions:
+ * addition and subtraction saturate, multiplication rounds to nearest and
+ * saturates (−1 · −1 gives the largest positive value), division by zero
+ * saturates to ±max. Used as the element type of FusedTensorND /
+ * FusedMatrix, expressions, dot products and GEMM compile to integer code
+ * (see fixed_point_microkernel.h):
+ *
+ *   FusedMatrix<Q15, 8, 8> A, B, C;
+ *   C = A * B + A;                              // saturating Q15 arithmetic
+ *   auto P = FusedMatrix<Q15, 8, 8>::matmul(A, B); // 64-bit accumulation
+ *
+ * Q15: 16-bit, resolution 2^-15 ≈ 3.1e-5.
+ * Q31: 32-bit, resolution 2^-31 ≈ 4.7e-10.
+ *
+ * On Cortex-M cores with the DSP extension (__ARM_FEATURE_DSP) the
+ * saturating operations use the CMSIS intrinsics (__QADD16, __QSUB16,
+ * __QADD, __QSUB, __SSAT); elsewhere they are portable C. There Q15
+ * tensors also run on a packed kernel, two values per word, with __SMLALD
+ * for dot products and GEMM.
+ */
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "arm/cmsis_compiler.h"
+#define TESSERACT_FIXED_POINT_DSP
+#endif
+
+namespace detail
+{
+    /// Clamp v to [lo, hi].
+    template <typename Wide>
+    constexpr Wide saturate(Wide v, Wide lo, Wide hi) noexcept
+    {
+        return v < lo ? lo : (v > hi ? hi : v);
+    }
+
+    /// Round-to-nearest (ties away from zero) quotient n / d, d ≠ 0.
+    constexpr long long div_round(long long n, long long d) noexcept
+    {
+        const long long q = n / d;
+        const long long r = n % d;
+        const long long ar = r < 0 ? -r : r;
+        const long long ad = d < 0 ? -d : d;
+        if (2 * ar >= ad)
+            return ((n < 0) != (d < 0)) ? q - 1 : q + 1;
+        return q;
+    }
+} // namespace detail
+
+/**
+ * @brief Signed fixed-point number q · 2^-FracBits with saturating arithmetic.
+ *
+ * @tparam Raw      short (Q15) or int (Q31)
+ * @tparam FracBits Fractional bits: 8 · sizeof(Raw) − 1
+ */
+template <typename Raw, int FracBits>
+struct FixedPoint
+{
+    static_assert(FracBits == 8 * static_cast<int>(sizeof(Raw)) - 1,
+                  "FixedPoint: the format has one sign bit and FracBits fractional bits");
+
+    using raw_type = Raw;
+    static constexpr int frac_bits = FracBits;
+    static constexpr long long raw_max = (1LL << FracBits) - 1;
+    static constexpr long long raw_min = -(1LL << FracBits);
+
+    Raw raw;
+
+    constexpr FixedPoint() noexcept : raw(0) {}
+
+    /// Nearest representable value (ties away from zero), saturated to [-1, 1 − 2^-F].
+    /// Implicit, so T{0}, scalar literals and calibrated constants work as for float.
+    constexpr FixedPoint(double x) noexcept : raw(from_real(x)) {}
+
+    constexpr explicit operator double() const noexcept { return static_cast<double>(raw) / static_cast<double>(1LL << FracBits); }
+    constexpr explicit operator float() const noexcept { return static_cast<float>(static_cast<double>(*this)); }
+
+    static constexpr FixedPoint from_raw(Raw r) noexcept
+    {
+        FixedPoint q;
+        q.raw = r;
+        return q;
+    }
+
+    /// Saturate a wider integer to the raw range.
+    static constexpr FixedPoint saturate(long long r) noexcept
+    {
+        return from_raw(static_cast<Raw>(detail::saturate(r, raw_min, raw_max)));
+    }
+
+    friend constexpr FixedPoint operator+(FixedPoint a, FixedPoint b) noexcept
+    {
+#ifdef TESSERACT_FIXED_POINT_DSP
+        if (!__builtin_is_constant_evaluated())
+        {
+            if constexpr (FracBits == 15)
+                return from_raw(static_cast<Raw>(__QADD16(static_cast<unsigned short>(a.raw), static_cast<unsigned short>(b.raw))));
+            else
+                return from_raw(__QADD(a.raw, b.raw));
+        }
+#endif
+        return saturate(static_cast<long long>(a.raw) + b.raw);
+    }
+
+    friend constexpr FixedPoint operator-(FixedPoint a, FixedPoint b) noexcept
+    {
+#ifdef TESSERACT_FIXED_POINT_DSP
+        if (!__builtin_is_constant_evaluated())
+        {
+            if constexpr (FracBits == 15)
+                return from_raw(static_cast<Raw>(__QSUB16(static_cast<unsigned short>(a.raw), static_cast<unsigned short>(b.raw))));
+            else
+                return from_raw(__QSUB(a.raw, b.raw));
+        }
+#endif
+        return saturate(static_cast<long long>(a.raw) - b.raw);
+    }
+
+    friend constexpr FixedPoint operator-(FixedPoint a) noexcept { return saturate(-static_cast<long long>(a.raw)); }
+
+    /// (a · b + 2^(F−1)) >> F, saturated.
+    friend constexpr FixedPoint operator*(FixedPoint a, FixedPoint b) noexcept
+    {
+        const long long p = static_cast<long long>(a.raw) * b.raw;
+#ifdef TESSERACT_FIXED_POINT_DSP
+        if (!__builtin_is_constant_evaluated())
+        {
+            if constexpr (FracBits == 15)
+                return from_raw(static_cast<Raw>(__SSAT(static_cast<int>((p + (1LL << 14)) >> 15), 16)));
+        }
+#endif
+        return saturate((p + (1LL << (FracBits - 1))) >> FracBits);
+    }
+
+    /// a / b rounded to nearest, saturated; x / 0 is ±max (0 / 0 is 0).
+    friend constexpr FixedPoint operator/(FixedPoint a, FixedPoint b) noexcept
+    {
+        if (b.raw == 0)
+            return from_raw(a.raw < 0 ? static_cast<Raw>(raw_min) : (a.raw > 0 ? static_cast<Raw>(raw_max) : Raw(0)));
+        return saturate(detail::div_round(static_cast<long long>(a.raw) << FracBits, b.raw));
+    }
+
+    constexpr FixedPoint &operator+=(FixedPoint o) noexcept { return *this = *this + o; }
+    constexpr FixedPoint &operator-=(FixedPoint o) noexcept { return *this = *this - o; }
+    constexpr FixedPoint &operator*=(FixedPoint o) noexcept { return *this = *this * o; }
+    constexpr FixedPoint &operator/=(FixedPoint o) noexcept { return *this = *this / o; }
+
+    friend constexpr bool operator==(FixedPoint a, FixedPoint b) noexcept { return a.raw == b.raw; }
+    friend constexpr bool operator!=(FixedPoint a, FixedPoint b) noexcept { return a.raw != b.raw; }
+    friend constexpr bool operator<(FixedPoint a, FixedPoint b) noexcept { return a.raw < b.raw; }
+    friend constexpr bool operator>(FixedPoint a, FixedPoint b) noexcept { return a.raw > b.raw; }
+    friend constexpr bool operator<=(FixedPoint a, FixedPoint b) noexcept { return a.raw <= b.raw; }
+    friend constexpr bool operator>=(FixedPoint a, FixedPoint b) noexcept { return a.raw >= b.raw; }
+
+private:
+    static constexpr Raw from_real(double x) noexcept
+    {
+        const double s = x * static_cast<double>(1LL << FracBits);
+        if (!(s > static_cast<double>(raw_min))) // also NaN → min
+            return static_cast<Raw>(raw_min);
+        if (s >= static_cast<double>(raw_max))
+            return static_cast<Raw>(raw_max);
+        return static_cast<Raw>(static_cast<long long>(s < 0.0 ? s - 0.5 : s + 0.5));
+    }
+};
+
+/// Q1.15: 16-bit fixed point (CMSIS q15_t).
+using Q15 = FixedPoint<short, 15>;
+
+/// Q1.31: 32-bit fixed point (CMSIS q31_t).
+using Q31 = FixedPoint<int, 31>;
+
+/**
+ * @brief Compile-time check for the fixed-point types (Q15, Q31).
+ * @tparam T Type to test.
+ */
+template <typename T>
+struct is_fixed_point
+{
+    static constexpr bool value = false;
+};
+
+/// @cond
+template <typename Raw, int F>
+struct is_fixed_point<FixedPoint<Raw, F>>
+{
+    static constexpr bool value = true;
+};
+/// @endcond
+
+/** @brief Helper variable template for is_fixed_point. */
+template <typename T>
+inline constexpr bool is_fixed_point_v = is_fixed_point<T>::value;
+
+/// @cond
+template <typename Raw, int F>
+struct NumericLimits<FixedPoint<Raw, F>>
+{
+    static constexpr FixedPoint<Raw, F> max() noexcept { return FixedPoint<Raw, F>::from_raw(static_cast<Raw>(FixedPoint<Raw, F>::raw_max)); }
+    static constexpr FixedPoint<Raw, F> lowest() noexcept { return FixedPoint<Raw, F>::from_raw(static_cast<Raw>(FixedPoint<Raw, F>::raw_min)); }
+};
+/// @endcond
+
+#endif // FIXED_POINT_H
@@ -3,6 +3,7 @@
 #include "config.h"
 #include "simple_type_traits.h"
 #include "fused/microkernels/microkernel_base.h"
+#include "fused/microkernels/vector_math.h"
 
 // ===============================
 // Operation Tags
@@ -173,8 +174,24 @@ struct Div
     {
         return microkernel::div(scalar, a);
     }
+
+    // Integer tensor / scalar: multiply-high and shift where the kernel has it
+    FORCE_INLINE static type apply(type a, const IntDivisor<T> &d) noexcept
+    {
+        if constexpr (requires { microkernel::div(a, d); })
+            return microkernel::div(a, d);
+        else
+            return microkernel::div(a, d.divisor);
+    }
 };
 
+/// True for the Div operation tag.
+template <template <typename, my_size_t, typename> class Op>
+inline constexpr bool is_div_op_v = false;
+
+template <>
+inline constexpr bool is_div_op_v<Div> = true;
+
 template <typename T, my_size_t Bits, typename Arch = DefaultArch>
 struct Min
 {
@@ -216,3 +233,148 @@ struct Max
 
     // commutative — no need for scalar-vec variant
 };
+
+// ===============================
+// Elementwise Math (vector_math.h)
+// ===============================
+// Unary tags for UnaryExpr, plus Atan2 for BinaryExpr / ScalarExpr.
+// float and double only; accuracy bounds are listed in vector_math.h.
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Exp
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return VecMath<microkernel>::exp(a);
+    }
+};
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Log
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return VecMath<microkernel>::log(a);
+    }
+};
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Sqrt
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return VecMath<microkernel>::sqrt(a);
+    }
+};
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Rsqrt
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return VecMath<microkernel>::rsqrt(a);
+    }
+};
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Sin
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return VecMath<microkernel>::sin(a);
+    }
+};
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Cos
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return VecMath<microkernel>::cos(a);
+    }
+};
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Tanh
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return VecMath<microkernel>::tanh(a);
+    }
+};
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Sigmoid
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return VecMath<microkernel>::sigmoid(a);
+    }
+};
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Atan2 // atan2(a, b) = angle of (b, a)
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a, type b) noexcept
+    {
+        return VecMath<microkernel>::atan2(a, b);
+    }
+
+    template <typename Vec = type>
+        requires(!is_same_v<Vec, T>)
+    FORCE_INLINE static Vec apply(Vec a, T scalar) noexcept
+    {
+        return VecMath<microkernel>::atan2(a, microkernel::set1(scalar));
+    }
+
+    template <typename Vec = type>
+        requires(!is_same_v<Vec, T>)
+    FORCE_INLINE static Vec apply(T scalar, Vec a) noexcept
+    {
+        return VecMath<microkernel>::atan2(microkernel::set1(scalar), a);
+    }
+};
+
+// ===============================
+// Complex
+// ===============================
+// Complex<float> / Complex<double> only (the complex microkernels).
+
+template <typename T, my_size_t Bits, typename Arch = DefaultArch>
+struct Conj
+{
+    using microkernel = Microkernel<T, Bits, Arch>;
+    using type = typename microkernel::VecType;
+
+    FORCE_INLINE static type apply(type a) noexcept
+    {
+        return microkernel::conj(a);
+    }
+};
@@ -16,8 +16,16 @@ class ScalarExprRHS : public BaseExpr<ScalarExprRHS<EXPR, ScalarT, Op>>
     static_assert(is_same_v<typename EXPR::value_type, ScalarT>,
                   "ScalarExprRHS: EXPR value_type and ScalarT must be the same");
 
+    // Integer division by the scalar: its multiply-high form is computed once, here
+    static constexpr bool PreparedDivisor = is_div_op_v<Op> && has_int_divisor_v<ScalarT>;
+    struct NoDivisor
+    {
+        constexpr explicit NoDivisor(ScalarT) noexcept {}
+    };
+
     const EXPR &_expr;
     ScalarT _scalar;
+    [[no_unique_address]] conditional_t<PreparedDivisor, IntDivisor<ScalarT>, NoDivisor> _divisor;
 
 public:
     static constexpr my_size_t NumDims = EXPR::NumDims;
@@ -26,7 +34,7 @@ public:
     using value_type = typename EXPR::value_type;
     using Layout = typename EXPR::Layout;
 
-    ScalarExprRHS(const EXPR &expr, ScalarT scalar) : _expr(expr), _scalar(scalar) {}
+    ScalarExprRHS(const EXPR &expr, ScalarT scalar) : _expr(expr), _scalar(scalar), _divisor(scalar) {}
 
     const EXPR &expr() const noexcept { return _expr; }
     ScalarT scalar() const noexcept { return _scalar; }
@@ -49,17 +57,27 @@ public:
     template <typename T, my_size_t Bits, typename Arch>
     inline typename Op<T, Bits, Arch>::type evalu(const my_size_t flat) const noexcept
     {
-        return Op<T, Bits, Arch>::apply(
-            _expr.template evalu<T, Bits, Arch>(flat),
-            _scalar);
+        if constexpr (PreparedDivisor && is_same_v<T, ScalarT>)
+            return Op<T, Bits, Arch>::apply(
+                _expr.template evalu<T, Bits, Arch>(flat),
+                _divisor);
+        else
+            return Op<T, Bits, Arch>::apply(
+                _expr.template evalu<T, Bits, Arch>(flat),
+                _scalar);
     }
 
     template <typename T, my_size_t Bits, typename Arch>
     inline typename Op<T, Bits, Arch>::type logical_evalu(my_size_t logical_flat) const noexcept
     {
-        return Op<T, Bits, Arch>::apply(
-            _expr.template logical_evalu<T, Bits, Arch>(logical_flat),
-            _scalar);
+        if constexpr (PreparedDivisor && is_same_v<T, ScalarT>)
+            return Op<T, Bits, Arch>::apply(
+                _expr.template logical_evalu<T, Bits, Arch>(logical_flat),
+                _divisor);
+        else
+            return Op<T, Bits, Arch>::apply(
+                _expr.template logical_evalu<T, Bits, Arch>(logical_flat),
+                _scalar);
     }
 
     my_size_t getNumDims() const noexcept
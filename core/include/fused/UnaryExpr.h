@@ -0,0 +1,70 @@
+#pragma once
+#include "config.h"
+#include "fused/BaseExpr.h"
+#include "fused/Operations.h"
+#include "simple_type_traits.h"
+
+// ===============================
+// Unary Expression Template
+// ===============================
+// Op(EXPR) elementwise, e.g. exp(x), sqrt(x). Op is a one-argument tag from
+// Operations.h; it sees whole vectors in evalu, so the function fuses into
+// the surrounding expression like any arithmetic node.
+template <
+    typename EXPR,
+    template <typename, my_size_t, typename> class Op>
+class UnaryExpr : public BaseExpr<UnaryExpr<EXPR, Op>>
+{
+    const EXPR &_expr;
+
+public:
+    static constexpr my_size_t NumDims = EXPR::NumDims;
+    static constexpr const my_size_t *Dim = EXPR::Dim;
+    static constexpr my_size_t TotalSize = EXPR::TotalSize;
+    using value_type = typename EXPR::value_type;
+    using Layout = typename EXPR::Layout;
+
+    explicit UnaryExpr(const EXPR &expr) : _expr(expr) {}
+
+    const EXPR &expr() const noexcept { return _expr; }
+
+    template <typename Output>
+    bool may_alias(const Output &output) const noexcept
+    {
+        return _expr.may_alias(output);
+    }
+
+    template <my_size_t length>
+    inline auto operator()(my_size_t (&indices)[length]) const noexcept
+    {
+        using T = std::decay_t<decltype(_expr(indices))>;
+        return Op<T, 0, GENERICARCH>::apply(_expr(indices));
+    }
+
+    template <typename T, my_size_t Bits, typename Arch>
+    inline typename Op<T, Bits, Arch>::type evalu(const my_size_t flat) const noexcept
+    {
+        return Op<T, Bits, Arch>::apply(_expr.template evalu<T, Bits, Arch>(flat));
+    }
+
+    template <typename T, my_size_t Bits, typename Arch>
+    inline typename Op<T, Bits, Arch>::type logical_evalu(my_size_t logical_flat) const noexcept
+    {
+        return Op<T, Bits, Arch>::apply(_expr.template logical_evalu<T, Bits, Arch>(logical_flat));
+    }
+
+    my_size_t getNumDims() const noexcept
+    {
+        return _expr.getNumDims();
+    }
+
+    my_size_t getDim(my_size_t i) const // TODO: conditionally noexcept
+    {
+        return _expr.getDim(i);
+    }
+
+    my_size_t getTotalSize() const noexcept
+    {
+        return _expr.getTotalSize();
+    }
+};
@@ -0,0 +1,615 @@
+#ifndef FUSED_EINSUM_H
+#define FUSED_EINSUM_H
+
+#include "config.h"
+#include "helper_traits.h"
+#include "simple_type_traits.h"
+#include "fused/BaseExpr.h"
+#include "fused/fused_tensor.h"
+#include "fused/kernel_ops/kernel_gemm.h"
+
+/**
+ * @file einsum.h
+ * @brief Compile-time string einsum: `einsum<"bij,bjk->bik">(A, B)`.
+ *
+ * The subscript string is parsed at compile time together with the operand
+ * shapes. Every label gets one of six roles:
+ *
+ *   role       in A   in B   in output   example ("bij,bjk->bik")
+ *   ─────────  ────   ────   ─────────   ────────────────────────
+ *   batch       ✓      ✓        ✓         b
+ *   free A      ✓               ✓         i
+ *   free B             ✓        ✓         k
+ *   contract    ✓      ✓                  j
+ *   sum A       ✓                         (summed out of A alone)
+ *   sum B              ✓                  (summed out of B alone)
+ *
+ * Any contraction is then the batched GEMM
+ *
+ *   C'[batch][M×N] = A'[batch][M×K] · B'[batch][K×N]
+ *
+ *   M = Π free A dims     K = Π contract dims     N = Π free B dims
+ *
+ * which runs as one KernelGemm::gemm() per batch slice. M = 1 or N = 1
+ * is a GEMV and runs KernelGemm::gemv() instead, as einsum(t1, t2, a, b)
+ * does (M = N = 1, a dot product, included); K = 1, an outer product,
+ * stays on gemm().
+ *
+ * Operands are used in place when their physical layout already is the
+ * canonical one (e.g. "ij,jk->ik", "bij,jk->bik", "bij,bjk->bik") or its
+ * transpose, which the GEMM reads directly ("ji,jk->ik", "ij,kj->ik",
+ * "bik,bjk->bij"); otherwise they are packed in a single pass that permutes axes and sums
+ * out sum-only labels (the transpose-GEMM-transpose lowering). The output
+ * is written in place when its labels are ordered batch, free A, free B
+ * with a single free B axis, and permuted from a canonical buffer
+ * otherwise.
+ *
+ * All label bookkeeping, shape checks and strides are resolved at compile
+ * time; malformed subscripts and shape mismatches are static_assert errors.
+ *
+ * Subscripts: letters a–z / A–Z, no repeated label within one operand
+ * (no traces or diagonals). Without "->", the output is every label that
+ * appears exactly once, in alphabetical order (NumPy's implicit mode).
+ * A rank-0 output ("i,i->", "ij,ij->") returns a scalar.
+ *
+ * @code
+ *   auto C  = einsum<"ij,jk->ik">(A, B);      // GEMM, no copies
+ *   auto Ct = einsum<"ij,jk->ki">(A, B);      // (A·B)ᵀ
+ *   auto Y  = einsum<"bij,bjk->bik">(X, W);   // batched GEMM
+ *   auto y  = einsum<"ij,j->i">(A, x);        // GEMV
+ *   auto s  = einsum<"ij,ij->">(A, B);        // Frobenius inner product
+ *   auto Z  = einsum<"ijk,jkl->il">(P, Q);    // two contracted axes
+ * @endcode
+ */
+
+namespace detail
+{
+
+    /// Subscript string usable as a template argument: einsum<"ij,jk->ik">.
+    template <my_size_t N>
+    struct EinsumString
+    {
+        char str[N]{};
+
+        consteval EinsumString(const char (&s)[N])
+        {
+            for (my_size_t i = 0; i < N; ++i)
+                str[i] = s[i];
+        }
+
+        static constexpr my_size_t length = N - 1;
+    };
+
+    /// Upper bound on operand / output rank accepted by einsum.
+    inline constexpr my_size_t EINSUM_MAX_RANK = 16;
+
+    /**
+     * @brief Fully resolved einsum: shapes, roles and canonical strides.
+     *
+     * Canonical buffers are 2-D with batch folded into the rows:
+     *   A' [batch·M, K]   B' [batch·K, N]   C' [batch·M, N]
+     * For every axis, *_row is its stride in rows and *_col its stride in
+     * columns of the canonical buffer (both 0 for summed-out axes).
+     */
+    struct EinsumPlan
+    {
+        bool well_formed = true;   ///< Two operands, letters only, at most one "->"
+        bool ranks_match = true;   ///< Label counts equal operand ranks
+        bool labels_unique = true; ///< No label repeated within an operand or the output
+        bool outputs_known = true; ///< Every output label appears in an operand
+        bool dims_match = true;    ///< Shared labels have equal extents
+
+        my_size_t rankA = 0, rankB = 0, rankOut = 0;
+        my_size_t out_dims[EINSUM_MAX_RANK]{};
+
+        my_size_t batch = 1, M = 1, K = 1, N = 1;
+
+        my_size_t a_row[EINSUM_MAX_RANK]{}, a_col[EINSUM_MAX_RANK]{};
+        my_size_t b_row[EINSUM_MAX_RANK]{}, b_col[EINSUM_MAX_RANK]{};
+        my_size_t c_row[EINSUM_MAX_RANK]{}, c_col[EINSUM_MAX_RANK]{};
+
+        bool a_direct = false; ///< A is [batch..., free A..., k]
+        bool b_direct = false; ///< B is [batch..., contract..., n]
+        bool c_direct = false; ///< Output is [batch..., free A..., n]
+        bool a_trans = false;  ///< A is [batch..., contract..., m] (read transposed)
+        bool b_trans = false;  ///< B is [batch..., free B..., k] (read transposed)
+    };
+
+    constexpr bool einsum_is_label(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    constexpr my_size_t einsum_find(const char *labels, my_size_t n, char c)
+    {
+        for (my_size_t i = 0; i < n; ++i)
+            if (labels[i] == c)
+                return i;
+        return n;
+    }
+
+    /// Row-major stride of labels[i] within the list (product of later extents).
+    constexpr my_size_t einsum_list_stride(const my_size_t *dims, my_size_t n, my_size_t i)
+    {
+        my_size_t s = 1;
+        for (my_size_t j = i + 1; j < n; ++j)
+            s *= dims[j];
+        return s;
+    }
+
+    /// True when labels[0..n) equals the concatenation l1 ++ l2 ++ l3.
+    constexpr bool einsum_is_concat(const char *labels, my_size_t n,
+                                   const char *l1, my_size_t n1,
+                                   const char *l2, my_size_t n2,
+                                   const char *l3, my_size_t n3)
+    {
+        if (n != n1 + n2 + n3)
+            return false;
+        for (my_size_t i = 0; i < n1; ++i)
+            if (labels[i] != l1[i])
+                return false;
+        for (my_size_t i = 0; i < n2; ++i)
+            if (labels[n1 + i] != l2[i])
+                return false;
+        for (my_size_t i = 0; i < n3; ++i)
+            if (labels[n1 + n2 + i] != l3[i])
+                return false;
+        return true;
+    }
+
+    template <EinsumString Spec, typename LeftExpr, typename RightExpr>
+    consteval EinsumPlan make_einsum_plan()
+    {
+        constexpr my_size_t R = EINSUM_MAX_RANK;
+        EinsumPlan p{};
+
+        // ---------------- parse ----------------
+        char labA[R]{}, labB[R]{}, labO[R]{};
+        my_size_t nA = 0, nB = 0, nO = 0;
+        my_size_t part = 0; // 0 = A, 1 = B, 2 = output
+        bool explicit_out = false;
+
+        for (my_size_t i = 0; i < Spec.length; ++i)
+        {
+            const char c = Spec.str[i];
+            if (c == ' ')
+                continue;
+            if (c == ',')
+            {
+                if (part != 0)
+                    p.well_formed = false;
+                part = 1;
+            }
+            else if (c == '-' && i + 1 < Spec.length && Spec.str[i + 1] == '>')
+            {
+                if (part != 1)
+                    p.well_formed = false;
+                part = 2;
+                explicit_out = true;
+                ++i;
+            }
+            else if (einsum_is_label(c))
+            {
+                char *dst = (part == 0) ? labA : (part == 1) ? labB
+                                                             : labO;
+                my_size_t &n = (part == 0) ? nA : (part == 1) ? nB
+                                                              : nO;
+                if (n == R)
+                    p.well_formed = false;
+                else
+                    dst[n++] = c;
+            }
+            else
+            {
+                p.well_formed = false;
+            }
+        }
+        if (part == 0)
+            p.well_formed = false;
+        if (!p.well_formed)
+            return p;
+
+        if (!explicit_out)
+        {
+            // Implicit output: labels appearing exactly once, alphabetical
+            for (char c = 'A'; c <= 'z'; ++c)
+            {
+                if (!einsum_is_label(c))
+                    continue;
+                const bool inA = einsum_find(labA, nA, c) < nA;
+                const bool inB = einsum_find(labB, nB, c) < nB;
+                if (inA != inB && nO < R)
+                    labO[nO++] = c;
+            }
+        }
+
+        p.rankA = nA;
+        p.rankB = nB;
+        p.rankOut = nO;
+        if (nA != LeftExpr::NumDims || nB != RightExpr::NumDims)
+        {
+            p.ranks_match = false;
+            return p;
+        }
+
+        for (my_size_t i = 0; i < nA; ++i)
+            if (einsum_find(labA + i + 1, nA - i - 1, labA[i]) < nA - i - 1)
+                p.labels_unique = false;
+        for (my_size_t i = 0; i < nB; ++i)
+            if (einsum_find(labB + i + 1, nB - i - 1, labB[i]) < nB - i - 1)
+                p.labels_unique = false;
+        for (my_size_t i = 0; i < nO; ++i)
+            if (einsum_find(labO + i + 1, nO - i - 1, labO[i]) < nO - i - 1)
+                p.labels_unique = false;
+        if (!p.labels_unique)
+            return p;
+
+        // ---------------- roles (canonical order) ----------------
+        char batch[R]{}, freeA[R]{}, freeB[R]{}, contract[R]{};
+        my_size_t d_batch[R]{}, d_freeA[R]{}, d_freeB[R]{}, d_contract[R]{};
+        my_size_t n_batch = 0, n_freeA = 0, n_freeB = 0, n_contract = 0;
+        bool has_sumA = false, has_sumB = false;
+
+        for (my_size_t o = 0; o < nO; ++o)
+        {
+            const char c = labO[o];
+            const my_size_t ia = einsum_find(labA, nA, c);
+            const my_size_t ib = einsum_find(labB, nB, c);
+            if (ia < nA && ib < nB)
+            {
+                if (LeftExpr::Dim[ia] != RightExpr::Dim[ib])
+                    p.dims_match = false;
+                d_batch[n_batch] = LeftExpr::Dim[ia];
+                batch[n_batch++] = c;
+                p.out_dims[o] = LeftExpr::Dim[ia];
+            }
+            else if (ia < nA)
+            {
+                d_freeA[n_freeA] = LeftExpr::Dim[ia];
+                freeA[n_freeA++] = c;
+                p.out_dims[o] = LeftExpr::Dim[ia];
+            }
+            else if (ib < nB)
+            {
+                d_freeB[n_freeB] = RightExpr::Dim[ib];
+                freeB[n_freeB++] = c;
+                p.out_dims[o] = RightExpr::Dim[ib];
+            }
+            else
+            {
+                p.outputs_known = false;
+                return p;
+            }
+        }
+
+        for (my_size_t i = 0; i < nA; ++i)
+        {
+            const char c = labA[i];
+            if (einsum_find(labO, nO, c) < nO)
+                continue;
+            const my_size_t ib = einsum_find(labB, nB, c);
+            if (ib < nB)
+            {
+                if (LeftExpr::Dim[i] != RightExpr::Dim[ib])
+                    p.dims_match = false;
+                d_contract[n_contract] = LeftExpr::Dim[i];
+                contract[n_contract++] = c;
+            }
+            else
+            {
+                has_sumA = true;
+            }
+        }
+        for (my_size_t i = 0; i < nB; ++i)
+            if (einsum_find(labO, nO, labB[i]) == nO && einsum_find(labA, nA, labB[i]) == nA)
+                has_sumB = true;
+
+        if (!p.dims_match)
+            return p;
+
+        for (my_size_t i = 0; i < n_batch; ++i)
+            p.batch *= d_batch[i];
+        for (my_size_t i = 0; i < n_freeA; ++i)
+            p.M *= d_freeA[i];
+        for (my_size_t i = 0; i < n_contract; ++i)
+            p.K *= d_contract[i];
+        for (my_size_t i = 0; i < n_freeB; ++i)
+            p.N *= d_freeB[i];
+
+        // ---------------- canonical strides ----------------
+        // Row index of A' / C' runs over batch ++ free A, of B' over batch ++ contract.
+        auto row_stride = [&](char c, const char *second, const my_size_t *d_second,
+                              my_size_t n_second) -> my_size_t
+        {
+            my_size_t rows_after = 1;
+            for (my_size_t j = 0; j < n_second; ++j)
+                rows_after *= d_second[j];
+
+            const my_size_t ib = einsum_find(batch, n_batch, c);
+            if (ib < n_batch)
+                return einsum_list_stride(d_batch, n_batch, ib) * rows_after;
+            return einsum_list_stride(d_second, n_second, einsum_find(second, n_second, c));
+        };
+
+        for (my_size_t i = 0; i < nA; ++i)
+        {
+            const char c = labA[i];
+            const my_size_t ik = einsum_find(contract, n_contract, c);
+            if (ik < n_contract)
+                p.a_col[i] = einsum_list_stride(d_contract, n_contract, ik);
+            else if (einsum_find(labO, nO, c) < nO)
+                p.a_row[i] = row_stride(c, freeA, d_freeA, n_freeA);
+        }
+
+        for (my_size_t i = 0; i < nB; ++i)
+        {
+            const char c = labB[i];
+            const my_size_t in = einsum_find(freeB, n_freeB, c);
+            if (in < n_freeB)
+                p.b_col[i] = einsum_list_stride(d_freeB, n_freeB, in);
+            else if (einsum_find(labO, nO, c) < nO || einsum_find(contract, n_contract, c) < n_contract)
+                p.b_row[i] = row_stride(c, contract, d_contract, n_contract);
+        }
+
+        for (my_size_t o = 0; o < nO; ++o)
+        {
+            const char c = labO[o];
+            const my_size_t in = einsum_find(freeB, n_freeB, c);
+            if (in < n_freeB)
+                p.c_col[o] = einsum_list_stride(d_freeB, n_freeB, in);
+            else
+                p.c_row[o] = row_stride(c, freeA, d_freeA, n_freeA);
+        }
+
+        // ---------------- in-place eligibility ----------------
+        // Physical layouts pad only the last axis, so leading axes fold into
+        // evenly spaced rows exactly when the last axis is the sole column axis.
+        p.a_direct = !has_sumA && n_contract == 1 && nA >= 2 &&
+                     einsum_is_concat(labA, nA, batch, n_batch, freeA, n_freeA, contract, n_contract);
+        p.b_direct = !has_sumB && n_freeB == 1 && nB >= 2 &&
+                     einsum_is_concat(labB, nB, batch, n_batch, contract, n_contract, freeB, n_freeB);
+        p.a_trans = !p.a_direct && !has_sumA && n_freeA == 1 && nA >= 2 &&
+                    einsum_is_concat(labA, nA, batch, n_batch, contract, n_contract, freeA, n_freeA);
+        p.b_trans = !p.b_direct && !has_sumB && n_contract == 1 && nB >= 2 &&
+                    einsum_is_concat(labB, nB, batch, n_batch, freeB, n_freeB, contract, n_contract);
+        p.c_direct = n_freeB == 1 && nO >= 2 &&
+                     einsum_is_concat(labO, nO, batch, n_batch, freeA, n_freeA, freeB, n_freeB);
+        return p;
+    }
+
+    template <typename T, EinsumPlan P, typename Seq>
+    struct einsum_output;
+
+    template <typename T, EinsumPlan P, my_size_t... I>
+    struct einsum_output<T, P, index_seq<I...>>
+    {
+        using type = FusedTensorND<T, P.out_dims[I]...>;
+    };
+
+    /// Placeholder for a canonical buffer that is not needed.
+    struct EinsumNoBuffer
+    {
+    };
+
+    /// Canonical buffer type, or EinsumNoBuffer when the operand is used in place.
+    template <bool Needed, typename Buffer>
+    struct einsum_buffer
+    {
+        using type = Buffer;
+    };
+
+    template <typename Buffer>
+    struct einsum_buffer<false, Buffer>
+    {
+        using type = EinsumNoBuffer;
+    };
+
+    /// Operand that can be handed to the GEMM as a raw strided pointer.
+    template <typename Expr>
+    constexpr bool einsum_in_place_operand() noexcept
+    {
+        return !expression::traits<Expr>::IsPermuted &&
+               requires(const Expr &e) { e.data(); };
+    }
+
+    /**
+     * @brief Scatter an operand into a canonical 2-D buffer in one pass.
+     *
+     * Walks the operand in logical row-major order with an odometer and
+     * accumulates each element at row·stride + col of @p dst. Summed-out
+     * axes have zero canonical strides, so they accumulate into the same
+     * slot; @p dst must then be zero-initialized.
+     */
+    template <typename T, my_size_t Rank, typename Expr>
+    void einsum_pack(const Expr &e, T *dst, my_size_t dst_stride,
+                     const my_size_t *row, const my_size_t *col, bool accumulate) noexcept
+    {
+        my_size_t dst_step[Rank];
+        for (my_size_t i = 0; i < Rank; ++i)
+            dst_step[i] = row[i] * dst_stride + col[i];
+
+        my_size_t coords[Rank] = {};
+        my_size_t dst_off = 0;
+        my_size_t src_off = 0; // physical offset, in-place operands only
+
+        for (my_size_t flat = 0; flat < Expr::TotalSize; ++flat)
+        {
+            T v;
+            if constexpr (einsum_in_place_operand<Expr>())
+                v = e.data()[src_off];
+            else
+                v = e.template logical_evalu<T, 1, GENERICARCH>(flat);
+
+            if (accumulate)
+                dst[dst_off] += v;
+            else
+                dst[dst_off] = v;
+
+            for (my_size_t i = Rank; i-- > 0;)
+            {
+                dst_off += dst_step[i];
+                if constexpr (einsum_in_place_operand<Expr>())
+                    src_off += Expr::Layout::stride(i);
+                if (++coords[i] < Expr::Dim[i])
+                    break;
+
+                dst_off -= coords[i] * dst_step[i];
+                if constexpr (einsum_in_place_operand<Expr>())
+                    src_off -= coords[i] * Expr::Layout::stride(i);
+                coords[i] = 0;
+            }
+        }
+    }
+
+} // namespace detail
+
+/**
+ * @brief Contract two tensors according to a compile-time subscript string.
+ *
+ * @tparam Spec Subscripts, e.g. "ij,jk->ik" (see file documentation).
+ * @return FusedTensorND with the output shape, or T for a rank-0 output.
+ */
+template <detail::EinsumString Spec, typename LeftExpr, typename RightExpr>
+auto einsum(const BaseExpr<LeftExpr> &_tensor1, const BaseExpr<RightExpr> &_tensor2)
+{
+    using T = typename LeftExpr::value_type;
+    static_assert(is_same_v<T, typename RightExpr::value_type>,
+                  "einsum operands must have the same value type");
+    static_assert(LeftExpr::NumDims <= detail::EINSUM_MAX_RANK &&
+                      RightExpr::NumDims <= detail::EINSUM_MAX_RANK,
+                  "einsum operand rank exceeds EINSUM_MAX_RANK");
+
+    static constexpr detail::EinsumPlan P = detail::make_einsum_plan<Spec, LeftExpr, RightExpr>();
+    static_assert(P.well_formed, "einsum: malformed subscripts (expected e.g. \"ij,jk->ik\")");
+    static_assert(P.ranks_match, "einsum: subscript count does not match operand rank");
+    static_assert(P.labels_unique, "einsum: repeated subscript within one operand or the output");
+    static_assert(P.outputs_known, "einsum: output subscript does not appear in any operand");
+    static_assert(P.dims_match, "einsum: extents of a shared subscript differ");
+
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    using APrime = FusedTensorND<T, P.batch * P.M, P.K>;
+    using BPrime = FusedTensorND<T, P.batch * P.K, P.N>;
+    using CPrime = FusedTensorND<T, P.batch * P.M, P.N>;
+    using Out = typename detail::einsum_output<T, P, typename make_index_seq<P.rankOut>::type>::type;
+
+    const auto &A = _tensor1.derived();
+    const auto &B = _tensor2.derived();
+
+    constexpr bool a_in_place = (P.a_direct || P.a_trans) && detail::einsum_in_place_operand<LeftExpr>();
+    constexpr bool b_in_place = (P.b_direct || P.b_trans) && detail::einsum_in_place_operand<RightExpr>();
+    constexpr bool trans_a = a_in_place && P.a_trans;
+    constexpr bool trans_b = b_in_place && P.b_trans;
+    constexpr bool c_in_place = P.rankOut > 0 && P.c_direct;
+
+    // ---------------- operands: in place or packed ----------------
+    const T *a_ptr;
+    my_size_t strideA;
+    [[maybe_unused]] typename detail::einsum_buffer<!a_in_place, APrime>::type A_buf;
+    if constexpr (a_in_place)
+    {
+        a_ptr = A.data();
+        strideA = LeftExpr::Layout::stride(LeftExpr::NumDims - 2);
+    }
+    else
+    {
+        constexpr bool sums = P.batch * P.M * P.K != LeftExpr::TotalSize;
+        if constexpr (sums)
+            A_buf.setToZero();
+        detail::einsum_pack<T, LeftExpr::NumDims>(A, A_buf.data(), APrime::Layout::stride(0),
+                                                  P.a_row, P.a_col, sums);
+        a_ptr = A_buf.data();
+        strideA = APrime::Layout::stride(0);
+    }
+
+    const T *b_ptr;
+    my_size_t strideB;
+    [[maybe_unused]] typename detail::einsum_buffer<!b_in_place, BPrime>::type B_buf;
+    if constexpr (b_in_place)
+    {
+        b_ptr = B.data();
+        strideB = RightExpr::Layout::stride(RightExpr::NumDims - 2);
+    }
+    else
+    {
+        constexpr bool sums = P.batch * P.K * P.N != RightExpr::TotalSize;
+        if constexpr (sums)
+            B_buf.setToZero();
+        detail::einsum_pack<T, RightExpr::NumDims>(B, B_buf.data(), BPrime::Layout::stride(0),
+                                                   P.b_row, P.b_col, sums);
+        b_ptr = B_buf.data();
+        strideB = BPrime::Layout::stride(0);
+    }
+
+    // ---------------- one GEMM per batch slice ----------------
+    constexpr my_size_t a_rows = trans_a ? P.K : P.M; // stored rows per slice
+    constexpr my_size_t b_rows = trans_b ? P.N : P.K;
+    auto run = [&](T *c_ptr, my_size_t strideC)
+    {
+        for (my_size_t g = 0; g < P.batch; ++g)
+        {
+            const T *a_g = a_ptr + g * a_rows * strideA;
+            const T *b_g = b_ptr + g * b_rows * strideB;
+            T *c_g = c_ptr + g * P.M * strideC;
+
+            if constexpr (P.N == 1)
+            {
+                // y = A·x, x = B's only column, y = C's only column
+                const my_size_t incx = trans_b ? 1 : strideB;
+                Gemm::template gemv<trans_a>(a_g, P.M, P.K, strideA, b_g, incx, c_g, strideC);
+            }
+            else if constexpr (P.M == 1)
+            {
+                // yᵀ = Bᵀ·x, x = A's only row, y = C's only row
+                const my_size_t incx = trans_a ? strideA : 1;
+                Gemm::template gemv<!trans_b, true>(b_g, P.N, P.K, strideB, a_g, incx, c_g, 1);
+            }
+            else
+            {
+                Gemm::template gemm<trans_a, trans_b>(a_g, P.M, P.K, strideA, b_g, P.N, strideB, c_g, strideC);
+            }
+        }
+    };
+
+    if constexpr (P.rankOut == 0)
+    {
+        CPrime C_buf;
+        run(C_buf.data(), CPrime::Layout::stride(0));
+        return C_buf.data()[0];
+    }
+    else if constexpr (c_in_place)
+    {
+        Out out;
+        run(out.data(), Out::Layout::stride(P.rankOut - 2));
+        return out;
+    }
+    else
+    {
+        CPrime C_buf;
+        run(C_buf.data(), CPrime::Layout::stride(0));
+
+        // Permute the canonical result into the output layout
+        Out out;
+        const my_size_t strideC = CPrime::Layout::stride(0);
+        my_size_t coords[P.rankOut] = {};
+        my_size_t src_off = 0;
+        my_size_t dst_off = 0;
+        for (my_size_t flat = 0; flat < Out::TotalSize; ++flat)
+        {
+            out.data()[dst_off] = C_buf.data()[src_off];
+            for (my_size_t i = P.rankOut; i-- > 0;)
+            {
+                src_off += P.c_row[i] * strideC + P.c_col[i];
+                dst_off += Out::Layout::stride(i);
+                if (++coords[i] < P.out_dims[i])
+                    break;
+
+                src_off -= coords[i] * (P.c_row[i] * strideC + P.c_col[i]);
+                dst_off -= coords[i] * Out::Layout::stride(i);
+                coords[i] = 0;
+            }
+        }
+        return out;
+    }
+}
+
+#endif // FUSED_EINSUM_H
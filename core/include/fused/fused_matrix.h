@@ -257,6 +257,21 @@ public:
         return {FusedTensorND<T, Rows, Cols>::einsum(mat1, mat2, 1, 0)};
     }
 
+    // matmul with a fused GEMM epilogue, e.g. matmul(A, B, GemmEpilogue<T>{}.add(R)) for A·B + R
+    template <typename LeftExpr, typename RightExpr, typename Ep>
+    static FusedMatrix<T, Rows, Cols> matmul(const BaseExpr<LeftExpr> &mat1, const BaseExpr<RightExpr> &mat2, const Ep &ep)
+    {
+        return {FusedTensorND<T, Rows, Cols>::einsum(mat1, mat2, 1, 0, ep)};
+    }
+
+    // in-place matmul: *this = ep(mat1 · mat2, *this), e.g. GemmEpilogue<T>{}.scale(alpha, beta)
+    template <typename LeftExpr, typename RightExpr, typename Ep = GemmEpilogue<T>>
+    FusedMatrix &matmul_update(const BaseExpr<LeftExpr> &mat1, const BaseExpr<RightExpr> &mat2, const Ep &ep = Ep{})
+    {
+        FusedTensorND<T, Rows, Cols>::einsum_update(mat1, mat2, 1, 0, ep);
+        return *this;
+    }
+
     bool isIdentity(void) const
     {
         // Check if the matrix is square
@@ -0,0 +1,292 @@
+/**
+ * @file fused_quantized.h
+ * @brief int8 quantized matrices and the quantized dense-layer product.
+ *
+ * A QuantizedMatrix stores int8 values q with an affine mapping back to
+ * real numbers, x ≈ scale · (q − zero_point), either one (scale, zero
+ * point) pair for the whole matrix or one per row:
+ *
+ *   QuantAxis::PerTensor   activations, outputs
+ *   QuantAxis::PerRow      weights stored [out, in]: one pair per output channel
+ *
+ * qlinear(X, W, Y) computes Y = X · Wᵀ for X [M, K] and W [N, K] on the
+ * int8 values (kernel_qgemm.h), accumulating in int32, and writes Y through
+ * the epilogue its type selects:
+ *
+ *   FusedMatrix<int32_t, M, N>   raw zero-point-corrected accumulators
+ *   FusedMatrix<float, M, N>     dequantized, optionally + bias
+ *   QuantizedMatrix<M, N>        requantized to Y's own scale / zero point
+ *                                (set beforehand), optionally + bias
+ *
+ * @code
+ *   auto Wq = QuantizedMatrix<64, 128, QuantAxis::PerRow>::quantize_symmetric(W);
+ *   auto Xq = QuantizedMatrix<1, 128>::quantize(x_row);
+ *   QuantizedMatrix<1, 64> Hq;
+ *   Hq.set_params(0.05f, -10);
+ *   qlinear(Xq, Wq, Hq, bias);           // int8 → int8, ready for the next layer
+ *   FusedMatrix<float, 1, 64> H;
+ *   qlinear(Xq, Wq, H, bias);            // int8 → float
+ * @endcode
+ *
+ * Rows are stored padded with zeros to a multiple of the kernel's K step
+ * and aligned to it; each row's Σ q is kept up to date, for the zero-point
+ * correction.
+ */
+#ifndef FUSED_QUANTIZED_H
+#define FUSED_QUANTIZED_H
+
+#include "config.h"
+#include "fused/fused_matrix.h"
+#include "fused/kernel_ops/kernel_epilogue.h"
+#include "fused/kernel_ops/kernel_qgemm.h"
+
+/// How many (scale, zero point) pairs a QuantizedMatrix carries.
+enum class QuantAxis
+{
+    PerTensor, ///< One pair for the whole matrix
+    PerRow     ///< One pair per row
+};
+
+template <my_size_t Rows, my_size_t Cols, QuantAxis Axis = QuantAxis::PerTensor>
+class QuantizedMatrix
+{
+    using QGemm = detail::KernelQGemm<BITS, DefaultArch>;
+
+public:
+    static constexpr my_size_t NumParams = (Axis == QuantAxis::PerRow) ? Rows : 1;
+
+    /// Bytes between rows: Cols rounded up to the GEMM kernel's K step.
+    static constexpr my_size_t Stride = ((Cols + QGemm::KStep - 1) / QGemm::KStep) * QGemm::KStep;
+
+    /// All values zero, scale 1, zero point 0.
+    QuantizedMatrix() noexcept
+    {
+        for (my_size_t i = 0; i < Rows * Stride; ++i)
+            data_[i] = 0;
+        for (my_size_t r = 0; r < Rows; ++r)
+            row_sums_[r] = 0;
+        set_params(1.0f, 0);
+    }
+
+    /**
+     * @brief Affine quantization covering each row's (PerRow) or the whole
+     *        matrix's (PerTensor) range, widened to include 0.
+     */
+    static QuantizedMatrix quantize(const FusedMatrix<float, Rows, Cols> &X) noexcept
+    {
+        QuantizedMatrix Q;
+        for (my_size_t p = 0; p < NumParams; ++p)
+        {
+            float lo = 0.0f, hi = 0.0f;
+            for_each_in_group(p, [&](my_size_t i, my_size_t j)
+                              { const float x = X(i, j); lo = x < lo ? x : lo; hi = x > hi ? x : hi; });
+            const float scale = (hi > lo) ? (hi - lo) / 255.0f : 1.0f;
+            Q.scale_[p] = scale;
+            Q.zero_point_[p] = static_cast<int32_t>(saturate(__builtin_rintf(-128.0f - lo / scale)));
+        }
+        Q.fill_from(X);
+        return Q;
+    }
+
+    /// Zero-point-free quantization: scale = max |x| / 127 per row or per matrix.
+    static QuantizedMatrix quantize_symmetric(const FusedMatrix<float, Rows, Cols> &X) noexcept
+    {
+        QuantizedMatrix Q;
+        for (my_size_t p = 0; p < NumParams; ++p)
+        {
+            float amax = 0.0f;
+            for_each_in_group(p, [&](my_size_t i, my_size_t j)
+                              { const float a = math::abs(X(i, j)); amax = a > amax ? a : amax; });
+            Q.scale_[p] = (amax > 0.0f) ? amax / 127.0f : 1.0f;
+            Q.zero_point_[p] = 0;
+        }
+        Q.fill_from(X);
+        return Q;
+    }
+
+    /// Quantization with a given scale and zero point (e.g. calibrated activation ranges).
+    static QuantizedMatrix quantize(const FusedMatrix<float, Rows, Cols> &X, float scale, int32_t zero_point) noexcept
+    {
+        QuantizedMatrix Q;
+        Q.set_params(scale, zero_point);
+        Q.fill_from(X);
+        return Q;
+    }
+
+    /// x = scale · (q − zero_point) for every element.
+    FusedMatrix<float, Rows, Cols> dequantize() const noexcept
+    {
+        FusedMatrix<float, Rows, Cols> X;
+        for (my_size_t i = 0; i < Rows; ++i)
+            for (my_size_t j = 0; j < Cols; ++j)
+                X(i, j) = value(i, j);
+        return X;
+    }
+
+    int8_t operator()(my_size_t i, my_size_t j) const noexcept { return data_[i * Stride + j]; }
+
+    /// Store a quantized value (keeps the row sum current).
+    void set(my_size_t i, my_size_t j, int8_t q) noexcept
+    {
+        row_sums_[i] += static_cast<int32_t>(q) - data_[i * Stride + j];
+        data_[i * Stride + j] = q;
+    }
+
+    /// Dequantized value of element (i, j).
+    float value(my_size_t i, my_size_t j) const noexcept
+    {
+        return scale(i) * static_cast<float>(static_cast<int32_t>((*this)(i, j)) - zero_point(i));
+    }
+
+    /// Scale of row r (PerRow) or of the matrix (PerTensor, r ignored).
+    float scale(my_size_t r = 0) const noexcept { return scale_[param_index(r)]; }
+
+    /// Zero point of row r (PerRow) or of the matrix (PerTensor, r ignored).
+    int32_t zero_point(my_size_t r = 0) const noexcept { return zero_point_[param_index(r)]; }
+
+    /// Same parameters for every row. The stored int8 values are kept.
+    void set_params(float scale, int32_t zero_point) noexcept
+    {
+        for (my_size_t p = 0; p < NumParams; ++p)
+        {
+            scale_[p] = scale;
+            zero_point_[p] = zero_point;
+        }
+    }
+
+    /// Parameters of row r (PerRow only). The stored int8 values are kept.
+    void set_params(my_size_t r, float scale, int32_t zero_point) noexcept
+    {
+        static_assert(Axis == QuantAxis::PerRow, "set_params(row, ...) requires QuantAxis::PerRow");
+        scale_[r] = scale;
+        zero_point_[r] = zero_point;
+    }
+
+    /// Σⱼ q(r, j)
+    int32_t row_sum(my_size_t r) const noexcept { return row_sums_[r]; }
+
+    const int8_t *data() const noexcept { return data_; }
+
+    /// This matrix as a GEMM operand.
+    detail::QGemmOperand operand() const noexcept
+    {
+        return {data_, Stride, row_sums_, scale_, zero_point_, NumParams > 1 ? my_size_t(1) : my_size_t(0)};
+    }
+
+    /**
+     * @brief *this = requantize(X · Wᵀ + bias) with this matrix's scale and zero point.
+     *
+     * @param bias   Per-column float bias (length Cols), or nullptr
+     * @param stride Physical distance between bias elements
+     */
+    template <my_size_t K, QuantAxis AX, QuantAxis AW>
+    void assign_linear(const QuantizedMatrix<Rows, K, AX> &X, const QuantizedMatrix<Cols, K, AW> &W,
+                       const float *bias = nullptr, my_size_t stride = 0) noexcept
+    {
+        static_assert(Axis == QuantAxis::PerTensor, "a requantized output has one scale and zero point");
+        for (my_size_t r = 0; r < Rows; ++r)
+            row_sums_[r] = 0;
+        const detail::QRequantize ep{data_, Stride, row_sums_, 1.0f / scale_[0], zero_point_[0], bias, stride};
+        QGemm::gemm(X.operand(), Rows, W.operand(), Cols, K, ep);
+    }
+
+private:
+    FORCE_INLINE static constexpr my_size_t param_index(my_size_t r) noexcept
+    {
+        return (Axis == QuantAxis::PerRow) ? r : 0;
+    }
+
+    FORCE_INLINE static float saturate(float q) noexcept
+    {
+        return q < -128.0f ? -128.0f : (q > 127.0f ? 127.0f : q);
+    }
+
+    /// f(i, j) over the elements sharing parameter set p.
+    template <typename F>
+    FORCE_INLINE static void for_each_in_group(my_size_t p, F &&f) noexcept
+    {
+        const my_size_t r0 = (Axis == QuantAxis::PerRow) ? p : 0;
+        const my_size_t r1 = (Axis == QuantAxis::PerRow) ? p + 1 : Rows;
+        for (my_size_t i = r0; i < r1; ++i)
+            for (my_size_t j = 0; j < Cols; ++j)
+                f(i, j);
+    }
+
+    /// q = saturate(rint(x / scale) + zero_point) with the current parameters.
+    void fill_from(const FusedMatrix<float, Rows, Cols> &X) noexcept
+    {
+        for (my_size_t i = 0; i < Rows; ++i)
+        {
+            const float inv = 1.0f / scale(i);
+            const float zp = static_cast<float>(zero_point(i));
+            int32_t sum = 0;
+            for (my_size_t j = 0; j < Cols; ++j)
+            {
+                const int8_t q = static_cast<int8_t>(saturate(__builtin_rintf(X(i, j) * inv) + zp));
+                data_[i * Stride + j] = q;
+                sum += q;
+            }
+            row_sums_[i] = sum;
+        }
+    }
+
+    alignas(QGemm::KStep) int8_t data_[Rows * Stride];
+    int32_t row_sums_[Rows];
+    float scale_[NumParams];
+    int32_t zero_point_[NumParams];
+};
+
+// ============================================================================
+// Quantized dense layer: Y = X · Wᵀ
+// ============================================================================
+
+/// Y = X · Wᵀ as zero-point-corrected int32 accumulators.
+template <my_size_t M, my_size_t N, my_size_t K, QuantAxis AX, QuantAxis AW>
+void qlinear(const QuantizedMatrix<M, K, AX> &X, const QuantizedMatrix<N, K, AW> &W,
+             FusedMatrix<int32_t, M, N> &Y) noexcept
+{
+    using Layout = typename FusedMatrix<int32_t, M, N>::Layout;
+    detail::KernelQGemm<BITS, DefaultArch>::gemm(X.operand(), M, W.operand(), N, K,
+                                                 detail::QStoreInt32{Y.data(), Layout::stride(0)});
+}
+
+/// Y = X · Wᵀ dequantized to float.
+template <my_size_t M, my_size_t N, my_size_t K, QuantAxis AX, QuantAxis AW>
+void qlinear(const QuantizedMatrix<M, K, AX> &X, const QuantizedMatrix<N, K, AW> &W,
+             FusedMatrix<float, M, N> &Y) noexcept
+{
+    using Layout = typename FusedMatrix<float, M, N>::Layout;
+    detail::KernelQGemm<BITS, DefaultArch>::gemm(X.operand(), M, W.operand(), N, K,
+                                                 detail::QDequantize{Y.data(), Layout::stride(0), nullptr, 0});
+}
+
+/// Y = X · Wᵀ + bias dequantized to float. bias is a [N,1] or [1,N] float tensor.
+template <my_size_t M, my_size_t N, my_size_t K, QuantAxis AX, QuantAxis AW, typename Bias>
+void qlinear(const QuantizedMatrix<M, K, AX> &X, const QuantizedMatrix<N, K, AW> &W,
+             FusedMatrix<float, M, N> &Y, const BaseExpr<Bias> &bias) noexcept
+{
+    static_assert(is_same_v<typename Bias::value_type, float>, "qlinear bias must be a float tensor");
+    using Layout = typename FusedMatrix<float, M, N>::Layout;
+    detail::KernelQGemm<BITS, DefaultArch>::gemm(
+        X.operand(), M, W.operand(), N, K,
+        detail::QDequantize{Y.data(), Layout::stride(0), bias.derived().data(), detail::vector_element_stride<Bias>()});
+}
+
+/// Y = X · Wᵀ requantized to Y's scale and zero point.
+template <my_size_t M, my_size_t N, my_size_t K, QuantAxis AX, QuantAxis AW>
+void qlinear(const QuantizedMatrix<M, K, AX> &X, const QuantizedMatrix<N, K, AW> &W,
+             QuantizedMatrix<M, N> &Y) noexcept
+{
+    Y.assign_linear(X, W);
+}
+
+/// Y = X · Wᵀ + bias requantized to Y's scale and zero point. bias is a [N,1] or [1,N] float tensor.
+template <my_size_t M, my_size_t N, my_size_t K, QuantAxis AX, QuantAxis AW, typename Bias>
+void qlinear(const QuantizedMatrix<M, K, AX> &X, const QuantizedMatrix<N, K, AW> &W,
+             QuantizedMatrix<M, N> &Y, const BaseExpr<Bias> &bias) noexcept
+{
+    static_assert(is_same_v<typename Bias::value_type, float>, "qlinear bias must be a float tensor");
+    Y.assign_linear(X, W, bias.derived().data(), detail::vector_element_stride<Bias>());
+}
+
+#endif // FUSED_QUANTIZED_H
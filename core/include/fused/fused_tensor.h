@@ -17,10 +17,12 @@
 #include "fused/storage/dynamic_storage.h"
 #include "fused/padding_policies/simd_padding_policy.h"
 #include "fused/padding_policies/no_padding_policy.h"
+#include "fused/padding_policies/default_padding_policy.h"
 #include "fused/access/dense_access.h"
 #include "fused/access/sparse_access.h"
 // #include "fused/views/permuted_view.h"
 #include "fused/views/permuted_view_constexpr.h"
+#include "fused/views/broadcast_view_constexpr.h"
 // #include "fused/layouts/strided_layout.h"
 #include "fused/layouts/strided_layout_constexpr.h"
 #include "algebra/algebraic_traits.h"
@@ -120,6 +122,35 @@ public:
         return *this;
     }
 
+    // ========================================================================
+    // Compound assignment — dst op= expr, one KernelEval pass, in place
+    // ========================================================================
+    // Evaluates (dst op expr) straight into dst: each vector of dst is
+    // loaded, combined and stored back, with no temporary. The expression is
+    // the one dst op expr builds, so dst += A * B is an FmaExpr (one fmadd
+    // per vector) and dst -= A * s a ScalarFmaExpr.
+    //
+    // Every eval path reads dst at the position it then stores, so reading
+    // dst itself is safe. Only a permuted view of dst inside expr reads
+    // positions already written, and only that is reported as aliasing.
+
+    template <typename Expr>
+    FusedTensorND &operator+=(const BaseExpr<Expr> &expr) { return update(expr.derived(), *this + expr.derived()); }
+
+    template <typename Expr>
+    FusedTensorND &operator-=(const BaseExpr<Expr> &expr) { return update(expr.derived(), *this - expr.derived()); }
+
+    template <typename Expr>
+    FusedTensorND &operator*=(const BaseExpr<Expr> &expr) { return update(expr.derived(), *this * expr.derived()); }
+
+    template <typename Expr>
+    FusedTensorND &operator/=(const BaseExpr<Expr> &expr) { return update(expr.derived(), *this / expr.derived()); }
+
+    FusedTensorND &operator+=(T scalar) { return update(*this, *this + scalar); }
+    FusedTensorND &operator-=(T scalar) { return update(*this, *this - scalar); }
+    FusedTensorND &operator*=(T scalar) { return update(*this, *this * scalar); }
+    FusedTensorND &operator/=(T scalar) { return update(*this, *this / scalar); }
+
     // ========================================================================
     // FusedTensorND::evalu — physical flat ONLY, K::load
     // ========================================================================
@@ -140,8 +171,10 @@ public:
      *
      * Unlike evalu (which takes physical offsets), this converts
      * logical flat → physical flat via Layout, handling padding gaps.
-     * Uses gather for SIMD widths > 1 since consecutive logical flats
-     * are not contiguous in physical memory when padding exists.
+     * Consecutive logical flats are contiguous in physical memory within a
+     * row, so a vector that does not cross a row boundary (or any vector of
+     * unpadded storage) is a plain unaligned load; one that crosses a
+     * padding gap is gathered.
      */
     template <typename T_, my_size_t Bits, typename Arch>
     FORCE_INLINE typename Microkernel<T_, Bits, Arch>::VecType
@@ -154,10 +187,18 @@ public:
             return K::load(data_.data() +
                            Layout::logical_flat_to_physical_flat(logical_flat));
         }
+        else if constexpr (Layout::PhysicalSize == Layout::LogicalSize)
+        {
+            return K::loadu(data_.data() + logical_flat);
+        }
         else
         {
+            constexpr my_size_t lastDim = Layout::logical_dim(NumDims - 1);
+            if (logical_flat % lastDim + live_lanes<K>() <= lastDim)
+                return K::loadu(data_.data() + Layout::logical_flat_to_physical_flat(logical_flat));
+
             my_size_t idxList[K::simdWidth];
-            for (my_size_t i = 0; i < K::simdWidth; ++i)
+            for (my_size_t i = 0; i < live_lanes<K>(); ++i)
                 idxList[i] = Layout::logical_flat_to_physical_flat(logical_flat + i);
             return K::gather(data_.data(), idxList);
         }
@@ -320,6 +361,14 @@ public:
     //     return PermutedView<Self, NumDims>(*this, perm);
     // }
 
+    // Broadcast to a larger shape, NumPy rules (e.g. a bias row: b.broadcast_to<M, N>())
+    template <my_size_t... Target>
+    FORCE_INLINE auto broadcast_to() const noexcept
+    {
+        // static_assert to check that the shapes are compatible are in BroadcastViewConstExpr
+        return BroadcastViewConstExpr<Self, Target...>(*this);
+    }
+
     FORCE_INLINE static constexpr my_size_t getTotalSize() noexcept
     {
         return TotalSize;
@@ -459,22 +508,28 @@ public:
     /**
      * @brief Contract two tensors along specified axes using SIMD dot products.
      *
-     * For 2D tensors, always dispatches to register-blocked GEMM by
-     * materializing transposed copies when needed. The O(N²) transpose
-     * cost is negligible vs O(N³) multiply, and the materialized tensor
-     * has proper SIMD-aligned padding for aligned K::load in the micro-kernel.
+     * For 2D tensors, always dispatches to KernelGemm, which reads each
+     * operand in place either as stored or transposed — transpose_views
+     * and unfavorable contraction axes cost no intermediate tensor.
      *
-     * For higher-dimensional tensors, falls back to generic stride-mapped
-     * per-element dot products.
+     * For higher-dimensional tensors, contractions of tensor1's last axis
+     * with tensor2's second-to-last axis ([B,M,K]×[K,N], [M,K]×[B,K,N],
+     * [B,M,K]×[B',K,N], ...) run as one KernelGemm call per leading slice
+     * of tensor2, with tensor1's free axes folded into the GEMM rows.
+     * Other axis pairs fall back to stride-mapped per-element dot products.
      *
      * ============================================================================
      * 2D GEMM — 4 CASES (contract axis a from tensor1, axis b from tensor2)
      * ============================================================================
      *
-     *   a=1, b=0: C[M,N] = A[M,K] × B[K,N]   — favorable, no transpose
-     *   a=0, b=0: C[K,N] = A^T[K,M] × B[M,N]  — transpose A
-     *   a=1, b=1: C[M,K] = A[M,N] × B^T[N,K]  — transpose B
-     *   a=0, b=1: C[K,K'] = A^T × B^T           — transpose both
+     *   a=1, b=0: C[M,N] = A[M,K] × B[K,N]   — NN
+     *   a=0, b=0: C[K,N] = A^T[K,M] × B[M,N]  — TN (A read transposed)
+     *   a=1, b=1: C[M,K] = A[M,N] × B^T[N,K]  — NT (B read transposed)
+     *   a=0, b=1: C[K,K'] = A^T × B^T           — TT
+     *
+     * A transpose_view operand flips its letter (its physical layout is
+     * already the transpose), so e.g. einsum(A, B.transpose_view(), 1, 0)
+     * runs NT.
      *
      * ============================================================================
      */
@@ -532,118 +587,70 @@ public:
         }
 
         // ====================================================================
-        // 2D GEMM path — always favorable after optional transpose
+        // 2D GEMM path — operands read in place, transposed as needed
         // ====================================================================
 
         if constexpr (Dims1 == 2 && Dims2 == 2)
         {
-            // Lambda: run GEMM given ready-to-go tensors and their axes
-            // A_ready has contraction on its last dim (stride 1)
-            // B_ready has free dim on its last dim (stride 1)
-            auto run_gemm = [&](const auto &A_ready, const auto &B_ready)
-            {
-                using LayoutA = typename std::remove_cvref_t<decltype(A_ready)>::Layout;
-                using LayoutB = typename std::remove_cvref_t<decltype(B_ready)>::Layout;
-
-                const my_size_t M = A_ready.getDim(0);
-                const my_size_t N = B_ready.getDim(1);
-
-                detail::KernelGemm<T, BITS, DefaultArch>::gemm(
-                    A_ready.data(), M, K_len, LayoutA::stride(0),
-                    B_ready.data(), N, LayoutB::stride(0),
-                    _outp.data(), OutputLayout::stride(0));
-            };
-
-            auto make_transposed = [](const auto &expr)
-            {
-                using E = remove_cvref_t<decltype(expr)>;
-                if constexpr (!requires { expr.transpose(); })
-                {
-                    // FusedTensorND: materialize transpose_view
-                    FusedTensorND<typename E::value_type, E::Dim[1], E::Dim[0]> dst;
-                    dst = expr.transpose_view();
-                    return dst;
-                }
-                else if constexpr (expression::traits<E>::IsPermuted)
-                {
-                    // Real permuted view (e.g. <1,0>): .transpose() returns the
-                    // base tensor, whose physical layout IS the transposed data
-                    return expr.transpose();
-                }
-                else
-                {
-                    // Identity permuted view (e.g. <0,1>): .transpose() returns
-                    // the base tensor with SAME dims — need to actually transpose
-                    auto &base = expr.transpose();
-                    FusedTensorND<typename E::value_type, E::Dim[1], E::Dim[0]> dst;
-                    dst = base.transpose_view();
-                    return dst;
-                }
-            };
-
-            auto ensure_materialized = [](const auto &expr)
-            {
-                using E = remove_cvref_t<decltype(expr)>;
-                if constexpr (!requires { expr.transpose(); })
-                {
-                    // FusedTensorND: physical layout already correct
-                    return expr;
-                }
-                else if constexpr (!expression::traits<E>::IsPermuted)
-                {
-                    // Identity view: base tensor has matching physical layout
-                    return expr.transpose();
-                }
-                else
-                {
-                    // Real permuted view: physical layout doesn't match logical dims
-                    FusedTensorND<typename E::value_type, E::Dim[0], E::Dim[1]> dst;
-                    dst = expr;
-                    return dst;
-                }
-            };
+            gemm_2d(_outp.data(), _tensor1, _tensor2, a, b, GemmEpilogue<T>{});
+            return _outp;
+        }
 
-            if (a == 1 && b == 0)
-            {
-                if constexpr (requires { _tensor1.derived().transpose(); } || requires { _tensor2.derived().transpose(); })
-                {
-                    // At least one input is a PermutedViewConstExpr —
-                    // materialize to fix physical layout
-                    run_gemm(ensure_materialized(_tensor1.derived()),
-                             ensure_materialized(_tensor2.derived()));
-                }
-                else
-                {
-                    // Both are FusedTensorND — physical layout guaranteed favorable
-                    run_gemm(_tensor1.derived(), _tensor2.derived());
-                }
-            }
-            else if (a == 0 && b == 0)
-            {
-                // std::cout << "Running GEMM with A transposed\n";
-                auto A_t = make_transposed(_tensor1.derived());
-                run_gemm(A_t, _tensor2.derived());
-            }
-            else if (a == 1 && b == 1)
-            {
-                // std::cout << "Running GEMM with B transposed\n";
-                auto B_t = make_transposed(_tensor2.derived());
-                run_gemm(_tensor1.derived(), B_t);
-            }
-            else
+        // ====================================================================
+        // Batched GEMM path — contract A's last axis with B's row axis
+        // ====================================================================
+        //
+        //   A [F1..., K]  ×  B [G..., K, N]  →  C [F1..., G..., N]
+        //
+        // A's free axes fold into one row index (rows are contiguous and
+        // evenly spaced by A's padded row stride), and so do C's. Each
+        // leading slice g of B is a plain K×N matrix, so the whole
+        // contraction is one GEMM per slice of B:
+        //
+        //   C[:, g, :] = A[(F1...), K] · B[g, K, N]     (row stride of C = |G|·Npad)
+
+        if constexpr (!expression::traits<LeftExpr>::IsPermuted &&
+                      !expression::traits<RightExpr>::IsPermuted &&
+                      requires { _tensor1.derived().data(); _tensor2.derived().data(); })
+        {
+            if (a == Dims1 - 1 && b == Dims2 - 2)
             {
-                // std::cout << "Running GEMM with both A and B transposed\n";
-                auto A_t = make_transposed(_tensor1.derived());
-                auto B_t = make_transposed(_tensor2.derived());
-                run_gemm(A_t, B_t);
+                my_size_t M_rows = 1;
+                for (my_size_t i = 0; i + 1 < Dims1; ++i)
+                    M_rows *= _tensor1.derived().getDim(i);
+
+                my_size_t batches = 1;
+                for (my_size_t i = 0; i + 2 < Dims2; ++i)
+                    batches *= _tensor2.derived().getDim(i);
+
+                const my_size_t N = _tensor2.derived().getDim(Dims2 - 1);
+                const my_size_t strideA = Layout1::stride(Dims1 - 2);
+                const my_size_t strideB = Layout2::stride(Dims2 - 2);
+                const my_size_t strideC = OutputLayout::stride(Dims1 - 2);
+                const my_size_t sliceB = K_len * strideB;
+                const my_size_t sliceC = OutputLayout::stride(n_newDims - 2);
+
+                const T *A = _tensor1.derived().data();
+                const T *B = _tensor2.derived().data();
+                T *C = _outp.data();
+
+                for (my_size_t g = 0; g < batches; ++g)
+                    detail::KernelGemm<T, BITS, DefaultArch>::gemm(
+                        A, M_rows, K_len, strideA,
+                        B + g * sliceB, N, strideB,
+                        C + g * sliceC, strideC);
+
+                return _outp;
             }
-
-            return _outp;
         }
 
         // ====================================================================
         // Generic fallback: stride-mapped per-element dot products
         // ====================================================================
+        //
+        // Output coordinates advance as an odometer: the innermost axis
+        // steps every element, and only on carry are the outer axes touched,
+        // so each element costs a few additions instead of a div/mod decode.
 
         my_size_t strides1_map[n_newDims];
         my_size_t strides2_map[n_newDims];
@@ -676,35 +683,101 @@ public:
 
         static constexpr my_size_t total_elements = (1 * ... * Dims);
 
+        my_size_t coords[n_newDims] = {};
+        my_size_t base1 = 0;
+        my_size_t base2 = 0;
+        my_size_t out_phys = 0;
+
         for (my_size_t flat = 0; flat < total_elements; ++flat)
         {
-            my_size_t coords[n_newDims];
-            my_size_t tmp = flat;
+            out_ptr[out_phys] = Kern::dot(
+                _tensor1.derived(), base1, contract_stride1,
+                _tensor2.derived(), base2, contract_stride2,
+                K_len);
+
+            // Advance the odometer
             for (my_size_t i = n_newDims; i-- > 0;)
             {
-                coords[i] = tmp % out_dims[i];
-                tmp /= out_dims[i];
-            }
+                base1 += strides1_map[i];
+                base2 += strides2_map[i];
+                out_phys += out_strides[i];
+                if (++coords[i] < out_dims[i])
+                    break;
 
-            my_size_t base1 = 0;
-            my_size_t base2 = 0;
-            my_size_t out_phys = 0;
-            for (my_size_t i = 0; i < n_newDims; ++i)
-            {
-                base1 += coords[i] * strides1_map[i];
-                base2 += coords[i] * strides2_map[i];
-                out_phys += coords[i] * out_strides[i];
+                base1 -= coords[i] * strides1_map[i];
+                base2 -= coords[i] * strides2_map[i];
+                out_phys -= coords[i] * out_strides[i];
+                coords[i] = 0;
             }
+        }
 
-            out_ptr[out_phys] = Kern::dot(
-                _tensor1.derived(), base1, contract_stride1,
-                _tensor2.derived(), base2, contract_stride2,
-                K_len);
+        return _outp;
+    }
+
+    /**
+     * @brief 2D contraction with a fused GEMM epilogue.
+     *
+     * Same as einsum(t1, t2, a, b) but applies @p ep while the output tile
+     * is still in registers — e.g. `+ R`, a bias, scaling or a clamp —
+     * saving a separate read/write pass over the result.
+     *
+     * beta (scaling of the existing output) is meaningless for a fresh
+     * result; use einsum_update() for C = alpha·A·B + beta·C.
+     *
+     * @code
+     *   // S = H·P·Hᵀ + R in one pass over S
+     *   auto S = FusedTensorND<T, M, M>::einsum(HP, H.transpose_view(), 1, 0, GemmEpilogue<T>{}.add(R));
+     * @endcode
+     */
+    template <typename LeftExpr, typename RightExpr, typename Ep>
+        requires(expression::traits<LeftExpr>::IsPhysical &&
+                 expression::traits<RightExpr>::IsPhysical)
+    static FusedTensorND einsum(
+        const BaseExpr<LeftExpr> &_tensor1,
+        const BaseExpr<RightExpr> &_tensor2,
+        const my_size_t a,
+        const my_size_t b,
+        const Ep &ep)
+    {
+        validate_contraction_2d(_tensor1, _tensor2, a, b);
+
+        if constexpr (Ep::IsScaled)
+        {
+            if (ep.beta != T{0})
+                MyErrorHandler::error("GEMM epilogue beta requires an existing output; use einsum_update");
         }
 
+        FusedTensorND _outp;
+        gemm_2d(_outp.data(), _tensor1, _tensor2, a, b, ep);
         return _outp;
     }
 
+    /**
+     * @brief In-place 2D contraction: *this = ep(A·B, *this).
+     *
+     * With a scaled epilogue this is the BLAS-style update
+     * C = alpha·A·B + beta·C, optionally followed by an addend and an op.
+     * Neither operand may alias *this.
+     */
+    template <typename LeftExpr, typename RightExpr, typename Ep = GemmEpilogue<T>>
+        requires(expression::traits<LeftExpr>::IsPhysical &&
+                 expression::traits<RightExpr>::IsPhysical)
+    FusedTensorND &einsum_update(
+        const BaseExpr<LeftExpr> &_tensor1,
+        const BaseExpr<RightExpr> &_tensor2,
+        const my_size_t a,
+        const my_size_t b,
+        const Ep &ep = Ep{})
+    {
+        validate_contraction_2d(_tensor1, _tensor2, a, b);
+
+        if (_tensor1.derived().may_alias(*this) || _tensor2.derived().may_alias(*this))
+            MyErrorHandler::error("einsum_update: output aliases an operand");
+
+        gemm_2d(data_.data(), _tensor1, _tensor2, a, b, ep);
+        return *this;
+    }
+
     // Function to print the contents of the tensor
     void print(bool with_padding = false) const
     {
@@ -844,8 +917,7 @@ public:
 
 private:
     // Example of using different access and storage policies
-    using AccessPolicy = DenseAccess<T, SimdPaddingPolicy, StaticStorage, Dims...>;
-    // using AccessPolicy = DenseAccess<T, NoPaddingPolicy, StaticStorage, Dims...>; // works only for GENERICARCH
+    using AccessPolicy = DenseAccess<T, DefaultPaddingPolicy, StaticStorage, Dims...>; // SimdPaddingPolicy, or NoPaddingPolicy with TESSERACT_NO_PADDING
 
     // using AccessPolicy = DenseAccess<T, SimdPaddingPolicy, DynamicStorage, Dims...>; // works
     // using AccessPolicy = DenseAccess<T, NoPaddingPolicy, DynamicStorage, Dims...>; // bad alloc
@@ -855,6 +927,190 @@ private:
     // using AccessPolicy = SparseAccess<T, TotalSize, my_size_t>; // default is static storage // something is wrong here
     AccessPolicy data_;
 
+    /**
+     * @brief Evaluate e (dst op rhs) into this tensor; see the compound assignment operators.
+     */
+    template <typename Rhs, typename Expr>
+    FORCE_INLINE FusedTensorND &update(const Rhs &rhs, const Expr &e)
+    {
+        if constexpr (expression::traits<Rhs>::IsPermuted)
+        {
+            if (rhs.may_alias(*this))
+            {
+                MyErrorHandler::log("Aliasing detected in compound assignment: permuted view of the destination", ErrorLevel::Warning);
+            }
+        }
+
+        KernelOps<T, BITS, DefaultArch>::eval(data_.data(), e);
+        return *this;
+    }
+
+    /**
+     * @brief Validate a 2D contraction and its [M,N] output against this tensor's dims.
+     */
+    template <typename LeftExpr, typename RightExpr>
+    static void validate_contraction_2d(
+        const BaseExpr<LeftExpr> &_tensor1,
+        const BaseExpr<RightExpr> &_tensor2,
+        const my_size_t a,
+        const my_size_t b)
+    {
+        static_assert(LeftExpr::NumDims == 2 && RightExpr::NumDims == 2 && sizeof...(Dims) == 2,
+                      "GEMM epilogues are supported for 2D contractions only");
+
+        if (a >= 2 || b >= 2)
+            MyErrorHandler::error("Invalid contraction axis");
+
+        if (_tensor1.derived().getDim(a) != _tensor2.derived().getDim(b))
+            MyErrorHandler::error("Contraction dimensions mismatch");
+
+        if (_tensor1.derived().getDim(1 - a) != Dim[0] ||
+            _tensor2.derived().getDim(1 - b) != Dim[1])
+            MyErrorHandler::error("Output dimensions mismatch");
+    }
+
+    /**
+     * @brief 2D GEMM core shared by einsum and einsum_update.
+     *
+     * Reads both operands in place: for each one the axis with unit
+     * physical stride decides whether KernelGemm reads it as stored or
+     * transposed (NN/NT/TN/TT), so transpose_views and unfavorable
+     * contraction axes need no intermediate copy. Writes into @p out,
+     * which must have this tensor's physical layout. The epilogue is
+     * applied at store time; its addend's extents are checked against
+     * this tensor's at compile time. Operands must already be validated.
+     *
+     * Kernel selection is by compile-time shape: a unit free dimension
+     * runs KernelGemm::gemv(), extents ≤ SMALL_DIM_MAX the unrolled
+     * gemm_small(), anything else gemm().
+     */
+    template <typename LeftExpr, typename RightExpr, typename Ep>
+    static void gemm_2d(
+        T *out,
+        const BaseExpr<LeftExpr> &_tensor1,
+        const BaseExpr<RightExpr> &_tensor2,
+        const my_size_t a,
+        const my_size_t b,
+        const Ep &ep)
+    {
+        static_assert(Ep::template FitsOutput<Dim[0], Dim[1]>,
+                      "GemmEpilogue addend does not match the output: an expression needs the output's shape, "
+                      "a row bias one value per column, a column bias one value per row");
+
+        using LayoutA = typename LeftExpr::Layout;
+        using LayoutB = typename RightExpr::Layout;
+        using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+        const my_size_t K_len = _tensor1.derived().getDim(a);
+        const my_size_t M = _tensor1.derived().getDim(1 - a);
+        const my_size_t N = _tensor2.derived().getDim(1 - b);
+
+        // A(i, k): as stored when k is the unit-stride axis, else transposed.
+        // B(k, j): as stored when j is the unit-stride axis, else transposed.
+        const bool transA = LayoutA::stride(a) != 1;
+        const bool transB = LayoutB::stride(1 - b) != 1;
+        const my_size_t lda = transA ? LayoutA::stride(a) : LayoutA::stride(1 - a);
+        const my_size_t ldb = transB ? LayoutB::stride(1 - b) : LayoutB::stride(b);
+
+        const T *A = _tensor1.derived().data();
+        const T *B = _tensor2.derived().data();
+        const my_size_t ldc = Layout::stride(0);
+
+        // Unit free dimension: matrix-vector product
+        if constexpr (Dim[0] == 1 || Dim[1] == 1)
+        {
+            if (a == 1)
+                gemm_2d_gemv<LeftExpr::Dim[1]>(A, lda, transA, B, ldb, transB, out, ep);
+            else
+                gemm_2d_gemv<LeftExpr::Dim[0]>(A, lda, transA, B, ldb, transB, out, ep);
+            return;
+        }
+
+        // Tiny fixed shapes: fully unrolled kernel, one instantiation per K
+        constexpr my_size_t S = Gemm::SMALL_DIM_MAX;
+        if constexpr (Dim[0] <= S && Dim[1] <= S && LeftExpr::Dim[0] <= S && LeftExpr::Dim[1] <= S)
+        {
+            if (a == 1)
+                gemm_2d_small<LeftExpr::Dim[1]>(A, lda, transA, B, ldb, transB, out, ep);
+            else
+                gemm_2d_small<LeftExpr::Dim[0]>(A, lda, transA, B, ldb, transB, out, ep);
+            return;
+        }
+
+        if (!transA && !transB)
+            Gemm::template gemm<false, false>(A, M, K_len, lda, B, N, ldb, out, ldc, ep);
+        else if (!transA)
+            Gemm::template gemm<false, true>(A, M, K_len, lda, B, N, ldb, out, ldc, ep);
+        else if (!transB)
+            Gemm::template gemm<true, false>(A, M, K_len, lda, B, N, ldb, out, ldc, ep);
+        else
+            Gemm::template gemm<true, true>(A, M, K_len, lda, B, N, ldb, out, ldc, ep);
+    }
+
+    /// gemm_2d for a unit free dimension: GEMV over whichever operand is the matrix.
+    template <my_size_t Kc, typename Ep>
+    FORCE_INLINE static void gemm_2d_gemv(
+        const T *A, my_size_t lda, bool transA,
+        const T *B, my_size_t ldb, bool transB,
+        T *out, const Ep &ep)
+    {
+        using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+        if constexpr (Dim[1] == 1)
+        {
+            // y = A·x, x = B's only column
+            constexpr my_size_t ldc = Layout::stride(0);
+            constexpr my_size_t S = Gemm::SMALL_DIM_MAX;
+            if constexpr (Dim[0] <= S && Kc <= S)
+            {
+                // Tiny dot form: horizontal sums would dominate, broadcast instead
+                if (!transA)
+                {
+                    if (transB)
+                        Gemm::template gemm_small<Dim[0], Kc, 1, false, true>(A, lda, B, ldb, out, ldc, ep);
+                    else
+                        Gemm::template gemm_small<Dim[0], Kc, 1, false, false>(A, lda, B, ldb, out, ldc, ep);
+                    return;
+                }
+            }
+
+            const my_size_t incx = transB ? 1 : ldb;
+            if (transA)
+                Gemm::template gemv<true>(A, Dim[0], Kc, lda, B, incx, out, ldc, ep);
+            else
+                Gemm::template gemv<false>(A, Dim[0], Kc, lda, B, incx, out, ldc, ep);
+        }
+        else
+        {
+            // yᵀ = Bᵀ·x, x = A's only row
+            const my_size_t incx = transA ? lda : 1;
+            if (transB)
+                Gemm::template gemv<false, true>(B, Dim[1], Kc, ldb, A, incx, out, 1, ep);
+            else
+                Gemm::template gemv<true, true>(B, Dim[1], Kc, ldb, A, incx, out, 1, ep);
+        }
+    }
+
+    /// gemm_2d for extents ≤ SMALL_DIM_MAX: picks the unrolled kernel variant.
+    template <my_size_t Kc, typename Ep>
+    FORCE_INLINE static void gemm_2d_small(
+        const T *A, my_size_t lda, bool transA,
+        const T *B, my_size_t ldb, bool transB,
+        T *out, const Ep &ep)
+    {
+        using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+        constexpr my_size_t ldc = Layout::stride(0);
+
+        if (!transA && !transB)
+            Gemm::template gemm_small<Dim[0], Kc, Dim[1], false, false>(A, lda, B, ldb, out, ldc, ep);
+        else if (!transA)
+            Gemm::template gemm_small<Dim[0], Kc, Dim[1], false, true>(A, lda, B, ldb, out, ldc, ep);
+        else if (!transB)
+            Gemm::template gemm_small<Dim[0], Kc, Dim[1], true, false>(A, lda, B, ldb, out, ldc, ep);
+        else
+            Gemm::template gemm_small<Dim[0], Kc, Dim[1], true, true>(A, lda, B, ldb, out, ldc, ep);
+    }
+
     template <my_size_t... Dims1>
     FORCE_INLINE void checkDimensionsMismatch(const FusedTensorND<T, Dims1...> &other) const // TODO: conditionally noexcept
     {
@@ -69,7 +69,11 @@ namespace detail
          * @brief Fast path — both expressions share the same physical layout.
          *
          * Iterates physical slices. evalu receives physical offsets.
-         * Same slice geometry for both sides.
+         * Same slice geometry for both sides. The last lastDim % simdWidth
+         * elements of each slice are evaluated as one masked vector
+         * (MaskedTail); only their live lanes are checked, since dead lanes
+         * of an expression may hold anything (e.g. 0/0). Unpadded storage is
+         * iterated as a single slice.
          */
         template <typename Expr1, typename Expr2>
         FORCE_INLINE static bool approx_equal_contiguous(
@@ -79,11 +83,13 @@ namespace detail
         {
             using ExprPadPolicy = typename Expr1::Layout::PadPolicyType;
 
-            static constexpr my_size_t lastDim = ExprPadPolicy::LastDim;
-            static constexpr my_size_t paddedLastDim = ExprPadPolicy::PaddedLastDim;
+            static constexpr bool dense = ExprPadPolicy::PaddedLastDim == ExprPadPolicy::LastDim;
+            static constexpr my_size_t lastDim = dense ? ExprPadPolicy::PhysicalSize : ExprPadPolicy::LastDim;
+            static constexpr my_size_t paddedLastDim = dense ? ExprPadPolicy::PhysicalSize : ExprPadPolicy::PaddedLastDim;
             static constexpr my_size_t numSlices = ExprPadPolicy::PhysicalSize / paddedLastDim;
             static constexpr my_size_t simdSteps = lastDim / simdWidth;
-            static constexpr my_size_t scalarStart = simdSteps * simdWidth;
+            static constexpr my_size_t tailStart = simdSteps * simdWidth;
+            static constexpr my_size_t tail = lastDim - tailStart;
 
             if constexpr (simdSteps > 0)
             {
@@ -100,19 +106,19 @@ namespace detail
                 }
             }
 
-            if constexpr (scalarStart < lastDim)
+            if constexpr (tail > 0)
             {
                 using ScalarK = Microkernel<T, 1, GENERICARCH>;
+                alignas(DATA_ALIGNAS) T lhs_tmp[simdWidth];
+                alignas(DATA_ALIGNAS) T rhs_tmp[simdWidth];
                 for (my_size_t slice = 0; slice < numSlices; ++slice)
                 {
-                    const my_size_t base = slice * paddedLastDim;
-                    for (my_size_t i = scalarStart; i < lastDim; ++i)
-                    {
-                        T lhs_val = lhs.template evalu<T, 1, GENERICARCH>(base + i);
-                        T rhs_val = rhs.template evalu<T, 1, GENERICARCH>(base + i);
-                        if (ScalarK::abs(lhs_val - rhs_val) > tolerance)
+                    const my_size_t base = slice * paddedLastDim + tailStart;
+                    K::store(lhs_tmp, lhs.template evalu<T, Bits, MaskedTail<Arch, tail>>(base));
+                    K::store(rhs_tmp, rhs.template evalu<T, Bits, MaskedTail<Arch, tail>>(base));
+                    for (my_size_t i = 0; i < tail; ++i)
+                        if (!ScalarK::all_within_tolerance(lhs_tmp[i], rhs_tmp[i], tolerance))
                             return false;
-                    }
                 }
             }
 
@@ -155,7 +161,7 @@ namespace detail
             {
                 T lhs_val = lhs.template logical_evalu<T, 1, GENERICARCH>(i);
                 T rhs_val = rhs.template logical_evalu<T, 1, GENERICARCH>(i);
-                if (ScalarK::abs(lhs_val - rhs_val) > tolerance)
+                if (!ScalarK::all_within_tolerance(lhs_val, rhs_val, tolerance))
                     return false;
             }
 
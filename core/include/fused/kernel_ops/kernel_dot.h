@@ -37,6 +37,7 @@ namespace detail
         using K = Microkernel<T, Bits, Arch>;
         using Helpers = KernelHelpers<T, Bits, Arch>;
         static constexpr my_size_t simdWidth = K::simdWidth;
+        using Acc = compute_type_t<T>; // float for Half / BFloat16: lanes are summed unrounded
 
         // ========================================================================
         // Public API
@@ -57,7 +58,11 @@ namespace detail
             const Expr2 &expr2, my_size_t base2, my_size_t stride2,
             my_size_t len) noexcept
         {
-            if (stride1 == 1 && stride2 == 1)
+            if constexpr (Helpers::PairMac)
+            {
+                return dot_pairs_impl(expr1.data() + base1, stride1, expr2.data() + base2, stride2, len);
+            }
+            else if (stride1 == 1 && stride2 == 1)
             {
                 // std::cout << "dot: dispatching to contiguous impl" << std::endl;
                 return dot_contiguous_impl(expr1, expr2, base1, base2, len);
@@ -81,7 +86,7 @@ namespace detail
             const Expr2 &expr2, my_size_t base2, my_size_t stride2,
             my_size_t len) noexcept
         {
-            T sum = T{0};
+            Acc sum = Acc{0};
             for (my_size_t i = 0; i < len; ++i)
                 sum += expr1.data()[base1 + i * stride1] *
                        expr2.data()[base2 + i * stride2];
@@ -96,13 +101,14 @@ namespace detail
         /**
          * @brief Contiguous dot product — both fibers have stride 1.
          *
-         * Uses K::load for aligned SIMD access. len may not be a multiple
-         * of simdWidth (e.g., logical last dim = 5, simdWidth = 4), so
-         * a scalar remainder handles the tail.
+         * Uses Helpers::load_row (aligned unless storage is unpadded). len
+         * may not be a multiple of simdWidth (e.g., logical last dim = 5,
+         * simdWidth = 4), so one masked vector (K::maskload, dead lanes zero)
+         * handles the tail before the horizontal sum.
          *
          *   fiber1: [v0 v1 v2 v3 | v4]     fiber2: [w0 w1 w2 w3 | w4]
          *            ^^^^^^^^^^^   ^^                ^^^^^^^^^^^   ^^
-         *            SIMD          scalar            SIMD          scalar
+         *            SIMD          masked            SIMD          masked
          */
         template <typename Expr1, typename Expr2>
         FORCE_INLINE static T dot_contiguous_impl(
@@ -117,30 +123,30 @@ namespace detail
             const T *ptr2 = expr2.data() + base2;
 
             const my_size_t simdSteps = len / simdWidth;
-            const my_size_t scalarStart = simdSteps * simdWidth;
+            const my_size_t tailStart = simdSteps * simdWidth;
 
-            T result = T{0};
+            typename K::VecType acc = K::set1(T{0});
 
-            if (simdSteps > 0)
+            for (my_size_t i = 0; i < simdSteps; ++i)
             {
-                typename K::VecType acc = K::set1(T{0});
-
-                for (my_size_t i = 0; i < simdSteps; ++i)
-                {
-                    auto v1 = K::load(ptr1 + i * simdWidth);
-                    auto v2 = K::load(ptr2 + i * simdWidth);
-                    acc = Helpers::fmadd_safe(v1, v2, acc);
-                }
-
-                alignas(DATA_ALIGNAS) T tmp[simdWidth];
-                K::store(tmp, acc);
+                auto v1 = Helpers::load_row(ptr1 + i * simdWidth);
+                auto v2 = Helpers::load_row(ptr2 + i * simdWidth);
+                acc = Helpers::fmadd_safe(v1, v2, acc);
+            }
 
-                for (my_size_t i = 0; i < simdWidth; ++i)
-                    result += tmp[i];
+            if (tailStart < len)
+            {
+                auto v1 = K::maskload(ptr1 + tailStart, len - tailStart);
+                auto v2 = K::maskload(ptr2 + tailStart, len - tailStart);
+                acc = Helpers::fmadd_safe(v1, v2, acc);
             }
 
-            for (my_size_t i = scalarStart; i < len; ++i)
-                result += ptr1[i] * ptr2[i];
+            alignas(DATA_ALIGNAS) Acc tmp[simdWidth];
+            K::store(tmp, acc);
+
+            Acc result = Acc{0};
+            for (my_size_t i = 0; i < simdWidth; ++i)
+                result += tmp[i];
 
             return result;
         }
@@ -174,7 +180,7 @@ namespace detail
             const my_size_t simdSteps = len / simdWidth;
             const my_size_t scalarStart = simdSteps * simdWidth;
 
-            T result = T{0};
+            Acc result = Acc{0};
 
             if (simdSteps > 0)
             {
@@ -199,7 +205,7 @@ namespace detail
                     idx2 += simdWidth * stride2;
                 }
 
-                alignas(DATA_ALIGNAS) T tmp[simdWidth];
+                alignas(DATA_ALIGNAS) Acc tmp[simdWidth];
                 K::store(tmp, acc);
 
                 for (my_size_t i = 0; i < simdWidth; ++i)
@@ -216,6 +222,46 @@ namespace detail
 
             return result;
         }
+
+        // ========================================================================
+        // Pair dot — K::mac (Helpers::PairMac)
+        // ========================================================================
+
+        /**
+         * @brief Dot product two elements per K::mac, one 64-bit sum rounded once.
+         *
+         * A contiguous fiber is loaded as pairs in place; a strided one is
+         * packed pair by pair. An odd last element pairs with zero.
+         *
+         *   fiber1: [v0 v1 | v2 v3 | v4 0]
+         *   fiber2: [w0 w1 | w2 w3 | w4 0]   acc += v0·w0 + v1·w1, …
+         */
+        FORCE_INLINE static T dot_pairs_impl(
+            const T *ptr1, my_size_t stride1,
+            const T *ptr2, my_size_t stride2,
+            my_size_t len) noexcept
+        {
+            typename K::AccType acc = 0;
+            const my_size_t pairs = len / 2;
+
+            if (stride1 == 1 && stride2 == 1)
+            {
+                for (my_size_t p = 0; p < pairs; ++p)
+                    acc = K::mac(acc, K::loadu(ptr1 + 2 * p), K::loadu(ptr2 + 2 * p));
+            }
+            else
+            {
+                for (my_size_t p = 0; p < pairs; ++p)
+                    acc = K::mac(acc,
+                                 K::lanes(ptr1[2 * p * stride1], ptr1[(2 * p + 1) * stride1]),
+                                 K::lanes(ptr2[2 * p * stride2], ptr2[(2 * p + 1) * stride2]));
+            }
+
+            if (len % 2)
+                acc = K::mac(acc, K::lanes(ptr1[(len - 1) * stride1], T{}), K::lanes(ptr2[(len - 1) * stride2], T{}));
+
+            return K::round_acc(acc);
+        }
     };
 
 } // namespace detail
@@ -0,0 +1,352 @@
+/**
+ * @file kernel_epilogue.h
+ * @brief GEMM epilogues — work applied to the C tile while it is still in registers.
+ *
+ * A plain GEMM stores A·B and anything else (scaling, + R, bias, clamp)
+ * needs another full read/write pass over C. An epilogue folds that work
+ * into the micro-kernel's final store:
+ *
+ *   C = op( alpha · A·B  +  beta · C_old  +  addend(i, j) )
+ *
+ *   ┌────────── micro-kernel ──────────┐
+ *   │ acc = Σ_k a(i,k)·b(k,j)          │
+ *   │ acc = alpha·acc + beta·C_old     │  ← merge   (every K block)
+ *   │ acc = op(acc + addend(i,j))      │  ← finish  (last K block only)
+ *   │ store(C, acc)                    │
+ *   └──────────────────────────────────┘
+ *
+ * Addends:
+ *   - another expression with C's shape          (e.g. + R, + Q, + (R + Q))
+ *   - a row bias:    C[i,j] += bias[j]           (length-N vector)
+ *   - a column bias: C[i,j] += bias[i]           (length-M vector)
+ *
+ * Addend extents are part of the epilogue type; einsum / matmul reject an
+ * addend that does not fit the output with a static_assert.
+ *
+ * Ops: any functor callable on T. If it also provides
+ * `template <typename K> typename K::VecType vec(typename K::VecType) const`,
+ * that SIMD form is used; otherwise the functor is applied lane by lane.
+ *
+ * Build epilogues fluently, in the same full-expression as the matmul
+ * (addends hold references, like every other expression node):
+ * @code
+ *   S = FusedMatrix<T, M, M>::matmul(HP, H.transpose_view(),
+ *                                    GemmEpilogue<T>{}.add(R));
+ *   Y = FusedMatrix<T, N, N>::matmul(A, B,
+ *                                    GemmEpilogue<T>{}.scale(T(0.5)).add_row_bias(b).map(ClampOp<T>{0, 1}));
+ * @endcode
+ */
+#ifndef KERNEL_EPILOGUE_H
+#define KERNEL_EPILOGUE_H
+
+#include "config.h"
+#include "fused/BaseExpr.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "fused/kernel_ops/kernel_helpers.h"
+
+namespace detail
+{
+
+    /// No addend: finish() only applies the op.
+    struct NoAddend
+    {
+    };
+
+    /// C[i,j] += expr(i,j) for an expression with C's shape.
+    template <typename Expr>
+    struct ExprAddend
+    {
+        static constexpr my_size_t Rows = Expr::Dim[0];
+        static constexpr my_size_t Cols = Expr::Dim[1]; ///< Row pitch of the logical flat index
+
+        const Expr *expr;
+    };
+
+    /// C[i,j] += bias[j] — one value per column, broadcast down the rows.
+    template <typename T, my_size_t N>
+    struct RowBiasAddend
+    {
+        static constexpr my_size_t Length = N; ///< Must equal C's column count
+
+        const T *data;
+        my_size_t stride; ///< Physical distance between consecutive bias elements
+    };
+
+    /// C[i,j] += bias[i] — one value per row, broadcast across the columns.
+    template <typename T, my_size_t M>
+    struct ColBiasAddend
+    {
+        static constexpr my_size_t Length = M; ///< Must equal C's row count
+
+        const T *data;
+        my_size_t stride;
+    };
+
+    /// Whether an addend fits an M × N output: same shape, or a bias of length N (row) / M (column).
+    template <typename Addend, my_size_t M, my_size_t N>
+    inline constexpr bool addend_fits = true;
+
+    template <typename Expr, my_size_t M, my_size_t N>
+    inline constexpr bool addend_fits<ExprAddend<Expr>, M, N> = ExprAddend<Expr>::Rows == M && ExprAddend<Expr>::Cols == N;
+
+    template <typename T, my_size_t L, my_size_t M, my_size_t N>
+    inline constexpr bool addend_fits<RowBiasAddend<T, L>, M, N> = L == N;
+
+    template <typename T, my_size_t L, my_size_t M, my_size_t N>
+    inline constexpr bool addend_fits<ColBiasAddend<T, L>, M, N> = L == M;
+
+    /// Identity op: finish() leaves the value untouched.
+    struct IdentityOp
+    {
+    };
+
+    /**
+     * @brief Physical element stride of a 1-D-shaped tensor ([N,1] or [1,N]).
+     *
+     * A FusedVector is [N,1]: each element sits on its own padded row, so
+     * consecutive elements are Layout::stride(0) apart. A [1,N] row is dense.
+     */
+    template <typename Expr>
+    constexpr my_size_t vector_element_stride() noexcept
+    {
+        static_assert(Expr::NumDims == 2 && (Expr::Dim[0] == 1 || Expr::Dim[1] == 1),
+                      "GEMM bias must be a [N,1] or [1,N] tensor");
+        return (Expr::Dim[0] == 1) ? 1 : Expr::Layout::stride(0);
+    }
+
+    /// Element count of a 1-D-shaped tensor ([N,1] or [1,N]).
+    template <typename Expr>
+    constexpr my_size_t vector_length() noexcept
+    {
+        return Expr::Dim[0] * Expr::Dim[1];
+    }
+
+} // namespace detail
+
+/**
+ * @brief Fluent description of a GEMM epilogue.
+ *
+ * @tparam T      Scalar type.
+ * @tparam Scaled Whether alpha/beta are applied (false → plain store, zero overhead).
+ * @tparam Addend detail::NoAddend, ExprAddend, RowBiasAddend or ColBiasAddend.
+ * @tparam Op     detail::IdentityOp or a user functor.
+ */
+template <typename T,
+          bool Scaled = false,
+          typename Addend = detail::NoAddend,
+          typename Op = detail::IdentityOp>
+struct GemmEpilogue
+{
+    static constexpr bool IsScaled = Scaled;
+    static constexpr bool HasAddend = !is_same_v<Addend, detail::NoAddend>;
+    static constexpr bool HasOp = !is_same_v<Op, detail::IdentityOp>;
+
+    /// The addend matches an M × N output (checked by the GEMM entry points).
+    template <my_size_t M, my_size_t N>
+    static constexpr bool FitsOutput = detail::addend_fits<Addend, M, N>;
+
+    T alpha = T{1};
+    T beta = T{0};
+    Addend addend{};
+    Op op{};
+
+    /// C = alpha·A·B + beta·C_old. beta != 0 requires an in-place update (einsum_update / matmul_update).
+    GemmEpilogue<T, true, Addend, Op> scale(T alpha_, T beta_ = T{0}) const noexcept
+    {
+        return {alpha_, beta_, addend, op};
+    }
+
+    /// C += expr, where expr has C's shape (any expression, including views).
+    template <typename Expr>
+    GemmEpilogue<T, Scaled, detail::ExprAddend<Expr>, Op> add(const BaseExpr<Expr> &expr) const noexcept
+    {
+        static_assert(!HasAddend, "GemmEpilogue supports a single addend");
+        static_assert(Expr::NumDims == 2, "GemmEpilogue addend must be 2-dimensional");
+        return {alpha, beta, {&expr.derived()}, op};
+    }
+
+    /// C[i,j] += bias[j]. bias is a [N,1] or [1,N] tensor, N = C's column count.
+    template <typename Expr>
+    GemmEpilogue<T, Scaled, detail::RowBiasAddend<T, detail::vector_length<Expr>()>, Op> add_row_bias(const BaseExpr<Expr> &bias) const noexcept
+    {
+        static_assert(!HasAddend, "GemmEpilogue supports a single addend");
+        return {alpha, beta, {bias.derived().data(), detail::vector_element_stride<Expr>()}, op};
+    }
+
+    /// C[i,j] += bias[i]. bias is a [M,1] or [1,M] tensor, M = C's row count.
+    template <typename Expr>
+    GemmEpilogue<T, Scaled, detail::ColBiasAddend<T, detail::vector_length<Expr>()>, Op> add_col_bias(const BaseExpr<Expr> &bias) const noexcept
+    {
+        static_assert(!HasAddend, "GemmEpilogue supports a single addend");
+        return {alpha, beta, {bias.derived().data(), detail::vector_element_stride<Expr>()}, op};
+    }
+
+    /// C = f(C) elementwise, applied last.
+    template <typename F>
+    GemmEpilogue<T, Scaled, Addend, F> map(F f) const noexcept
+    {
+        static_assert(!HasOp, "GemmEpilogue supports a single elementwise op");
+        return {alpha, beta, addend, f};
+    }
+};
+
+/**
+ * @brief Elementwise clamp to [lo, hi] with a SIMD form. Usable as a GemmEpilogue op.
+ */
+template <typename T>
+struct ClampOp
+{
+    T lo;
+    T hi;
+
+    T operator()(T x) const noexcept { return x < lo ? lo : (x > hi ? hi : x); }
+
+    template <typename K>
+    typename K::VecType vec(typename K::VecType x) const noexcept
+    {
+        return K::min(K::max(x, K::set1(lo)), K::set1(hi));
+    }
+};
+
+namespace detail
+{
+
+    /**
+     * @brief Applies a GemmEpilogue to accumulators inside the GEMM kernels.
+     *
+     * merge()  — combine a K block's accumulator with C (alpha/beta, or
+     *            plain accumulation for K blocks after the first).
+     * finish() — add the addend and apply the op (last K block only).
+     *
+     * Vector forms operate on simdWidth columns starting at (i, j);
+     * j is always a multiple of simdWidth and j + simdWidth ≤ N.
+     */
+    template <typename T, my_size_t Bits, typename Arch>
+    struct KernelEpilogue
+    {
+        using K = Microkernel<T, Bits, Arch>;
+        using VecType = typename K::VecType;
+        using Helpers = KernelHelpers<T, Bits, Arch>;
+        static constexpr my_size_t simdWidth = K::simdWidth;
+
+        /**
+         * @param first  True for the first K block: C holds caller data (used only when beta != 0).
+         *               False for later blocks: C holds the partial product and is always added.
+         */
+        template <typename Ep>
+        FORCE_INLINE static VecType merge(const Ep &ep, VecType acc, const T *c, bool first) noexcept
+        {
+            if constexpr (Ep::IsScaled)
+            {
+                acc = K::mul(acc, K::set1(ep.alpha));
+                if (!first)
+                    return K::add(acc, Helpers::load_row(c));
+                if (ep.beta != T{0})
+                    return Helpers::fmadd_safe(K::set1(ep.beta), Helpers::load_row(c), acc);
+                return acc;
+            }
+            else
+            {
+                return first ? acc : K::add(acc, Helpers::load_row(c));
+            }
+        }
+
+        template <typename Ep>
+        FORCE_INLINE static T merge_scalar(const Ep &ep, T acc, const T *c, bool first) noexcept
+        {
+            if constexpr (Ep::IsScaled)
+            {
+                acc = acc * ep.alpha;
+                if (!first)
+                    return acc + *c;
+                if (ep.beta != T{0})
+                    return acc + ep.beta * *c;
+                return acc;
+            }
+            else
+            {
+                return first ? acc : T(acc + *c);
+            }
+        }
+
+        template <typename Ep>
+        FORCE_INLINE static VecType finish(const Ep &ep, VecType v, my_size_t i, my_size_t j) noexcept
+        {
+            if constexpr (Ep::HasAddend)
+                v = K::add(v, addend_vec(ep.addend, i, j));
+
+            if constexpr (Ep::HasOp)
+            {
+                if constexpr (requires { ep.op.template vec<K>(v); })
+                {
+                    v = ep.op.template vec<K>(v);
+                }
+                else
+                {
+                    alignas(Bits / 8) T lanes[simdWidth];
+                    K::store(lanes, v);
+                    for (my_size_t l = 0; l < simdWidth; ++l)
+                        lanes[l] = ep.op(lanes[l]);
+                    v = K::load(lanes);
+                }
+            }
+            return v;
+        }
+
+        template <typename Ep>
+        FORCE_INLINE static T finish_scalar(const Ep &ep, T v, my_size_t i, my_size_t j) noexcept
+        {
+            if constexpr (Ep::HasAddend)
+                v = v + addend_scalar(ep.addend, i, j);
+            if constexpr (Ep::HasOp)
+                v = ep.op(v);
+            return v;
+        }
+
+    private:
+        template <typename Expr>
+        FORCE_INLINE static VecType addend_vec(const ExprAddend<Expr> &a, my_size_t i, my_size_t j) noexcept
+        {
+            return a.expr->template logical_evalu<T, Bits, Arch>(i * ExprAddend<Expr>::Cols + j);
+        }
+
+        template <my_size_t L>
+        FORCE_INLINE static VecType addend_vec(const RowBiasAddend<T, L> &a, my_size_t, my_size_t j) noexcept
+        {
+            if (a.stride == 1)
+                return K::loadu(a.data + j);
+
+            my_size_t idx[simdWidth];
+            for (my_size_t l = 0; l < simdWidth; ++l)
+                idx[l] = (j + l) * a.stride;
+            return K::gather(a.data, idx);
+        }
+
+        template <my_size_t L>
+        FORCE_INLINE static VecType addend_vec(const ColBiasAddend<T, L> &a, my_size_t i, my_size_t) noexcept
+        {
+            return K::set1(a.data[i * a.stride]);
+        }
+
+        template <typename Expr>
+        FORCE_INLINE static T addend_scalar(const ExprAddend<Expr> &a, my_size_t i, my_size_t j) noexcept
+        {
+            return a.expr->template logical_evalu<T, 1, GENERICARCH>(i * ExprAddend<Expr>::Cols + j);
+        }
+
+        template <my_size_t L>
+        FORCE_INLINE static T addend_scalar(const RowBiasAddend<T, L> &a, my_size_t, my_size_t j) noexcept
+        {
+            return a.data[j * a.stride];
+        }
+
+        template <my_size_t L>
+        FORCE_INLINE static T addend_scalar(const ColBiasAddend<T, L> &a, my_size_t i, my_size_t) noexcept
+        {
+            return a.data[i * a.stride];
+        }
+    };
+
+} // namespace detail
+
+#endif // KERNEL_EPILOGUE_H
@@ -6,6 +6,12 @@
  * expression::traits<Expr>::IsPermuted:
  *   - Contiguous: linear physical iteration, K::load/K::store
  *   - Permuted:   output-slice iteration with logical_flat tracking, K::gather
+ *   - Tiled:      a bare permuted view that moves the last axis, copied in
+ *                 simdWidth × simdWidth register tiles (K::transpose)
+ *
+ * A partial vector at the end of a row (unpadded storage, or a permuted
+ * output row shorter than its padding) is evaluated through
+ * MaskedTail<Arch, n> and written with one K::maskstore.
  */
 #ifndef KERNEL_EVAL_H
 #define KERNEL_EVAL_H
@@ -13,7 +19,7 @@
 #include "config.h"
 #include "fused/microkernels/microkernel_base.h"
 #include "helper_traits.h"
-#include "fused/padding_policies/simd_padding_policy.h"
+#include "fused/padding_policies/default_padding_policy.h"
 #include "expression_traits/expression_traits.h"
 
 namespace detail
@@ -31,15 +37,29 @@ namespace detail
 
         /**
          * @brief Dispatch: pick contiguous or permuted eval based on expression layout.
+         *
+         * Contiguous expressions of at least RUNTIME_DISPATCH_MIN_SIZE
+         * elements go through runtime_dispatch (a different kernel family
+         * only with TESSERACT_RUNTIME_DISPATCH).
          */
         template <typename Expr>
         FORCE_INLINE static void eval(T *output, const Expr &expr) noexcept
         {
-            if constexpr (!expression::traits<Expr>::IsPermuted)
+            if constexpr (!expression::traits<Expr>::IsPermuted &&
+                          Expr::Layout::PhysicalSize >= RUNTIME_DISPATCH_MIN_SIZE)
+            {
+                runtime_dispatch<T, Bits, Arch>([&]<my_size_t DBits, typename DArch>()
+                                                { KernelEval<T, DBits, DArch>::eval_vectorized_contiguous(output, expr); });
+            }
+            else if constexpr (!expression::traits<Expr>::IsPermuted)
             {
                 // std::cout << "eval_contiguous" << std::endl;
                 eval_vectorized_contiguous(output, expr);
             }
+            else if constexpr (TiledTranspose<Expr>)
+            {
+                eval_tiled_transpose(output, expr);
+            }
             else
             {
                 // std::cout << "eval_permuted" << std::endl;
@@ -48,6 +68,9 @@ namespace detail
         }
 
     private:
+        template <typename, my_size_t, typename>
+        friend struct KernelEval;
+
         // ========================================================================
         // OutputPadPolicy — derive output padding from permuted expression dims
         // ========================================================================
@@ -60,7 +83,7 @@ namespace detail
         template <typename Expr, my_size_t... Is>
         struct OutputPadImpl<Expr, index_seq<Is...>>
         {
-            using type = SimdPaddingPolicy<typename Expr::value_type, Expr::Dim[Is]...>;
+            using type = DefaultPaddingPolicy<typename Expr::value_type, Expr::Dim[Is]...>;
         };
 
         template <typename Expr>
@@ -69,6 +92,29 @@ namespace detail
             using type = typename OutputPadImpl<Expr, typename make_index_seq<Expr::NumDims>::type>::type;
         };
 
+        /// Physical stride of axis i in a buffer laid out as OutputPad.
+        template <typename OutputPad>
+        static constexpr my_size_t output_stride(my_size_t i) noexcept
+        {
+            my_size_t s = 1;
+            for (my_size_t j = OutputPad::NumDims - 1; j > i; --j)
+                s *= OutputPad::PhysicalDims[j];
+            return s;
+        }
+
+        /// A physical permuted view (PermutedViewConstExpr) whose last axis is
+        /// not the source's last axis, on a kernel with an in-register transpose.
+        template <typename Expr>
+        static constexpr bool TiledTranspose = []
+        {
+            if constexpr (expression::traits<Expr>::IsPermuted && expression::traits<Expr>::IsPhysical &&
+                          is_same_v<typename Expr::value_type, T> && (simdWidth > 1) &&
+                          requires(typename K::VecType (&r)[simdWidth]) { K::transpose(r); })
+                return Expr::Layout::stride(Expr::NumDims - 1) != 1;
+            else
+                return false;
+        }();
+
         // ========================================================================
         // Contiguous path
         // ========================================================================
@@ -76,9 +122,11 @@ namespace detail
         /**
          * @brief CONTIGUOUS PATH (identity layout) — no permutation, no remapping.
          *
-         * Iterates entire physical buffer linearly. PhysicalSize is guaranteed
-         * to be a multiple of simdWidth by the padding policy. Padding
-         * slots contain zeros — harmless for element-wise ops.
+         * Iterates entire physical buffer linearly. With SimdPaddingPolicy
+         * PhysicalSize is a multiple of simdWidth and padding slots contain
+         * zeros — harmless for element-wise ops. Unpadded storage ends in a
+         * partial vector, evaluated masked (MaskedTail) and stored with
+         * K::maskstore.
          *
          * evalu receives physical flat offsets.
          *
@@ -96,12 +144,7 @@ namespace detail
             using Layout = typename Expr::Layout;
             static constexpr my_size_t physicalSize = Layout::PhysicalSize;
             static constexpr my_size_t simdSteps = physicalSize / simdWidth;
-            static constexpr bool hasRemainder = (physicalSize % simdWidth) != 0;
-
-            // Paranoia check: ensure physical size is a multiple of SIMD width,
-            // so we never read out of bounds
-            static_assert(physicalSize % simdWidth == 0,
-                          "PhysicalSize must be a multiple of SimdWidth");
+            static constexpr my_size_t tail = physicalSize % simdWidth;
 
             // SIMD loop
             for (my_size_t i = 0; i < simdSteps; ++i)
@@ -110,16 +153,11 @@ namespace detail
                 K::store(output + i * simdWidth, val);
             }
 
-            // Scalar remainder TODO: The whole point of padding is that PhysicalSize is already
-            // a multiple of SimdWidth — so there's no scalar remainder
-            // Delete this code if confirmed unnecessary
-            if constexpr (hasRemainder)
+            // Masked tail (unpadded storage only)
+            if constexpr (tail > 0)
             {
-                std::cout << "Warning: Scalar evaluation for remainder elements." << std::endl;
-                // for (my_size_t i = simdSteps * simdWidth; i < physicalSize; ++i)
-                // {
-                //     output[i] = expr.template evalu<T, 1, GENERICARCH>(i);
-                // }
+                constexpr my_size_t start = simdSteps * simdWidth;
+                K::maskstore(output + start, expr.template evalu<T, Bits, MaskedTail<Arch, tail>>(start), tail);
             }
         }
 
@@ -138,13 +176,17 @@ namespace detail
          * EXAMPLE: output [3,2] padded to [3,4], source [2,3] transposed
          * ============================================================================
          *
-         *   lastDim=2, paddedLastDim=4, numSlices=3, simdSteps=0, scalarStart=0
+         *   lastDim=2, paddedLastDim=4, numSlices=3, simdSteps=0, tail=2
          *
-         *   slice 0: out_base=0,  logical_flat 0,1 → store at output[0], output[1]
-         *   slice 1: out_base=4,  logical_flat 2,3 → store at output[4], output[5]
-         *   slice 2: out_base=8,  logical_flat 4,5 → store at output[8], output[9]
+         *   slice 0: out_base=0,  logical_flat 0,1 → maskstore at output[0], output[1]
+         *   slice 1: out_base=4,  logical_flat 2,3 → maskstore at output[4], output[5]
+         *   slice 2: out_base=8,  logical_flat 4,5 → maskstore at output[8], output[9]
          *
          *   Padding at output[2,3,6,7,10,11] untouched.
+         *
+         * Each slice's last lastDim % simdWidth elements are one masked vector
+         * (MaskedTail + K::maskstore). Unpadded output rows are back to back,
+         * so the whole buffer is then iterated as a single slice.
          * ============================================================================
          */
         template <typename Expr>
@@ -154,12 +196,14 @@ namespace detail
         {
             using OutputPad = typename OutputPadPolicy<Expr>::type;
 
-            static constexpr my_size_t lastDim = OutputPad::LastDim;
-            static constexpr my_size_t paddedLastDim = OutputPad::PaddedLastDim;
+            static constexpr bool dense = OutputPad::PaddedLastDim == OutputPad::LastDim;
+            static constexpr my_size_t lastDim = dense ? OutputPad::PhysicalSize : OutputPad::LastDim;
+            static constexpr my_size_t paddedLastDim = dense ? OutputPad::PhysicalSize : OutputPad::PaddedLastDim;
             static constexpr my_size_t numSlices = OutputPad::PhysicalSize / paddedLastDim;
 
             static constexpr my_size_t simdSteps = lastDim / simdWidth;
-            static constexpr my_size_t scalarStart = simdSteps * simdWidth;
+            static constexpr my_size_t tailStart = simdSteps * simdWidth;
+            static constexpr my_size_t tail = lastDim - tailStart;
 
             my_size_t logical_flat = 0;
 
@@ -174,16 +218,107 @@ namespace detail
                     logical_flat += simdWidth;
                 }
 
-                if constexpr (scalarStart < lastDim)
+                if constexpr (tail > 0)
                 {
-                    for (my_size_t i = scalarStart; i < lastDim; ++i)
+                    K::maskstore(output + out_base + tailStart,
+                                 expr.template logical_evalu<T, Bits, MaskedTail<Arch, tail>>(logical_flat), tail);
+                    logical_flat += tail;
+                }
+            }
+        }
+
+        // ========================================================================
+        // Tiled transpose path
+        // ========================================================================
+
+        /**
+         * @brief TILED PATH — a bare permuted view that moves the last axis.
+         *
+         * The generic permuted path gathers every output vector with a source
+         * stride of stride(last). Here the copy is split into 2-D planes over
+         * the view's axis Q that is contiguous in the source (source stride 1)
+         * and the view's last axis L (output stride 1); the other axes are a
+         * batch of planes. Each plane is walked in TILE_BLOCK × TILE_BLOCK
+         * blocks (source and output block both stay in L1/L2) of
+         * simdWidth × simdWidth tiles: simdWidth source loads along Q, one
+         * K::transpose, simdWidth stores along L.
+         *
+         * Partial tiles at the plane edges load masked (rows past the end of
+         * L are zero) and store masked, so output padding is not written.
+         */
+        static constexpr my_size_t TILE_BLOCK = 32;
+
+        template <typename Expr>
+        FORCE_INLINE static void eval_tiled_transpose(T *output, const Expr &expr) noexcept
+        {
+            using Layout = typename Expr::Layout;
+            using OutputPad = typename OutputPadPolicy<Expr>::type;
+            constexpr my_size_t N = Expr::NumDims;
+            constexpr my_size_t L = N - 1;
+            constexpr my_size_t Q = Layout::inverse_perm_array(N - 1);
+            constexpr my_size_t dimQ = Layout::logical_dim(Q);
+            constexpr my_size_t dimL = Layout::logical_dim(L);
+            constexpr my_size_t srcStrideL = Layout::stride(L);
+            constexpr my_size_t outStrideQ = output_stride<OutputPad>(Q);
+
+            constexpr my_size_t numPlanes = Layout::LogicalSize / (dimQ * dimL);
+            const T *src = expr.data();
+
+            for (my_size_t plane = 0; plane < numPlanes; ++plane)
+            {
+                // Decompose the plane index over the batch axes (all but Q and L)
+                my_size_t rest = plane, srcBase = 0, outBase = 0;
+                for (my_size_t a = N - 1; a-- > 0;)
+                {
+                    if (a == Q)
+                        continue;
+                    const my_size_t c = rest % Layout::logical_dim(a);
+                    rest /= Layout::logical_dim(a);
+                    srcBase += c * Layout::stride(a);
+                    outBase += c * output_stride<OutputPad>(a);
+                }
+
+                for (my_size_t bq = 0; bq < dimQ; bq += TILE_BLOCK)
+                    for (my_size_t bl = 0; bl < dimL; bl += TILE_BLOCK)
                     {
-                        output[out_base + i] = expr.template logical_evalu<T, 1, GENERICARCH>(logical_flat);
-                        ++logical_flat;
+                        const my_size_t endQ = bq + TILE_BLOCK < dimQ ? bq + TILE_BLOCK : dimQ;
+                        const my_size_t endL = bl + TILE_BLOCK < dimL ? bl + TILE_BLOCK : dimL;
+                        for (my_size_t q = bq; q < endQ; q += simdWidth)
+                            for (my_size_t l = bl; l < endL; l += simdWidth)
+                                transpose_tile<srcStrideL, outStrideQ>(src + srcBase + l * srcStrideL + q,
+                                                                       output + outBase + q * outStrideQ + l,
+                                                                       dimQ - q, dimL - l);
                     }
-                }
             }
         }
+
+        /**
+         * @brief One simdWidth × simdWidth tile: src rows run along Q, dst rows along L.
+         * @param nq Elements left along Q from this tile (>= simdWidth: full width)
+         * @param nl Elements left along L from this tile
+         */
+        template <my_size_t SrcStride, my_size_t DstStride>
+        FORCE_INLINE static void transpose_tile(const T *src, T *dst, my_size_t nq, my_size_t nl) noexcept
+        {
+            typename K::VecType r[simdWidth];
+            if (nq >= simdWidth && nl >= simdWidth)
+            {
+                for (my_size_t i = 0; i < simdWidth; ++i)
+                    r[i] = K::loadu(src + i * SrcStride);
+                K::transpose(r);
+                for (my_size_t i = 0; i < simdWidth; ++i)
+                    K::storeu(dst + i * DstStride, r[i]);
+                return;
+            }
+
+            const my_size_t rows = nl < simdWidth ? nl : simdWidth;
+            const my_size_t cols = nq < simdWidth ? nq : simdWidth;
+            for (my_size_t i = 0; i < simdWidth; ++i)
+                r[i] = i < rows ? K::maskload(src + i * SrcStride, cols) : K::set1(T{});
+            K::transpose(r);
+            for (my_size_t i = 0; i < cols; ++i)
+                K::maskstore(dst + i * DstStride, r[i], rows);
+        }
     };
 
 } // namespace detail
@@ -1,6 +1,6 @@
 /**
  * @file kernel_gemm.h
- * @brief Register-blocked GEMM for optimized 2D matrix multiplication.
+ * @brief Cache-blocked, register-blocked GEMM for optimized 2D matrix multiplication.
  *
  * Implements C[M,N] = A[M,K] × B[K,N] using an outer-product micro-kernel
  * formulation that maximizes register reuse and SIMD throughput.
@@ -49,35 +49,182 @@
  *
  *     1. Wide tiles   (j += NR):         MR × NR   via micro_kernel_wide
  *     2. Narrow tiles (j += simdWidth):  MR × simdWidth via micro_kernel_narrow
- *     3. Scalar cols  (j += 1):          MR × 1    via scalar_column_MR
+ *     3. Column tail  (N % simdWidth):   MR × n    via micro_kernel_narrow<Partial>
  *
  *   Remainder rows (< MR) use the same three-pass column strategy
  *   with single-row variants.
  *
  *     ┌──────────┬──────────┬───────┬────┐
- *     │  NR      │  NR      │simdW  │scl │  ← j passes
+ *     │  NR      │  NR      │simdW  │ n  │  ← j passes
  *     │  wide    │  wide    │narrow │    │
  *   ──┼──────────┼──────────┼───────┼────┤
- *   MR│micro_    │micro_    │micro_ │scl │
- *     │kernel_   │kernel_   │kernel_│col │
- *     │wide      │wide      │narrow │MR  │
+ *   MR│micro_    │micro_    │micro_ │nar-│
+ *     │kernel_   │kernel_   │kernel_│row │
+ *     │wide      │wide      │narrow │tail│
  *   ──┼──────────┼──────────┼───────┼────┤
  *   MR│  ...     │  ...     │  ...  │    │
  *   ──┼──────────┼──────────┼───────┼────┤
- *  rem│single_   │single_   │single_│scl │  ← remainder rows
+ *  rem│single_   │single_   │single_│tail│  ← remainder rows
  *     │row_wide  │row_wide  │row_   │    │
  *     │          │          │narrow │    │
  *     └──────────┴──────────┴───────┴────┘
  *
- * @section layout Memory Layout Requirements
+ *   The column tail is one partial vector: B is read with K::maskload
+ *   (or in full, padding lanes included, when rows are padded) and C is
+ *   written with K::maskstore, so no scalar column loop remains.
  *
- * The micro-kernel assumes the "favorable" layout:
- *   - A's contraction axis is the last dim (stride 1): sequential k access
- *   - B's free axis is the last dim (stride 1): K::load reads contiguous columns
+ * @section cache_blocking Cache Blocking and Panel Packing
  *
- * The einsum caller is responsible for materializing transposed copies
- * when the original layout is unfavorable. The O(N²) transpose cost is
- * negligible against the O(N³) multiply.
+ * Register blocking alone streams the full K extent of A and B for every
+ * MR × NR tile. Once B no longer fits in cache (roughly 100×100 and up)
+ * the kernel becomes memory-bound. Large products therefore go through
+ * gemm_packed(), a BLIS-style five-loop nest around the same outer-product
+ * micro-kernel:
+ *
+ *   for jc in 0..N step NC:                 ← B block stays in L3
+ *     for pc in 0..K step KC:
+ *       pack B[pc:pc+KC, jc:jc+NC] → Bp      (KC × NR micro-panels)
+ *       for ic in 0..M step MC:             ← A block stays in L2
+ *         pack A[ic:ic+MC, pc:pc+KC] → Ap    (MR × KC micro-panels)
+ *         for jr in 0..NC step NR:          ← B micro-panel stays in L1
+ *           for ir in 0..MC step MR:
+ *             micro_kernel_packed(Ap[ir], Bp[jr])  → C[ic+ir, jc+jr] (+)=
+ *
+ * Packed layouts (k-major inside each micro-panel, so the kernel reads
+ * both operands with unit stride):
+ *
+ *   Ap panel (MR rows):   [a(0,k) a(1,k) .. a(MR-1,k)] for k = 0..KC-1
+ *   Bp panel (NR cols):   [b(k,0) b(k,1) .. b(k,NR-1)] for k = 0..KC-1
+ *
+ * Partial panels at the M/N edges are zero-filled during packing so the
+ * micro-kernel always runs a full MR × NR tile; edge tiles are written
+ * back through a small scratch tile. The first KC block stores into C,
+ * later blocks accumulate into it.
+ *
+ * Ap and Bp are per-thread heap blocks, allocated on a thread's first
+ * packed product and freed when it exits.
+ *
+ * KC, MC and NC are defined per-architecture next to MR/NR_VECS. A value
+ * of 0 (GENERICARCH) disables packing. Small products, where everything
+ * already fits in cache, skip packing and use the register-blocked path.
+ *
+ * @section parallel Parallel Execution (opt-in)
+ *
+ * With a ParallelExecutor registered in ParallelContext, gemm_packed()
+ * keeps the jc/pc loops on the calling thread (which packs B once per
+ * block) and splits the ic/jr work into row-band × column-chunk tasks.
+ * Each task packs its own A band. No two tasks write the same C element
+ * and the per-element arithmetic is unchanged, so results are
+ * bit-identical to the serial path. Any product at or above
+ * ParallelContext's min_volume takes the packed path, even below
+ * PACK_MIN_VOLUME; the register-blocked path is always serial.
+ *
+ * @section dispatch Runtime CPU Dispatch (opt-in)
+ *
+ * With TESSERACT_RUNTIME_DISPATCH, gemm() / gemmt() / syrk() on the
+ * default arch run on the widest x86 family the CPU supports (SSE2,
+ * AVX2 + FMA or AVX-512), chosen by cpuid at start-up
+ * (x86_dispatch.h). MR/NR and the block sizes follow the chosen family.
+ * gemm_small() and gemv() stay on the compile-time arch: they are
+ * inlined into the caller.
+ *
+ * @section epilogue Epilogues
+ *
+ * Every store site passes the accumulators through a GemmEpilogue
+ * (kernel_epilogue.h) before writing C: alpha/beta scaling on each K
+ * block, then addend (expression, row or column bias) and elementwise op
+ * on the last one. The default epilogue compiles to the plain store.
+ *
+ * @section layout Memory Layout and Transposed Operands
+ *
+ * Each operand is a row-major buffer with a padded row stride (or a
+ * compact one under TESSERACT_NO_PADDING, where row accesses become
+ * unaligned — see KernelHelpers::AlignedRows), read either as stored or
+ * transposed (TransA / TransB template flags):
+ *
+ *   TransA = false:  A(i,k) = A[i·strideA + k]     A stored M × K
+ *   TransA = true:   A(i,k) = A[k·strideA + i]     A stored K × M
+ *   TransB = false:  B(k,j) = B[k·strideB + j]     B stored K × N
+ *   TransB = true:   B(k,j) = B[j·strideB + k]     B stored N × K
+ *
+ * so NN, NT, TN and TT products run without a transposed copy:
+ *
+ *   - Packed path: pack_a / pack_b read the operand in whichever order
+ *     it is stored; the packed panels (and the micro-kernel) are the same.
+ *   - Register path: A elements are broadcast one at a time, so TransA
+ *     only changes the address. B is loaded as vectors along j, which a
+ *     transposed B cannot provide; gemm() stages Bᵀ once into the
+ *     thread-local B buffer (one contiguous read pass, no gathers) and
+ *     then runs the NN kernels. Without packing buffers (KC = 0) the
+ *     kernels read B(k, j..) directly (scalar or gathered).
+ *
+ * @section symmetric Symmetric Outputs (GEMMT / SYRK)
+ *
+ * When C is known to be symmetric (F·P·Fᵀ, A·Aᵀ), gemmt() computes only
+ * one triangle: every tiling loop above clips its column range to the
+ * triangle of its row band, and macro/micro tiles that lie entirely in
+ * the other triangle are skipped (their A blocks are not even packed).
+ *
+ *   Lower:  row band [i, i+MR) covers columns [0, min(N, i+MR))
+ *   Upper:  row band [i, i+MR) covers columns [⌊i/simdWidth⌋·simdWidth, N)
+ *
+ * Tiles straddling the diagonal are computed whole, so a few entries
+ * just across it are written too (with their correct values); the rest
+ * of the other triangle is never read or written. That halves the
+ * multiply-adds. symmetrize() mirrors the computed triangle when the
+ * consumer needs the full matrix; consumers that read only one triangle
+ * skip it.
+ *
+ * @section small Fixed-Size Small Products
+ *
+ * For tiny matrices (3×3, 4×4, 6×6) the tiling above is mostly loop
+ * control and remainder handling: a 3×3 float is one partial vector
+ * wide and falls entirely into the partial-vector tail paths.
+ * When every extent is a compile-time constant ≤ SMALL_DIM_MAX,
+ * gemm_small<M, K, N>() replaces the whole nest with one fully unrolled
+ * block (index_seq folds, no loops):
+ *
+ *   acc[M][NV] = 0                                 NV = ⌈N / simdWidth⌉
+ *   for k:  b[v] = B row k (NV vectors)           all of C in registers
+ *           acc[i][v] += A(i,k) · b[v]            M·NV FMAs per k
+ *   store full vectors; the partial last vector lane by lane
+ *
+ * B rows are loaded as whole vectors, reading (and discarding) the
+ * padding lanes past N (masked loads instead when storage is unpadded);
+ * C padding is never written. A transposed B is staged once into a
+ * register-sized local block.
+ *
+ * @section gemv Matrix-Vector Products
+ *
+ * With N = 1 every tile of the nest above is a single partial vector of
+ * one lane. gemv() handles it in
+ * whichever form reads A contiguously:
+ *
+ *   dot form  (A as stored)  y[i] = A[i,:] · x     GEMV_ROWS rows per x vector
+ *   axpy form (A stored K×M) y   += A[k,:] · x[k]  GEMV_VECS vectors of y per pass
+ *
+ * Each row (dot) or each vector of y (axpy) owns an accumulator, so the
+ * FMA chains are independent. A column-vector x is strided by the
+ * padded row width; the dot form first copies up to GEMV_STAGE of it
+ * to a contiguous local buffer. A 1 × N result is the same product
+ * with A = Bᵀ (RowY).
+ *
+ * @section pairs Pair Path (packed Q15)
+ *
+ * A kernel with K::mac (KernelHelpers::PairMac, the packed Q15 kernel)
+ * multiplies two k steps per instruction into a 64-bit accumulator,
+ * which the broadcast-FMA tiles above cannot use: their fmadd saturates
+ * every step. register_blocked(), gemm_small() and gemv() hand such
+ * products to pair_gemm() instead, 2 × 2 tiles of C:
+ *
+ *   for k in 0..K step 2:
+ *       a[r] = A(i+r, k), A(i+r, k+1)   one load along a stored row, else packed
+ *       b[c] = B(k, j+c), B(k+1, j+c)   likewise
+ *       acc[r][c] = K::mac(acc[r][c], a[r], b[c])
+ *   C(i+r, j+c) = K::round_acc(acc[r][c])   (through the scalar epilogue)
+ *
+ * An odd K pairs its last step with zero. Uplo clips the column range as
+ * in the register path.
  *
  * @section example Concrete Example (MR=4, simdWidth=4, doubles)
  *
@@ -102,19 +249,33 @@
 #ifndef KERNEL_GEMM_H
 #define KERNEL_GEMM_H
 
+#include <cstdlib> // for aligned_alloc, free
 #include "config.h"
+#include "helper_traits.h"
 #include "fused/microkernels/microkernel_base.h"
 #include "fused/kernel_ops/kernel_helpers.h"
+#include "fused/kernel_ops/kernel_epilogue.h"
+#include "utilities/parallel_executor.h"
 
 namespace detail
 {
 
+    /// Part of C a GEMM computes (see @ref symmetric).
+    enum class GemmUplo
+    {
+        Full,  ///< Whole matrix
+        Lower, ///< Lower triangle including the diagonal
+        Upper  ///< Upper triangle including the diagonal
+    };
+
     template <typename T, my_size_t Bits, typename Arch>
     struct KernelGemm
     {
         using K = Microkernel<T, Bits, Arch>;
         using Helpers = KernelHelpers<T, Bits, Arch>;
+        using Epi = KernelEpilogue<T, Bits, Arch>;
         static constexpr my_size_t simdWidth = K::simdWidth;
+        using Acc = compute_type_t<T>; // float for Half / BFloat16
 
         /// Tile height: rows of C computed per micro-kernel invocation.
         static constexpr my_size_t MR = K::MR;
@@ -125,36 +286,437 @@ namespace detail
         /// Tile width: columns of C computed per wide micro-kernel invocation.
         static constexpr my_size_t NR = K::NR;
 
+        /// Depth of a packed A/B panel (contraction-axis block).
+        static constexpr my_size_t KC = K::KC;
+
+        /// Rows of A packed per block. Multiple of MR.
+        static constexpr my_size_t MC = K::MC;
+
+        /// Columns of B packed per block. Multiple of NR.
+        static constexpr my_size_t NC = K::NC;
+
+        /// Products with M·N·K below this volume skip packing (operands are cache-resident),
+        /// unless ParallelContext hands them to an executor.
+        static constexpr my_size_t PACK_MIN_VOLUME = 128 * 128 * 128;
+
+        static_assert(KC == 0 || (MC % MR == 0 && NC % NR == 0),
+                      "GEMM block sizes must be multiples of the register tile");
+
+        /// Largest compile-time extent handled by the unrolled gemm_small().
+        static constexpr my_size_t SMALL_DIM_MAX = 8;
+
+        /// Rows of A dotted with x per pass of the dot-form gemv (one accumulator each).
+        static constexpr my_size_t GEMV_ROWS = 8;
+
+        /// Vectors of y accumulated per pass of the axpy-form gemv.
+        static constexpr my_size_t GEMV_VECS = 4;
+
+        /// Longest strided x the dot-form gemv copies to a contiguous local buffer.
+        static constexpr my_size_t GEMV_STAGE = 256;
+
         /**
-         * @brief Register-blocked GEMM: C[M,N] = A[M,K] × B[K,N]
+         * @brief GEMM: C[M,N] = A[M,K] × B[K,N]
          *
-         * Top-level dispatcher that tiles the output matrix and routes each
-         * tile to the appropriate micro-kernel based on its position.
+         * Routes large products to the cache-blocked packed path and small
+         * ones to the register-blocked path (see @ref cache_blocking).
+         * Both produce identical results up to floating-point summation order.
          *
          * All pointers address raw physical memory with padded row strides.
-         * The caller must ensure the favorable layout (see @ref layout).
+         * Operands are read as stored or transposed (see @ref layout).
          *
+         * @tparam TransA A is stored K × M (e.g. the base of a transpose_view)
+         * @tparam TransB B is stored N × K
          * @param A       Pointer to first element of A
          * @param M       Number of rows of A (and C)
          * @param K_len   Contraction length (columns of A, rows of B)
-         * @param strideA Physical row stride of A (≥ K_len, includes padding)
+         * @param strideA Physical row stride of A as stored (includes padding)
          * @param B       Pointer to first element of B
          * @param N       Number of columns of B (and C)
-         * @param strideB Physical row stride of B (≥ N, includes padding)
+         * @param strideB Physical row stride of B as stored (includes padding)
          * @param C       Pointer to first element of C (output, zero-initialized not required)
          * @param strideC Physical row stride of C (≥ N, includes padding)
+         * @param ep      Epilogue applied at store time (see kernel_epilogue.h).
+         *                C is read only if ep.beta != 0.
          */
+        template <bool TransA = false, bool TransB = false, typename Ep = GemmEpilogue<T>>
         static void gemm(
             const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
             const T *B, my_size_t N, my_size_t strideB,
-            T *C, my_size_t strideC) noexcept
+            T *C, my_size_t strideC,
+            const Ep &ep = Ep{}) noexcept
+        {
+            dispatch<GemmUplo::Full, TransA, TransB>(A, M, K_len, strideA, B, N, strideB, C, strideC, ep);
+        }
+
+        /**
+         * @brief Symmetric-output GEMM: one triangle of C[N,N] = A[N,K] × B[K,N]
+         *
+         * For products known to be symmetric (e.g. (F·P)·Fᵀ). Computes the
+         * @p Uplo triangle with half the multiply-adds; the other triangle is
+         * left alone apart from tiles straddling the diagonal (see
+         * @ref symmetric). Call symmetrize() afterwards if the full matrix is
+         * needed. The epilogue applies to the computed entries only.
+         *
+         * Parameters are those of gemm() with M = N.
+         */
+        template <GemmUplo Uplo, bool TransA = false, bool TransB = false, typename Ep = GemmEpilogue<T>>
+        static void gemmt(
+            const T *A, my_size_t N, my_size_t K_len, my_size_t strideA,
+            const T *B, my_size_t strideB,
+            T *C, my_size_t strideC,
+            const Ep &ep = Ep{}) noexcept
+        {
+            dispatch<Uplo, TransA, TransB>(A, N, K_len, strideA, B, N, strideB, C, strideC, ep);
+        }
+
+        /**
+         * @brief Symmetric rank-k product: one triangle of C = A·Aᵀ (or Aᵀ·A).
+         *
+         * @tparam TransA false: A is stored N × K and C = A·Aᵀ.
+         *                true:  A is stored K × N and C = Aᵀ·A.
+         * @param N       Order of C
+         * @param K_len   Rank of the update
+         */
+        template <GemmUplo Uplo, bool TransA = false, typename Ep = GemmEpilogue<T>>
+        static void syrk(
+            const T *A, my_size_t N, my_size_t K_len, my_size_t strideA,
+            T *C, my_size_t strideC,
+            const Ep &ep = Ep{}) noexcept
+        {
+            dispatch<Uplo, TransA, !TransA>(A, N, K_len, strideA, A, N, strideA, C, strideC, ep);
+        }
+
+        /**
+         * @brief Mirror the @p Uplo triangle of C[N,N] onto the other one.
+         *
+         * Overwrites the strictly opposite triangle, including any entries a
+         * gemmt() diagonal tile wrote there.
+         */
+        template <GemmUplo Uplo>
+        static void symmetrize(T *C, my_size_t N, my_size_t strideC) noexcept
+        {
+            static_assert(Uplo != GemmUplo::Full, "symmetrize needs a source triangle");
+            for (my_size_t i = 0; i < N; ++i)
+                for (my_size_t j = i + 1; j < N; ++j)
+                {
+                    if constexpr (Uplo == GemmUplo::Lower)
+                        C[i * strideC + j] = C[j * strideC + i];
+                    else
+                        C[j * strideC + i] = C[i * strideC + j];
+                }
+        }
+
+        /**
+         * @brief Fully unrolled GEMM for compile-time extents ≤ SMALL_DIM_MAX.
+         *
+         * Keeps all of C in registers (see @ref small). Same operand
+         * conventions as gemm(); with padded storage B's stored rows (B not
+         * transposed) must be padded to a multiple of simdWidth, as every
+         * FusedTensorND row is.
+         */
+        template <my_size_t M, my_size_t K_len, my_size_t N,
+                  bool TransA = false, bool TransB = false, typename Ep = GemmEpilogue<T>>
+        FORCE_INLINE static void gemm_small(
+            const T *A, my_size_t strideA,
+            const T *B, my_size_t strideB,
+            T *C, my_size_t strideC,
+            const Ep &ep = Ep{}) noexcept
+        {
+            static_assert(M >= 1 && K_len >= 1 && N >= 1 &&
+                              M <= SMALL_DIM_MAX && K_len <= SMALL_DIM_MAX && N <= SMALL_DIM_MAX,
+                          "gemm_small handles extents 1..SMALL_DIM_MAX");
+
+            if constexpr (Helpers::PairMac)
+            {
+                pair_gemm<GemmUplo::Full, TransA, TransB>(A, M, K_len, strideA, B, N, strideB,
+                                                          [&](my_size_t i, my_size_t j, T v) FORCE_INLINE_LAMBDA
+                                                          { store_scalar(ep, C + i * strideC + j, v, i, j); });
+                return;
+            }
+
+            constexpr my_size_t NV = (N + simdWidth - 1) / simdWidth;
+            constexpr my_size_t NV_FULL = N / simdWidth;
+            constexpr my_size_t ldb = NV * simdWidth;
+            using Rows = typename make_index_seq<M>::type;
+            using Vecs = typename make_index_seq<NV>::type;
+            using Full = typename make_index_seq<NV_FULL>::type;
+
+            // B rows as aligned vectors: in place, or Bᵀ staged locally
+            alignas(Bits / 8) T Bs[TransB ? K_len * ldb : 1] = {};
+            const T *Bv = B;
+            my_size_t ldbv = strideB;
+            if constexpr (TransB)
+            {
+                for (my_size_t j = 0; j < N; ++j)
+                    for (my_size_t k = 0; k < K_len; ++k)
+                        Bs[k * ldb + j] = B[j * strideB + k];
+                Bv = Bs;
+                ldbv = ldb;
+            }
+
+            typename K::VecType acc[M][NV];
+            unroll(Rows{}, [&](my_size_t i) FORCE_INLINE_LAMBDA
+                   { unroll(Vecs{}, [&](my_size_t v) FORCE_INLINE_LAMBDA
+                            { acc[i][v] = K::set1(T{0}); }); });
+
+            unroll(typename make_index_seq<K_len>::type{}, [&](my_size_t k) FORCE_INLINE_LAMBDA
+                   {
+                       typename K::VecType b[NV];
+                       unroll(Vecs{}, [&](my_size_t v) FORCE_INLINE_LAMBDA
+                              {
+                                  const T *row = Bv + k * ldbv + v * simdWidth;
+                                  if constexpr (TransB || Helpers::AlignedRows)
+                                      b[v] = K::load(row);
+                                  else if (v < NV_FULL)
+                                      b[v] = K::loadu(row);
+                                  else
+                                      b[v] = K::maskload(row, N - NV_FULL * simdWidth); });
+                       unroll(Rows{}, [&](my_size_t i) FORCE_INLINE_LAMBDA
+                              {
+                                  auto a = K::set1(A[a_offset<TransA>(strideA, i, k)]);
+                                  unroll(Vecs{}, [&](my_size_t v) FORCE_INLINE_LAMBDA
+                                         { acc[i][v] = Helpers::fmadd_safe(a, b[v], acc[i][v]); });
+                              }); });
+
+            unroll(Rows{}, [&](my_size_t i) FORCE_INLINE_LAMBDA
+                   {
+                       unroll(Full{}, [&](my_size_t v) FORCE_INLINE_LAMBDA
+                              { store_vec(ep, C + i * strideC + v * simdWidth, acc[i][v], i, v * simdWidth); });
+
+                       if constexpr (NV != NV_FULL)
+                       {
+                           constexpr my_size_t j = NV_FULL * simdWidth;
+                           store_partial(ep, C + i * strideC + j, acc[i][NV_FULL], N - j, i, j);
+                       } });
+        }
+
+        /**
+         * @brief Matrix-vector product: y[M] = A[M,K] × x[K]
+         *
+         * The N = 1 case of gemm() (see @ref gemv). A not transposed is
+         * swept in dot form, GEMV_ROWS rows against each x vector; TransA
+         * (A stored K × M) in axpy form, GEMV_VECS vectors of y per pass.
+         *
+         * @tparam TransA A is stored K × M
+         * @tparam RowY   y is the row of a 1 × M result, so the epilogue sees
+         *                (0, i); otherwise the column of an M × 1 one, (i, 0)
+         * @param A       Pointer to first element of A; stored rows aligned
+         *                and padded to a multiple of simdWidth, as in FusedTensorND
+         *                (any stride under TESSERACT_NO_PADDING)
+         * @param M       Length of y (rows of A)
+         * @param K_len   Length of x (columns of A)
+         * @param strideA Physical row stride of A as stored
+         * @param x       Pointer to x[0]; aligned when incx == 1
+         * @param incx    Physical distance between x[k] and x[k+1]
+         * @param y       Pointer to y[0] (output); aligned when RowY
+         * @param incy    Physical distance between y[i] and y[i+1] (1 when RowY)
+         * @param ep      Epilogue applied at store time
+         */
+        template <bool TransA = false, bool RowY = false, typename Ep = GemmEpilogue<T>>
+        FORCE_INLINE static void gemv(
+            const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
+            const T *x, my_size_t incx,
+            T *y, my_size_t incy,
+            const Ep &ep = Ep{}) noexcept
         {
-            // Column boundaries for the three-pass tiling:
-            //   [0, wide_N)    → wide micro-kernel   (steps of NR)
-            //   [wide_N, narrow_N) → narrow micro-kernel (steps of simdWidth)
-            //   [narrow_N, N)  → scalar column loop   (steps of 1)
-            const my_size_t wide_N = (N / NR) * NR;
-            const my_size_t narrow_N = (N / simdWidth) * simdWidth;
+            if constexpr (Helpers::PairMac)
+            {
+                // x is B's only column, B(k, 0) = x[k·incx]
+                pair_gemm<GemmUplo::Full, TransA, false>(A, M, K_len, strideA, x, 1, incx,
+                                                         [&](my_size_t i, my_size_t, T v) FORCE_INLINE_LAMBDA
+                                                         { gemv_store<RowY>(ep, y + i * incy, v, i); });
+                return;
+            }
+
+            if constexpr (TransA)
+            {
+                my_size_t i = 0;
+                for (; i + GEMV_VECS * simdWidth <= M; i += GEMV_VECS * simdWidth)
+                    gemv_axpy<GEMV_VECS, RowY>(A + i, strideA, K_len, x, incx, y + i * incy, incy, GEMV_VECS * simdWidth, ep, i);
+                for (; i + simdWidth <= M; i += simdWidth)
+                    gemv_axpy<1, RowY>(A + i, strideA, K_len, x, incx, y + i * incy, incy, simdWidth, ep, i);
+                if (i < M)
+                    gemv_axpy<1, RowY, true>(A + i, strideA, K_len, x, incx, y + i * incy, incy, M - i, ep, i);
+            }
+            else
+            {
+                // A column-vector x is strided by its padded row: make it contiguous once
+                alignas(Bits / 8) T xs[simdWidth > 1 ? GEMV_STAGE : 1];
+                if (simdWidth > 1 && incx != 1 && K_len <= GEMV_STAGE)
+                {
+                    for (my_size_t k = 0; k < K_len; ++k)
+                        xs[k] = x[k * incx];
+                    x = xs;
+                    incx = 1;
+                }
+
+                my_size_t i = 0;
+                for (; i + GEMV_ROWS <= M; i += GEMV_ROWS)
+                    gemv_dot<GEMV_ROWS, RowY>(A + i * strideA, strideA, K_len, x, incx, y + i * incy, incy, ep, i);
+                for (; i + GEMV_ROWS / 2 <= M; i += GEMV_ROWS / 2)
+                    gemv_dot<GEMV_ROWS / 2, RowY>(A + i * strideA, strideA, K_len, x, incx, y + i * incy, incy, ep, i);
+                for (; i < M; ++i)
+                    gemv_dot<1, RowY>(A + i * strideA, strideA, K_len, x, incx, y + i * incy, incy, ep, i);
+            }
+        }
+
+        /**
+         * @brief Register-blocked GEMM: C[M,N] = A[M,K] × B[K,N]
+         *
+         * Tiles the output matrix and routes each tile to the appropriate
+         * micro-kernel based on its position. Operands are read in place.
+         *
+         * Parameters are identical to gemm(). With TransB and simdWidth > 1,
+         * B vectors are gathered; gemm() avoids that by staging Bᵀ first.
+         */
+        template <bool TransA = false, bool TransB = false, typename Ep = GemmEpilogue<T>>
+        static void gemm_register_blocked(
+            const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
+            const T *B, my_size_t N, my_size_t strideB,
+            T *C, my_size_t strideC,
+            const Ep &ep = Ep{}) noexcept
+        {
+            register_blocked<GemmUplo::Full, TransA, TransB>(A, M, K_len, strideA, B, N, strideB, C, strideC, ep);
+        }
+
+        /**
+         * @brief Cache-blocked, panel-packed GEMM: C[M,N] = A[M,K] × B[K,N]
+         *
+         * Five-loop BLIS nest (see @ref cache_blocking). Packing buffers are
+         * static thread-local storage sized MC × KC and KC × NC, so the
+         * routine is reentrant across threads and never allocates.
+         *
+         * When a ParallelExecutor is registered and M·N·K reaches its
+         * threshold, each packed B block is shared and the ic loop is
+         * distributed across the executor (see parallel_macro_kernel()).
+         *
+         * The epilogue's merge step runs on every K block and its finish
+         * step (addend, op) only on the last one.
+         *
+         * Parameters are identical to gemm(). Requires KC != 0.
+         */
+        template <bool TransA = false, bool TransB = false, typename Ep = GemmEpilogue<T>>
+        static void gemm_packed(
+            const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
+            const T *B, my_size_t N, my_size_t strideB,
+            T *C, my_size_t strideC,
+            const Ep &ep = Ep{}) noexcept
+        {
+            packed<GemmUplo::Full, TransA, TransB>(A, M, K_len, strideA, B, N, strideB, C, strideC, ep);
+        }
+
+    private:
+        template <typename, my_size_t, typename>
+        friend struct KernelGemm;
+
+        /**
+         * @brief Shared entry of gemm() / gemmt() / syrk().
+         *
+         * Runs route() on the kernel family runtime_dispatch() picks: this
+         * one, or with TESSERACT_RUNTIME_DISPATCH the widest the CPU has.
+         */
+        template <GemmUplo Uplo, bool TransA, bool TransB, typename Ep>
+        static void dispatch(
+            const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
+            const T *B, my_size_t N, my_size_t strideB,
+            T *C, my_size_t strideC,
+            const Ep &ep) noexcept
+        {
+            runtime_dispatch<T, Bits, Arch>([&]<my_size_t DBits, typename DArch>()
+                                            { KernelGemm<T, DBits, DArch>::template route<Uplo, TransA, TransB>(
+                                                  A, M, K_len, strideA, B, N, strideB, C, strideC, ep); });
+        }
+
+        /// Pick the packed or register path.
+        template <GemmUplo Uplo, bool TransA, bool TransB, typename Ep>
+        static void route(
+            const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
+            const T *B, my_size_t N, my_size_t strideB,
+            T *C, my_size_t strideC,
+            const Ep &ep) noexcept
+        {
+            if constexpr (KC != 0)
+            {
+                // The parallel split lives in the packed path: take it for any
+                // product the registered executor accepts, even below PACK_MIN_VOLUME
+                if (M * N * K_len >= PACK_MIN_VOLUME || ParallelContext::executor_for(M * N * K_len) != nullptr)
+                {
+                    packed<Uplo, TransA, TransB>(A, M, K_len, strideA, B, N, strideB, C, strideC, ep);
+                    return;
+                }
+
+                if constexpr (TransB && simdWidth > 1)
+                {
+                    // Stage Bᵀ row-major in the B packing buffer so the
+                    // register kernels can load B rows as vectors.
+                    const my_size_t ldb = round_up(N, simdWidth);
+                    if (K_len * ldb <= KC * NC)
+                    {
+                        T *Bs = packed_b_buffer();
+                        transpose_b(B, strideB, K_len, N, Bs, ldb);
+                        register_blocked<Uplo, TransA, false>(A, M, K_len, strideA, Bs, N, ldb, C, strideC, ep);
+                    }
+                    else
+                    {
+                        packed<Uplo, TransA, TransB>(A, M, K_len, strideA, B, N, strideB, C, strideC, ep);
+                    }
+                    return;
+                }
+            }
+            register_blocked<Uplo, TransA, TransB>(A, M, K_len, strideA, B, N, strideB, C, strideC, ep);
+        }
+
+        /**
+         * @brief Columns [j0, j1) of C computed for the row band [i, i + rows).
+         *
+         * j0 stays a multiple of simdWidth so C tiles remain aligned.
+         */
+        template <GemmUplo Uplo>
+        FORCE_INLINE static void column_range(
+            my_size_t i, my_size_t rows, my_size_t N,
+            my_size_t &j0, my_size_t &j1) noexcept
+        {
+            j0 = 0;
+            j1 = N;
+            if constexpr (Uplo == GemmUplo::Lower)
+                j1 = (i + rows < N) ? i + rows : N;
+            else if constexpr (Uplo == GemmUplo::Upper)
+                j0 = (i / simdWidth) * simdWidth;
+        }
+
+        /// Tile [i, i+rows) × [j, j+cols) lies entirely outside the Uplo triangle.
+        template <GemmUplo Uplo>
+        FORCE_INLINE static constexpr bool outside(
+            my_size_t i, my_size_t rows, my_size_t j, my_size_t cols) noexcept
+        {
+            if constexpr (Uplo == GemmUplo::Lower)
+                return j >= i + rows;
+            else if constexpr (Uplo == GemmUplo::Upper)
+                return j + cols <= i;
+            else
+                return false;
+        }
+
+        template <GemmUplo Uplo, bool TransA, bool TransB, typename Ep>
+        static void register_blocked(
+            const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
+            const T *B, my_size_t N, my_size_t strideB,
+            T *C, my_size_t strideC,
+            const Ep &ep) noexcept
+        {
+            if constexpr (Helpers::PairMac)
+            {
+                pair_gemm<Uplo, TransA, TransB>(A, M, K_len, strideA, B, N, strideB,
+                                                [&](my_size_t i, my_size_t j, T v) FORCE_INLINE_LAMBDA
+                                                { store_scalar(ep, C + i * strideC + j, v, i, j); });
+                return;
+            }
+
+            // Column passes over each row band's range [j0, j1):
+            //   wide micro-kernel   (steps of NR)
+            //   narrow micro-kernel (steps of simdWidth)
+            //   partial narrow tile (the last j1 - j < simdWidth columns)
+            my_size_t j0, j1;
 
             // ==============================================================
             // Main body: MR rows at a time
@@ -162,33 +724,34 @@ namespace detail
             my_size_t i = 0;
             for (; i + MR <= M; i += MR)
             {
-                my_size_t j = 0;
+                column_range<Uplo>(i, MR, N, j0, j1);
+                my_size_t j = j0;
 
-                for (; j < wide_N; j += NR)
+                for (; j + NR <= j1; j += NR)
                 {
-                    micro_kernel_wide(
-                        A + i * strideA, strideA,
-                        B + j, strideB,
+                    micro_kernel_wide<TransA, TransB>(
+                        A + a_offset<TransA>(strideA, i, 0), strideA,
+                        B + b_offset<TransB>(strideB, 0, j), strideB,
                         C + i * strideC + j, strideC,
-                        K_len);
+                        K_len, ep, i, j);
                 }
 
-                for (; j < narrow_N; j += simdWidth)
+                for (; j + simdWidth <= j1; j += simdWidth)
                 {
-                    micro_kernel_narrow(
-                        A + i * strideA, strideA,
-                        B + j, strideB,
+                    micro_kernel_narrow<TransA, TransB>(
+                        A + a_offset<TransA>(strideA, i, 0), strideA,
+                        B + b_offset<TransB>(strideB, 0, j), strideB,
                         C + i * strideC + j, strideC,
-                        K_len);
+                        K_len, ep, i, j);
                 }
 
-                for (; j < N; ++j)
+                if (j < j1)
                 {
-                    scalar_column_MR(
-                        A + i * strideA, strideA,
-                        B + j, strideB,
+                    micro_kernel_narrow<TransA, TransB, true>(
+                        A + a_offset<TransA>(strideA, i, 0), strideA,
+                        B + b_offset<TransB>(strideB, 0, j), strideB,
                         C + i * strideC + j, strideC,
-                        K_len);
+                        K_len, ep, i, j, j1 - j);
                 }
             }
 
@@ -198,37 +761,575 @@ namespace detail
             // ==============================================================
             for (; i < M; ++i)
             {
-                my_size_t j = 0;
+                column_range<Uplo>(i, 1, N, j0, j1);
+                my_size_t j = j0;
 
-                for (; j < wide_N; j += NR)
+                for (; j + NR <= j1; j += NR)
                 {
-                    single_row_wide(
-                        A + i * strideA,
-                        B + j, strideB,
+                    single_row_wide<TransA, TransB>(
+                        A + a_offset<TransA>(strideA, i, 0), strideA,
+                        B + b_offset<TransB>(strideB, 0, j), strideB,
                         C + i * strideC + j,
-                        K_len);
+                        K_len, ep, i, j);
                 }
 
-                for (; j < narrow_N; j += simdWidth)
+                for (; j + simdWidth <= j1; j += simdWidth)
                 {
-                    single_row_narrow(
-                        A + i * strideA,
-                        B + j, strideB,
+                    single_row_narrow<TransA, TransB>(
+                        A + a_offset<TransA>(strideA, i, 0), strideA,
+                        B + b_offset<TransB>(strideB, 0, j), strideB,
                         C + i * strideC + j,
-                        K_len);
+                        K_len, ep, i, j);
                 }
 
-                for (; j < N; ++j)
+                if (j < j1)
                 {
-                    T sum = T{0};
-                    for (my_size_t k = 0; k < K_len; ++k)
-                        sum += A[i * strideA + k] * B[k * strideB + j];
-                    C[i * strideC + j] = sum;
+                    single_row_narrow<TransA, TransB, true>(
+                        A + a_offset<TransA>(strideA, i, 0), strideA,
+                        B + b_offset<TransB>(strideB, 0, j), strideB,
+                        C + i * strideC + j,
+                        K_len, ep, i, j, j1 - j);
                 }
             }
         }
 
-    private:
+        template <GemmUplo Uplo, bool TransA, bool TransB, typename Ep>
+        static void packed(
+            const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
+            const T *B, my_size_t N, my_size_t strideB,
+            T *C, my_size_t strideC,
+            const Ep &ep) noexcept
+        {
+            static_assert(KC != 0, "gemm_packed requires cache-blocking constants (KC/MC/NC)");
+
+            ParallelExecutor *executor = ParallelContext::executor_for(M * N * K_len);
+
+            T *Bp = packed_b_buffer();
+
+            for (my_size_t jc = 0; jc < N; jc += NC)
+            {
+                const my_size_t nc = (N - jc < NC) ? N - jc : NC;
+
+                for (my_size_t pc = 0; pc < K_len; pc += KC)
+                {
+                    const my_size_t kc = (K_len - pc < KC) ? K_len - pc : KC;
+                    const BlockPos pos{0, jc, pc == 0, pc + kc >= K_len};
+
+                    pack_b<TransB>(B + b_offset<TransB>(strideB, pc, jc), strideB, kc, nc, Bp);
+
+                    if (executor != nullptr)
+                    {
+                        parallel_macro_kernel<Uplo, TransA>(*executor, A + a_offset<TransA>(strideA, 0, pc), strideA, M,
+                                                      Bp, nc, kc, C + jc, strideC, ep, pos);
+                        continue;
+                    }
+
+                    T *Ap = packed_a_buffer();
+                    for (my_size_t ic = 0; ic < M; ic += MC)
+                    {
+                        const my_size_t mc = (M - ic < MC) ? M - ic : MC;
+                        if (outside<Uplo>(ic, mc, jc, nc))
+                            continue;
+
+                        pack_a<TransA>(A + a_offset<TransA>(strideA, ic, pc), strideA, mc, kc, Ap);
+
+                        macro_kernel<Uplo>(Ap, Bp, mc, nc, kc,
+                                     C + ic * strideC + jc, strideC,
+                                     ep, BlockPos{ic, jc, pos.first, pos.last});
+                    }
+                }
+            }
+        }
+
+        // ====================================================================
+        // Packed path
+        // ====================================================================
+
+        /// Origin of a macro block in C plus its position along K.
+        struct BlockPos
+        {
+            my_size_t i0;
+            my_size_t j0;
+            bool first; ///< First K block: C holds caller data
+            bool last;  ///< Last K block: apply the epilogue's finish step
+        };
+
+        /**
+         * @brief A thread's packing buffers, allocated on first use.
+         *
+         * Heap blocks behind a thread_local pointer pair rather than
+         * thread_local arrays: MC·KC + KC·NC elements (about 2 MB for
+         * float on AVX-512) would otherwise sit in the static TLS block
+         * of every thread, and a library loaded with dlopen() cannot
+         * always get a TLS segment that size. Freed at thread exit.
+         */
+        struct PackBuffers
+        {
+            T *a = nullptr; ///< MC × KC, the packed A block
+            T *b = nullptr; ///< KC × NC, the packed B block
+
+            ~PackBuffers()
+            {
+                std::free(a);
+                std::free(b);
+            }
+        };
+
+        FORCE_INLINE static PackBuffers &pack_buffers() noexcept
+        {
+            static thread_local PackBuffers buffers;
+            return buffers;
+        }
+
+        /// Aligned heap block of n elements; allocation failure is an error.
+        static T *allocate_panel(my_size_t n) noexcept
+        {
+            constexpr my_size_t align = Bits / 8;
+            void *p = std::aligned_alloc(align, round_up(n * sizeof(T), align));
+            if (p == nullptr)
+                MyErrorHandler::error("KernelGemm: cannot allocate packing buffers");
+            return static_cast<T *>(p);
+        }
+
+        /// This thread's MC × KC buffer holding the packed A block.
+        FORCE_INLINE static T *packed_a_buffer() noexcept
+        {
+            T *&buf = pack_buffers().a;
+            if (buf == nullptr) [[unlikely]]
+                buf = allocate_panel(MC * KC);
+            return buf;
+        }
+
+        /// This thread's KC × NC buffer holding the packed B block.
+        FORCE_INLINE static T *packed_b_buffer() noexcept
+        {
+            T *&buf = pack_buffers().b;
+            if (buf == nullptr) [[unlikely]]
+                buf = allocate_panel(KC * NC);
+            return buf;
+        }
+
+        /**
+         * @brief Pack an mc × kc block of A into MR-row micro-panels.
+         *
+         *   A block (row-major, strideA)      Ap (panel p, k-major)
+         *   [a00 a01 a02 ..]                  [a00 a10 a20 a30 | a01 a11 a21 a31 | ..]
+         *   [a10 a11 a12 ..]        →          ^^^^^^^^^^^^^^^   k=0
+         *   [a20 a21 a22 ..]
+         *   [a30 a31 a32 ..]
+         *
+         * With TransA the block is stored k-major already, so each panel
+         * step is a contiguous MR-element copy. Rows past mc in the last
+         * panel are zero-filled.
+         */
+        template <bool TransA>
+        FORCE_INLINE static void pack_a(
+            const T *A, my_size_t strideA,
+            my_size_t mc, my_size_t kc, T *Ap) noexcept
+        {
+            for (my_size_t ir = 0; ir < mc; ir += MR)
+            {
+                const my_size_t mr = (mc - ir < MR) ? mc - ir : MR;
+                const T *src = A + a_offset<TransA>(strideA, ir, 0);
+
+                if (mr == MR)
+                {
+                    for (my_size_t k = 0; k < kc; ++k)
+                        for (my_size_t r = 0; r < MR; ++r)
+                            Ap[k * MR + r] = src[a_offset<TransA>(strideA, r, k)];
+                }
+                else
+                {
+                    for (my_size_t k = 0; k < kc; ++k)
+                        for (my_size_t r = 0; r < MR; ++r)
+                            Ap[k * MR + r] = (r < mr) ? src[a_offset<TransA>(strideA, r, k)] : T{0};
+                }
+                Ap += MR * kc;
+            }
+        }
+
+        /**
+         * @brief Pack a kc × nc block of B into NR-column micro-panels.
+         *
+         *   B block (row-major, strideB)      Bp (panel q, k-major)
+         *   [b00 b01 .. b0,NR-1 | b0,NR ..]   [b00 b01 .. b0,NR-1 | b10 b11 .. | ..]
+         *   [b10 b11 .. b1,NR-1 | b1,NR ..]    ^^^^^^^^^^^^^^^^^^   k=0
+         *
+         * Full panels are copied with aligned SIMD loads (jc is a multiple of NR
+         * and strideB a multiple of simdWidth). With TransB each panel column
+         * is a contiguous run of the stored rows and is copied k by k.
+         * Columns past nc are zero-filled.
+         */
+        template <bool TransB>
+        FORCE_INLINE static void pack_b(
+            const T *B, my_size_t strideB,
+            my_size_t kc, my_size_t nc, T *Bp) noexcept
+        {
+            for (my_size_t jr = 0; jr < nc; jr += NR)
+            {
+                const my_size_t nr = (nc - jr < NR) ? nc - jr : NR;
+                const T *src = B + b_offset<TransB>(strideB, 0, jr);
+
+                if constexpr (TransB)
+                {
+                    for (my_size_t c = 0; c < NR; ++c)
+                    {
+                        if (c < nr)
+                            for (my_size_t k = 0; k < kc; ++k)
+                                Bp[k * NR + c] = src[c * strideB + k];
+                        else
+                            for (my_size_t k = 0; k < kc; ++k)
+                                Bp[k * NR + c] = T{0};
+                    }
+                }
+                else if (nr == NR)
+                {
+                    for (my_size_t k = 0; k < kc; ++k)
+                        for (my_size_t v = 0; v < NR_VECS; ++v)
+                            K::store(Bp + k * NR + v * simdWidth,
+                                     Helpers::load_row(src + k * strideB + v * simdWidth));
+                }
+                else
+                {
+                    for (my_size_t k = 0; k < kc; ++k)
+                        for (my_size_t c = 0; c < NR; ++c)
+                            Bp[k * NR + c] = (c < nr) ? src[k * strideB + c] : T{0};
+                }
+                Bp += NR * kc;
+            }
+        }
+
+        /**
+         * @brief Copy a transposed B (stored N × K) into row-major K × N at Bs.
+         *
+         * Walks the stored rows contiguously; ldb is a multiple of simdWidth
+         * so the register kernels' aligned loads stay valid.
+         */
+        FORCE_INLINE static void transpose_b(
+            const T *B, my_size_t strideB,
+            my_size_t K_len, my_size_t N, T *Bs, my_size_t ldb) noexcept
+        {
+            for (my_size_t j = 0; j < N; ++j)
+            {
+                const T *row = B + j * strideB;
+                for (my_size_t k = 0; k < K_len; ++k)
+                    Bs[k * ldb + j] = row[k];
+            }
+        }
+
+        /// Offset of A(i, k) in A as stored.
+        template <bool TransA>
+        FORCE_INLINE static constexpr my_size_t a_offset(my_size_t strideA, my_size_t i, my_size_t k) noexcept
+        {
+            return TransA ? k * strideA + i : i * strideA + k;
+        }
+
+        /// Offset of B(k, j) in B as stored.
+        template <bool TransB>
+        FORCE_INLINE static constexpr my_size_t b_offset(my_size_t strideB, my_size_t k, my_size_t j) noexcept
+        {
+            return TransB ? j * strideB + k : k * strideB + j;
+        }
+
+        /// simdWidth consecutive columns B(k, j..j+simdWidth-1); B points at B(0, j).
+        template <bool TransB>
+        FORCE_INLINE static typename K::VecType load_b(const T *B, my_size_t strideB, my_size_t k) noexcept
+        {
+            if constexpr (!TransB)
+            {
+                return Helpers::load_row(B + k * strideB);
+            }
+            else if constexpr (simdWidth == 1)
+            {
+                return K::load(B + k);
+            }
+            else
+            {
+                my_size_t idx[simdWidth];
+                for (my_size_t l = 0; l < simdWidth; ++l)
+                    idx[l] = l * strideB + k;
+                return K::gather(B, idx);
+            }
+        }
+
+        /// First n < simdWidth columns B(k, j..j+n-1) as a partial vector; other lanes are discarded at the store.
+        template <bool TransB>
+        FORCE_INLINE static typename K::VecType load_b_partial(
+            const T *B, my_size_t strideB, my_size_t k, my_size_t n) noexcept
+        {
+            if constexpr (!TransB)
+            {
+                if constexpr (Helpers::AlignedRows)
+                    return K::load(B + k * strideB); // padding lanes are allocated
+                else
+                    return K::maskload(B + k * strideB, n);
+            }
+            else
+            {
+                // Rows j+n.. of a stored-transposed B may not exist: dead lanes re-read B(k, j)
+                my_size_t idx[simdWidth];
+                for (my_size_t l = 0; l < simdWidth; ++l)
+                    idx[l] = (l < n ? l * strideB : 0) + k;
+                return K::gather(B, idx);
+            }
+        }
+
+        /// Shared state for one parallel (KC × NC) step; tasks index (row band, column chunk).
+        template <typename Ep>
+        struct ParallelBlock
+        {
+            const T *A;
+            my_size_t strideA;
+            my_size_t M;
+            const T *Bp;
+            my_size_t kc;
+            T *C;
+            my_size_t strideC;
+            const Ep *ep;
+            BlockPos pos;
+            my_size_t band;  ///< Rows per task (multiple of MR, ≤ MC)
+            my_size_t chunk; ///< Columns per task (multiple of NR)
+            my_size_t nc;
+            my_size_t n_col; ///< Column chunks per row band
+        };
+
+        /**
+         * @brief Partition one packed B block across an executor.
+         *
+         * The output block C[0:M, 0:nc] is split into row bands (≤ MC rows,
+         * multiples of MR) and, when there are fewer bands than workers,
+         * column chunks (multiples of NR). Each task packs its own A band
+         * into its thread-local buffer and runs macro_kernel on its tile of
+         * C, reading the shared packed B block.
+         *
+         *        chunk 0     chunk 1
+         *      ┌───────────┬───────────┐
+         *   b0 │  task 0   │  task 1   │
+         *      ├───────────┼───────────┤
+         *   b1 │  task 2   │  task 3   │
+         *      └───────────┴───────────┘
+         *
+         * Every C element is owned by exactly one task and is computed with
+         * the same k order and the same micro-kernel as the serial path, so
+         * the result is bit-identical to it.
+         */
+        template <GemmUplo Uplo, bool TransA, typename Ep>
+        static void parallel_macro_kernel(
+            ParallelExecutor &executor,
+            const T *A, my_size_t strideA, my_size_t M,
+            const T *Bp, my_size_t nc, my_size_t kc,
+            T *C, my_size_t strideC,
+            const Ep &ep, BlockPos pos) noexcept
+        {
+            const my_size_t workers = executor.num_workers();
+
+            my_size_t band = round_up((M + workers - 1) / workers, MR);
+            if (band > MC)
+                band = MC;
+            const my_size_t n_bands = (M + band - 1) / band;
+
+            my_size_t n_col = (n_bands < workers) ? (workers + n_bands - 1) / n_bands : 1;
+            const my_size_t chunk = round_up((nc + n_col - 1) / n_col, NR);
+            n_col = (nc + chunk - 1) / chunk;
+
+            ParallelBlock<Ep> blk{A, strideA, M, Bp, kc, C, strideC, &ep, pos,
+                                  band, chunk, nc, n_col};
+
+            // Through ArchTarget so a runtime-dispatched Arch runs its tasks on its own target
+            executor.parallel_for(n_bands * n_col,
+                                  &ArchTarget<Arch>::template task<&parallel_block_task<Uplo, TransA, Ep>>, &blk);
+        }
+
+        template <GemmUplo Uplo, bool TransA, typename Ep>
+        static void parallel_block_task(void *ctx, my_size_t index) noexcept
+        {
+            ParallelContext::TaskScope scope;
+            const ParallelBlock<Ep> &blk = *static_cast<const ParallelBlock<Ep> *>(ctx);
+
+            const my_size_t ic = (index / blk.n_col) * blk.band;
+            const my_size_t j0 = (index % blk.n_col) * blk.chunk;
+            const my_size_t mc = (blk.M - ic < blk.band) ? blk.M - ic : blk.band;
+            const my_size_t ncw = (blk.nc - j0 < blk.chunk) ? blk.nc - j0 : blk.chunk;
+            if (outside<Uplo>(ic, mc, blk.pos.j0 + j0, ncw))
+                return;
+
+            T *Ap = packed_a_buffer();
+            pack_a<TransA>(blk.A + a_offset<TransA>(blk.strideA, ic, 0), blk.strideA, mc, blk.kc, Ap);
+
+            macro_kernel<Uplo>(Ap, blk.Bp + j0 * blk.kc, mc, ncw, blk.kc,
+                         blk.C + ic * blk.strideC + j0, blk.strideC,
+                         *blk.ep, BlockPos{ic, blk.pos.j0 + j0, blk.pos.first, blk.pos.last});
+        }
+
+        FORCE_INLINE static constexpr my_size_t round_up(my_size_t x, my_size_t m) noexcept
+        {
+            return ((x + m - 1) / m) * m;
+        }
+
+        /// Call f(0), f(1), …, f(N-1) as separate statements (compile-time unrolled).
+        template <my_size_t... Is, typename F>
+        FORCE_INLINE static void unroll(index_seq<Is...>, F &&f) noexcept
+        {
+            (f(Is), ...);
+        }
+
+        /**
+         * @brief Sweep the micro-kernel over one packed (MC × KC) × (KC × NC) block.
+         *
+         * Interior tiles write straight to C. Edge tiles (mr < MR or nr < NR)
+         * go through a scratch tile so padding columns and rows beyond M are
+         * never touched.
+         *
+         * Tiles entirely outside the Uplo triangle are skipped.
+         *
+         * @param pos Logical origin of this block in C (for the epilogue) and its K position
+         */
+        template <GemmUplo Uplo, typename Ep>
+        FORCE_INLINE static void macro_kernel(
+            const T *Ap, const T *Bp,
+            my_size_t mc, my_size_t nc, my_size_t kc,
+            T *C, my_size_t strideC,
+            const Ep &ep, BlockPos pos) noexcept
+        {
+            for (my_size_t jr = 0; jr < nc; jr += NR)
+            {
+                const my_size_t nr = (nc - jr < NR) ? nc - jr : NR;
+                const T *Bpanel = Bp + jr * kc;
+
+                for (my_size_t ir = 0; ir < mc; ir += MR)
+                {
+                    const my_size_t mr = (mc - ir < MR) ? mc - ir : MR;
+                    const T *Apanel = Ap + ir * kc;
+                    T *Ctile = C + ir * strideC + jr;
+                    const my_size_t i = pos.i0 + ir;
+                    const my_size_t j = pos.j0 + jr;
+                    if (outside<Uplo>(i, mr, j, nr))
+                        continue;
+
+                    if (mr == MR && nr == NR)
+                    {
+                        micro_kernel_packed(Apanel, Bpanel, kc, Ctile, strideC, ep, i, j, pos.first, pos.last);
+                    }
+                    else
+                    {
+                        alignas(Bits / 8) T tile[MR * NR];
+                        micro_kernel_packed(Apanel, Bpanel, kc, tile, NR, GemmEpilogue<T>{}, 0, 0, true, false);
+
+                        for (my_size_t r = 0; r < mr; ++r)
+                            for (my_size_t c = 0; c < nr; ++c)
+                            {
+                                T *dst = Ctile + r * strideC + c;
+                                T v = Epi::merge_scalar(ep, tile[r * NR + c], dst, pos.first);
+                                *dst = pos.last ? Epi::finish_scalar(ep, v, i + r, j + c) : v;
+                            }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Packed micro-kernel: MR × NR tile from contiguous panels.
+         *
+         * Same outer-product accumulation as micro_kernel_wide, but both
+         * operands advance with unit stride: MR scalars of Ap and NR_VECS
+         * vectors of Bp per k step. The accumulators are merged with C
+         * (first K block: alpha/beta; later blocks: add) and, on the last
+         * K block, finished by the epilogue before the store.
+         *
+         * @param Ap    Packed A micro-panel (kc × MR, k-major)
+         * @param Bp    Packed B micro-panel (kc × NR, k-major)
+         * @param kc    Panel depth
+         * @param C     Pointer to C[i, j] — output tile origin (aligned)
+         * @param strideC Row stride of C
+         * @param ep    Epilogue
+         * @param i, j  Logical coordinates of the tile origin in C
+         * @param first First K block
+         * @param last  Last K block
+         */
+        template <typename Ep>
+        FORCE_INLINE static void micro_kernel_packed(
+            const T *Ap, const T *Bp, my_size_t kc,
+            T *C, my_size_t strideC,
+            const Ep &ep, my_size_t i, my_size_t j,
+            bool first, bool last) noexcept
+        {
+            typename K::VecType acc[MR][NR_VECS];
+            for (my_size_t r = 0; r < MR; ++r)
+                for (my_size_t v = 0; v < NR_VECS; ++v)
+                    acc[r][v] = K::set1(T{0});
+
+            for (my_size_t k = 0; k < kc; ++k)
+            {
+                typename K::VecType b_vec[NR_VECS];
+                for (my_size_t v = 0; v < NR_VECS; ++v)
+                    b_vec[v] = K::load(Bp + v * simdWidth);
+
+                for (my_size_t r = 0; r < MR; ++r)
+                {
+                    auto a_bcast = K::set1(Ap[r]);
+                    for (my_size_t v = 0; v < NR_VECS; ++v)
+                        acc[r][v] = Helpers::fmadd_safe(a_bcast, b_vec[v], acc[r][v]);
+                }
+
+                Ap += MR;
+                Bp += NR;
+            }
+
+            for (my_size_t r = 0; r < MR; ++r)
+                for (my_size_t v = 0; v < NR_VECS; ++v)
+                {
+                    T *dst = C + r * strideC + v * simdWidth;
+                    auto out = Epi::merge(ep, acc[r][v], dst, first);
+                    if (last)
+                        out = Epi::finish(ep, out, i + r, j + v * simdWidth);
+                    Helpers::store_row(dst, out);
+                }
+        }
+
+        // ====================================================================
+        // Register-blocked path
+        // ====================================================================
+
+        /// Single-pass store of one SIMD vector: merge + finish, then store.
+        template <typename Ep>
+        FORCE_INLINE static void store_vec(
+            const Ep &ep, T *dst, typename K::VecType acc, my_size_t i, my_size_t j) noexcept
+        {
+            Helpers::store_row(dst, Epi::finish(ep, Epi::merge(ep, acc, dst, true), i, j));
+        }
+
+        /**
+         * @brief Single-pass store of the first n < simdWidth lanes of acc.
+         *
+         * The plain epilogue is one K::maskstore. Otherwise the lanes go
+         * through the scalar epilogue: its vector form would read C, the
+         * addend and the op input past column N.
+         */
+        template <typename Ep>
+        FORCE_INLINE static void store_partial(
+            const Ep &ep, T *dst, typename K::VecType acc, my_size_t n, my_size_t i, my_size_t j) noexcept
+        {
+            if constexpr (!Ep::IsScaled && !Ep::HasAddend && !Ep::HasOp)
+            {
+                K::maskstore(dst, acc, n);
+            }
+            else
+            {
+                alignas(Bits / 8) T lanes[simdWidth];
+                K::store(lanes, acc);
+                for (my_size_t l = 0; l < n; ++l)
+                    store_scalar(ep, dst + l, lanes[l], i, j + l);
+            }
+        }
+
+        /// Single-pass store of one scalar: merge + finish, then store.
+        template <typename Ep>
+        FORCE_INLINE static void store_scalar(
+            const Ep &ep, T *dst, T acc, my_size_t i, my_size_t j) noexcept
+        {
+            *dst = Epi::finish_scalar(ep, Epi::merge_scalar(ep, acc, dst, true), i, j);
+        }
+
         /**
          * @brief Wide micro-kernel: computes an MR × NR tile of C.
          *
@@ -241,7 +1342,7 @@ namespace detail
          *      b. For each of MR rows of A:
          *         - Broadcast A[row, k] into a SIMD register
          *         - FMA broadcast × each B vector into the row's accumulators
-         *   3. Store MR × NR_VECS accumulators to C
+         *   3. Apply the epilogue and store MR × NR_VECS accumulators to C
          *
          * Register allocation (example: AVX2 doubles, MR=4, NR_VECS=3):
          *   12 accumulators (acc[4][3])  + 3 B vectors + 1 A broadcast = 16 YMM
@@ -253,12 +1354,16 @@ namespace detail
          * @param C       Pointer to C[i, j] — output tile origin
          * @param strideC Row stride of C
          * @param K_len   Contraction length
+         * @param ep      Epilogue
+         * @param i, j    Logical coordinates of the tile origin in C
          */
+        template <bool TransA, bool TransB, typename Ep>
         FORCE_INLINE static void micro_kernel_wide(
             const T *A, my_size_t strideA,
             const T *B, my_size_t strideB,
             T *C, my_size_t strideC,
-            my_size_t K_len) noexcept
+            my_size_t K_len,
+            const Ep &ep, my_size_t i, my_size_t j) noexcept
         {
             // Step 1: zero accumulators
             typename K::VecType acc[MR][NR_VECS];
@@ -272,12 +1377,12 @@ namespace detail
                 // 2a: load NR_VECS contiguous vectors from B[k, j..j+NR-1]
                 typename K::VecType b_vec[NR_VECS];
                 for (my_size_t v = 0; v < NR_VECS; ++v)
-                    b_vec[v] = K::load(B + k * strideB + v * simdWidth);
+                    b_vec[v] = load_b<TransB>(B + b_offset<TransB>(strideB, 0, v * simdWidth), strideB, k);
 
                 // 2b: broadcast each A element and FMA into accumulators
                 for (my_size_t r = 0; r < MR; ++r)
                 {
-                    auto a_bcast = K::set1(A[r * strideA + k]);
+                    auto a_bcast = K::set1(A[a_offset<TransA>(strideA, r, k)]);
                     for (my_size_t v = 0; v < NR_VECS; ++v)
                         acc[r][v] = Helpers::fmadd_safe(a_bcast, b_vec[v], acc[r][v]);
                 }
@@ -286,7 +1391,7 @@ namespace detail
             // Step 3: store completed tile to C
             for (my_size_t r = 0; r < MR; ++r)
                 for (my_size_t v = 0; v < NR_VECS; ++v)
-                    K::store(C + r * strideC + v * simdWidth, acc[r][v]);
+                    store_vec(ep, C + r * strideC + v * simdWidth, acc[r][v], i + r, j + v * simdWidth);
         }
 
         /**
@@ -298,6 +1403,10 @@ namespace detail
          * Same algorithm as micro_kernel_wide but with NR_VECS=1: one B vector
          * loaded per k step, reused across MR rows.
          *
+         * Partial: the column tail (n < simdWidth columns left). B is loaded
+         * with load_b_partial and C written with store_partial, so the whole
+         * tail is still MR vector FMAs per k step.
+         *
          * @param A       Pointer to A[i, 0]
          * @param strideA Row stride of A
          * @param B       Pointer to B[0, j]
@@ -305,12 +1414,17 @@ namespace detail
          * @param C       Pointer to C[i, j]
          * @param strideC Row stride of C
          * @param K_len   Contraction length
+         * @param ep      Epilogue
+         * @param i, j    Logical coordinates of the tile origin in C
+         * @param n       Columns written (Partial only)
          */
+        template <bool TransA, bool TransB, bool Partial = false, typename Ep>
         FORCE_INLINE static void micro_kernel_narrow(
             const T *A, my_size_t strideA,
             const T *B, my_size_t strideB,
             T *C, my_size_t strideC,
-            my_size_t K_len) noexcept
+            my_size_t K_len,
+            const Ep &ep, my_size_t i, my_size_t j, my_size_t n = simdWidth) noexcept
         {
             typename K::VecType acc[MR];
             for (my_size_t r = 0; r < MR; ++r)
@@ -318,50 +1432,26 @@ namespace detail
 
             for (my_size_t k = 0; k < K_len; ++k)
             {
-                auto b_vec = K::load(B + k * strideB);
+                typename K::VecType b_vec;
+                if constexpr (Partial)
+                    b_vec = load_b_partial<TransB>(B, strideB, k, n);
+                else
+                    b_vec = load_b<TransB>(B, strideB, k);
 
                 for (my_size_t r = 0; r < MR; ++r)
                 {
-                    auto a_bcast = K::set1(A[r * strideA + k]);
+                    auto a_bcast = K::set1(A[a_offset<TransA>(strideA, r, k)]);
                     acc[r] = Helpers::fmadd_safe(a_bcast, b_vec, acc[r]);
                 }
             }
 
             for (my_size_t r = 0; r < MR; ++r)
-                K::store(C + r * strideC, acc[r]);
-        }
-
-        /**
-         * @brief Scalar column kernel: computes MR × 1 output elements.
-         *
-         * Handles the final columns when N is not a multiple of simdWidth.
-         * Still processes MR rows simultaneously to reuse the B scalar across rows.
-         *
-         * @param A       Pointer to A[i, 0]
-         * @param strideA Row stride of A
-         * @param B       Pointer to B[0, j] (single column)
-         * @param strideB Row stride of B
-         * @param C       Pointer to C[i, j] (single column)
-         * @param strideC Row stride of C
-         * @param K_len   Contraction length
-         */
-        FORCE_INLINE static void scalar_column_MR(
-            const T *A, my_size_t strideA,
-            const T *B, my_size_t strideB,
-            T *C, my_size_t strideC,
-            my_size_t K_len) noexcept
-        {
-            T acc[MR] = {};
-
-            for (my_size_t k = 0; k < K_len; ++k)
             {
-                T b_val = B[k * strideB];
-                for (my_size_t r = 0; r < MR; ++r)
-                    acc[r] += A[r * strideA + k] * b_val;
+                if constexpr (Partial)
+                    store_partial(ep, C + r * strideC, acc[r], n, i + r, j);
+                else
+                    store_vec(ep, C + r * strideC, acc[r], i + r, j);
             }
-
-            for (my_size_t r = 0; r < MR; ++r)
-                C[r * strideC] = acc[r];
         }
 
         /**
@@ -371,16 +1461,21 @@ namespace detail
          * Loads NR_VECS B vectors per k step, each multiplied by one A scalar.
          *
          * @param A       Pointer to A[i, 0] (single row)
+         * @param strideA Row stride of A
          * @param B       Pointer to B[0, j]
          * @param strideB Row stride of B
          * @param C       Pointer to C[i, j]
          * @param K_len   Contraction length
+         * @param ep      Epilogue
+         * @param i, j    Logical coordinates of the first output element in C
          */
+        template <bool TransA, bool TransB, typename Ep>
         FORCE_INLINE static void single_row_wide(
-            const T *A,
+            const T *A, my_size_t strideA,
             const T *B, my_size_t strideB,
             T *C,
-            my_size_t K_len) noexcept
+            my_size_t K_len,
+            const Ep &ep, my_size_t i, my_size_t j) noexcept
         {
             typename K::VecType acc[NR_VECS];
             for (my_size_t v = 0; v < NR_VECS; ++v)
@@ -388,46 +1483,286 @@ namespace detail
 
             for (my_size_t k = 0; k < K_len; ++k)
             {
-                auto a_bcast = K::set1(A[k]);
+                auto a_bcast = K::set1(A[a_offset<TransA>(strideA, 0, k)]);
                 for (my_size_t v = 0; v < NR_VECS; ++v)
-                    acc[v] = Helpers::fmadd_safe(a_bcast, K::load(B + k * strideB + v * simdWidth), acc[v]);
+                    acc[v] = Helpers::fmadd_safe(
+                        a_bcast, load_b<TransB>(B + b_offset<TransB>(strideB, 0, v * simdWidth), strideB, k), acc[v]);
             }
 
             for (my_size_t v = 0; v < NR_VECS; ++v)
-                K::store(C + v * simdWidth, acc[v]);
+                store_vec(ep, C + v * simdWidth, acc[v], i, j + v * simdWidth);
         }
 
         /**
          * @brief Single-row narrow kernel: computes 1 × simdWidth output elements.
          *
-         * Handles remainder rows across partial column spans (between wide
-         * and scalar regions). One B vector per k step, one A scalar.
+         * Handles remainder rows across the narrow column span and, with
+         * Partial, the column tail. One B vector per k step, one A scalar.
          *
          * @param A       Pointer to A[i, 0] (single row)
+         * @param strideA Row stride of A
          * @param B       Pointer to B[0, j]
          * @param strideB Row stride of B
          * @param C       Pointer to C[i, j]
          * @param K_len   Contraction length
+         * @param ep      Epilogue
+         * @param i, j    Logical coordinates of the first output element in C
+         * @param n       Columns written (Partial only)
          */
+        template <bool TransA, bool TransB, bool Partial = false, typename Ep>
         FORCE_INLINE static void single_row_narrow(
-            const T *A,
+            const T *A, my_size_t strideA,
             const T *B, my_size_t strideB,
             T *C,
-            my_size_t K_len) noexcept
+            my_size_t K_len,
+            const Ep &ep, my_size_t i, my_size_t j, my_size_t n = simdWidth) noexcept
         {
             typename K::VecType acc = K::set1(T{0});
 
             for (my_size_t k = 0; k < K_len; ++k)
             {
-                auto b_vec = K::load(B + k * strideB);
-                auto a_bcast = K::set1(A[k]);
+                typename K::VecType b_vec;
+                if constexpr (Partial)
+                    b_vec = load_b_partial<TransB>(B, strideB, k, n);
+                else
+                    b_vec = load_b<TransB>(B, strideB, k);
+                auto a_bcast = K::set1(A[a_offset<TransA>(strideA, 0, k)]);
                 acc = Helpers::fmadd_safe(a_bcast, b_vec, acc);
             }
 
-            K::store(C, acc);
+            if constexpr (Partial)
+                store_partial(ep, C, acc, n, i, j);
+            else
+                store_vec(ep, C, acc, i, j);
+        }
+
+        // ====================================================================
+        // Pair path (K::mac, see @ref pairs)
+        // ====================================================================
+
+        /// Elements k and k+1 of a fiber as one pair: a load in place when they are adjacent.
+        template <bool Adjacent>
+        FORCE_INLINE static typename K::VecType pair_at(const T *p, my_size_t step) noexcept
+        {
+            if constexpr (Adjacent)
+                return K::loadu(p);
+            else
+                return K::lanes(p[0], p[step]);
+        }
+
+        /**
+         * @brief R × C tile of C at (i, j), one 64-bit accumulator per element.
+         *
+         * @param A Pointer to A(i, 0)
+         * @param B Pointer to B(0, j)
+         * @param store store(i, j, value) for each element of the tile
+         */
+        template <my_size_t R, my_size_t C, bool TransA, bool TransB, typename Store>
+        FORCE_INLINE static void pair_tile(
+            const T *A, my_size_t strideA,
+            const T *B, my_size_t strideB,
+            my_size_t K_len, my_size_t i, my_size_t j, Store &store) noexcept
+        {
+            // Distances between consecutive k and between consecutive rows / columns
+            const my_size_t ka = TransA ? strideA : 1, ra = TransA ? 1 : strideA;
+            const my_size_t kb = TransB ? 1 : strideB, cb = TransB ? strideB : 1;
+
+            typename K::AccType acc[R][C] = {};
+            my_size_t k = 0;
+            for (; k + 2 <= K_len; k += 2)
+            {
+                typename K::VecType a[R], b[C];
+                for (my_size_t r = 0; r < R; ++r)
+                    a[r] = pair_at<!TransA>(A + r * ra + k * ka, ka);
+                for (my_size_t c = 0; c < C; ++c)
+                    b[c] = pair_at<TransB>(B + c * cb + k * kb, kb);
+                for (my_size_t r = 0; r < R; ++r)
+                    for (my_size_t c = 0; c < C; ++c)
+                        acc[r][c] = K::mac(acc[r][c], a[r], b[c]);
+            }
+
+            if (k < K_len)
+                for (my_size_t r = 0; r < R; ++r)
+                    for (my_size_t c = 0; c < C; ++c)
+                        acc[r][c] = K::mac(acc[r][c], K::lanes(A[r * ra + k * ka], T{}), K::lanes(B[c * cb + k * kb], T{}));
+
+            for (my_size_t r = 0; r < R; ++r)
+                for (my_size_t c = 0; c < C; ++c)
+                    store(i + r, j + c, K::round_acc(acc[r][c]));
+        }
+
+        /**
+         * @brief C = A × B (the Uplo part of it) in 2 × 2 pair tiles.
+         *
+         * Operands as for gemm(); each element goes to store(i, j, value).
+         */
+        template <GemmUplo Uplo, bool TransA, bool TransB, typename Store>
+        static void pair_gemm(
+            const T *A, my_size_t M, my_size_t K_len, my_size_t strideA,
+            const T *B, my_size_t N, my_size_t strideB,
+            Store &&store) noexcept
+        {
+            my_size_t j0, j1;
+            my_size_t i = 0;
+            for (; i < M; i += 2)
+            {
+                const my_size_t rows = (M - i < 2) ? 1 : 2;
+                column_range<Uplo>(i, rows, N, j0, j1);
+                const T *Ai = A + a_offset<TransA>(strideA, i, 0);
+                for (my_size_t j = j0; j < j1; j += 2)
+                {
+                    const T *Bj = B + b_offset<TransB>(strideB, 0, j);
+                    if (rows == 2 && j + 2 <= j1)
+                        pair_tile<2, 2, TransA, TransB>(Ai, strideA, Bj, strideB, K_len, i, j, store);
+                    else if (rows == 2)
+                        pair_tile<2, 1, TransA, TransB>(Ai, strideA, Bj, strideB, K_len, i, j, store);
+                    else if (j + 2 <= j1)
+                        pair_tile<1, 2, TransA, TransB>(Ai, strideA, Bj, strideB, K_len, i, j, store);
+                    else
+                        pair_tile<1, 1, TransA, TransB>(Ai, strideA, Bj, strideB, K_len, i, j, store);
+                }
+            }
+        }
+
+        // ====================================================================
+        // GEMV
+        // ====================================================================
+
+        /// Store y[i] through the epilogue at its logical C position.
+        template <bool RowY, typename Ep>
+        FORCE_INLINE static void gemv_store(const Ep &ep, T *dst, T acc, my_size_t i) noexcept
+        {
+            if constexpr (RowY)
+                store_scalar(ep, dst, acc, 0, i);
+            else
+                store_scalar(ep, dst, acc, i, 0);
+        }
+
+        /// x[k .. k+simdWidth) as one vector: a load when contiguous, else assembled once per pass.
+        FORCE_INLINE static typename K::VecType load_x(const T *x, my_size_t incx, my_size_t k) noexcept
+        {
+            if (incx == 1)
+                return Helpers::load_row(x + k);
+
+            alignas(Bits / 8) T lanes[simdWidth];
+            for (my_size_t l = 0; l < simdWidth; ++l)
+                lanes[l] = x[(k + l) * incx];
+            return K::load(lanes);
+        }
+
+        /**
+         * @brief Dot form: y[i .. i+R) = A[i .. i+R, :] · x
+         *
+         * R independent accumulators; each x vector is loaded once per pass
+         * and reused across the R rows. The K tail is one masked vector per
+         * row (dead lanes zero), folded in before the scalar horizontal sums.
+         */
+        template <my_size_t R, bool RowY, typename Ep>
+        FORCE_INLINE static void gemv_dot(
+            const T *A, my_size_t strideA, my_size_t K_len,
+            const T *x, my_size_t incx,
+            T *y, my_size_t incy,
+            const Ep &ep, my_size_t i) noexcept
+        {
+            const my_size_t K_vec = (K_len / simdWidth) * simdWidth;
+
+            typename K::VecType acc[R];
+            for (my_size_t r = 0; r < R; ++r)
+                acc[r] = K::set1(T{0});
+
+            for (my_size_t k = 0; k < K_vec; k += simdWidth)
+            {
+                auto xv = load_x(x, incx, k);
+                for (my_size_t r = 0; r < R; ++r)
+                    acc[r] = Helpers::fmadd_safe(Helpers::load_row(A + r * strideA + k), xv, acc[r]);
+            }
+
+            if (K_vec < K_len)
+            {
+                const my_size_t rem = K_len - K_vec;
+                typename K::VecType xv;
+                if (incx == 1)
+                {
+                    xv = K::maskload(x + K_vec, rem);
+                }
+                else
+                {
+                    alignas(Bits / 8) T lanes[simdWidth] = {};
+                    for (my_size_t l = 0; l < rem; ++l)
+                        lanes[l] = x[(K_vec + l) * incx];
+                    xv = K::load(lanes);
+                }
+                for (my_size_t r = 0; r < R; ++r)
+                    acc[r] = Helpers::fmadd_safe(K::maskload(A + r * strideA + K_vec, rem), xv, acc[r]);
+            }
+
+            alignas(Bits / 8) Acc lanes[simdWidth];
+            for (my_size_t r = 0; r < R; ++r)
+            {
+                K::store(lanes, acc[r]);
+                Acc sum = lanes[0];
+                for (my_size_t l = 1; l < simdWidth; ++l)
+                    sum += lanes[l];
+                gemv_store<RowY>(ep, y + r * incy, sum, i + r);
+            }
+        }
+
+        /**
+         * @brief Axpy form: y[i .. i+len) = Σₖ A(k, i .. i+len) · x[k], A stored K × M
+         *
+         * V vector accumulators run side by side over the whole of K.
+         * len < V·simdWidth only for the last, partial vector (Partial,
+         * V = 1): its padding lanes are loaded from A's padded rows (masked
+         * off when rows are unpadded) and discarded at the store.
+         */
+        template <my_size_t V, bool RowY, bool Partial = false, typename Ep>
+        FORCE_INLINE static void gemv_axpy(
+            const T *A, my_size_t strideA, my_size_t K_len,
+            const T *x, my_size_t incx,
+            T *y, my_size_t incy, my_size_t len,
+            const Ep &ep, my_size_t i) noexcept
+        {
+            typename K::VecType acc[V];
+            for (my_size_t v = 0; v < V; ++v)
+                acc[v] = K::set1(T{0});
+
+            for (my_size_t k = 0; k < K_len; ++k)
+            {
+                auto xk = K::set1(x[k * incx]);
+                for (my_size_t v = 0; v < V; ++v)
+                {
+                    const T *row = A + k * strideA + v * simdWidth;
+                    typename K::VecType av;
+                    if constexpr (Partial && Helpers::AlignedRows)
+                        av = K::load(row);
+                    else if constexpr (Partial)
+                        av = K::maskload(row, len);
+                    else
+                        av = Helpers::load_row(row);
+                    acc[v] = Helpers::fmadd_safe(av, xk, acc[v]);
+                }
+            }
+
+            if constexpr (RowY && Partial)
+            {
+                store_partial(ep, y, acc[0], len, 0, i);
+                return;
+            }
+            else if constexpr (RowY)
+            {
+                for (my_size_t v = 0; v < V; ++v)
+                    store_vec(ep, y + v * simdWidth, acc[v], 0, i + v * simdWidth);
+                return;
+            }
+
+            alignas(Bits / 8) T lanes[V * simdWidth];
+            for (my_size_t v = 0; v < V; ++v)
+                K::store(lanes + v * simdWidth, acc[v]);
+            for (my_size_t l = 0; l < len; ++l)
+                gemv_store<RowY>(ep, y + l * incy, lanes[l], i + l);
         }
     };
 
 } // namespace detail
 
-#endif // KERNEL_GEMM_H
\ No newline at end of file
+#endif // KERNEL_GEMM_H
@@ -19,6 +19,46 @@ namespace detail
     {
         using K = Microkernel<T, Bits, Arch>;
 
+        /**
+         * @brief Row starts of tensor storage are simdWidth-aligned.
+         *
+         * True with SimdPaddingPolicy (every row begins on a vector
+         * boundary). Compact storage (TESSERACT_NO_PADDING) starts rows
+         * anywhere, so kernels reading or writing user rows go through
+         * load_row / store_row, which pick the unaligned forms there.
+         * Packing buffers and local arrays stay aligned either way.
+         */
+#ifdef TESSERACT_NO_PADDING
+        static constexpr bool AlignedRows = false;
+#else
+        static constexpr bool AlignedRows = true;
+#endif
+
+        /**
+         * @brief K multiplies pairs of 16-bit lanes into a 64-bit accumulator (K::mac).
+         *
+         * The packed Q15 kernel (fixed_point_microkernel.h). Its fmadd
+         * saturates every step, so dot products and GEMM accumulate with
+         * K::mac instead and round once per result (K::round_acc).
+         */
+        static constexpr bool PairMac = requires(typename K::AccType acc, typename K::VecType v) { K::mac(acc, v, v); };
+
+        FORCE_INLINE static typename K::VecType load_row(const T *ptr) noexcept
+        {
+            if constexpr (AlignedRows)
+                return K::load(ptr);
+            else
+                return K::loadu(ptr);
+        }
+
+        FORCE_INLINE static void store_row(T *ptr, typename K::VecType val) noexcept
+        {
+            if constexpr (AlignedRows)
+                K::store(ptr, val);
+            else
+                K::storeu(ptr, val);
+        }
+
         /**
          * @brief Fused multiply-add with fallback for architectures without native FMA.
          *
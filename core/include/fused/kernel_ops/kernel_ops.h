@@ -4,9 +4,11 @@
  *
  * Delegates to specialized sub-modules:
  *   - kernel_eval.h     — expression evaluation (contiguous / permuted)
- *   - kernel_reduce.h   — reductions (min, max, sum)
+ *   - kernel_reduce.h   — reductions (min, max, sum; per axis: sum, min, max, mean, prod; argmin / argmax)
  *   - kernel_compare.h  — approximate equality comparisons
  *   - kernel_dot.h      — dot products (contiguous / strided) for einsum
+ *   - kernel_gemm.h     — register- and cache-blocked GEMM for 2D einsum
+ *   - kernel_epilogue.h — GEMM epilogues (alpha/beta, addend, op) fused into stores
  *   - kernel_helpers.h  — shared SIMD utilities (fmadd_safe)
  *
  * Callers should include only this file.
@@ -59,10 +61,41 @@ struct KernelOps
         return detail::KernelReduce<T, Bits, Arch>::reduce_max(expr);
     }
 
-    template <typename Expr>
+    /**
+     * @brief Sum; S: Unrolled (default), Compensated or Pairwise.
+     */
+    template <detail::Summation S = detail::Summation::Unrolled, typename Expr>
     FORCE_INLINE static T reduce_sum(const Expr &expr) noexcept
     {
-        return detail::KernelReduce<T, Bits, Arch>::reduce_sum(expr);
+        return detail::KernelReduce<T, Bits, Arch>::template reduce_sum<S>(expr);
+    }
+
+    /**
+     * @brief Reduce along Axis into output (the expression's shape with Axis removed).
+     */
+    template <detail::ReduceOp Op, my_size_t Axis, typename Expr>
+    FORCE_INLINE static void reduce_axis(T *output, const Expr &expr) noexcept
+    {
+        detail::KernelReduce<T, Bits, Arch>::template reduce_axis<Op, Axis>(output, expr);
+    }
+
+    /**
+     * @brief Logical flat index of the first minimum (Min) or maximum (Max).
+     */
+    template <detail::ReduceOp Op, typename Expr>
+    FORCE_INLINE static my_size_t arg_reduce(const Expr &expr) noexcept
+    {
+        return detail::KernelReduce<T, Bits, Arch>::template arg_reduce<Op>(expr);
+    }
+
+    /**
+     * @brief Index along Axis of the first minimum / maximum, into output
+     *        (the expression's shape with Axis removed).
+     */
+    template <detail::ReduceOp Op, my_size_t Axis, typename Expr>
+    FORCE_INLINE static void arg_reduce_axis(my_size_t *output, const Expr &expr) noexcept
+    {
+        detail::KernelReduce<T, Bits, Arch>::template arg_reduce_axis<Op, Axis>(output, expr);
     }
 
     // ========================================================================
@@ -0,0 +1,236 @@
+/**
+ * @file kernel_qgemm.h
+ * @brief int8 × int8 → int32 GEMM for quantized tensors (fused_quantized.h).
+ *
+ * Computes C[M,N] = A[M,K] · B[N,K]ᵀ where both operands are int8 rows
+ * that run along K — activations [batch, in] and weights [out, in], the
+ * layout of a dense layer. Every output is a dot product of two contiguous
+ * rows, so nothing is packed or transposed and a single input row (M = 1)
+ * streams the weights exactly once.
+ *
+ * @section tile Register Tile
+ *
+ *   for k in 0..K step KStep:
+ *       load NR B chunks                      (NR loads)
+ *       for each of MR A rows:
+ *           load the A chunk                  (1 load)
+ *           acc[r][c] += dot(A chunk, B chunk[c])   (NR dot steps)
+ *   reduce the accumulators → MR × NR int32 sums
+ *
+ * QGemmMicrokernel (one per arch, see microkernel_base.h) supplies the dot
+ * step: vpdpbusd (AVX-512 VNNI / AVX-VNNI), vpmaddwd on sign-extended
+ * bytes (AVX2, AVX-512BW, SSE2), sdot (NEON A76) or smull + sadalp.
+ * All of them are exact: no intermediate saturates.
+ *
+ * Rows are zero-padded to a multiple of KStep, so the last chunk reads
+ * zeros past K and needs no tail handling.
+ *
+ * @section zero_point Zero Points
+ *
+ * A quantized value q stands for s · (q − z). The kernel accumulates Σₖ a·b
+ * on the raw int8 values and folds the zero points in afterwards, from the
+ * row sums each operand keeps:
+ *
+ *   Σₖ (a − za)(b − zb) = Σₖ a·b − zb·Σₖ a − za·(Σₖ b − K·zb)
+ *
+ * The B_BIAS of a VNNI kernel (B fed as b + 128) is one more −128·Σₖ a term.
+ *
+ * @section epilogues Epilogues
+ *
+ * The corrected int32 value of each C element goes to an epilogue:
+ *
+ *   QStoreInt32   C = acc                                       (int32)
+ *   QDequantize   C = sa·sb·acc + bias[j]                        (float)
+ *   QRequantize   C = sat8(rint((sa·sb·acc + bias[j]) / sc) + zc) (int8)
+ *
+ * sa, sb are the per-tensor or per-row scales of A's row i and B's row j.
+ */
+#ifndef KERNEL_QGEMM_H
+#define KERNEL_QGEMM_H
+
+#include "config.h"
+#include "fused/microkernels/microkernel_base.h"
+
+namespace detail
+{
+
+    /**
+     * @brief One operand of the quantized GEMM: int8 rows along K plus their parameters.
+     *
+     * Row r starts at data + r · stride, is aligned to the kernel's KStep
+     * and zero-filled from K up to the next multiple of KStep.
+     */
+    struct QGemmOperand
+    {
+        const int8_t *data;
+        my_size_t stride;          ///< Bytes between consecutive rows
+        const int32_t *row_sums;   ///< Σₖ q(r, k), one per row
+        const float *scale;        ///< scale[r · param_step]
+        const int32_t *zero_point; ///< zero_point[r · param_step]
+        my_size_t param_step;      ///< 1: per-row parameters, 0: one per tensor
+
+        FORCE_INLINE float scale_of(my_size_t r) const noexcept { return scale[r * param_step]; }
+        FORCE_INLINE int32_t zero_point_of(my_size_t r) const noexcept { return zero_point[r * param_step]; }
+    };
+
+    /// C[i,j] = acc
+    struct QStoreInt32
+    {
+        int32_t *C;
+        my_size_t strideC;
+
+        FORCE_INLINE void store(const QGemmOperand &, my_size_t i, const QGemmOperand &, my_size_t j, int32_t acc) const noexcept
+        {
+            C[i * strideC + j] = acc;
+        }
+    };
+
+    /// C[i,j] = sa(i) · sb(j) · acc + bias[j]
+    struct QDequantize
+    {
+        float *C;
+        my_size_t strideC;
+        const float *bias;      ///< nullptr: no bias
+        my_size_t bias_stride;
+
+        FORCE_INLINE void store(const QGemmOperand &A, my_size_t i, const QGemmOperand &B, my_size_t j, int32_t acc) const noexcept
+        {
+            float v = A.scale_of(i) * B.scale_of(j) * static_cast<float>(acc);
+            if (bias)
+                v += bias[j * bias_stride];
+            C[i * strideC + j] = v;
+        }
+    };
+
+    /// C[i,j] = saturate_int8(rint(dequantized / scale) + zero_point); row sums kept for the next GEMM.
+    struct QRequantize
+    {
+        int8_t *C;
+        my_size_t strideC;
+        int32_t *row_sums; ///< Zeroed by the caller, accumulated here
+        float inv_scale;
+        int32_t zero_point;
+        const float *bias;
+        my_size_t bias_stride;
+
+        FORCE_INLINE void store(const QGemmOperand &A, my_size_t i, const QGemmOperand &B, my_size_t j, int32_t acc) const noexcept
+        {
+            float v = A.scale_of(i) * B.scale_of(j) * static_cast<float>(acc);
+            if (bias)
+                v += bias[j * bias_stride];
+            float q = __builtin_rintf(v * inv_scale) + static_cast<float>(zero_point);
+            q = q < -128.0f ? -128.0f : (q > 127.0f ? 127.0f : q);
+            const int8_t out = static_cast<int8_t>(q);
+            C[i * strideC + j] = out;
+            row_sums[i] += out;
+        }
+    };
+
+    template <my_size_t Bits, typename Arch>
+    struct KernelQGemm
+    {
+        using QK = QGemmMicrokernel<Bits, Arch>;
+
+        /// int8 elements per dot step; rows are padded to a multiple of it.
+        static constexpr my_size_t KStep = QK::KStep;
+
+        /// Rows of A per register tile.
+        static constexpr my_size_t MR = QK::MR;
+
+        /// Rows of B (columns of C) per register tile.
+        static constexpr my_size_t NR = QK::NR;
+
+        /**
+         * @brief C[M,N] = A[M,K] · B[N,K]ᵀ with zero-point correction, stored through ep.
+         *
+         * @param A     Left operand, M rows of K_len int8 values
+         * @param M     Rows of A and C
+         * @param B     Right operand, N rows of K_len int8 values
+         * @param N     Rows of B, columns of C
+         * @param K_len Contraction length (logical, before padding)
+         * @param ep    QStoreInt32, QDequantize or QRequantize
+         */
+        template <typename Ep>
+        static void gemm(
+            const QGemmOperand &A, my_size_t M,
+            const QGemmOperand &B, my_size_t N,
+            my_size_t K_len, const Ep &ep) noexcept
+        {
+            my_size_t i = 0;
+            for (; i + MR <= M; i += MR)
+                row_band<MR>(A, i, B, N, K_len, ep);
+            for (; i < M; ++i)
+                row_band<1>(A, i, B, N, K_len, ep);
+        }
+
+    private:
+        /// All of C's columns for R rows of A; the A rows stay in L1 while B streams past.
+        template <my_size_t R, typename Ep>
+        FORCE_INLINE static void row_band(
+            const QGemmOperand &A, my_size_t i,
+            const QGemmOperand &B, my_size_t N,
+            my_size_t K_len, const Ep &ep) noexcept
+        {
+            my_size_t j = 0;
+            for (; j + NR <= N; j += NR)
+                micro_kernel<R, NR>(A, i, B, j, K_len, ep);
+            for (; j < N; ++j)
+                micro_kernel<R, 1>(A, i, B, j, K_len, ep);
+        }
+
+        /// R × C tile of C at (i, j): R·C accumulators over the whole of K.
+        template <my_size_t R, my_size_t C, typename Ep>
+        FORCE_INLINE static void micro_kernel(
+            const QGemmOperand &A, my_size_t i,
+            const QGemmOperand &B, my_size_t j,
+            my_size_t K_len, const Ep &ep) noexcept
+        {
+            typename QK::AccType acc[R][C];
+            for (my_size_t r = 0; r < R; ++r)
+                for (my_size_t c = 0; c < C; ++c)
+                    acc[r][c] = QK::zero();
+
+            const int8_t *a = A.data + i * A.stride;
+            const int8_t *b = B.data + j * B.stride;
+            for (my_size_t k = 0; k < K_len; k += KStep)
+            {
+                typename QK::Operand b_chunk[C];
+                for (my_size_t c = 0; c < C; ++c)
+                    b_chunk[c] = QK::load_b(b + c * B.stride + k);
+
+                for (my_size_t r = 0; r < R; ++r)
+                {
+                    const auto a_chunk = QK::load_a(a + r * A.stride + k);
+                    for (my_size_t c = 0; c < C; ++c)
+                        acc[r][c] = QK::dot(acc[r][c], a_chunk, b_chunk[c]);
+                }
+            }
+
+            for (my_size_t r = 0; r < R; ++r)
+            {
+                int32_t sums[C];
+                if constexpr (C == 4)
+                    QK::hsum4(acc[r], sums);
+                else
+                    for (my_size_t c = 0; c < C; ++c)
+                        sums[c] = QK::hsum(acc[r][c]);
+                for (my_size_t c = 0; c < C; ++c)
+                    ep.store(A, i + r, B, j + c, correct(A, i + r, B, j + c, K_len, sums[c]));
+            }
+        }
+
+        /// Fold the zero points (and the kernel's B_BIAS) into a raw Σₖ a·b (see @ref zero_point).
+        FORCE_INLINE static int32_t correct(
+            const QGemmOperand &A, my_size_t i,
+            const QGemmOperand &B, my_size_t j,
+            my_size_t K_len, int32_t raw) noexcept
+        {
+            const int32_t za = A.zero_point_of(i);
+            const int32_t zb = B.zero_point_of(j);
+            return raw - (QK::B_BIAS + zb) * A.row_sums[i] - za * (B.row_sums[j] - static_cast<int32_t>(K_len) * zb);
+        }
+    };
+
+} // namespace detail
+
+#endif // KERNEL_QGEMM_H
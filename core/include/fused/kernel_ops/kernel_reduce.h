@@ -1,11 +1,20 @@
 /**
  * @file kernel_reduce.h
- * @brief Reduction operations — min, max, sum over expression elements.
+ * @brief Reduction operations — min, max, sum over expression elements,
+ *        and sum/min/max/mean/prod along one axis.
  *
  * Parameterized on ReduceOp enum. Dispatches based on expression layout:
- *   - Contiguous: physical slice iteration, SIMD + scalar tail
+ *   - Contiguous: physical slice iteration, SIMD + masked tail
  *   - Logical:    flat logical index iteration, scalar only (for permuted views)
  *
+ * Axis reductions (reduce_axis) write a tensor with the axis removed;
+ * argmin / argmax (arg_reduce, arg_reduce_axis) return element indices. See
+ * the AXIS REDUCTIONS and ARG REDUCTIONS sections below.
+ *
+ * Contiguous reductions of RUNTIME_DISPATCH_MIN_SIZE or more elements go
+ * through runtime_dispatch, which with TESSERACT_RUNTIME_DISPATCH runs them
+ * on the widest kernel family the CPU supports.
+ *
  * ============================================================================
  * STRATEGY (contiguous path)
  * ============================================================================
@@ -24,11 +33,22 @@
  *   slice 1 = [0,1,:]    slice 4 = [1,1,:]
  *   slice 2 = [0,2,:]    slice 5 = [1,2,:]
  *
- * Per slice, SIMD processes simdWidth-aligned chunks, then a scalar tail
- * handles the remainder. Padding is never read.
+ * Per slice, SIMD processes simdWidth-aligned chunks, then one partial
+ * vector (MaskedTail: maskload, dead lanes zero) handles the remainder. Tail
+ * vectors accumulate separately across slices and only their first
+ * lastDim % simdWidth lanes are combined at the end. Padding is never read.
+ * Chunks go round-robin into ReduceAccumulators independent accumulators,
+ * so the loop is bound by load / add throughput, not add latency.
+ *
+ * reduce_sum takes a Summation mode: Compensated (TwoSum error terms) or
+ * Pairwise (tree-ordered) walk the same chunks — see COMPENSATED AND
+ * PAIRWISE SUMMATION below.
+ *
+ * Unpadded storage (NoPaddingPolicy) has no gaps between slices, so the whole
+ * buffer is reduced as one slice and only its very end is a partial vector.
  *
  * ============================================================================
- * GENERICARCH (SimdWidth=1): no padding, simdSteps=lastDim, no scalar tail.
+ * GENERICARCH (SimdWidth=1): no padding, simdSteps=lastDim, no tail.
  * Microkernel ops inline to plain scalar — same codegen as a manual loop.
  * ============================================================================
  */
@@ -38,6 +58,9 @@
 #include "config.h"
 #include "fused/microkernels/microkernel_base.h"
 #include "numeric_limits.h"
+#include "helper_traits.h"
+#include "fused/Operations.h"
+#include "fused/padding_policies/default_padding_policy.h"
 #include "expression_traits/expression_traits.h"
 
 namespace detail
@@ -51,7 +74,42 @@ namespace detail
     {
         Min,
         Max,
-        Sum
+        Sum,
+        Mean, // Sum, divided by the element count at the end
+        Prod
+    };
+
+    // ============================================================================
+    // Summation — how reduce_sum orders and rounds its additions
+    // ============================================================================
+
+    enum class Summation
+    {
+        Unrolled,    // ReduceAccumulators independent accumulators (default, fastest)
+        Compensated, // plus a per-lane error term (TwoSum): error independent of length
+        Pairwise     // blocks of ReduceAccumulators vectors, summed as a binary tree
+    };
+
+    // ============================================================================
+    // AxisReducedPadPolicy — padding of an expression's shape with one axis removed
+    // ============================================================================
+
+    template <typename V, typename Expr, my_size_t Axis, typename Seq>
+    struct AxisReducedPadImpl
+    {
+    };
+
+    template <typename V, typename Expr, my_size_t Axis, my_size_t... Is>
+    struct AxisReducedPadImpl<V, Expr, Axis, index_seq<Is...>>
+    {
+        using type = DefaultPaddingPolicy<V, Expr::Dim[Is < Axis ? Is : Is + 1]...>;
+    };
+
+    /// V: element type of the result (the expression's, or my_size_t for indices)
+    template <typename Expr, my_size_t Axis, typename V = typename Expr::value_type>
+    struct AxisReducedPadPolicy
+    {
+        using type = typename AxisReducedPadImpl<V, Expr, Axis, typename make_index_seq<Expr::NumDims - 1>::type>::type;
     };
 
     template <typename T, my_size_t Bits, typename Arch>
@@ -59,6 +117,7 @@ namespace detail
     {
         using K = Microkernel<T, Bits, Arch>;
         static constexpr my_size_t simdWidth = K::simdWidth;
+        using Acc = compute_type_t<T>; // float for Half / BFloat16: lanes combine unrounded
 
         // ========================================================================
         // Public API
@@ -76,10 +135,88 @@ namespace detail
             return reduce<ReduceOp::Max>(expr);
         }
 
-        template <typename Expr>
+        /**
+         * @brief Sum of expr. S picks the summation order; Compensated and
+         *        Pairwise apply to float and double, other types sum Unrolled.
+         */
+        template <Summation S = Summation::Unrolled, typename Expr>
         FORCE_INLINE static T reduce_sum(const Expr &expr) noexcept
         {
-            return reduce<ReduceOp::Sum>(expr);
+            if constexpr (S == Summation::Unrolled || !is_floating_point_v<T>)
+            {
+                return reduce<ReduceOp::Sum>(expr);
+            }
+            else if constexpr (!expression::traits<Expr>::IsPermuted &&
+                               Expr::Layout::PhysicalSize >= RUNTIME_DISPATCH_MIN_SIZE)
+            {
+                return runtime_dispatch<T, Bits, Arch>([&]<my_size_t DBits, typename DArch>()
+                                                       { return KernelReduce<T, DBits, DArch>::template sum_contiguous<S>(expr); });
+            }
+            else if constexpr (!expression::traits<Expr>::IsPermuted)
+            {
+                return sum_contiguous<S>(expr);
+            }
+            else
+            {
+                return KernelReduce<T, 1, GENERICARCH>::template sum_logical<S>(expr);
+            }
+        }
+
+        /**
+         * @brief Reduce expr along Axis into output, laid out as
+         *        AxisReducedPadPolicy<Expr, Axis> (padding written as zeros).
+         */
+        template <ReduceOp Op, my_size_t Axis, typename Expr>
+        FORCE_INLINE static void reduce_axis(T *output, const Expr &expr) noexcept
+        {
+            if constexpr (!expression::traits<Expr>::IsPermuted &&
+                          Expr::Layout::PhysicalSize >= RUNTIME_DISPATCH_MIN_SIZE)
+            {
+                runtime_dispatch<T, Bits, Arch>([&]<my_size_t DBits, typename DArch>()
+                                                { KernelReduce<T, DBits, DArch>::template reduce_axis_rows<Op, Axis>(output, expr); });
+            }
+            else
+            {
+                reduce_axis_rows<Op, Axis>(output, expr);
+            }
+        }
+
+        /**
+         * @brief Logical flat index of the first minimum (Op = Min) or
+         *        maximum (Op = Max) of expr.
+         */
+        template <ReduceOp Op, typename Expr>
+        FORCE_INLINE static my_size_t arg_reduce(const Expr &expr) noexcept
+        {
+            if constexpr (!expression::traits<Expr>::IsPermuted &&
+                          Expr::Layout::PhysicalSize >= RUNTIME_DISPATCH_MIN_SIZE)
+            {
+                return runtime_dispatch<T, Bits, Arch>([&]<my_size_t DBits, typename DArch>()
+                                                       { return KernelReduce<T, DBits, DArch>::template arg_reduce_rows<Op>(expr); });
+            }
+            else
+            {
+                return arg_reduce_rows<Op>(expr);
+            }
+        }
+
+        /**
+         * @brief Index along Axis of the first minimum / maximum, into output
+         *        laid out as AxisReducedPadPolicy<Expr, Axis, my_size_t>.
+         */
+        template <ReduceOp Op, my_size_t Axis, typename Expr>
+        FORCE_INLINE static void arg_reduce_axis(my_size_t *output, const Expr &expr) noexcept
+        {
+            if constexpr (!expression::traits<Expr>::IsPermuted &&
+                          Expr::Layout::PhysicalSize >= RUNTIME_DISPATCH_MIN_SIZE)
+            {
+                runtime_dispatch<T, Bits, Arch>([&]<my_size_t DBits, typename DArch>()
+                                                { KernelReduce<T, DBits, DArch>::template arg_reduce_axis_rows<Op, Axis>(output, expr); });
+            }
+            else
+            {
+                arg_reduce_axis_rows<Op, Axis>(output, expr);
+            }
         }
 
         // ========================================================================
@@ -87,6 +224,9 @@ namespace detail
         // ========================================================================
 
     private: // TODO: make private once KernelOps facade is the only caller
+        template <typename, my_size_t, typename>
+        friend struct KernelReduce;
+
         // --- ReduceOp traits ---
 
         template <ReduceOp Op>
@@ -96,8 +236,10 @@ namespace detail
                 return NumericLimits<T>::max();
             if constexpr (Op == ReduceOp::Max)
                 return NumericLimits<T>::lowest();
-            if constexpr (Op == ReduceOp::Sum)
+            if constexpr (Op == ReduceOp::Sum || Op == ReduceOp::Mean)
                 return T{0};
+            if constexpr (Op == ReduceOp::Prod)
+                return T{1};
         }
 
         template <ReduceOp Op>
@@ -108,20 +250,24 @@ namespace detail
                 return K::min(a, b);
             if constexpr (Op == ReduceOp::Max)
                 return K::max(a, b);
-            if constexpr (Op == ReduceOp::Sum)
+            if constexpr (Op == ReduceOp::Sum || Op == ReduceOp::Mean)
                 return K::add(a, b);
+            if constexpr (Op == ReduceOp::Prod)
+                return K::mul(a, b);
         }
 
         template <ReduceOp Op>
-        FORCE_INLINE static T reduce_scalar_combine(T a, T b) noexcept
+        FORCE_INLINE static Acc reduce_scalar_combine(Acc a, Acc b) noexcept
         {
             using ScalarK = Microkernel<T, 1, GENERICARCH>;
             if constexpr (Op == ReduceOp::Min)
                 return ScalarK::min(a, b);
             if constexpr (Op == ReduceOp::Max)
                 return ScalarK::max(a, b);
-            if constexpr (Op == ReduceOp::Sum)
+            if constexpr (Op == ReduceOp::Sum || Op == ReduceOp::Mean)
                 return ScalarK::add(a, b);
+            if constexpr (Op == ReduceOp::Prod)
+                return ScalarK::mul(a, b);
         }
 
         // --- Dispatch ---
@@ -129,7 +275,13 @@ namespace detail
         template <ReduceOp Op, typename Expr>
         FORCE_INLINE static T reduce(const Expr &expr) noexcept
         {
-            if constexpr (!expression::traits<Expr>::IsPermuted)
+            if constexpr (!expression::traits<Expr>::IsPermuted &&
+                          Expr::Layout::PhysicalSize >= RUNTIME_DISPATCH_MIN_SIZE)
+            {
+                return runtime_dispatch<T, Bits, Arch>([&]<my_size_t DBits, typename DArch>()
+                                                       { return KernelReduce<T, DBits, DArch>::template reduce_contiguous<Op>(expr); });
+            }
+            else if constexpr (!expression::traits<Expr>::IsPermuted)
             {
                 // std::cout << "reduce_contiguous" << std::endl;
                 return reduce_contiguous<Op>(expr);
@@ -142,49 +294,147 @@ namespace detail
         }
 
         // --- Contiguous path — iterate physical slices, skip padding ---
+        //
+        // ReduceAccumulators independent vector accumulators, so consecutive
+        // loads do not wait on each other's combine (a vector add has a
+        // latency of several cycles but issues more than once per cycle).
+        // Slices of at least ReduceAccumulators vectors are unrolled within
+        // the slice; shorter slices are walked as one sequence of vectors
+        // across slices. The accumulators are combined as a tree at the end.
 
-        template <ReduceOp Op, typename Expr>
-        FORCE_INLINE static T reduce_contiguous(const Expr &expr) noexcept
-        {
-            using ExprPadPolicy = typename Expr::Layout::PadPolicyType;
+        static constexpr my_size_t ReduceAccumulators = 8;
+        static_assert((ReduceAccumulators & (ReduceAccumulators - 1)) == 0, "ReduceAccumulators: power of two");
 
-            static constexpr my_size_t lastDim = ExprPadPolicy::LastDim;
-            static constexpr my_size_t paddedLastDim = ExprPadPolicy::PaddedLastDim;
-            static constexpr my_size_t numSlices = ExprPadPolicy::PhysicalSize / paddedLastDim;
+        /// Shape of Expr's physical storage as the contiguous path sees it.
+        template <typename Expr>
+        struct ContiguousSlices
+        {
+            using P = typename Expr::Layout::PadPolicyType;
+            static constexpr bool dense = P::PaddedLastDim == P::LastDim;
+            static constexpr my_size_t lastDim = dense ? P::PhysicalSize : P::LastDim;
+            static constexpr my_size_t paddedLastDim = dense ? P::PhysicalSize : P::PaddedLastDim;
+            static constexpr my_size_t numSlices = P::PhysicalSize / paddedLastDim;
             static constexpr my_size_t simdSteps = lastDim / simdWidth;
-            static constexpr my_size_t scalarStart = simdSteps * simdWidth;
+            static constexpr my_size_t tailStart = simdSteps * simdWidth;
+            static constexpr my_size_t tail = lastDim - tailStart;
+        };
 
-            T result = reduce_identity<Op>();
+        /// Call f(0), f(1), …, f(N-1) as separate statements (compile-time unrolled).
+        template <my_size_t... Is, typename F>
+        FORCE_INLINE static void unroll(index_seq<Is...>, F &&f) noexcept
+        {
+            (f(Is), ...);
+        }
 
-            if constexpr (simdSteps > 0)
+        /// Vectors load(0) … load(Count-1): group(v) per ReduceAccumulators of them, single(v) for the rest.
+        template <my_size_t Count, typename Load, typename Group, typename Single>
+        FORCE_INLINE static void for_each_vec(const Load &load, Group &&group, Single &&single) noexcept
+        {
+            // Trip counts are constants, so GCC sees no group past Count
+            static constexpr my_size_t groups = Count / ReduceAccumulators;
+            if constexpr (Count >= ReduceAccumulators)
             {
-                typename K::VecType acc = K::set1(reduce_identity<Op>());
-
-                for (my_size_t slice = 0; slice < numSlices; ++slice)
+                for (my_size_t n = 0; n < groups; ++n)
                 {
-                    const my_size_t base = slice * paddedLastDim;
-                    for (my_size_t i = 0; i < simdSteps; ++i)
-                        acc = reduce_simd_combine<Op>(
-                            acc, expr.template evalu<T, Bits, Arch>(base + i * simdWidth));
+                    const my_size_t g = n * ReduceAccumulators;
+                    decltype(load(g)) v[ReduceAccumulators];
+                    unroll(typename make_index_seq<ReduceAccumulators>::type{}, [&](my_size_t a) FORCE_INLINE_LAMBDA
+                           { v[a] = load(g + a); });
+                    group(v);
                 }
-
-                alignas(DATA_ALIGNAS) T tmp[simdWidth];
-                K::store(tmp, acc);
-
-                for (my_size_t i = 0; i < simdWidth; ++i)
-                    result = reduce_scalar_combine<Op>(result, tmp[i]);
             }
+            for (my_size_t g = groups * ReduceAccumulators; g < Count; ++g)
+                single(load(g));
+        }
 
-            if constexpr (scalarStart < lastDim)
+        /// Every full vector of the slices, through for_each_vec.
+        template <typename Expr, typename Group, typename Single>
+        FORCE_INLINE static void sweep_vectors(const Expr &expr, Group &&group, Single &&single) noexcept
+        {
+            using C = ContiguousSlices<Expr>;
+            if constexpr (C::simdSteps >= ReduceAccumulators)
             {
-                for (my_size_t slice = 0; slice < numSlices; ++slice)
+                for (my_size_t slice = 0; slice < C::numSlices; ++slice)
                 {
-                    const my_size_t base = slice * paddedLastDim;
-                    for (my_size_t i = scalarStart; i < lastDim; ++i)
-                        result = reduce_scalar_combine<Op>(
-                            result, expr.template evalu<T, 1, GENERICARCH>(base + i));
+                    const my_size_t base = slice * C::paddedLastDim;
+                    for_each_vec<C::simdSteps>(
+                        [&](my_size_t i) FORCE_INLINE_LAMBDA
+                        { return expr.template evalu<T, Bits, Arch>(base + i * simdWidth); },
+                        group, single);
                 }
             }
+            else
+            {
+                for_each_vec<C::numSlices * C::simdSteps>(
+                    [&](my_size_t g) FORCE_INLINE_LAMBDA
+                    { return expr.template evalu<T, Bits, Arch>((g / C::simdSteps) * C::paddedLastDim +
+                                                                (g % C::simdSteps) * simdWidth); },
+                    group, single);
+            }
+        }
+
+        /// The tail vector (MaskedTail) of every slice, through for_each_vec.
+        template <typename Expr, typename Group, typename Single>
+        FORCE_INLINE static void sweep_tail(const Expr &expr, Group &&group, Single &&single) noexcept
+        {
+            using C = ContiguousSlices<Expr>;
+            for_each_vec<C::numSlices>(
+                [&](my_size_t slice) FORCE_INLINE_LAMBDA
+                { return expr.template evalu<T, Bits, MaskedTail<Arch, C::tail>>(slice * C::paddedLastDim + C::tailStart); },
+                group, single);
+        }
+
+        /// f(a, a + W) for the pairs of a balanced tree over N slots (a power of two), leaves first.
+        template <my_size_t N = ReduceAccumulators, my_size_t W = 1, typename F>
+        FORCE_INLINE static void tree(F &&f) noexcept
+        {
+            if constexpr (W < N)
+            {
+                unroll(typename make_index_seq<N / (2 * W)>::type{}, [&](my_size_t p) FORCE_INLINE_LAMBDA
+                       { f(2 * W * p, 2 * W * p + W); });
+                tree<N, 2 * W>(f);
+            }
+        }
+
+        /// acc[0] ∘ acc[1] ∘ … as a balanced tree.
+        template <ReduceOp Op>
+        FORCE_INLINE static typename K::VecType combine_tree(typename K::VecType *acc) noexcept
+        {
+            tree([&](my_size_t a, my_size_t b) FORCE_INLINE_LAMBDA
+                 { acc[a] = reduce_simd_combine<Op>(acc[a], acc[b]); });
+            return acc[0];
+        }
+
+        template <ReduceOp Op, typename Expr>
+        FORCE_INLINE static T reduce_contiguous(const Expr &expr) noexcept
+        {
+            using C = ContiguousSlices<Expr>;
+            using V = typename K::VecType;
+
+            Acc result = reduce_identity<Op>();
+
+            // Full vectors, then the tail vectors: separate accumulators, only
+            // the first C::tail lanes of the latter are live
+            auto accumulate = [&]<my_size_t Lanes>(auto sweep) FORCE_INLINE_LAMBDA
+            {
+                V acc[ReduceAccumulators];
+                unroll(typename make_index_seq<ReduceAccumulators>::type{}, [&](my_size_t a) FORCE_INLINE_LAMBDA
+                       { acc[a] = K::set1(reduce_identity<Op>()); });
+                sweep([&](const V *v) FORCE_INLINE_LAMBDA
+                      { unroll(typename make_index_seq<ReduceAccumulators>::type{}, [&](my_size_t a) FORCE_INLINE_LAMBDA
+                               { acc[a] = reduce_simd_combine<Op>(acc[a], v[a]); }); },
+                      [&](V v) FORCE_INLINE_LAMBDA
+                      { acc[0] = reduce_simd_combine<Op>(acc[0], v); });
+                result = reduce_lanes<Op, Lanes>(result, combine_tree<Op>(acc));
+            };
+
+            if constexpr (C::simdSteps > 0)
+                accumulate.template operator()<simdWidth>([&](auto &&group, auto &&single) FORCE_INLINE_LAMBDA
+                                                          { sweep_vectors(expr, group, single); });
+
+            if constexpr (C::tail > 0)
+                accumulate.template operator()<C::tail>([&](auto &&group, auto &&single) FORCE_INLINE_LAMBDA
+                                                        { sweep_tail(expr, group, single); });
 
             return result;
         }
@@ -200,7 +450,7 @@ namespace detail
         {
             static constexpr my_size_t totalSize = Expr::TotalSize;
 
-            T result = reduce_identity<Op>();
+            Acc result = reduce_identity<Op>();
 
             for (my_size_t i = 0; i < totalSize; ++i)
                 result = reduce_scalar_combine<Op>(
@@ -208,6 +458,698 @@ namespace detail
 
             return result;
         }
+
+        // ========================================================================
+        // COMPENSATED AND PAIRWISE SUMMATION
+        // ========================================================================
+        //
+        // Both walk the same vectors as reduce_contiguous (sweep_vectors,
+        // sweep_tail), in groups of ReduceAccumulators.
+        //
+        // Compensated: each accumulator is a pair (s, c). Knuth's TwoSum adds
+        // x to s and recovers the exact rounding error of that add, which
+        // goes into c — Neumaier's correction without the |s| >= |x| branch:
+        //
+        //   t = s + x    z = t - s    c += (s - (t - z)) + (x - z)    s = t
+        //
+        // The error no longer grows with the number of elements; six extra
+        // adds per vector, spread over independent accumulator pairs.
+        //
+        // Pairwise: each group of vectors is summed as a tree, and the group
+        // sums are merged like a binary counter — a stack holding one partial
+        // sum per level, where two sums of equal level merge into the next:
+        //
+        //   groups: g0 g1 g2 g3 …  →  (g0+g1)  →  ((g0+g1)+(g2+g3))  …
+        //
+        // so every element takes part in O(log n) rounded adds.
+        //
+        // In both modes the final lanes and partial sums are folded with
+        // scalar TwoSum. They rely on IEEE rounding: -ffast-math (or
+        // -fassociative-math) may fold the error terms away.
+
+        /// s + x into s, its rounding error into c (KK: K, or the scalar kernel for lanes).
+        template <typename KK = K>
+        FORCE_INLINE static void two_sum(typename KK::VecType &s, typename KK::VecType &c, typename KK::VecType x) noexcept
+        {
+            const typename KK::VecType t = KK::add(s, x);
+            const typename KK::VecType z = KK::sub(t, s);
+            c = KK::add(c, KK::add(KK::sub(s, KK::sub(t, z)), KK::sub(x, z)));
+            s = t;
+        }
+
+        /// First Lanes lanes of the pair (sum, err) into (s, c).
+        template <my_size_t Lanes>
+        FORCE_INLINE static void fold_lanes(T &s, T &c, typename K::VecType sum, typename K::VecType err) noexcept
+        {
+            alignas(DATA_ALIGNAS) T tmp[simdWidth];
+            alignas(DATA_ALIGNAS) T etmp[simdWidth];
+            K::store(tmp, sum);
+            K::store(etmp, err);
+            for (my_size_t i = 0; i < Lanes; ++i)
+            {
+                two_sum<Microkernel<T, 1, GENERICARCH>>(s, c, tmp[i]);
+                c += etmp[i];
+            }
+        }
+
+        /**
+         * @brief Fold one vector sequence into (s, c) with summation S.
+         *
+         * sweep(group, single) feeds the sequence (sweep_vectors, sweep_tail);
+         * Count bounds the number of group / single calls; only the first
+         * Lanes lanes of the vectors are live.
+         */
+        template <Summation S, my_size_t Lanes, my_size_t Count, typename Sweep>
+        FORCE_INLINE static void sum_sequence(const Sweep &sweep, T &s, T &c) noexcept
+        {
+            using V = typename K::VecType;
+
+            if constexpr (S == Summation::Compensated)
+            {
+                // Half as many pairs as accumulators: two registers each
+                static constexpr my_size_t pairs = ReduceAccumulators / 2;
+                V sum[pairs], err[pairs];
+                unroll(typename make_index_seq<pairs>::type{}, [&](my_size_t a) FORCE_INLINE_LAMBDA
+                       { sum[a] = err[a] = K::set1(T{0}); });
+                sweep([&](const V *v) FORCE_INLINE_LAMBDA
+                      { unroll(typename make_index_seq<ReduceAccumulators>::type{}, [&](my_size_t a) FORCE_INLINE_LAMBDA
+                               { two_sum(sum[a % pairs], err[a % pairs], v[a]); }); },
+                      [&](V v) FORCE_INLINE_LAMBDA
+                      { two_sum(sum[0], err[0], v); });
+                // Pairs combine as a tree, still compensated, before one horizontal fold
+                tree<pairs>([&](my_size_t a, my_size_t b) FORCE_INLINE_LAMBDA
+                     {
+                         two_sum(sum[a], err[a], sum[b]);
+                         err[a] = K::add(err[a], err[b]);
+                     });
+                fold_lanes<Lanes>(s, c, sum[0], err[0]);
+            }
+            else
+            {
+                static constexpr my_size_t levels = [] {
+                    my_size_t l = 1;
+                    for (my_size_t n = Count; n > 1; n = (n + 1) / 2)
+                        ++l;
+                    return l;
+                }();
+
+                V stack[levels];
+                my_size_t depth = 0, pushed = 0;
+                auto push = [&](V part) FORCE_INLINE_LAMBDA
+                {
+                    // The trailing ones of `pushed` are the full levels to merge
+                    for (my_size_t n = pushed++; n & 1; n >>= 1)
+                        part = K::add(stack[--depth], part);
+                    stack[depth++] = part;
+                };
+                sweep([&](V *v) FORCE_INLINE_LAMBDA
+                      { push(combine_tree<ReduceOp::Sum>(v)); },
+                      [&](V v) FORCE_INLINE_LAMBDA
+                      { push(v); });
+                if (depth == 0)
+                    return;
+                V total = stack[--depth], err = K::set1(T{0});
+                while (depth > 0)
+                    two_sum(total, err, stack[--depth]);
+                fold_lanes<Lanes>(s, c, total, err);
+            }
+        }
+
+        template <Summation S, typename Expr>
+        FORCE_INLINE static T sum_contiguous(const Expr &expr) noexcept
+        {
+            using C = ContiguousSlices<Expr>;
+            T s{0}, c{0};
+
+            if constexpr (C::simdSteps > 0)
+                sum_sequence<S, simdWidth, C::numSlices * C::simdSteps>(
+                    [&](auto &&group, auto &&single) FORCE_INLINE_LAMBDA
+                    { sweep_vectors(expr, group, single); },
+                    s, c);
+
+            if constexpr (C::tail > 0)
+                sum_sequence<S, C::tail, C::numSlices>(
+                    [&](auto &&group, auto &&single) FORCE_INLINE_LAMBDA
+                    { sweep_tail(expr, group, single); },
+                    s, c);
+
+            return s + c;
+        }
+
+        /// Permuted expressions: the logical sequence, one element at a time (instantiated on GENERICARCH).
+        template <Summation S, typename Expr>
+        FORCE_INLINE static T sum_logical(const Expr &expr) noexcept
+        {
+            T s{0}, c{0};
+            sum_sequence<S, 1, Expr::TotalSize>(
+                [&](auto &&group, auto &&single) FORCE_INLINE_LAMBDA
+                { for_each_vec<Expr::TotalSize>([&](my_size_t i) FORCE_INLINE_LAMBDA
+                                                { return expr.template logical_evalu<T, 1, GENERICARCH>(i); },
+                                                group, single); },
+                s, c);
+            return s + c;
+        }
+
+        // ========================================================================
+        // AXIS REDUCTIONS
+        // ========================================================================
+        //
+        // The expression is walked as rows along its last axis. A row is
+        // PaddedLastDim apart in the physical layout (evalu), or LastDim apart
+        // in logical flats (logical_evalu) — used for permuted expressions and
+        // for unpadded rows that are not vector-aligned, where evalu's aligned
+        // loads would fault. Each row is simdSteps full vectors and one
+        // MaskedTail vector; padding is never read.
+        //
+        // Last axis (shape [.., n] → [..]): each row is combined into one
+        // vector, then its lanes horizontally into one output element.
+        //
+        //   row r: [v0 v1 v2 | t]  →  acc = v0 ∘ v1 ∘ v2  →  Σ lanes ∘ Σ tail lanes  →  out[r]
+        //
+        // Outer axis (shape [o, n, i.., L] → [o, i.., L]): the n rows that
+        // collapse onto one output row are combined vertically, lane for lane,
+        // AxisColBlock vectors at a time held in registers, and each finished
+        // vector is stored once. No horizontal step.
+        //
+        //   out row = in row(k=0) ∘ in row(k=1) ∘ … ∘ in row(k=n-1)
+        //
+        // Mean is Sum divided by n: Acc division for the last axis, one vector
+        // division per output vector otherwise (IntDivisor for integers).
+
+        static constexpr my_size_t AxisColBlock = 4;
+
+        /// Walk rows by logical flats: permuted, or unpadded rows that break vector alignment.
+        template <typename Expr>
+        static constexpr bool axis_rows_logical() noexcept
+        {
+            if constexpr (expression::traits<Expr>::IsPermuted)
+                return true;
+            else
+                return Expr::Layout::PadPolicyType::PaddedLastDim % simdWidth != 0;
+        }
+
+        template <typename Expr, bool Logical>
+        static constexpr my_size_t axis_row_stride() noexcept
+        {
+            if constexpr (Logical)
+                return Expr::Dim[Expr::NumDims - 1];
+            else
+                return Expr::Layout::PadPolicyType::PaddedLastDim;
+        }
+
+        /// Vector at column `col` of input row `row`.
+        template <bool Logical, my_size_t RowStride, typename KArch, typename Expr>
+        FORCE_INLINE static typename K::VecType row_load(const Expr &expr, my_size_t row, my_size_t col) noexcept
+        {
+            if constexpr (Logical)
+                return expr.template logical_evalu<T, Bits, KArch>(row * RowStride + col);
+            else
+                return expr.template evalu<T, Bits, KArch>(row * RowStride + col);
+        }
+
+        /// First Lanes lanes of v combined into acc.
+        template <ReduceOp Op, my_size_t Lanes>
+        FORCE_INLINE static Acc reduce_lanes(Acc acc, typename K::VecType v) noexcept
+        {
+            alignas(DATA_ALIGNAS) Acc tmp[simdWidth];
+            K::store(tmp, v);
+            for (my_size_t i = 0; i < Lanes; ++i)
+                acc = reduce_scalar_combine<Op>(acc, tmp[i]);
+            return acc;
+        }
+
+        /// Finished output vector: acc, or acc / n for Mean.
+        template <ReduceOp Op, my_size_t N>
+        FORCE_INLINE static typename K::VecType axis_finish(typename K::VecType acc) noexcept
+        {
+            if constexpr (Op != ReduceOp::Mean)
+                return acc;
+            else if constexpr (has_int_divisor_v<T>)
+            {
+                static constexpr IntDivisor<T> divisor{static_cast<T>(N)};
+                return Div<T, Bits, Arch>::apply(acc, divisor);
+            }
+            else
+                return K::div(acc, K::set1(static_cast<T>(N)));
+        }
+
+        template <ReduceOp Op, my_size_t Axis, typename Expr>
+        FORCE_INLINE static void reduce_axis_rows(T *output, const Expr &expr) noexcept
+        {
+            static_assert(Axis < Expr::NumDims, "reduce_axis: Axis out of range");
+
+            using OutPad = typename AxisReducedPadPolicy<Expr, Axis>::type;
+            static constexpr bool logical = axis_rows_logical<Expr>();
+            static constexpr my_size_t rowStride = axis_row_stride<Expr, logical>();
+            static constexpr my_size_t lastDim = Expr::Dim[Expr::NumDims - 1];
+            static constexpr my_size_t simdSteps = lastDim / simdWidth;
+            static constexpr my_size_t tailStart = simdSteps * simdWidth;
+            static constexpr my_size_t tail = lastDim - tailStart;
+            static constexpr my_size_t n = Expr::Dim[Axis];
+
+            if constexpr (Axis == Expr::NumDims - 1)
+            {
+                static constexpr my_size_t numRows = Expr::TotalSize / lastDim;
+                static constexpr my_size_t outLastDim = OutPad::LastDim;
+                static constexpr my_size_t outRowStride = OutPad::PaddedLastDim;
+
+                my_size_t out_row = 0, out_col = 0;
+                for (my_size_t row = 0; row < numRows; ++row)
+                {
+                    Acc result = reduce_identity<Op>();
+
+                    if constexpr (simdSteps > 0)
+                    {
+                        typename K::VecType acc = row_load<logical, rowStride, Arch>(expr, row, 0);
+                        for (my_size_t i = 1; i < simdSteps; ++i)
+                            acc = reduce_simd_combine<Op>(acc, row_load<logical, rowStride, Arch>(expr, row, i * simdWidth));
+                        result = reduce_lanes<Op, simdWidth>(result, acc);
+                    }
+
+                    if constexpr (tail > 0)
+                        result = reduce_lanes<Op, tail>(
+                            result, row_load<logical, rowStride, MaskedTail<Arch, tail>>(expr, row, tailStart));
+
+                    if constexpr (Op == ReduceOp::Mean)
+                        result = result / static_cast<Acc>(n);
+
+                    output[out_row * outRowStride + out_col] = static_cast<T>(result);
+                    if (++out_col == outLastDim)
+                    {
+                        for (my_size_t l = outLastDim; l < outRowStride; ++l)
+                            output[out_row * outRowStride + l] = T{0};
+                        out_col = 0;
+                        ++out_row;
+                    }
+                }
+            }
+            else
+            {
+                // Rows between Axis and the last axis: consecutive k are innerRows rows apart
+                static constexpr my_size_t innerRows = [] {
+                    my_size_t r = 1;
+                    for (my_size_t d = Axis + 1; d < Expr::NumDims - 1; ++d)
+                        r *= Expr::Dim[d];
+                    return r;
+                }();
+                static constexpr my_size_t outer = Expr::TotalSize / (n * innerRows * lastDim);
+                static constexpr my_size_t outRowStride = OutPad::PaddedLastDim;
+                static constexpr bool alignedOut = outRowStride % simdWidth == 0;
+
+                auto store = [](T *ptr, typename K::VecType v)
+                {
+                    if constexpr (alignedOut)
+                        K::store(ptr, v);
+                    else
+                        K::storeu(ptr, v);
+                };
+
+                for (my_size_t o = 0; o < outer; ++o)
+                    for (my_size_t j = 0; j < innerRows; ++j)
+                    {
+                        const my_size_t row0 = o * n * innerRows + j;
+                        T *out = output + (o * innerRows + j) * outRowStride;
+
+                        my_size_t c = 0;
+                        for (; c + AxisColBlock * simdWidth <= tailStart; c += AxisColBlock * simdWidth)
+                        {
+                            typename K::VecType acc[AxisColBlock];
+                            for (my_size_t b = 0; b < AxisColBlock; ++b)
+                                acc[b] = row_load<logical, rowStride, Arch>(expr, row0, c + b * simdWidth);
+                            for (my_size_t k = 1; k < n; ++k)
+                                for (my_size_t b = 0; b < AxisColBlock; ++b)
+                                    acc[b] = reduce_simd_combine<Op>(
+                                        acc[b], row_load<logical, rowStride, Arch>(expr, row0 + k * innerRows, c + b * simdWidth));
+                            for (my_size_t b = 0; b < AxisColBlock; ++b)
+                                store(out + c + b * simdWidth, axis_finish<Op, n>(acc[b]));
+                        }
+
+                        for (; c < tailStart; c += simdWidth)
+                        {
+                            typename K::VecType acc = row_load<logical, rowStride, Arch>(expr, row0, c);
+                            for (my_size_t k = 1; k < n; ++k)
+                                acc = reduce_simd_combine<Op>(acc, row_load<logical, rowStride, Arch>(expr, row0 + k * innerRows, c));
+                            store(out + c, axis_finish<Op, n>(acc));
+                        }
+
+                        if constexpr (tail > 0)
+                        {
+                            typename K::VecType acc = row_load<logical, rowStride, MaskedTail<Arch, tail>>(expr, row0, tailStart);
+                            for (my_size_t k = 1; k < n; ++k)
+                                acc = reduce_simd_combine<Op>(
+                                    acc, row_load<logical, rowStride, MaskedTail<Arch, tail>>(expr, row0 + k * innerRows, tailStart));
+                            K::maskstore(out + tailStart, axis_finish<Op, n>(acc), tail);
+                        }
+
+                        for (my_size_t l = lastDim; l < outRowStride; ++l)
+                            out[l] = T{0};
+                    }
+            }
+        }
+
+        // ========================================================================
+        // ARG REDUCTIONS
+        // ========================================================================
+        //
+        // argmin / argmax walk the same rows as the axis reductions. Next to
+        // the best-value vector, an index vector holds per lane the step at
+        // which that value was seen, in T, so one K::select_lt on the same
+        // comparison moves value and index together:
+        //
+        //   better  = v < best                 (argmax: best < v)
+        //   bestIdx = better ? step : bestIdx
+        //   best    = better ? v    : best
+        //
+        // The comparison is strict, so every lane keeps its first extremum.
+        // Lanes start from the first vector, so they only ever hold real
+        // elements. The horizontal resolve maps (step, lane) back to an element
+        // index and picks the best value, the lowest index on ties. A tail
+        // vector (MaskedTail) is resolved over its live lanes only; its dead
+        // lanes are never compared. The first resolve of a row (or tensor)
+        // seeds (bestV, bestI) from its lane 0: an identity seed would beat
+        // a row of +inf (argmin) or -inf (argmax) and leave no index.
+        //
+        // Last axis: steps count vectors along the row, one resolve per row.
+        // Outer axis: steps are k, no horizontal resolve — each lane's index is
+        // already the answer for its column.
+        //
+        // Kernels without select_lt, and step counts T cannot hold exactly
+        // (float past 2^24), fall back to a scalar logical_evalu loop. NaNs
+        // compare false, so with NaNs present the result is unspecified.
+
+        /// Vectorized when the kernel has select_lt and T counts 0..Steps exactly.
+        template <my_size_t Steps>
+        static constexpr bool arg_vectorized() noexcept
+        {
+            if constexpr (!requires(typename K::VecType v) { K::select_lt(v, v, v, v); })
+                return false;
+            else
+                return static_cast<my_size_t>(static_cast<T>(Steps)) == Steps &&
+                       static_cast<my_size_t>(static_cast<T>(Steps - 1)) == Steps - 1;
+        }
+
+        template <ReduceOp Op>
+        FORCE_INLINE static bool arg_better(T v, T best) noexcept
+        {
+            static_assert(Op == ReduceOp::Min || Op == ReduceOp::Max, "arg_reduce: Min or Max");
+            if constexpr (Op == ReduceOp::Min)
+                return v < best;
+            else
+                return best < v;
+        }
+
+        template <ReduceOp Op>
+        FORCE_INLINE static void arg_update(typename K::VecType v, typename K::VecType step,
+                                            typename K::VecType &best, typename K::VecType &bestIdx) noexcept
+        {
+            if constexpr (Op == ReduceOp::Min)
+            {
+                bestIdx = K::select_lt(v, best, step, bestIdx);
+                best = K::select_lt(v, best, v, best);
+            }
+            else
+            {
+                bestIdx = K::select_lt(best, v, step, bestIdx);
+                best = K::select_lt(best, v, v, best);
+            }
+        }
+
+        /// Fold the first Lanes lanes into (bestV, bestI); index_of(step, lane) is the element index.
+        /// Seed: (bestV, bestI) hold nothing yet, lane 0 is taken as is.
+        template <ReduceOp Op, my_size_t Lanes, bool Seed, typename IndexOf>
+        FORCE_INLINE static void arg_resolve(typename K::VecType best, typename K::VecType bestIdx,
+                                             const IndexOf &index_of, T &bestV, my_size_t &bestI) noexcept
+        {
+            alignas(DATA_ALIGNAS) T v[simdWidth];
+            alignas(DATA_ALIGNAS) T step[simdWidth];
+            K::store(v, best);
+            K::store(step, bestIdx);
+            if constexpr (Seed)
+            {
+                bestV = v[0];
+                bestI = index_of(static_cast<my_size_t>(step[0]), 0);
+            }
+            for (my_size_t l = Seed ? 1 : 0; l < Lanes; ++l)
+            {
+                const my_size_t i = index_of(static_cast<my_size_t>(step[l]), l);
+                if (arg_better<Op>(v[l], bestV) || (!arg_better<Op>(bestV, v[l]) && i < bestI))
+                {
+                    bestV = v[l];
+                    bestI = i;
+                }
+            }
+        }
+
+        template <ReduceOp Op, typename Expr>
+        FORCE_INLINE static my_size_t arg_reduce_rows(const Expr &expr) noexcept
+        {
+            static constexpr bool logical = axis_rows_logical<Expr>();
+            static constexpr my_size_t rowStride = axis_row_stride<Expr, logical>();
+            static constexpr my_size_t lastDim = Expr::Dim[Expr::NumDims - 1];
+            static constexpr my_size_t simdSteps = lastDim / simdWidth;
+            static constexpr my_size_t tailStart = simdSteps * simdWidth;
+            static constexpr my_size_t tail = lastDim - tailStart;
+            static constexpr my_size_t numRows = Expr::TotalSize / lastDim;
+
+            if constexpr (!arg_vectorized<numRows * (simdSteps > 0 ? simdSteps : 1)>())
+            {
+                T bestV = expr.template logical_evalu<T, 1, GENERICARCH>(0);
+                my_size_t bestI = 0;
+                for (my_size_t i = 1; i < Expr::TotalSize; ++i)
+                {
+                    const T v = expr.template logical_evalu<T, 1, GENERICARCH>(i);
+                    if (arg_better<Op>(v, bestV))
+                    {
+                        bestV = v;
+                        bestI = i;
+                    }
+                }
+                return bestI;
+            }
+            else
+            {
+                T bestV{};
+                my_size_t bestI = 0;
+                const typename K::VecType one = K::set1(T(1));
+
+                if constexpr (simdSteps > 0)
+                {
+                    // Steps run over the whole tensor: step s is row s / simdSteps, vector s % simdSteps
+                    typename K::VecType best = row_load<logical, rowStride, Arch>(expr, 0, 0);
+                    typename K::VecType bestIdx = K::set1(T(0));
+                    typename K::VecType step = K::set1(T(0));
+                    for (my_size_t row = 0; row < numRows; ++row)
+                        for (my_size_t i = 0; i < simdSteps; ++i)
+                        {
+                            arg_update<Op>(row_load<logical, rowStride, Arch>(expr, row, i * simdWidth), step, best, bestIdx);
+                            step = K::add(step, one);
+                        }
+                    arg_resolve<Op, simdWidth, true>(
+                        best, bestIdx, [](my_size_t s, my_size_t l)
+                        { return (s / simdSteps) * lastDim + (s % simdSteps) * simdWidth + l; },
+                        bestV, bestI);
+                }
+
+                if constexpr (tail > 0)
+                {
+                    // One tail vector per row: step is the row
+                    using KT = MaskedTail<Arch, tail>;
+                    typename K::VecType best = row_load<logical, rowStride, KT>(expr, 0, tailStart);
+                    typename K::VecType bestIdx = K::set1(T(0));
+                    typename K::VecType step = one;
+                    for (my_size_t row = 1; row < numRows; ++row)
+                    {
+                        arg_update<Op>(row_load<logical, rowStride, KT>(expr, row, tailStart), step, best, bestIdx);
+                        step = K::add(step, one);
+                    }
+                    arg_resolve<Op, tail, simdSteps == 0>(
+                        best, bestIdx, [](my_size_t s, my_size_t l)
+                        { return s * lastDim + tailStart + l; },
+                        bestV, bestI);
+                }
+
+                return bestI;
+            }
+        }
+
+        template <ReduceOp Op, my_size_t Axis, typename Expr>
+        FORCE_INLINE static void arg_reduce_axis_rows(my_size_t *output, const Expr &expr) noexcept
+        {
+            static_assert(Axis < Expr::NumDims, "arg_reduce_axis: Axis out of range");
+
+            using OutPad = typename AxisReducedPadPolicy<Expr, Axis, my_size_t>::type;
+            static constexpr bool logical = axis_rows_logical<Expr>();
+            static constexpr my_size_t rowStride = axis_row_stride<Expr, logical>();
+            static constexpr my_size_t lastDim = Expr::Dim[Expr::NumDims - 1];
+            static constexpr my_size_t simdSteps = lastDim / simdWidth;
+            static constexpr my_size_t tailStart = simdSteps * simdWidth;
+            static constexpr my_size_t tail = lastDim - tailStart;
+            static constexpr my_size_t n = Expr::Dim[Axis];
+            static constexpr my_size_t outRowStride = OutPad::PaddedLastDim;
+
+            if constexpr (Axis == Expr::NumDims - 1)
+            {
+                static constexpr my_size_t numRows = Expr::TotalSize / lastDim;
+                static constexpr my_size_t outLastDim = OutPad::LastDim;
+
+                my_size_t out_row = 0, out_col = 0;
+                for (my_size_t row = 0; row < numRows; ++row)
+                {
+                    T bestV{};
+                    my_size_t bestI = 0;
+
+                    if constexpr (!arg_vectorized<(simdSteps > 0 ? simdSteps : 1)>())
+                    {
+                        bestV = expr.template logical_evalu<T, 1, GENERICARCH>(row * lastDim);
+                        bestI = 0;
+                        for (my_size_t col = 1; col < lastDim; ++col)
+                        {
+                            const T v = expr.template logical_evalu<T, 1, GENERICARCH>(row * lastDim + col);
+                            if (arg_better<Op>(v, bestV))
+                            {
+                                bestV = v;
+                                bestI = col;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        if constexpr (simdSteps > 0)
+                        {
+                            const typename K::VecType one = K::set1(T(1));
+                            typename K::VecType best = row_load<logical, rowStride, Arch>(expr, row, 0);
+                            typename K::VecType bestIdx = K::set1(T(0));
+                            typename K::VecType step = one;
+                            for (my_size_t i = 1; i < simdSteps; ++i)
+                            {
+                                arg_update<Op>(row_load<logical, rowStride, Arch>(expr, row, i * simdWidth), step, best, bestIdx);
+                                step = K::add(step, one);
+                            }
+                            arg_resolve<Op, simdWidth, true>(
+                                best, bestIdx, [](my_size_t s, my_size_t l)
+                                { return s * simdWidth + l; },
+                                bestV, bestI);
+                        }
+
+                        if constexpr (tail > 0)
+                            arg_resolve<Op, tail, simdSteps == 0>(
+                                row_load<logical, rowStride, MaskedTail<Arch, tail>>(expr, row, tailStart), K::set1(T(0)),
+                                [](my_size_t, my_size_t l)
+                                { return tailStart + l; },
+                                bestV, bestI);
+                    }
+
+                    output[out_row * outRowStride + out_col] = bestI;
+                    if (++out_col == outLastDim)
+                    {
+                        for (my_size_t l = outLastDim; l < outRowStride; ++l)
+                            output[out_row * outRowStride + l] = 0;
+                        out_col = 0;
+                        ++out_row;
+                    }
+                }
+            }
+            else
+            {
+                static constexpr my_size_t innerRows = [] {
+                    my_size_t r = 1;
+                    for (my_size_t d = Axis + 1; d < Expr::NumDims - 1; ++d)
+                        r *= Expr::Dim[d];
+                    return r;
+                }();
+                static constexpr my_size_t outer = Expr::TotalSize / (n * innerRows * lastDim);
+
+                // Each lane's step (k) is its column's answer
+                auto store_indices = []<my_size_t Lanes>(my_size_t *out, typename K::VecType bestIdx)
+                {
+                    alignas(DATA_ALIGNAS) T step[simdWidth];
+                    K::store(step, bestIdx);
+                    for (my_size_t l = 0; l < Lanes; ++l)
+                        out[l] = static_cast<my_size_t>(step[l]);
+                };
+
+                for (my_size_t o = 0; o < outer; ++o)
+                    for (my_size_t j = 0; j < innerRows; ++j)
+                    {
+                        const my_size_t row0 = o * n * innerRows + j;
+                        my_size_t *out = output + (o * innerRows + j) * outRowStride;
+
+                        if constexpr (!arg_vectorized<n>())
+                        {
+                            for (my_size_t col = 0; col < lastDim; ++col)
+                            {
+                                T bestV = expr.template logical_evalu<T, 1, GENERICARCH>(row0 * lastDim + col);
+                                my_size_t bestI = 0;
+                                for (my_size_t k = 1; k < n; ++k)
+                                {
+                                    const T v = expr.template logical_evalu<T, 1, GENERICARCH>((row0 + k * innerRows) * lastDim + col);
+                                    if (arg_better<Op>(v, bestV))
+                                    {
+                                        bestV = v;
+                                        bestI = k;
+                                    }
+                                }
+                                out[col] = bestI;
+                            }
+                        }
+                        else
+                        {
+                            const typename K::VecType one = K::set1(T(1));
+
+                            my_size_t c = 0;
+                            for (; c + AxisColBlock * simdWidth <= tailStart; c += AxisColBlock * simdWidth)
+                            {
+                                typename K::VecType best[AxisColBlock], bestIdx[AxisColBlock];
+                                for (my_size_t b = 0; b < AxisColBlock; ++b)
+                                {
+                                    best[b] = row_load<logical, rowStride, Arch>(expr, row0, c + b * simdWidth);
+                                    bestIdx[b] = K::set1(T(0));
+                                }
+                                typename K::VecType step = one;
+                                for (my_size_t k = 1; k < n; ++k)
+                                {
+                                    for (my_size_t b = 0; b < AxisColBlock; ++b)
+                                        arg_update<Op>(row_load<logical, rowStride, Arch>(expr, row0 + k * innerRows, c + b * simdWidth),
+                                                       step, best[b], bestIdx[b]);
+                                    step = K::add(step, one);
+                                }
+                                for (my_size_t b = 0; b < AxisColBlock; ++b)
+                                    store_indices.template operator()<simdWidth>(out + c + b * simdWidth, bestIdx[b]);
+                            }
+
+                            for (; c < tailStart; c += simdWidth)
+                            {
+                                typename K::VecType best = row_load<logical, rowStride, Arch>(expr, row0, c);
+                                typename K::VecType bestIdx = K::set1(T(0));
+                                typename K::VecType step = one;
+                                for (my_size_t k = 1; k < n; ++k)
+                                {
+                                    arg_update<Op>(row_load<logical, rowStride, Arch>(expr, row0 + k * innerRows, c), step, best, bestIdx);
+                                    step = K::add(step, one);
+                                }
+                                store_indices.template operator()<simdWidth>(out + c, bestIdx);
+                            }
+
+                            if constexpr (tail > 0)
+                            {
+                                using KT = MaskedTail<Arch, tail>;
+                                typename K::VecType best = row_load<logical, rowStride, KT>(expr, row0, tailStart);
+                                typename K::VecType bestIdx = K::set1(T(0));
+                                typename K::VecType step = one;
+                                for (my_size_t k = 1; k < n; ++k)
+                                {
+                                    arg_update<Op>(row_load<logical, rowStride, KT>(expr, row0 + k * innerRows, tailStart), step, best, bestIdx);
+                                    step = K::add(step, one);
+                                }
+                                store_indices.template operator()<tail>(out + tailStart, bestIdx);
+                            }
+                        }
+
+                        for (my_size_t l = lastDim; l < outRowStride; ++l)
+                            out[l] = 0;
+                    }
+            }
+        }
     };
 
 } // namespace detail
@@ -0,0 +1,226 @@
+#ifndef __AVX2_COMPLEX_MICROKERNEL_H__
+#define __AVX2_COMPLEX_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+#include "complex.h"
+
+// ============================================================================
+// AVX2 (256-bit) complex specializations
+// ============================================================================
+// Interleaved storage [re, im, re, im, ...]: four Complex<float> or two
+// Complex<double> per vector. The product a·b is
+//
+//   fmaddsub(dup_re(a), b, dup_im(a) · swap(b))
+//
+// (− on real lanes, + on imaginary lanes), and a·b + c nests a second
+// fmaddsub, so a complex multiply-add is two FMAs plus in-lane shuffles
+// (moveldup / movehdup / permute). In the GEMM register tile the dups of
+// a broadcast A element and the swap of each B vector are shared across
+// the tile, leaving two FMAs per accumulator per k.
+
+template <>
+struct Microkernel<Complex<float>, 256, X86_AVX>
+{
+    static constexpr my_size_t simdWidth = 4; // 256 bits / 64 bits per Complex<float> = 4
+    // GEMM tiling constants: MR × NR_VECS accumulators + 2·NR_VECS (b, swap(b)) + 2 (re/im of a)
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 2;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 8
+    // GEMM cache-blocking constants (packed panels, same bytes as the double kernel)
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 504;
+    using VecType = __m256;
+    using ScalarType = Complex<float>;
+    using R = Microkernel<float, 256, X86_AVX>;
+
+    FORCE_INLINE static const float *flat(const ScalarType *p) noexcept { return reinterpret_cast<const float *>(p); }
+    FORCE_INLINE static float *flat(ScalarType *p) noexcept { return reinterpret_cast<float *>(p); }
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm256_load_ps(flat(ptr)); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm256_loadu_ps(flat(ptr)); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm256_store_ps(flat(ptr), val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm256_storeu_ps(flat(ptr), val); }
+    FORCE_INLINE static VecType set1(ScalarType s) noexcept { return _mm256_setr_ps(s.re, s.im, s.re, s.im, s.re, s.im, s.re, s.im); }
+
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return R::maskload(flat(ptr), 2 * n); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { R::maskstore(flat(ptr), val, 2 * n); }
+
+    // In-pair shuffles: [re, re], [im, im], [im, re]
+    FORCE_INLINE static VecType dup_re(VecType v) noexcept { return _mm256_moveldup_ps(v); }
+    FORCE_INLINE static VecType dup_im(VecType v) noexcept { return _mm256_movehdup_ps(v); }
+    FORCE_INLINE static VecType swap(VecType v) noexcept { return _mm256_permute_ps(v, 0xB1); }
+
+    // a − b on real lanes, a + b on imaginary lanes
+    FORCE_INLINE static VecType addsub(VecType a, VecType b) noexcept { return _mm256_addsub_ps(a, b); }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept
+    {
+        return _mm256_xor_ps(v, _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f));
+    }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm256_add_ps(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm256_add_ps(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm256_sub_ps(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm256_sub_ps(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm256_sub_ps(set1(a), b); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+        return _mm256_fmaddsub_ps(dup_re(a), b, _mm256_mul_ps(dup_im(a), swap(b)));
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(set1(b), a); }
+
+    // a·conj(b) / |b|²
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        __m256 bb = _mm256_mul_ps(b, b);
+        return _mm256_div_ps(mul(a, conj(b)), _mm256_add_ps(bb, swap(bb)));
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return div(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return div(set1(a), b); }
+
+    // fmadd: a*b + c
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm256_fmaddsub_ps(dup_re(a), b, _mm256_fmaddsub_ps(dup_im(a), swap(b), c));
+    }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(set1(b), a, c); }
+
+    // fmsub: a*b - c
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm256_sub_ps(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(set1(b), a, c); }
+
+    // fnmadd: -(a*b) + c
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm256_sub_ps(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(set1(b), a, c); }
+
+    // fnmsub: -(a*b) - c
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm256_sub_ps(_mm256_xor_ps(mul(a, b), _mm256_set1_ps(-0.0f)), c);
+    }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(set1(b), a, c); }
+
+    // Each Complex<float> is one 64-bit element of a double gather
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        __m128i vindex = _mm_setr_epi32(static_cast<int32_t>(indices[0]), static_cast<int32_t>(indices[1]),
+                                        static_cast<int32_t>(indices[2]), static_cast<int32_t>(indices[3]));
+        return _mm256_castpd_ps(_mm256_i32gather_pd(reinterpret_cast<const double *>(base), vindex, sizeof(ScalarType)));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        alignas(32) ScalarType tmp[simdWidth];
+        store(tmp, val);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            base[indices[i]] = tmp[i];
+    }
+
+    // |Δre| ≤ tol.re and |Δim| ≤ tol.re on every lane
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        return R::all_within_tolerance(a, b, tol.re);
+    }
+};
+
+template <>
+struct Microkernel<Complex<double>, 256, X86_AVX>
+{
+    static constexpr my_size_t simdWidth = 2; // 256 bits / 128 bits per Complex<double> = 2
+    // GEMM tiling constants: MR × NR_VECS accumulators + 2·NR_VECS (b, swap(b)) + 2 (re/im of a)
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 2;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 4
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 64;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 252;
+    using VecType = __m256d;
+    using ScalarType = Complex<double>;
+    using R = Microkernel<double, 256, X86_AVX>;
+
+    FORCE_INLINE static const double *flat(const ScalarType *p) noexcept { return reinterpret_cast<const double *>(p); }
+    FORCE_INLINE static double *flat(ScalarType *p) noexcept { return reinterpret_cast<double *>(p); }
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm256_load_pd(flat(ptr)); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm256_loadu_pd(flat(ptr)); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm256_store_pd(flat(ptr), val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm256_storeu_pd(flat(ptr), val); }
+    FORCE_INLINE static VecType set1(ScalarType s) noexcept { return _mm256_setr_pd(s.re, s.im, s.re, s.im); }
+
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return R::maskload(flat(ptr), 2 * n); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { R::maskstore(flat(ptr), val, 2 * n); }
+
+    FORCE_INLINE static VecType dup_re(VecType v) noexcept { return _mm256_movedup_pd(v); }
+    FORCE_INLINE static VecType dup_im(VecType v) noexcept { return _mm256_permute_pd(v, 0xF); }
+    FORCE_INLINE static VecType swap(VecType v) noexcept { return _mm256_permute_pd(v, 0x5); }
+
+    FORCE_INLINE static VecType addsub(VecType a, VecType b) noexcept { return _mm256_addsub_pd(a, b); }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept { return _mm256_xor_pd(v, _mm256_setr_pd(0.0, -0.0, 0.0, -0.0)); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm256_add_pd(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm256_add_pd(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm256_sub_pd(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm256_sub_pd(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm256_sub_pd(set1(a), b); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+        return _mm256_fmaddsub_pd(dup_re(a), b, _mm256_mul_pd(dup_im(a), swap(b)));
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(set1(b), a); }
+
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        __m256d bb = _mm256_mul_pd(b, b);
+        return _mm256_div_pd(mul(a, conj(b)), _mm256_add_pd(bb, swap(bb)));
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return div(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return div(set1(a), b); }
+
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm256_fmaddsub_pd(dup_re(a), b, _mm256_fmaddsub_pd(dup_im(a), swap(b), c));
+    }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm256_sub_pd(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm256_sub_pd(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm256_sub_pd(_mm256_xor_pd(mul(a, b), _mm256_set1_pd(-0.0)), c);
+    }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(set1(b), a, c); }
+
+    // Two 128-bit loads, one per number
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        __m256d lo = _mm256_castpd128_pd256(_mm_loadu_pd(flat(base + indices[0])));
+        return _mm256_insertf128_pd(lo, _mm_loadu_pd(flat(base + indices[1])), 1);
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        _mm_storeu_pd(flat(base + indices[0]), _mm256_castpd256_pd128(val));
+        _mm_storeu_pd(flat(base + indices[1]), _mm256_extractf128_pd(val, 1));
+    }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        return R::all_within_tolerance(a, b, tol.re);
+    }
+};
+
+#endif // __AVX2_COMPLEX_MICROKERNEL_H__
@@ -0,0 +1,123 @@
+#ifndef __AVX2_HALF_MICROKERNEL_H__
+#define __AVX2_HALF_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+#include "fused/microkernels/half_microkernel.h"
+
+// ============================================================================
+// AVX2 (256-bit) Half / BFloat16 storage: 8 lanes, widened to __m256
+// ============================================================================
+// binary16 uses F16C (every AVX2 CPU has it; the runtime-dispatched AVX2
+// target enables it). Built with -mavx2 but without -mf16c, it falls back
+// to the integer conversions of the SSE2 kernel, 8 lanes wide.
+
+namespace detail
+{
+    /// Eight 32-bit lanes holding 16-bit values → 128 bits, packed.
+    FORCE_INLINE __m128i avx_pack_u16(__m256i v) noexcept
+    {
+        // packus works per 128-bit half: [a0..a3 a0..a3 | a4..a7 a4..a7] → qwords 0 and 2
+        return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(v, v), 0x08));
+    }
+
+    /// float → bfloat16 in the low 16 bits of each 32-bit lane, round to nearest even.
+    FORCE_INLINE __m256i avx_float_to_bf16(__m256 f) noexcept
+    {
+        const __m256i u = _mm256_castps_si256(f);
+        const __m256i hi = _mm256_srli_epi32(u, 16);
+        const __m256i rounded = _mm256_srli_epi32(
+            _mm256_add_epi32(u, _mm256_add_epi32(_mm256_set1_epi32(0x7fff), _mm256_and_si256(hi, _mm256_set1_epi32(1)))), 16);
+        const __m256i nan = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+        return _mm256_blendv_epi8(rounded, _mm256_or_si256(hi, _mm256_set1_epi32(0x40)), nan);
+    }
+
+#if !defined(__F16C__) && !defined(TESSERACT_DISPATCH_AVX2)
+    /// Eight binary16 values (low 16 bits of each 32-bit lane) → float.
+    FORCE_INLINE __m256 avx_half_to_float(__m256i h) noexcept
+    {
+        const __m256i expmant = _mm256_and_si256(h, _mm256_set1_epi32(0x7fff));
+        const __m256i sign = _mm256_slli_epi32(_mm256_xor_si256(h, expmant), 16);
+        const __m256 scaled = _mm256_mul_ps(_mm256_castsi256_ps(_mm256_slli_epi32(expmant, 13)),
+                                            _mm256_castsi256_ps(_mm256_set1_epi32((254 - 15) << 23)));
+        const __m256i infnan = _mm256_and_si256(_mm256_cmpgt_epi32(expmant, _mm256_set1_epi32(0x7bff)),
+                                                _mm256_set1_epi32(255 << 23));
+        return _mm256_or_ps(scaled, _mm256_castsi256_ps(_mm256_or_si256(sign, infnan)));
+    }
+
+    /// float → binary16 in the low 16 bits of each 32-bit lane, round to nearest even.
+    FORCE_INLINE __m256i avx_float_to_half(__m256 f) noexcept
+    {
+        __m256i u = _mm256_castps_si256(f);
+        const __m256i sign = _mm256_and_si256(u, _mm256_set1_epi32(static_cast<int>(0x80000000u)));
+        u = _mm256_xor_si256(u, sign);
+
+        const __m256i big = _mm256_cmpgt_epi32(u, _mm256_set1_epi32(((127 + 16) << 23) - 1));
+        const __m256i nan = _mm256_cmpgt_epi32(u, _mm256_set1_epi32(255 << 23));
+        const __m256i infnan = _mm256_or_si256(_mm256_set1_epi32(0x7c00), _mm256_and_si256(nan, _mm256_set1_epi32(0x0200)));
+
+        const __m256i magic = _mm256_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+        const __m256i sub = _mm256_cmpgt_epi32(_mm256_set1_epi32(113 << 23), u);
+        const __m256i subv = _mm256_sub_epi32(
+            _mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(u), _mm256_castsi256_ps(magic))), magic);
+
+        const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(u, 13), _mm256_set1_epi32(1));
+        const __m256i normv = _mm256_srli_epi32(
+            _mm256_add_epi32(_mm256_add_epi32(u, _mm256_set1_epi32(static_cast<int>((15u - 127u) << 23) + 0xfff)), odd), 13);
+
+        const __m256i h = _mm256_blendv_epi8(_mm256_blendv_epi8(normv, subv, sub), infnan, big);
+        return _mm256_or_si256(h, _mm256_srli_epi32(sign, 16));
+    }
+#endif
+} // namespace detail
+
+struct AvxHalfConvert
+{
+    FORCE_INLINE static __m256 load(const Half *ptr) noexcept
+    {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+#if defined(__F16C__) || defined(TESSERACT_DISPATCH_AVX2)
+        return _mm256_cvtph_ps(h);
+#else
+        return detail::avx_half_to_float(_mm256_cvtepu16_epi32(h));
+#endif
+    }
+
+    FORCE_INLINE static void store(Half *ptr, __m256 val) noexcept
+    {
+#if defined(__F16C__) || defined(TESSERACT_DISPATCH_AVX2)
+        const __m128i h = _mm256_cvtps_ph(val, _MM_FROUND_TO_NEAREST_INT);
+#else
+        const __m128i h = detail::avx_pack_u16(detail::avx_float_to_half(val));
+#endif
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), h);
+    }
+};
+
+struct AvxBf16Convert
+{
+    FORCE_INLINE static __m256 load(const BFloat16 *ptr) noexcept
+    {
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(b), 16));
+    }
+
+    FORCE_INLINE static void store(BFloat16 *ptr, __m256 val) noexcept
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), detail::avx_pack_u16(detail::avx_float_to_bf16(val)));
+    }
+};
+
+template <>
+struct Microkernel<Half, 256, X86_AVX>
+    : HalfMicrokernel<Half, Microkernel<float, 256, X86_AVX>, AvxHalfConvert>
+{
+};
+
+template <>
+struct Microkernel<BFloat16, 256, X86_AVX>
+    : HalfMicrokernel<BFloat16, Microkernel<float, 256, X86_AVX>, AvxBf16Convert>
+{
+};
+
+#endif // __AVX2_HALF_MICROKERNEL_H__
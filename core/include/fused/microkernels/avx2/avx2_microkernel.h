@@ -12,6 +12,9 @@ struct X86_AVX
 // ============================================================================
 // AVX2 (256-bit) specializations
 // ============================================================================
+// Tails: maskload / maskstore touch only the first n lanes (n ≤ simdWidth)
+// through a lane mask (vpmaskmov), so a partial vector never reads or writes
+// past n. Masked-off lanes of maskload are zero.
 
 template <>
 struct Microkernel<float, 256, X86_AVX>
@@ -22,6 +25,10 @@ struct Microkernel<float, 256, X86_AVX>
     static constexpr my_size_t MR = 4;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 24
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 256; // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 64;  // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 1008; // B block width    → KC × NC packed B in L3
     using VecType = __m256;
     using ScalarType = float;
 
@@ -31,6 +38,10 @@ struct Microkernel<float, 256, X86_AVX>
     FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm256_storeu_ps(ptr, val); }
     FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm256_set1_ps(scalar); }
 
+    FORCE_INLINE static __m256i tail_mask(my_size_t n) noexcept { return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(n)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)); }
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return _mm256_maskload_ps(ptr, tail_mask(n)); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { _mm256_maskstore_ps(ptr, tail_mask(n), val); }
+
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm256_add_ps(a, b); }
     FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm256_add_ps(a, set1(b)); }
 
@@ -97,6 +108,31 @@ struct Microkernel<float, 256, X86_AVX>
             base[indices[i]] = tmp[i];
     }
 
+    /// In-register 8×8 transpose: lane j of r[i] ↔ lane i of r[j]
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        // Interleave row pairs, then 2×2 blocks within each 128-bit half,
+        // then swap the halves
+        VecType t[8], s[8];
+        for (int i = 0; i < 8; i += 2)
+        {
+            t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+            t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+        }
+        for (int i = 0; i < 8; i += 4)
+        {
+            s[i] = _mm256_shuffle_ps(t[i], t[i + 2], 0x44);
+            s[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], 0xEE);
+            s[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], 0x44);
+            s[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], 0xEE);
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            r[i] = _mm256_permute2f128_ps(s[i], s[i + 4], 0x20);
+            r[i + 4] = _mm256_permute2f128_ps(s[i], s[i + 4], 0x31);
+        }
+    }
+
     FORCE_INLINE static VecType abs(VecType v) noexcept
     {
         // Clear sign bit: AND with 0x7FFFFFFF
@@ -104,6 +140,46 @@ struct Microkernel<float, 256, X86_AVX>
         return _mm256_andnot_ps(sign_mask, v);
     }
 
+    // ============================================================================
+    // Elementwise math primitives (building blocks of vector_math.h)
+    // ============================================================================
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept { return _mm256_sqrt_ps(v); }
+
+    // Round to nearest, ties to even
+    FORCE_INLINE static VecType round(VecType v) noexcept { return _mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    // a < b ? x : y, lane-wise (false for NaN)
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+    }
+
+    // Magnitude of mag, sign of sgn
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        __m256 sign_mask = _mm256_set1_ps(-0.0f);
+        return _mm256_or_ps(_mm256_andnot_ps(sign_mask, mag), _mm256_and_ps(sign_mask, sgn));
+    }
+
+    // 2^n for integral n in [-126, 127]
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept
+    {
+        __m256i e = _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+    }
+
+    // Unbiased exponent floor(log2 v) and mantissa v / 2^e ∈ [1, 2), for positive normal v
+    FORCE_INLINE static VecType getexp(VecType v) noexcept
+    {
+        __m256i e = _mm256_srli_epi32(_mm256_castps_si256(v), 23);
+        return _mm256_cvtepi32_ps(_mm256_sub_epi32(e, _mm256_set1_epi32(127)));
+    }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept
+    {
+        __m256i m = _mm256_and_si256(_mm256_castps_si256(v), _mm256_set1_epi32(0x007FFFFF));
+        return _mm256_castsi256_ps(_mm256_or_si256(m, _mm256_set1_epi32(0x3F800000)));
+    }
+
     FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
     {
         __m256 diff = _mm256_sub_ps(a, b);
@@ -124,6 +200,10 @@ struct Microkernel<double, 256, X86_AVX>
     static constexpr my_size_t MR = 4;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 12
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 128; // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 64;  // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 504; // B block width     → KC × NC packed B in L3
     using VecType = __m256d;
     using ScalarType = double;
 
@@ -133,6 +213,10 @@ struct Microkernel<double, 256, X86_AVX>
     FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm256_storeu_pd(ptr, val); }
     FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm256_set1_pd(scalar); }
 
+    FORCE_INLINE static __m256i tail_mask(my_size_t n) noexcept { return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(n)), _mm256_setr_epi64x(0, 1, 2, 3)); }
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return _mm256_maskload_pd(ptr, tail_mask(n)); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { _mm256_maskstore_pd(ptr, tail_mask(n), val); }
+
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm256_add_pd(a, b); }
     FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm256_add_pd(a, set1(b)); }
 
@@ -183,12 +267,67 @@ struct Microkernel<double, 256, X86_AVX>
             base[indices[i]] = tmp[i];
     }
 
+    /// In-register 4×4 transpose: lane j of r[i] ↔ lane i of r[j]
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        const VecType t0 = _mm256_unpacklo_pd(r[0], r[1]);
+        const VecType t1 = _mm256_unpackhi_pd(r[0], r[1]);
+        const VecType t2 = _mm256_unpacklo_pd(r[2], r[3]);
+        const VecType t3 = _mm256_unpackhi_pd(r[2], r[3]);
+        r[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+        r[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+        r[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+        r[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
     FORCE_INLINE static VecType abs(VecType v) noexcept
     {
         __m256d sign_mask = _mm256_set1_pd(-0.0);
         return _mm256_andnot_pd(sign_mask, v);
     }
 
+    // ============================================================================
+    // Elementwise math primitives (building blocks of vector_math.h)
+    // ============================================================================
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept { return _mm256_sqrt_pd(v); }
+
+    // Round to nearest, ties to even
+    FORCE_INLINE static VecType round(VecType v) noexcept { return _mm256_round_pd(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    // a < b ? x : y, lane-wise (false for NaN)
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return _mm256_blendv_pd(y, x, _mm256_cmp_pd(a, b, _CMP_LT_OQ));
+    }
+
+    // Magnitude of mag, sign of sgn
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        __m256d sign_mask = _mm256_set1_pd(-0.0);
+        return _mm256_or_pd(_mm256_andnot_pd(sign_mask, mag), _mm256_and_pd(sign_mask, sgn));
+    }
+
+    // 2^n for integral n in [-1022, 1023]. No cvtpd_epi64 before AVX-512:
+    // n + 2^52 + 1023 holds the biased exponent in its low mantissa bits.
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept
+    {
+        __m256d t = _mm256_add_pd(n, _mm256_set1_pd(4503599627370496.0 + 1023.0));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(t), 52));
+    }
+
+    // Unbiased exponent floor(log2 v) and mantissa v / 2^e ∈ [1, 2), for positive normal v
+    FORCE_INLINE static VecType getexp(VecType v) noexcept
+    {
+        __m256i e = _mm256_srli_epi64(_mm256_castpd_si256(v), 52);
+        __m256d t = _mm256_castsi256_pd(_mm256_or_si256(e, _mm256_set1_epi64x(0x4330000000000000LL)));
+        return _mm256_sub_pd(t, _mm256_set1_pd(4503599627370496.0 + 1023.0));
+    }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept
+    {
+        __m256i m = _mm256_and_si256(_mm256_castpd_si256(v), _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+        return _mm256_castsi256_pd(_mm256_or_si256(m, _mm256_set1_epi64x(0x3FF0000000000000LL)));
+    }
+
     FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
     {
         __m256d diff = _mm256_sub_pd(a, b);
@@ -212,6 +351,10 @@ struct Microkernel<int32_t, 256, X86_AVX>
     static constexpr my_size_t MR = 4;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 24
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 256; // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 64;  // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 1008; // B block width    → KC × NC packed B in L3
     using VecType = __m256i;
     using ScalarType = int32_t;
 
@@ -221,6 +364,10 @@ struct Microkernel<int32_t, 256, X86_AVX>
     FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), val); }
     FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm256_set1_epi32(scalar); }
 
+    FORCE_INLINE static VecType tail_mask(my_size_t n) noexcept { return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(n)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)); }
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return _mm256_maskload_epi32(reinterpret_cast<const int *>(ptr), tail_mask(n)); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { _mm256_maskstore_epi32(reinterpret_cast<int *>(ptr), tail_mask(n), val); }
+
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm256_add_epi32(a, b); }
     FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm256_add_epi32(a, set1(b)); }
 
@@ -259,6 +406,29 @@ struct Microkernel<int32_t, 256, X86_AVX>
         return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(vr));
     }
 
+    /// Signed high 32 bits of a · b per lane.
+    FORCE_INLINE static VecType mulhi(VecType a, VecType b) noexcept
+    {
+        // _mm256_mul_epi32 multiplies the even lanes into 64-bit products
+        const __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+        const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+        return _mm256_blend_epi32(even, odd, 0xAA);
+    }
+
+    /// Division by a loop-invariant divisor: multiply-high and shift (see int_divisor.h).
+    FORCE_INLINE static VecType div(VecType a, const IntDivisor<ScalarType> &d) noexcept
+    {
+        if (d.magic == 0) [[unlikely]]
+            return div(a, d.divisor);
+        __m256i q = mulhi(a, set1(d.magic));
+        if (d.add > 0)
+            q = _mm256_add_epi32(q, a);
+        else if (d.add < 0)
+            q = _mm256_sub_epi32(q, a);
+        q = _mm256_sra_epi32(q, _mm_cvtsi32_si128(d.shift));
+        return _mm256_add_epi32(q, _mm256_srli_epi32(q, 31));
+    }
+
     // NOTE: No FMA for integers in AVX2. Emulate as mul + add.
     // fmadd: a*b + c
     FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return _mm256_add_epi32(_mm256_mullo_epi32(a, b), c); }
@@ -291,6 +461,12 @@ struct Microkernel<int32_t, 256, X86_AVX>
     FORCE_INLINE static VecType max(VecType a, VecType b) noexcept { return _mm256_max_epi32(a, b); }
     FORCE_INLINE static VecType max(VecType a, ScalarType b) noexcept { return _mm256_max_epi32(a, set1(b)); }
 
+    // a < b ? x : y, lane-wise
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return _mm256_blendv_epi8(y, x, _mm256_cmpgt_epi32(b, a));
+    }
+
     // ============================================================================
     // Gather
     // ============================================================================
@@ -313,6 +489,17 @@ struct Microkernel<int32_t, 256, X86_AVX>
             base[indices[i]] = tmp[i];
     }
 
+    /// In-register 8×8 transpose, as the float kernel's (a pure lane shuffle)
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        Microkernel<float, 256, X86_AVX>::VecType f[simdWidth];
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            f[i] = _mm256_castsi256_ps(r[i]);
+        Microkernel<float, 256, X86_AVX>::transpose(f);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            r[i] = _mm256_castps_si256(f[i]);
+    }
+
     FORCE_INLINE static VecType abs(VecType v) noexcept
     {
         return _mm256_abs_epi32(v);
@@ -341,6 +528,10 @@ struct Microkernel<int64_t, 256, X86_AVX>
     static constexpr my_size_t MR = 4;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 12
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 128; // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 64;  // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 504; // B block width     → KC × NC packed B in L3
     using VecType = __m256i;
     using ScalarType = int64_t;
 
@@ -350,6 +541,10 @@ struct Microkernel<int64_t, 256, X86_AVX>
     FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), val); }
     FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm256_set1_epi64x(scalar); }
 
+    FORCE_INLINE static VecType tail_mask(my_size_t n) noexcept { return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(n)), _mm256_setr_epi64x(0, 1, 2, 3)); }
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return _mm256_maskload_epi64(reinterpret_cast<const long long *>(ptr), tail_mask(n)); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { _mm256_maskstore_epi64(reinterpret_cast<long long *>(ptr), tail_mask(n), val); }
+
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm256_add_epi64(a, b); }
     FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm256_add_epi64(a, set1(b)); }
 
@@ -406,6 +601,45 @@ struct Microkernel<int64_t, 256, X86_AVX>
         return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(vr));
     }
 
+    /// Signed high 64 bits of a · b per lane, from four 32-bit partial products.
+    FORCE_INLINE static VecType mulhi(VecType a, VecType b) noexcept
+    {
+        // Unsigned: hi(a)hi(b) + carries of lo(a)lo(b), lo(a)hi(b), hi(a)lo(b)
+        const __m256i lo32 = _mm256_set1_epi64x(0xFFFFFFFFLL);
+        const __m256i a_hi = _mm256_srli_epi64(a, 32);
+        const __m256i b_hi = _mm256_srli_epi64(b, 32);
+        const __m256i t = _mm256_add_epi64(_mm256_mul_epu32(a_hi, b), _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32));
+        const __m256i w = _mm256_add_epi64(_mm256_and_si256(t, lo32), _mm256_mul_epu32(a, b_hi));
+        __m256i hi = _mm256_add_epi64(_mm256_mul_epu32(a_hi, b_hi), _mm256_add_epi64(_mm256_srli_epi64(t, 32), _mm256_srli_epi64(w, 32)));
+
+        // Signed: subtract b where a < 0 and a where b < 0
+        const __m256i zero = _mm256_setzero_si256();
+        hi = _mm256_sub_epi64(hi, _mm256_and_si256(_mm256_cmpgt_epi64(zero, a), b));
+        return _mm256_sub_epi64(hi, _mm256_and_si256(_mm256_cmpgt_epi64(zero, b), a));
+    }
+
+    /// Arithmetic right shift by n (0 ≤ n < 64); AVX2 has no _mm256_sra_epi64.
+    FORCE_INLINE static VecType sra(VecType a, int n) noexcept
+    {
+        const __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+        return _mm256_or_si256(_mm256_srl_epi64(a, _mm_cvtsi32_si128(n)),
+                               _mm256_sll_epi64(sign, _mm_cvtsi32_si128(64 - n))); // shift by 64 gives 0
+    }
+
+    /// Division by a loop-invariant divisor: multiply-high and shift (see int_divisor.h).
+    FORCE_INLINE static VecType div(VecType a, const IntDivisor<ScalarType> &d) noexcept
+    {
+        if (d.magic == 0) [[unlikely]]
+            return div(a, d.divisor);
+        __m256i q = mulhi(a, set1(d.magic));
+        if (d.add > 0)
+            q = _mm256_add_epi64(q, a);
+        else if (d.add < 0)
+            q = _mm256_sub_epi64(q, a);
+        q = sra(q, d.shift);
+        return _mm256_add_epi64(q, _mm256_srli_epi64(q, 63));
+    }
+
     // Emulated FMA
     FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return add(mul(a, b), c); }
     FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return add(mul(a, b), c); }
@@ -441,6 +675,12 @@ struct Microkernel<int64_t, 256, X86_AVX>
     }
     FORCE_INLINE static VecType max(VecType a, ScalarType b) noexcept { return max(a, set1(b)); }
 
+    // a < b ? x : y, lane-wise
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return _mm256_blendv_epi8(y, x, _mm256_cmpgt_epi64(b, a));
+    }
+
     // ============================================================================
     // Gather
     // ============================================================================
@@ -459,6 +699,17 @@ struct Microkernel<int64_t, 256, X86_AVX>
             base[indices[i]] = tmp[i];
     }
 
+    /// In-register 4×4 transpose, as the double kernel's (a pure lane shuffle)
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        Microkernel<double, 256, X86_AVX>::VecType f[simdWidth];
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            f[i] = _mm256_castsi256_pd(r[i]);
+        Microkernel<double, 256, X86_AVX>::transpose(f);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            r[i] = _mm256_castpd_si256(f[i]);
+    }
+
     FORCE_INLINE static VecType abs(VecType v) noexcept
     {
         // AVX2 has no _mm256_abs_epi64. Emulate:
@@ -0,0 +1,81 @@
+#ifndef __AVX2_QGEMM_MICROKERNEL_H__
+#define __AVX2_QGEMM_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+
+// ============================================================================
+// AVX2 (256-bit) int8 dot-product kernel for the quantized GEMM
+// ============================================================================
+// With AVX-VNNI, vpdpbusd multiplies 32 unsigned × signed byte pairs and adds
+// each group of four into an int32 lane. B is fed as the unsigned operand,
+// offset by +128 (B_BIAS); the GEMM subtracts 128 · Σₖ a(i,k) afterwards.
+//
+// Without it, sixteen int8 values are sign-extended to int16 and vpmaddwd
+// sums adjacent products into eight int32 lanes. vpmaddubsw would take the
+// bytes directly, but its int16 pair sums saturate (255 · 127 · 2 > 32767).
+
+template <>
+struct QGemmMicrokernel<256, X86_AVX>
+{
+    static constexpr my_size_t MR = 2; // 8 accumulators + 4 B + 1 A + 1 product of 16 YMM
+    static constexpr my_size_t NR = 4;
+    using AccType = __m256i;
+    using Operand = __m256i;
+
+    FORCE_INLINE static AccType zero() noexcept { return _mm256_setzero_si256(); }
+
+#ifdef __AVXVNNI__
+    static constexpr my_size_t KStep = 32;
+    static constexpr int32_t B_BIAS = 128;
+
+    FORCE_INLINE static Operand load_a(const int8_t *ptr) noexcept
+    {
+        return _mm256_load_si256(reinterpret_cast<const __m256i *>(ptr));
+    }
+
+    FORCE_INLINE static Operand load_b(const int8_t *ptr) noexcept
+    {
+        return _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i *>(ptr)),
+                                _mm256_set1_epi8(static_cast<char>(0x80)));
+    }
+
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept
+    {
+        return _mm256_dpbusd_avx_epi32(acc, b, a);
+    }
+#else
+    static constexpr my_size_t KStep = 16;
+    static constexpr int32_t B_BIAS = 0;
+
+    FORCE_INLINE static Operand load_a(const int8_t *ptr) noexcept
+    {
+        return _mm256_cvtepi8_epi16(_mm_load_si128(reinterpret_cast<const __m128i *>(ptr)));
+    }
+
+    FORCE_INLINE static Operand load_b(const int8_t *ptr) noexcept { return load_a(ptr); }
+
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept
+    {
+        return _mm256_add_epi32(acc, _mm256_madd_epi16(a, b));
+    }
+#endif
+
+    FORCE_INLINE static int32_t hsum(AccType acc) noexcept
+    {
+        __m128i s = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(s);
+    }
+
+    /// out[c] = Σ lanes of acc[c], c < 4 — one transposed reduction.
+    FORCE_INLINE static void hsum4(const AccType *acc, int32_t *out) noexcept
+    {
+        const __m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(acc[0], acc[1]), _mm256_hadd_epi32(acc[2], acc[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_add_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1)));
+    }
+};
+
+#endif // __AVX2_QGEMM_MICROKERNEL_H__
@@ -0,0 +1,248 @@
+#ifndef __AVX512_COMPLEX_MICROKERNEL_H__
+#define __AVX512_COMPLEX_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+#include "complex.h"
+
+// Unmasked intrinsics and -Wmaybe-uninitialized: see avx512_microkernel.h
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// ============================================================================
+// AVX-512 (512-bit) complex specializations
+// ============================================================================
+// Interleaved storage, eight Complex<float> or four Complex<double> per
+// vector; same scheme as the AVX2 kernels (two fmaddsub per complex
+// multiply-add). AVX-512F has no addsub, so it is fmaddsub(a, 1, b), and
+// the sign flips use integer xor (xor_ps / xor_pd need AVX-512DQ).
+//
+// GEMM register tile: MR × NR_VECS = 6 × 3 = 18 accumulators + 3 B vectors
+// + 3 swapped B vectors + the two halves of the A broadcast = 26 of 32.
+
+template <>
+struct Microkernel<Complex<float>, 512, X86_AVX512>
+{
+    static constexpr my_size_t simdWidth = 8; // 512 bits / 64 bits per Complex<float> = 8
+    // GEMM tiling constants (register-blocked)
+    static constexpr my_size_t num_registers = 32;
+    static constexpr my_size_t MR = 6;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 24
+    // GEMM cache-blocking constants (packed panels, same bytes as the double kernel)
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 96;
+    static constexpr my_size_t NC = 1008;
+    using VecType = __m512;
+    using ScalarType = Complex<float>;
+    using R = Microkernel<float, 512, X86_AVX512>;
+
+    FORCE_INLINE static const float *flat(const ScalarType *p) noexcept { return reinterpret_cast<const float *>(p); }
+    FORCE_INLINE static float *flat(ScalarType *p) noexcept { return reinterpret_cast<float *>(p); }
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm512_load_ps(flat(ptr)); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm512_loadu_ps(flat(ptr)); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm512_store_ps(flat(ptr), val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm512_storeu_ps(flat(ptr), val); }
+    FORCE_INLINE static VecType set1(ScalarType s) noexcept
+    {
+        return _mm512_setr_ps(s.re, s.im, s.re, s.im, s.re, s.im, s.re, s.im,
+                              s.re, s.im, s.re, s.im, s.re, s.im, s.re, s.im);
+    }
+
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return R::maskload(flat(ptr), 2 * n); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { R::maskstore(flat(ptr), val, 2 * n); }
+
+    // In-pair shuffles: [re, re], [im, im], [im, re]
+    FORCE_INLINE static VecType dup_re(VecType v) noexcept { return _mm512_moveldup_ps(v); }
+    FORCE_INLINE static VecType dup_im(VecType v) noexcept { return _mm512_movehdup_ps(v); }
+    FORCE_INLINE static VecType swap(VecType v) noexcept { return _mm512_permute_ps(v, 0xB1); }
+
+    // a − b on real lanes, a + b on imaginary lanes
+    FORCE_INLINE static VecType addsub(VecType a, VecType b) noexcept { return _mm512_fmaddsub_ps(a, _mm512_set1_ps(1.0f), b); }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept
+    {
+        const __m512i im_sign = _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ull));
+        return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(v), im_sign));
+    }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm512_add_ps(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm512_add_ps(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm512_sub_ps(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm512_sub_ps(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm512_sub_ps(set1(a), b); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+        return _mm512_fmaddsub_ps(dup_re(a), b, _mm512_mul_ps(dup_im(a), swap(b)));
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(set1(b), a); }
+
+    // a·conj(b) / |b|²
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        __m512 bb = _mm512_mul_ps(b, b);
+        return _mm512_div_ps(mul(a, conj(b)), _mm512_add_ps(bb, swap(bb)));
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return div(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return div(set1(a), b); }
+
+    // fmadd: a*b + c
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm512_fmaddsub_ps(dup_re(a), b, _mm512_fmaddsub_ps(dup_im(a), swap(b), c));
+    }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(set1(b), a, c); }
+
+    // fmsub: a*b - c
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm512_sub_ps(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(set1(b), a, c); }
+
+    // fnmadd: -(a*b) + c
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm512_sub_ps(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(set1(b), a, c); }
+
+    // fnmsub: -(a*b) - c
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm512_sub_ps(_mm512_sub_ps(_mm512_setzero_ps(), mul(a, b)), c);
+    }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(set1(b), a, c); }
+
+    // Each Complex<float> is one 64-bit element of a double gather
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        alignas(32) int32_t idx32[simdWidth];
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            idx32[i] = static_cast<int32_t>(indices[i]);
+        __m256i vindex = _mm256_load_si256(reinterpret_cast<const __m256i *>(idx32));
+        return _mm512_castpd_ps(_mm512_i32gather_pd(vindex, base, sizeof(ScalarType)));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        alignas(64) ScalarType tmp[simdWidth];
+        store(tmp, val);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            base[indices[i]] = tmp[i];
+    }
+
+    // |Δre| ≤ tol.re and |Δim| ≤ tol.re on every lane
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        return R::all_within_tolerance(a, b, tol.re);
+    }
+};
+
+template <>
+struct Microkernel<Complex<double>, 512, X86_AVX512>
+{
+    static constexpr my_size_t simdWidth = 4; // 512 bits / 128 bits per Complex<double> = 4
+    // GEMM tiling constants (register-blocked)
+    static constexpr my_size_t num_registers = 32;
+    static constexpr my_size_t MR = 6;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 12
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 64;
+    static constexpr my_size_t MC = 96;
+    static constexpr my_size_t NC = 504;
+    using VecType = __m512d;
+    using ScalarType = Complex<double>;
+    using R = Microkernel<double, 512, X86_AVX512>;
+
+    FORCE_INLINE static const double *flat(const ScalarType *p) noexcept { return reinterpret_cast<const double *>(p); }
+    FORCE_INLINE static double *flat(ScalarType *p) noexcept { return reinterpret_cast<double *>(p); }
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm512_load_pd(flat(ptr)); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm512_loadu_pd(flat(ptr)); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm512_store_pd(flat(ptr), val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm512_storeu_pd(flat(ptr), val); }
+    FORCE_INLINE static VecType set1(ScalarType s) noexcept { return _mm512_setr_pd(s.re, s.im, s.re, s.im, s.re, s.im, s.re, s.im); }
+
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return R::maskload(flat(ptr), 2 * n); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { R::maskstore(flat(ptr), val, 2 * n); }
+
+    FORCE_INLINE static VecType dup_re(VecType v) noexcept { return _mm512_movedup_pd(v); }
+    FORCE_INLINE static VecType dup_im(VecType v) noexcept { return _mm512_permute_pd(v, 0xFF); }
+    FORCE_INLINE static VecType swap(VecType v) noexcept { return _mm512_permute_pd(v, 0x55); }
+
+    FORCE_INLINE static VecType addsub(VecType a, VecType b) noexcept { return _mm512_fmaddsub_pd(a, _mm512_set1_pd(1.0), b); }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept
+    {
+        const __m512i im_sign = _mm512_setr_epi64(0, static_cast<long long>(0x8000000000000000ull),
+                                                  0, static_cast<long long>(0x8000000000000000ull),
+                                                  0, static_cast<long long>(0x8000000000000000ull),
+                                                  0, static_cast<long long>(0x8000000000000000ull));
+        return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(v), im_sign));
+    }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm512_add_pd(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm512_add_pd(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm512_sub_pd(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm512_sub_pd(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm512_sub_pd(set1(a), b); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+        return _mm512_fmaddsub_pd(dup_re(a), b, _mm512_mul_pd(dup_im(a), swap(b)));
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(set1(b), a); }
+
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        __m512d bb = _mm512_mul_pd(b, b);
+        return _mm512_div_pd(mul(a, conj(b)), _mm512_add_pd(bb, swap(bb)));
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return div(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return div(set1(a), b); }
+
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm512_fmaddsub_pd(dup_re(a), b, _mm512_fmaddsub_pd(dup_im(a), swap(b), c));
+    }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm512_sub_pd(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm512_sub_pd(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm512_sub_pd(_mm512_sub_pd(_mm512_setzero_pd(), mul(a, b)), c);
+    }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(set1(b), a, c); }
+
+    // Both halves of each number from one 64-bit gather: indices 2i, 2i + 1
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        const long long i0 = static_cast<long long>(2 * indices[0]), i1 = static_cast<long long>(2 * indices[1]);
+        const long long i2 = static_cast<long long>(2 * indices[2]), i3 = static_cast<long long>(2 * indices[3]);
+        __m512i vindex = _mm512_setr_epi64(i0, i0 + 1, i1, i1 + 1, i2, i2 + 1, i3, i3 + 1);
+        return _mm512_i64gather_pd(vindex, flat(base), sizeof(double));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        alignas(64) ScalarType tmp[simdWidth];
+        store(tmp, val);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            base[indices[i]] = tmp[i];
+    }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        return R::all_within_tolerance(a, b, tol.re);
+    }
+};
+
+#pragma GCC diagnostic pop
+
+#endif // __AVX512_COMPLEX_MICROKERNEL_H__
@@ -0,0 +1,68 @@
+#ifndef __AVX512_HALF_MICROKERNEL_H__
+#define __AVX512_HALF_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+#include "fused/microkernels/half_microkernel.h"
+
+// Unmasked intrinsics and -Wmaybe-uninitialized: see avx512_microkernel.h
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// ============================================================================
+// AVX-512 (512-bit) Half / BFloat16 storage: 16 lanes, widened to __m512
+// ============================================================================
+// vcvtph2ps / vcvtps2ph and the 32 → 16-bit narrowing (vpmovdw) are all
+// AVX-512F; no BW or BF16 extension is needed.
+
+struct Avx512HalfConvert
+{
+    FORCE_INLINE static __m512 load(const Half *ptr) noexcept
+    {
+        return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)));
+    }
+
+    FORCE_INLINE static void store(Half *ptr, __m512 val) noexcept
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr),
+                            _mm512_cvtps_ph(val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    }
+};
+
+struct Avx512Bf16Convert
+{
+    FORCE_INLINE static __m512 load(const BFloat16 *ptr) noexcept
+    {
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+        return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(b), 16));
+    }
+
+    // Round to nearest even; NaN stays (quiet) NaN
+    FORCE_INLINE static void store(BFloat16 *ptr, __m512 val) noexcept
+    {
+        const __m512i u = _mm512_castps_si512(val);
+        const __m512i hi = _mm512_srli_epi32(u, 16);
+        const __m512i rounded = _mm512_srli_epi32(
+            _mm512_add_epi32(u, _mm512_add_epi32(_mm512_set1_epi32(0x7fff), _mm512_and_si512(hi, _mm512_set1_epi32(1)))), 16);
+        const __mmask16 nan = _mm512_cmp_ps_mask(val, val, _CMP_UNORD_Q);
+        const __m512i b = _mm512_mask_or_epi32(rounded, nan, hi, _mm512_set1_epi32(0x40));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), _mm512_cvtepi32_epi16(b));
+    }
+};
+
+template <>
+struct Microkernel<Half, 512, X86_AVX512>
+    : HalfMicrokernel<Half, Microkernel<float, 512, X86_AVX512>, Avx512HalfConvert>
+{
+};
+
+template <>
+struct Microkernel<BFloat16, 512, X86_AVX512>
+    : HalfMicrokernel<BFloat16, Microkernel<float, 512, X86_AVX512>, Avx512Bf16Convert>
+{
+};
+
+#pragma GCC diagnostic pop
+
+#endif // __AVX512_HALF_MICROKERNEL_H__
@@ -0,0 +1,680 @@
+#ifndef __AVX512_MICROKERNEL_H__
+#define __AVX512_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+
+// GCC 12 implements most unmasked AVX-512 intrinsics as the masked builtin
+// with an _mm512_undefined_*() source, which -Wall then reports as
+// '__Y' may be used uninitialized wherever they are inlined.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// Architecture tag
+struct X86_AVX512
+{
+}; // 512-bit AVX-512 (F, optionally DQ)
+
+// ============================================================================
+// AVX-512 (512-bit) specializations
+// ============================================================================
+//
+// GEMM register tile: 32 ZMM registers hold MR × NR_VECS = 8 × 3 = 24
+// accumulators + 3 B vectors + 1 A broadcast = 28, leaving headroom for
+// the epilogue. MR = 8 keeps the row remainder (M % MR) short for the
+// small matrices this library mostly sees.
+//
+// Tails: maskload / maskstore touch only the first n lanes (n ≤ simdWidth)
+// through an __mmask, so a partial vector never reads or writes past n.
+// Masked-off lanes of maskload are zero.
+
+template <>
+struct Microkernel<float, 512, X86_AVX512>
+{
+    static constexpr my_size_t simdWidth = 16; // 512 bits / 32 bits per float = 16
+    // GEMM tiling constants (register-blocked)
+    static constexpr my_size_t num_registers = 32;
+    static constexpr my_size_t MR = 8;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 48
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 128;  // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 192;  // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 2016; // B block width     → KC × NC packed B in L3
+    using VecType = __m512;
+    using ScalarType = float;
+    using MaskType = __mmask16;
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm512_load_ps(ptr); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm512_loadu_ps(ptr); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm512_store_ps(ptr, val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm512_storeu_ps(ptr, val); }
+    FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm512_set1_ps(scalar); }
+
+    // Masked tail access: first n lanes only
+    FORCE_INLINE static MaskType tail_mask(my_size_t n) noexcept { return static_cast<MaskType>((1u << n) - 1u); }
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return _mm512_maskz_loadu_ps(tail_mask(n), ptr); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { _mm512_mask_storeu_ps(ptr, tail_mask(n), val); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm512_add_ps(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm512_add_ps(a, set1(b)); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept { return _mm512_mul_ps(a, b); }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return _mm512_mul_ps(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm512_sub_ps(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm512_sub_ps(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm512_sub_ps(set1(a), b); }
+
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept { return _mm512_div_ps(a, b); }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return _mm512_div_ps(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return _mm512_div_ps(set1(a), b); }
+
+    // fmadd: a*b + c
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return _mm512_fmadd_ps(a, set1(b), c); }
+
+    // fmsub: a*b - c
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm512_fmsub_ps(a, b, c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return _mm512_fmsub_ps(a, set1(b), c); }
+
+    // fnmadd: -(a*b) + c
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm512_fnmadd_ps(a, b, c); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return _mm512_fnmadd_ps(a, set1(b), c); }
+
+    // fnmsub: -(a*b) - c
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return _mm512_fnmsub_ps(a, b, c); }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return _mm512_fnmsub_ps(a, set1(b), c); }
+
+    FORCE_INLINE static VecType min(VecType a, VecType b) noexcept { return _mm512_min_ps(a, b); }
+    FORCE_INLINE static VecType min(VecType a, ScalarType b) noexcept { return _mm512_min_ps(a, set1(b)); }
+
+    FORCE_INLINE static VecType max(VecType a, VecType b) noexcept { return _mm512_max_ps(a, b); }
+    FORCE_INLINE static VecType max(VecType a, ScalarType b) noexcept { return _mm512_max_ps(a, set1(b)); }
+
+    // ============================================================================
+    // Gather / scatter: native, 16 × 32-bit indices
+    // ============================================================================
+    FORCE_INLINE static __m512i indices32(const my_size_t *indices) noexcept
+    {
+        // my_size_t → int32_t: two 8 × 64-bit halves narrowed with vpmovqd
+        __m256i lo = _mm512_cvtepi64_epi32(_mm512_loadu_si512(indices));
+        __m256i hi = _mm512_cvtepi64_epi32(_mm512_loadu_si512(indices + 8));
+        return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+    }
+
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, indices32(indices), base, sizeof(ScalarType));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        _mm512_i32scatter_ps(base, indices32(indices), val, sizeof(ScalarType));
+    }
+
+    /// In-register 16×16 transpose: lane j of r[i] ↔ lane i of r[j]
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        // Interleave row pairs and 2×2 blocks within each 128-bit lane: s[4k + c]
+        // lane q then holds column 4q + c of rows 4k..4k+3. Two 128-bit lane
+        // shuffles gather lane q of s[c], s[4 + c], s[8 + c], s[12 + c].
+        VecType t[16], s[16];
+        for (int i = 0; i < 16; i += 2)
+        {
+            t[i] = _mm512_unpacklo_ps(r[i], r[i + 1]);
+            t[i + 1] = _mm512_unpackhi_ps(r[i], r[i + 1]);
+        }
+        for (int i = 0; i < 16; i += 4)
+        {
+            s[i] = _mm512_shuffle_ps(t[i], t[i + 2], 0x44);
+            s[i + 1] = _mm512_shuffle_ps(t[i], t[i + 2], 0xEE);
+            s[i + 2] = _mm512_shuffle_ps(t[i + 1], t[i + 3], 0x44);
+            s[i + 3] = _mm512_shuffle_ps(t[i + 1], t[i + 3], 0xEE);
+        }
+        for (int c = 0; c < 4; ++c)
+        {
+            const VecType v0 = _mm512_shuffle_f32x4(s[c], s[4 + c], 0x88);
+            const VecType v1 = _mm512_shuffle_f32x4(s[c], s[4 + c], 0xDD);
+            const VecType v2 = _mm512_shuffle_f32x4(s[8 + c], s[12 + c], 0x88);
+            const VecType v3 = _mm512_shuffle_f32x4(s[8 + c], s[12 + c], 0xDD);
+            r[c] = _mm512_shuffle_f32x4(v0, v2, 0x88);
+            r[4 + c] = _mm512_shuffle_f32x4(v1, v3, 0x88);
+            r[8 + c] = _mm512_shuffle_f32x4(v0, v2, 0xDD);
+            r[12 + c] = _mm512_shuffle_f32x4(v1, v3, 0xDD);
+        }
+    }
+
+    FORCE_INLINE static VecType abs(VecType v) noexcept { return _mm512_abs_ps(v); }
+
+    // ============================================================================
+    // Elementwise math primitives (building blocks of vector_math.h)
+    // ============================================================================
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept { return _mm512_sqrt_ps(v); }
+
+    // Round to nearest, ties to even
+    FORCE_INLINE static VecType round(VecType v) noexcept { return _mm512_roundscale_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    // a < b ? x : y, lane-wise (false for NaN)
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), y, x);
+    }
+
+    // Magnitude of mag, sign of sgn (integer logic: and_ps / or_ps need AVX-512DQ)
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        const __m512i sign_mask = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+        return _mm512_castsi512_ps(_mm512_or_si512(_mm512_andnot_si512(sign_mask, _mm512_castps_si512(mag)),
+                                                   _mm512_and_si512(sign_mask, _mm512_castps_si512(sgn))));
+    }
+
+    // 2^n for integral n (vscalefps)
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept { return _mm512_scalef_ps(set1(1.0f), n); }
+
+    // Unbiased exponent floor(log2 v) and mantissa v / 2^e ∈ [1, 2), for positive normal v
+    FORCE_INLINE static VecType getexp(VecType v) noexcept { return _mm512_getexp_ps(v); }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept { return _mm512_getmant_ps(v, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        __m512 abs_diff = abs(_mm512_sub_ps(a, b));
+        return _mm512_cmp_ps_mask(abs_diff, set1(tol), _CMP_LE_OQ) == 0xFFFF; // all 16 lanes passed
+    }
+};
+
+template <>
+struct Microkernel<double, 512, X86_AVX512>
+{
+    static constexpr my_size_t simdWidth = 8; // 512 bits / 64 bits per double = 8
+    // GEMM tiling constants (register-blocked)
+    static constexpr my_size_t num_registers = 32;
+    static constexpr my_size_t MR = 8;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 24
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 128;  // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 96;   // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 1008; // B block width     → KC × NC packed B in L3
+    using VecType = __m512d;
+    using ScalarType = double;
+    using MaskType = __mmask8;
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm512_load_pd(ptr); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm512_loadu_pd(ptr); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm512_store_pd(ptr, val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm512_storeu_pd(ptr, val); }
+    FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm512_set1_pd(scalar); }
+
+    // Masked tail access: first n lanes only
+    FORCE_INLINE static MaskType tail_mask(my_size_t n) noexcept { return static_cast<MaskType>((1u << n) - 1u); }
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return _mm512_maskz_loadu_pd(tail_mask(n), ptr); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { _mm512_mask_storeu_pd(ptr, tail_mask(n), val); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm512_add_pd(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm512_add_pd(a, set1(b)); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept { return _mm512_mul_pd(a, b); }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return _mm512_mul_pd(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm512_sub_pd(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm512_sub_pd(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm512_sub_pd(set1(a), b); }
+
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept { return _mm512_div_pd(a, b); }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return _mm512_div_pd(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return _mm512_div_pd(set1(a), b); }
+
+    // fmadd: a*b + c
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return _mm512_fmadd_pd(a, b, c); }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return _mm512_fmadd_pd(a, set1(b), c); }
+
+    // fmsub: a*b - c
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm512_fmsub_pd(a, b, c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return _mm512_fmsub_pd(a, set1(b), c); }
+
+    // fnmadd: -(a*b) + c
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm512_fnmadd_pd(a, b, c); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return _mm512_fnmadd_pd(a, set1(b), c); }
+
+    // fnmsub: -(a*b) - c
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return _mm512_fnmsub_pd(a, b, c); }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return _mm512_fnmsub_pd(a, set1(b), c); }
+
+    FORCE_INLINE static VecType min(VecType a, VecType b) noexcept { return _mm512_min_pd(a, b); }
+    FORCE_INLINE static VecType min(VecType a, ScalarType b) noexcept { return _mm512_min_pd(a, set1(b)); }
+
+    FORCE_INLINE static VecType max(VecType a, VecType b) noexcept { return _mm512_max_pd(a, b); }
+    FORCE_INLINE static VecType max(VecType a, ScalarType b) noexcept { return _mm512_max_pd(a, set1(b)); }
+
+    // ============================================================================
+    // Gather / scatter: native, 8 × 64-bit indices (my_size_t as is)
+    // ============================================================================
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), 0xFF, _mm512_loadu_si512(indices), base, sizeof(ScalarType));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        _mm512_i64scatter_pd(base, _mm512_loadu_si512(indices), val, sizeof(ScalarType));
+    }
+
+    /// In-register 8×8 transpose: lane j of r[i] ↔ lane i of r[j]
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        // t[2k + c] 128-bit lane q holds column 2q + c of rows 2k, 2k+1; two
+        // 128-bit lane shuffles gather lane q of t[c], t[2 + c], t[4 + c], t[6 + c].
+        VecType t[8];
+        for (int i = 0; i < 8; i += 2)
+        {
+            t[i] = _mm512_unpacklo_pd(r[i], r[i + 1]);
+            t[i + 1] = _mm512_unpackhi_pd(r[i], r[i + 1]);
+        }
+        for (int c = 0; c < 2; ++c)
+        {
+            const VecType v0 = _mm512_shuffle_f64x2(t[c], t[2 + c], 0x88);
+            const VecType v1 = _mm512_shuffle_f64x2(t[c], t[2 + c], 0xDD);
+            const VecType v2 = _mm512_shuffle_f64x2(t[4 + c], t[6 + c], 0x88);
+            const VecType v3 = _mm512_shuffle_f64x2(t[4 + c], t[6 + c], 0xDD);
+            r[c] = _mm512_shuffle_f64x2(v0, v2, 0x88);
+            r[2 + c] = _mm512_shuffle_f64x2(v1, v3, 0x88);
+            r[4 + c] = _mm512_shuffle_f64x2(v0, v2, 0xDD);
+            r[6 + c] = _mm512_shuffle_f64x2(v1, v3, 0xDD);
+        }
+    }
+
+    FORCE_INLINE static VecType abs(VecType v) noexcept { return _mm512_abs_pd(v); }
+
+    // ============================================================================
+    // Elementwise math primitives (building blocks of vector_math.h)
+    // ============================================================================
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept { return _mm512_sqrt_pd(v); }
+
+    // Round to nearest, ties to even
+    FORCE_INLINE static VecType round(VecType v) noexcept { return _mm512_roundscale_pd(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    // a < b ? x : y, lane-wise (false for NaN)
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_LT_OQ), y, x);
+    }
+
+    // Magnitude of mag, sign of sgn (integer logic: and_pd / or_pd need AVX-512DQ)
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        const __m512i sign_mask = _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ull));
+        return _mm512_castsi512_pd(_mm512_or_si512(_mm512_andnot_si512(sign_mask, _mm512_castpd_si512(mag)),
+                                                   _mm512_and_si512(sign_mask, _mm512_castpd_si512(sgn))));
+    }
+
+    // 2^n for integral n (vscalefps)
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept { return _mm512_scalef_pd(set1(1.0), n); }
+
+    // Unbiased exponent floor(log2 v) and mantissa v / 2^e ∈ [1, 2), for positive normal v
+    FORCE_INLINE static VecType getexp(VecType v) noexcept { return _mm512_getexp_pd(v); }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept { return _mm512_getmant_pd(v, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        __m512d abs_diff = abs(_mm512_sub_pd(a, b));
+        return _mm512_cmp_pd_mask(abs_diff, set1(tol), _CMP_LE_OQ) == 0xFF; // all 8 lanes passed
+    }
+};
+
+// ============================================================================
+// AVX-512 (512-bit) int32_t specialization
+// ============================================================================
+
+template <>
+struct Microkernel<int32_t, 512, X86_AVX512>
+{
+    static constexpr my_size_t simdWidth = 16; // 512 bits / 32 bits = 16
+    static constexpr my_size_t num_registers = 32;
+    static constexpr my_size_t MR = 8;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 48
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 128;  // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 192;  // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 2016; // B block width     → KC × NC packed B in L3
+    using VecType = __m512i;
+    using ScalarType = int32_t;
+    using MaskType = __mmask16;
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm512_load_si512(ptr); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm512_loadu_si512(ptr); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm512_store_si512(ptr, val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm512_storeu_si512(ptr, val); }
+    FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm512_set1_epi32(scalar); }
+
+    // Masked tail access: first n lanes only
+    FORCE_INLINE static MaskType tail_mask(my_size_t n) noexcept { return static_cast<MaskType>((1u << n) - 1u); }
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return _mm512_maskz_loadu_epi32(tail_mask(n), ptr); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { _mm512_mask_storeu_epi32(ptr, tail_mask(n), val); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm512_add_epi32(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm512_add_epi32(a, set1(b)); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept { return _mm512_mullo_epi32(a, b); }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return _mm512_mullo_epi32(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm512_sub_epi32(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm512_sub_epi32(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm512_sub_epi32(set1(a), b); }
+
+    // No SIMD integer divide exists on x86; scalar fallback.
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        alignas(64) ScalarType va[simdWidth], vb[simdWidth];
+        _mm512_storeu_si512(va, a);
+        _mm512_storeu_si512(vb, b);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            va[i] /= vb[i];
+        return _mm512_loadu_si512(va);
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept
+    {
+        alignas(64) ScalarType va[simdWidth];
+        _mm512_storeu_si512(va, a);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            va[i] /= b;
+        return _mm512_loadu_si512(va);
+    }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept
+    {
+        alignas(64) ScalarType vb[simdWidth];
+        _mm512_storeu_si512(vb, b);
+        alignas(64) ScalarType vr[simdWidth];
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            vr[i] = a / vb[i];
+        return _mm512_loadu_si512(vr);
+    }
+
+    /// Signed high 32 bits of a · b per lane.
+    FORCE_INLINE static VecType mulhi(VecType a, VecType b) noexcept
+    {
+        // _mm512_mul_epi32 multiplies the even lanes into 64-bit products
+        const __m512i even = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+        const __m512i odd = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+        return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+    }
+
+    /// Division by a loop-invariant divisor: multiply-high and shift (see int_divisor.h).
+    FORCE_INLINE static VecType div(VecType a, const IntDivisor<ScalarType> &d) noexcept
+    {
+        if (d.magic == 0) [[unlikely]]
+            return div(a, d.divisor);
+        __m512i q = mulhi(a, set1(d.magic));
+        if (d.add > 0)
+            q = _mm512_add_epi32(q, a);
+        else if (d.add < 0)
+            q = _mm512_sub_epi32(q, a);
+        q = _mm512_sra_epi32(q, _mm_cvtsi32_si128(d.shift));
+        return _mm512_add_epi32(q, _mm512_srli_epi32(q, 31));
+    }
+
+    // NOTE: No FMA for integers in AVX-512F. Emulate as mul + add.
+    // fmadd: a*b + c
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c); }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return _mm512_add_epi32(_mm512_mullo_epi32(a, set1(b)), c); }
+
+    // fmsub: a*b - c
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm512_sub_epi32(_mm512_mullo_epi32(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return _mm512_sub_epi32(_mm512_mullo_epi32(a, set1(b)), c); }
+
+    // fnmadd: -(a*b) + c  =>  c - a*b
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm512_sub_epi32(c, _mm512_mullo_epi32(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return _mm512_sub_epi32(c, _mm512_mullo_epi32(a, set1(b))); }
+
+    // fnmsub: -(a*b) - c
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept
+    {
+        __m512i neg_ab = _mm512_sub_epi32(_mm512_setzero_si512(), _mm512_mullo_epi32(a, b));
+        return _mm512_sub_epi32(neg_ab, c);
+    }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept
+    {
+        __m512i neg_ab = _mm512_sub_epi32(_mm512_setzero_si512(), _mm512_mullo_epi32(a, set1(b)));
+        return _mm512_sub_epi32(neg_ab, c);
+    }
+
+    FORCE_INLINE static VecType min(VecType a, VecType b) noexcept { return _mm512_min_epi32(a, b); }
+    FORCE_INLINE static VecType min(VecType a, ScalarType b) noexcept { return _mm512_min_epi32(a, set1(b)); }
+
+    FORCE_INLINE static VecType max(VecType a, VecType b) noexcept { return _mm512_max_epi32(a, b); }
+    FORCE_INLINE static VecType max(VecType a, ScalarType b) noexcept { return _mm512_max_epi32(a, set1(b)); }
+
+    // a < b ? x : y, lane-wise
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return _mm512_mask_blend_epi32(_mm512_cmplt_epi32_mask(a, b), y, x);
+    }
+
+    // ============================================================================
+    // Gather / scatter: native, 16 × 32-bit indices
+    // ============================================================================
+    FORCE_INLINE static __m512i indices32(const my_size_t *indices) noexcept
+    {
+        __m256i lo = _mm512_cvtepi64_epi32(_mm512_loadu_si512(indices));
+        __m256i hi = _mm512_cvtepi64_epi32(_mm512_loadu_si512(indices + 8));
+        return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+    }
+
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, indices32(indices), base, sizeof(ScalarType));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        _mm512_i32scatter_epi32(base, indices32(indices), val, sizeof(ScalarType));
+    }
+
+    /// In-register 16×16 transpose, as the float kernel's (a pure lane shuffle)
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        Microkernel<float, 512, X86_AVX512>::VecType f[simdWidth];
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            f[i] = _mm512_castsi512_ps(r[i]);
+        Microkernel<float, 512, X86_AVX512>::transpose(f);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            r[i] = _mm512_castps_si512(f[i]);
+    }
+
+    FORCE_INLINE static VecType abs(VecType v) noexcept { return _mm512_abs_epi32(v); }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        __m512i abs_diff = _mm512_abs_epi32(_mm512_sub_epi32(a, b));
+        return _mm512_cmpgt_epi32_mask(abs_diff, set1(tol)) == 0; // none greater than tol
+    }
+};
+
+// ============================================================================
+// AVX-512 (512-bit) int64_t specialization
+// ============================================================================
+
+template <>
+struct Microkernel<int64_t, 512, X86_AVX512>
+{
+    static constexpr my_size_t simdWidth = 8; // 512 bits / 64 bits = 8
+    static constexpr my_size_t num_registers = 32;
+    static constexpr my_size_t MR = 8;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 24
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 128;  // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 96;   // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 1008; // B block width     → KC × NC packed B in L3
+    using VecType = __m512i;
+    using ScalarType = int64_t;
+    using MaskType = __mmask8;
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm512_load_si512(ptr); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm512_loadu_si512(ptr); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm512_store_si512(ptr, val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm512_storeu_si512(ptr, val); }
+    FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm512_set1_epi64(scalar); }
+
+    // Masked tail access: first n lanes only
+    FORCE_INLINE static MaskType tail_mask(my_size_t n) noexcept { return static_cast<MaskType>((1u << n) - 1u); }
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return _mm512_maskz_loadu_epi64(tail_mask(n), ptr); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { _mm512_mask_storeu_epi64(ptr, tail_mask(n), val); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm512_add_epi64(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm512_add_epi64(a, set1(b)); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+#ifdef __AVX512DQ__
+        return _mm512_mullo_epi64(a, b);
+#else
+        return mullo_emulated(a, b);
+#endif
+    }
+
+    /// AVX-512F alone has no 64×64→low64 multiply: 32-bit partial products
+    ///   result = lo(a)*lo(b) + (lo(a)*hi(b) + hi(a)*lo(b)) << 32
+    /// mul uses it without DQ; always defined so it is tested on DQ machines too.
+    FORCE_INLINE static VecType mullo_emulated(VecType a, VecType b) noexcept
+    {
+        __m512i a_hi = _mm512_srli_epi64(a, 32);
+        __m512i b_hi = _mm512_srli_epi64(b, 32);
+        __m512i lo_lo = _mm512_mul_epu32(a, b);
+        __m512i cross = _mm512_add_epi64(_mm512_mul_epu32(a, b_hi), _mm512_mul_epu32(a_hi, b));
+        return _mm512_add_epi64(lo_lo, _mm512_slli_epi64(cross, 32));
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm512_sub_epi64(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm512_sub_epi64(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm512_sub_epi64(set1(a), b); }
+
+    // No SIMD integer divide exists on x86; scalar fallback.
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        alignas(64) ScalarType va[simdWidth], vb[simdWidth];
+        _mm512_storeu_si512(va, a);
+        _mm512_storeu_si512(vb, b);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            va[i] /= vb[i];
+        return _mm512_loadu_si512(va);
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept
+    {
+        alignas(64) ScalarType va[simdWidth];
+        _mm512_storeu_si512(va, a);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            va[i] /= b;
+        return _mm512_loadu_si512(va);
+    }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept
+    {
+        alignas(64) ScalarType vb[simdWidth];
+        _mm512_storeu_si512(vb, b);
+        alignas(64) ScalarType vr[simdWidth];
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            vr[i] = a / vb[i];
+        return _mm512_loadu_si512(vr);
+    }
+
+    /// Signed high 64 bits of a · b per lane, from four 32-bit partial products.
+    FORCE_INLINE static VecType mulhi(VecType a, VecType b) noexcept
+    {
+        // Unsigned: hi(a)hi(b) + carries of lo(a)lo(b), lo(a)hi(b), hi(a)lo(b)
+        const __m512i lo32 = _mm512_set1_epi64(0xFFFFFFFFLL);
+        const __m512i a_hi = _mm512_srli_epi64(a, 32);
+        const __m512i b_hi = _mm512_srli_epi64(b, 32);
+        const __m512i t = _mm512_add_epi64(_mm512_mul_epu32(a_hi, b), _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32));
+        const __m512i w = _mm512_add_epi64(_mm512_and_si512(t, lo32), _mm512_mul_epu32(a, b_hi));
+        __m512i hi = _mm512_add_epi64(_mm512_mul_epu32(a_hi, b_hi), _mm512_add_epi64(_mm512_srli_epi64(t, 32), _mm512_srli_epi64(w, 32)));
+
+        // Signed: subtract b where a < 0 and a where b < 0
+        hi = _mm512_sub_epi64(hi, _mm512_and_si512(_mm512_srai_epi64(a, 63), b));
+        return _mm512_sub_epi64(hi, _mm512_and_si512(_mm512_srai_epi64(b, 63), a));
+    }
+
+    /// Division by a loop-invariant divisor: multiply-high and shift (see int_divisor.h).
+    FORCE_INLINE static VecType div(VecType a, const IntDivisor<ScalarType> &d) noexcept
+    {
+        if (d.magic == 0) [[unlikely]]
+            return div(a, d.divisor);
+        __m512i q = mulhi(a, set1(d.magic));
+        if (d.add > 0)
+            q = _mm512_add_epi64(q, a);
+        else if (d.add < 0)
+            q = _mm512_sub_epi64(q, a);
+        q = _mm512_sra_epi64(q, _mm_cvtsi32_si128(d.shift));
+        return _mm512_add_epi64(q, _mm512_srli_epi64(q, 63));
+    }
+
+    // Emulated FMA
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return add(mul(a, b), c); }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return add(mul(a, b), c); }
+
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return sub(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return sub(mul(a, b), c); }
+
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return sub(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return sub(c, mul(a, b)); }
+
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept
+    {
+        return sub(_mm512_setzero_si512(), add(mul(a, b), c));
+    }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept
+    {
+        return sub(_mm512_setzero_si512(), add(mul(a, b), c));
+    }
+
+    // Native 64-bit min/max (AVX2 has to emulate these)
+    FORCE_INLINE static VecType min(VecType a, VecType b) noexcept { return _mm512_min_epi64(a, b); }
+    FORCE_INLINE static VecType min(VecType a, ScalarType b) noexcept { return _mm512_min_epi64(a, set1(b)); }
+
+    FORCE_INLINE static VecType max(VecType a, VecType b) noexcept { return _mm512_max_epi64(a, b); }
+    FORCE_INLINE static VecType max(VecType a, ScalarType b) noexcept { return _mm512_max_epi64(a, set1(b)); }
+
+    // a < b ? x : y, lane-wise
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return _mm512_mask_blend_epi64(_mm512_cmplt_epi64_mask(a, b), y, x);
+    }
+
+    // ============================================================================
+    // Gather / scatter: native, 8 × 64-bit indices
+    // ============================================================================
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        return _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), 0xFF, _mm512_loadu_si512(indices), base, sizeof(ScalarType));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        _mm512_i64scatter_epi64(base, _mm512_loadu_si512(indices), val, sizeof(ScalarType));
+    }
+
+    /// In-register 8×8 transpose, as the double kernel's (a pure lane shuffle)
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        Microkernel<double, 512, X86_AVX512>::VecType f[simdWidth];
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            f[i] = _mm512_castsi512_pd(r[i]);
+        Microkernel<double, 512, X86_AVX512>::transpose(f);
+        for (my_size_t i = 0; i < simdWidth; ++i)
+            r[i] = _mm512_castpd_si512(f[i]);
+    }
+
+    FORCE_INLINE static VecType abs(VecType v) noexcept { return _mm512_abs_epi64(v); }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        __m512i abs_diff = _mm512_abs_epi64(_mm512_sub_epi64(a, b));
+        return _mm512_cmpgt_epi64_mask(abs_diff, set1(tol)) == 0; // none greater than tol
+    }
+};
+
+#pragma GCC diagnostic pop
+
+#endif // __AVX512_MICROKERNEL_H__
@@ -0,0 +1,116 @@
+#ifndef __AVX512_QGEMM_MICROKERNEL_H__
+#define __AVX512_QGEMM_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+
+// Unmasked intrinsics and -Wmaybe-uninitialized: see avx512_microkernel.h
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// ============================================================================
+// AVX-512 (512-bit) int8 dot-product kernel for the quantized GEMM
+// ============================================================================
+// AVX-512 VNNI: vpdpbusd, 64 unsigned × signed byte pairs per instruction,
+// B fed unsigned with a +128 offset (B_BIAS, removed by the GEMM).
+// AVX-512 BW: 32 int8 values sign-extended to int16, then vpmaddwd.
+// AVX-512F alone has no 512-bit byte or word arithmetic: the same
+// widening pair on 256-bit registers.
+
+template <>
+struct QGemmMicrokernel<512, X86_AVX512>
+{
+    static constexpr my_size_t MR = 4; // 16 accumulators + 4 B + 1 A + 1 product of 32 ZMM
+    static constexpr my_size_t NR = 4;
+
+#if defined(__AVX512BW__)
+    using AccType = __m512i;
+    using Operand = __m512i;
+
+    FORCE_INLINE static AccType zero() noexcept { return _mm512_setzero_si512(); }
+
+#if defined(__AVX512VNNI__)
+    static constexpr my_size_t KStep = 64;
+    static constexpr int32_t B_BIAS = 128;
+
+    FORCE_INLINE static Operand load_a(const int8_t *ptr) noexcept { return _mm512_load_si512(ptr); }
+
+    FORCE_INLINE static Operand load_b(const int8_t *ptr) noexcept
+    {
+        return _mm512_xor_si512(_mm512_load_si512(ptr), _mm512_set1_epi8(static_cast<char>(0x80)));
+    }
+
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept
+    {
+        return _mm512_dpbusd_epi32(acc, b, a);
+    }
+#else
+    static constexpr my_size_t KStep = 32;
+    static constexpr int32_t B_BIAS = 0;
+
+    FORCE_INLINE static Operand load_a(const int8_t *ptr) noexcept
+    {
+        return _mm512_cvtepi8_epi16(_mm256_load_si256(reinterpret_cast<const __m256i *>(ptr)));
+    }
+
+    FORCE_INLINE static Operand load_b(const int8_t *ptr) noexcept { return load_a(ptr); }
+
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept
+    {
+        return _mm512_add_epi32(acc, _mm512_madd_epi16(a, b));
+    }
+#endif
+
+    FORCE_INLINE static int32_t hsum(AccType acc) noexcept { return _mm512_reduce_add_epi32(acc); }
+
+    /// out[c] = Σ lanes of acc[c], c < 4 — one transposed reduction.
+    FORCE_INLINE static void hsum4(const AccType *acc, int32_t *out) noexcept
+    {
+        __m256i h[4];
+        for (int c = 0; c < 4; ++c)
+            h[c] = _mm256_add_epi32(_mm512_castsi512_si256(acc[c]), _mm512_extracti64x4_epi64(acc[c], 1));
+        const __m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(h[0], h[1]), _mm256_hadd_epi32(h[2], h[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_add_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1)));
+    }
+#else
+    static constexpr my_size_t KStep = 16;
+    static constexpr int32_t B_BIAS = 0;
+    using AccType = __m256i;
+    using Operand = __m256i;
+
+    FORCE_INLINE static AccType zero() noexcept { return _mm256_setzero_si256(); }
+
+    FORCE_INLINE static Operand load_a(const int8_t *ptr) noexcept
+    {
+        return _mm256_cvtepi8_epi16(_mm_load_si128(reinterpret_cast<const __m128i *>(ptr)));
+    }
+
+    FORCE_INLINE static Operand load_b(const int8_t *ptr) noexcept { return load_a(ptr); }
+
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept
+    {
+        return _mm256_add_epi32(acc, _mm256_madd_epi16(a, b));
+    }
+
+    FORCE_INLINE static int32_t hsum(AccType acc) noexcept
+    {
+        __m128i s = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(s);
+    }
+
+    FORCE_INLINE static void hsum4(const AccType *acc, int32_t *out) noexcept
+    {
+        const __m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(acc[0], acc[1]), _mm256_hadd_epi32(acc[2], acc[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_add_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1)));
+    }
+#endif
+};
+
+#pragma GCC diagnostic pop
+
+#endif // __AVX512_QGEMM_MICROKERNEL_H__
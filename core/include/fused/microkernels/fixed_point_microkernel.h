@@ -0,0 +1,357 @@
+#ifndef FIXED_POINT_MICROKERNEL_H
+#define FIXED_POINT_MICROKERNEL_H
+
+#include "config.h"
+#include "fixed_point.h"
+
+// ============================================================================
+// Fixed-point microkernel (Q15 / Q31)
+// ============================================================================
+// Microkernel<FixedPoint<Raw, F>, Bits, Arch> is the same scalar integer
+// kernel on every arch: one element per "vector". Values are processed in a
+// 64-bit register format, FixedPointWide, with WideBits fractional bits:
+//
+//   Q15   WideBits = 30   (products of two Q15 values are exact)
+//   Q31   WideBits = 31
+//
+// Loads widen, stores round to nearest and saturate to the Raw range. In
+// between, add / sub are plain 64-bit integer operations and mul / div round
+// to WideBits, so an expression saturates once, at its store, and dot
+// products and GEMM accumulate in 64 bits (CMSIS-DSP accumulates q15 dot
+// products in q63 the same way) and round once per output element.
+//
+// A single operation matches the scalar FixedPoint operator bit for bit. A
+// chain can differ by one LSB, in the kernel's favour, where the scalar form
+// rounds or saturates an intermediate. Intermediates are exact up to
+// |x| < 2^(63 − 2·WideBits) — beyond that mul saturates.
+//
+// Packed Q15 (TESSERACT_FIXED_POINT_PACKED, on by default with the DSP
+// extension): the 64-bit format costs a __builtin_mul_overflow per mul,
+// slow on Cortex-M. There the default kernel slot for Q15 is
+// FixedPointQ15x2Microkernel instead, two values per 32-bit word:
+//
+//   add / sub        __QADD16 / __QSUB16, both lanes at once
+//   mul / div, ...   per lane, the scalar operators
+//   dot, GEMM        __SMLALD: two 16 × 16 products into a 64-bit sum
+//
+// Every operation saturates, as the scalar operators do, so expressions
+// match the scalar code exactly. Dot products and GEMM keep the 64-bit
+// accumulation above: they take K::mac instead of fmadd (see
+// KernelHelpers::PairMac). SMLALD is the dual multiply-accumulate SMLAD
+// with a 64-bit accumulator; SMLAD's 32-bit one wraps on a single pair of
+// −1 · −1 products. Elsewhere the intrinsics are portable C, so defining
+// TESSERACT_FIXED_POINT_PACKED runs the packed kernel on any host. The
+// wide kernel stays for Q31 and for Q15 without the macro.
+
+/// A fixed-point value in the 64-bit kernel format: v · 2^-WideBits.
+template <typename Q>
+struct FixedPointWide
+{
+    static constexpr int WideBits = (Q::frac_bits <= 15) ? 2 * Q::frac_bits : Q::frac_bits;
+    static constexpr int Up = WideBits - Q::frac_bits;
+
+    long long v;
+
+    constexpr FixedPointWide() noexcept : v(0) {}
+    constexpr FixedPointWide(Q q) noexcept : v(static_cast<long long>(q.raw) * (1LL << Up)) {}
+
+    /// Round to nearest (ties up), saturate to Q's range.
+    constexpr operator Q() const noexcept
+    {
+        if constexpr (Up == 0)
+            return Q::saturate(v);
+        else
+            return Q::saturate((v >> Up) + ((v >> (Up - 1)) & 1));
+    }
+
+    static constexpr FixedPointWide from_wide(long long w) noexcept
+    {
+        FixedPointWide r;
+        r.v = w;
+        return r;
+    }
+};
+
+template <typename Q>
+struct FixedPointMicrokernel
+{
+    static constexpr my_size_t simdWidth = 1;
+    // GEMM tiling constants, as for the scalar fallback
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 1;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 1
+    // No packing: the 64-bit accumulators must not pass through Q storage
+    // between KC blocks, and MCU targets have no cache to block for.
+    static constexpr my_size_t KC = 0;
+    static constexpr my_size_t MC = 0;
+    static constexpr my_size_t NC = 0;
+    using VecType = FixedPointWide<Q>;
+    using ScalarType = Q;
+
+    static constexpr int W = VecType::WideBits;
+
+    /// Magnitude mul / div saturate to: far outside Q's range, with headroom for a few more adds.
+    static constexpr long long WIDE_SAT = 1LL << 60;
+
+    FORCE_INLINE static VecType load(const Q *ptr) noexcept { return VecType(*ptr); }
+    FORCE_INLINE static VecType loadu(const Q *ptr) noexcept { return VecType(*ptr); }
+
+    FORCE_INLINE static void store(Q *ptr, VecType val) noexcept { *ptr = static_cast<Q>(val); }
+    FORCE_INLINE static void storeu(Q *ptr, VecType val) noexcept { *ptr = static_cast<Q>(val); }
+
+    FORCE_INLINE static VecType maskload(const Q *ptr, my_size_t n) noexcept { return n ? VecType(*ptr) : VecType{}; }
+    FORCE_INLINE static void maskstore(Q *ptr, VecType val, my_size_t n) noexcept
+    {
+        if (n)
+            *ptr = static_cast<Q>(val);
+    }
+
+    FORCE_INLINE static VecType set1(Q scalar) noexcept { return VecType(scalar); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return VecType::from_wide(a.v + b.v); }
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return VecType::from_wide(a.v - b.v); }
+
+    /// (a · b) >> W, rounded to nearest.
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+        long long p;
+        if (__builtin_mul_overflow(a.v, b.v, &p)) [[unlikely]]
+            return VecType::from_wide(((a.v < 0) != (b.v < 0)) ? -WIDE_SAT : WIDE_SAT);
+        return VecType::from_wide((p >> W) + ((p >> (W - 1)) & 1));
+    }
+
+    /// (a << W) / b, rounded to nearest; x / 0 saturates.
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        long long n;
+        if (b.v == 0 || __builtin_mul_overflow(a.v, 1LL << W, &n)) [[unlikely]]
+            return VecType::from_wide(a.v == 0 ? 0 : (((a.v < 0) != (b.v < 0)) ? -WIDE_SAT : WIDE_SAT));
+        return VecType::from_wide(detail::div_round(n, b.v));
+    }
+
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return add(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return sub(mul(a, b), c); }
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return sub(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return VecType::from_wide(-mul(a, b).v - c.v); }
+
+    FORCE_INLINE static VecType min(VecType a, VecType b) noexcept { return a.v < b.v ? a : b; }
+    FORCE_INLINE static VecType max(VecType a, VecType b) noexcept { return a.v > b.v ? a : b; }
+    FORCE_INLINE static VecType abs(VecType a) noexcept { return VecType::from_wide(a.v < 0 ? -a.v : a.v); }
+
+    FORCE_INLINE static VecType gather(const Q *base, const my_size_t *indices) noexcept { return VecType(base[indices[0]]); }
+    FORCE_INLINE static void scatter(Q *base, const my_size_t *indices, VecType val) noexcept { base[indices[0]] = static_cast<Q>(val); }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, Q tol) noexcept
+    {
+        const long long d = a.v - b.v;
+        return (d < 0 ? -d : d) <= VecType(tol).v;
+    }
+};
+
+template <typename Raw, int F, my_size_t Bits, typename Arch>
+struct Microkernel<FixedPoint<Raw, F>, Bits, Arch> : FixedPointMicrokernel<FixedPoint<Raw, F>>
+{
+};
+
+// More specialized than both the above and the generic Microkernel<T, Bits, GENERICARCH>
+template <typename Raw, int F, my_size_t Bits>
+struct Microkernel<FixedPoint<Raw, F>, Bits, GENERICARCH> : FixedPointMicrokernel<FixedPoint<Raw, F>>
+{
+};
+
+// ============================================================================
+// Packed Q15 microkernel
+// ============================================================================
+
+#if defined(TESSERACT_FIXED_POINT_DSP) && !defined(TESSERACT_FIXED_POINT_PACKED)
+#define TESSERACT_FIXED_POINT_PACKED
+#endif
+
+/**
+ * @brief Two Q15 values in one 32-bit word, lane 0 in the low halfword.
+ *
+ * The layout of a q15_t pair in memory on a little-endian core. Converting
+ * from Q broadcasts and converting back reads lane 0, so scalar code that
+ * runs through the kernel slot (Op<T, 0, GENERICARCH> when BITS is 0)
+ * computes lane 0 of a broadcast.
+ */
+template <typename Q>
+struct FixedPointPair
+{
+    static_assert(Q::frac_bits == 15, "FixedPointPair: two Q15 values per 32-bit word");
+
+    unsigned int v;
+
+    constexpr FixedPointPair() noexcept : v(0) {}
+    constexpr FixedPointPair(Q q) noexcept : v(bits(q) | (bits(q) << 16)) {}
+
+    constexpr operator Q() const noexcept { return lo(); }
+
+    constexpr Q lo() const noexcept { return Q::from_raw(static_cast<short>(v & 0xFFFFu)); }
+    constexpr Q hi() const noexcept { return Q::from_raw(static_cast<short>(v >> 16)); }
+
+    static constexpr unsigned int bits(Q q) noexcept { return static_cast<unsigned short>(q.raw); }
+
+    static constexpr FixedPointPair from_word(unsigned int w) noexcept
+    {
+        FixedPointPair r;
+        r.v = w;
+        return r;
+    }
+};
+
+struct FixedPointQ15x2Microkernel
+{
+    static constexpr my_size_t simdWidth = 2;
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 1;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 2
+    // GEMM runs on K::mac (kernel_gemm.h, pair path), unpacked
+    static constexpr my_size_t KC = 0;
+    static constexpr my_size_t MC = 0;
+    static constexpr my_size_t NC = 0;
+    using VecType = FixedPointPair<Q15>;
+    using ScalarType = Q15;
+
+    /// Dot product / GEMM accumulator: a sum of exact Q30 products.
+    using AccType = long long;
+
+    // --- The DSP instructions: intrinsics, or the same operation in C ---
+
+    /// Saturating add of each halfword.
+    FORCE_INLINE static unsigned int qadd16(unsigned int a, unsigned int b) noexcept
+    {
+#ifdef TESSERACT_FIXED_POINT_DSP
+        return __QADD16(a, b);
+#else
+        return lanes(VecType::from_word(a).lo() + VecType::from_word(b).lo(),
+                     VecType::from_word(a).hi() + VecType::from_word(b).hi()).v;
+#endif
+    }
+
+    /// Saturating subtract of each halfword.
+    FORCE_INLINE static unsigned int qsub16(unsigned int a, unsigned int b) noexcept
+    {
+#ifdef TESSERACT_FIXED_POINT_DSP
+        return __QSUB16(a, b);
+#else
+        return lanes(VecType::from_word(a).lo() - VecType::from_word(b).lo(),
+                     VecType::from_word(a).hi() - VecType::from_word(b).hi()).v;
+#endif
+    }
+
+    /// acc + lo(a)·lo(b) + hi(a)·hi(b), in 64 bits.
+    FORCE_INLINE static AccType smlald(unsigned int a, unsigned int b, AccType acc) noexcept
+    {
+#ifdef TESSERACT_FIXED_POINT_DSP
+        return static_cast<AccType>(__SMLALD(a, b, static_cast<unsigned long long>(acc)));
+#else
+        const VecType x = VecType::from_word(a), y = VecType::from_word(b);
+        return acc + static_cast<long long>(x.lo().raw) * y.lo().raw + static_cast<long long>(x.hi().raw) * y.hi().raw;
+#endif
+    }
+
+    /// lo in the low halfword, hi in the high one.
+    FORCE_INLINE static VecType lanes(Q15 lo, Q15 hi) noexcept
+    {
+#ifdef TESSERACT_FIXED_POINT_DSP
+        return VecType::from_word(__PKHBT(VecType::bits(lo), VecType::bits(hi), 16));
+#else
+        return VecType::from_word(VecType::bits(lo) | (VecType::bits(hi) << 16));
+#endif
+    }
+
+    // --- Memory ---
+
+    FORCE_INLINE static VecType load(const Q15 *ptr) noexcept
+    {
+        unsigned int w;
+        __builtin_memcpy(&w, ptr, sizeof w);
+        return VecType::from_word(w);
+    }
+    FORCE_INLINE static VecType loadu(const Q15 *ptr) noexcept { return load(ptr); }
+
+    FORCE_INLINE static void store(Q15 *ptr, VecType val) noexcept { __builtin_memcpy(static_cast<void *>(ptr), &val.v, sizeof val.v); }
+    FORCE_INLINE static void storeu(Q15 *ptr, VecType val) noexcept { store(ptr, val); }
+
+    FORCE_INLINE static VecType maskload(const Q15 *ptr, my_size_t n) noexcept
+    {
+        return n >= 2 ? load(ptr) : (n ? lanes(ptr[0], Q15{}) : VecType{});
+    }
+    FORCE_INLINE static void maskstore(Q15 *ptr, VecType val, my_size_t n) noexcept
+    {
+        if (n >= 2)
+            store(ptr, val);
+        else if (n)
+            ptr[0] = val.lo();
+    }
+
+    FORCE_INLINE static VecType set1(Q15 scalar) noexcept { return VecType(scalar); }
+
+    FORCE_INLINE static VecType gather(const Q15 *base, const my_size_t *indices) noexcept { return lanes(base[indices[0]], base[indices[1]]); }
+    FORCE_INLINE static void scatter(Q15 *base, const my_size_t *indices, VecType val) noexcept
+    {
+        base[indices[0]] = val.lo();
+        base[indices[1]] = val.hi();
+    }
+
+    // --- Arithmetic: saturating, as the scalar operators ---
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return VecType::from_word(qadd16(a.v, b.v)); }
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return VecType::from_word(qsub16(a.v, b.v)); }
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept { return lanes(a.lo() * b.lo(), a.hi() * b.hi()); }
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept { return lanes(a.lo() / b.lo(), a.hi() / b.hi()); }
+
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return add(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return sub(mul(a, b), c); }
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return sub(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return sub(sub(VecType{}, mul(a, b)), c); }
+
+    FORCE_INLINE static VecType min(VecType a, VecType b) noexcept { return lanes(a.lo() < b.lo() ? a.lo() : b.lo(), a.hi() < b.hi() ? a.hi() : b.hi()); }
+    FORCE_INLINE static VecType max(VecType a, VecType b) noexcept { return lanes(a.lo() > b.lo() ? a.lo() : b.lo(), a.hi() > b.hi() ? a.hi() : b.hi()); }
+    FORCE_INLINE static VecType abs(VecType a) noexcept { return lanes(a.lo() < Q15{} ? -a.lo() : a.lo(), a.hi() < Q15{} ? -a.hi() : a.hi()); }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, Q15 tol) noexcept
+    {
+        const int dlo = a.lo().raw - b.lo().raw, dhi = a.hi().raw - b.hi().raw;
+        return (dlo < 0 ? -dlo : dlo) <= tol.raw && (dhi < 0 ? -dhi : dhi) <= tol.raw;
+    }
+
+    // --- Dot products and GEMM (KernelHelpers::PairMac) ---
+
+    /// acc + a(k)·b(k) + a(k+1)·b(k+1) for pairs along the contraction axis.
+    FORCE_INLINE static AccType mac(AccType acc, VecType a, VecType b) noexcept { return smlald(a.v, b.v, acc); }
+
+    /// A sum of Q30 products rounded once to Q15 (nearest, ties up), saturated.
+    FORCE_INLINE static Q15 round_acc(AccType acc) noexcept { return Q15::saturate((acc >> 15) + ((acc >> 14) & 1)); }
+};
+
+#ifdef TESSERACT_FIXED_POINT_PACKED
+// The default kernel slot only: Bits = 1 (the scalar kernel of the logical
+// paths) and the other arches stay on the wide kernel. Needs BITS and
+// DefaultArch, so microkernel_base.h includes this file after the arch block.
+template <>
+struct Microkernel<Q15, BITS, DefaultArch> : FixedPointQ15x2Microkernel
+{
+};
+
+template <typename Arch, my_size_t N>
+struct MaskedTail;
+
+// The one partial vector of a pair: lane 0 live. Spelled out, since the
+// generic MaskedTail adapter and the wide kernel's <FixedPoint, Bits, Arch>
+// would both match it.
+template <>
+struct Microkernel<Q15, BITS, MaskedTail<DefaultArch, 1>> : FixedPointQ15x2Microkernel
+{
+    static constexpr my_size_t liveLanes = 1;
+
+    FORCE_INLINE static VecType load(const Q15 *ptr) noexcept { return maskload(ptr, 1); }
+    FORCE_INLINE static VecType loadu(const Q15 *ptr) noexcept { return maskload(ptr, 1); }
+    FORCE_INLINE static VecType gather(const Q15 *base, const my_size_t *indices) noexcept { return lanes(base[indices[0]], Q15{}); }
+};
+#endif
+
+#endif // FIXED_POINT_MICROKERNEL_H
@@ -0,0 +1,64 @@
+#ifndef GENERIC_COMPLEX_MICROKERNEL_H
+#define GENERIC_COMPLEX_MICROKERNEL_H
+
+#include "config.h"
+#include "complex.h"
+
+// Generic microkernel for Complex<float> / Complex<double> (scalar fallback).
+// One complex number per "vector"; the operations are Complex<T>'s own.
+// Ordering (min / max / abs as a complex) is not defined for complex values.
+
+template <typename T, my_size_t Bits>
+struct Microkernel<Complex<T>, Bits, GENERICARCH>
+{
+    static constexpr my_size_t simdWidth = 1;
+    // GEMM tiling constants (scalar fallback)
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 2;
+    static constexpr my_size_t NR_VECS = 1;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 1
+    // GEMM cache blocking disabled, as for the real scalar kernel
+    static constexpr my_size_t KC = 0;
+    static constexpr my_size_t MC = 0;
+    static constexpr my_size_t NC = 0;
+    using VecType = Complex<T>;
+    using ScalarType = Complex<T>;
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return *ptr; }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return *ptr; }
+
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { *ptr = val; }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { *ptr = val; }
+
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return n ? *ptr : VecType{}; }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept
+    {
+        if (n)
+            *ptr = val;
+    }
+
+    FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return scalar; }
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return a + b; }
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept { return a * b; }
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return a - b; }
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept { return a / b; }
+
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return a * b + c; }
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return a * b - c; }
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return c - a * b; }
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return -(a * b) - c; }
+
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept { return base[indices[0]]; }
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept { base[indices[0]] = val; }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept { return {v.re, -v.im}; }
+
+    /// |Δre| ≤ tol.re and |Δim| ≤ tol.re (false for NaN)
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        const T dr = a.re - b.re, di = a.im - b.im;
+        return (dr < T{0} ? -dr : dr) <= tol.re && (di < T{0} ? -di : di) <= tol.re;
+    }
+};
+
+#endif // GENERIC_COMPLEX_MICROKERNEL_H
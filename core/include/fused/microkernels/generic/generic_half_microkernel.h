@@ -0,0 +1,29 @@
+#ifndef GENERIC_HALF_MICROKERNEL_H
+#define GENERIC_HALF_MICROKERNEL_H
+
+#include "config.h"
+#include "fused/microkernels/half_microkernel.h"
+
+// Generic microkernel for Half / BFloat16 (scalar fallback): one element per
+// "vector", converted with the portable bit manipulation in half.h.
+
+template <typename H>
+struct ScalarHalfConvert
+{
+    FORCE_INLINE static float load(const H *ptr) noexcept { return static_cast<float>(*ptr); }
+    FORCE_INLINE static void store(H *ptr, float val) noexcept { *ptr = H(val); }
+};
+
+template <my_size_t Bits>
+struct Microkernel<Half, Bits, GENERICARCH>
+    : HalfMicrokernel<Half, Microkernel<float, Bits, GENERICARCH>, ScalarHalfConvert<Half>>
+{
+};
+
+template <my_size_t Bits>
+struct Microkernel<BFloat16, Bits, GENERICARCH>
+    : HalfMicrokernel<BFloat16, Microkernel<float, Bits, GENERICARCH>, ScalarHalfConvert<BFloat16>>
+{
+};
+
+#endif // GENERIC_HALF_MICROKERNEL_H
@@ -18,6 +18,11 @@ struct Microkernel<T, Bits, GENERICARCH>
     static constexpr my_size_t MR = 4;
     static constexpr my_size_t NR_VECS = 1;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 1
+    // GEMM cache blocking disabled: scalar targets are typically MCUs with no
+    // cache hierarchy to exploit, and the packing buffers would cost SRAM.
+    static constexpr my_size_t KC = 0;
+    static constexpr my_size_t MC = 0;
+    static constexpr my_size_t NC = 0;
     using VecType = T;
     using ScalarType = T; // In scalar mode, VecType is the same as ScalarType
 
@@ -27,6 +32,14 @@ struct Microkernel<T, Bits, GENERICARCH>
     FORCE_INLINE static void store(T *ptr, VecType val) noexcept { *ptr = val; }
     FORCE_INLINE static void storeu(T *ptr, VecType val) noexcept { *ptr = val; }
 
+    // Partial "vector" of n ∈ {0, 1} lanes
+    FORCE_INLINE static VecType maskload(const T *ptr, my_size_t n) noexcept { return n ? *ptr : T{0}; }
+    FORCE_INLINE static void maskstore(T *ptr, VecType val, my_size_t n) noexcept
+    {
+        if (n)
+            *ptr = val;
+    }
+
     FORCE_INLINE static VecType set1(T scalar) noexcept { return scalar; } // In scalar mode, set1 is identity}
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return a + b; }
     FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept { return a * b; }
@@ -45,6 +58,52 @@ struct Microkernel<T, Bits, GENERICARCH>
     FORCE_INLINE static void scatter(T *base, const my_size_t *indices, VecType val) noexcept { base[indices[0]] = val; }
 
     FORCE_INLINE static VecType abs(VecType v) noexcept { return v < T{0} ? -v : v; }
+
+    // Elementwise math primitives (building blocks of vector_math.h), float / double only
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept
+    {
+        if constexpr (is_same_v<T, float>)
+            return __builtin_sqrtf(v);
+        else
+            return __builtin_sqrt(v);
+    }
+    FORCE_INLINE static VecType round(VecType v) noexcept // nearest, ties to even
+    {
+        if constexpr (is_same_v<T, float>)
+            return __builtin_rintf(v);
+        else
+            return __builtin_rint(v);
+    }
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept { return a < b ? x : y; }
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        if constexpr (is_same_v<T, float>)
+            return __builtin_copysignf(mag, sgn);
+        else
+            return __builtin_copysign(mag, sgn);
+    }
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept
+    {
+        if constexpr (is_same_v<T, float>)
+            return __builtin_ldexpf(1.0f, static_cast<int>(n));
+        else
+            return __builtin_ldexp(1.0, static_cast<int>(n));
+    }
+    FORCE_INLINE static VecType getexp(VecType v) noexcept
+    {
+        if constexpr (is_same_v<T, float>)
+            return static_cast<T>(__builtin_ilogbf(v));
+        else
+            return static_cast<T>(__builtin_ilogb(v));
+    }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept
+    {
+        if constexpr (is_same_v<T, float>)
+            return __builtin_scalbnf(v, -__builtin_ilogbf(v));
+        else
+            return __builtin_scalbn(v, -__builtin_ilogb(v));
+    }
+
     FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, T tol) noexcept
     {
         T diff = a - b;
@@ -0,0 +1,33 @@
+#ifndef GENERIC_QGEMM_MICROKERNEL_H
+#define GENERIC_QGEMM_MICROKERNEL_H
+
+#include "config.h"
+
+// Generic int8 dot-product kernel for the quantized GEMM (scalar fallback):
+// four int8 products per step, accumulated in int32.
+
+template <my_size_t Bits>
+struct QGemmMicrokernel<Bits, GENERICARCH>
+{
+    static constexpr my_size_t KStep = 4; // int8 elements per dot step
+    static constexpr my_size_t MR = 2;
+    static constexpr my_size_t NR = 2;
+    static constexpr int32_t B_BIAS = 0;
+    using AccType = int32_t;
+    using Operand = const int8_t *;
+
+    FORCE_INLINE static AccType zero() noexcept { return 0; }
+    FORCE_INLINE static Operand load_a(const int8_t *ptr) noexcept { return ptr; }
+    FORCE_INLINE static Operand load_b(const int8_t *ptr) noexcept { return ptr; }
+
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept
+    {
+        for (my_size_t k = 0; k < KStep; ++k)
+            acc += int32_t(a[k]) * int32_t(b[k]);
+        return acc;
+    }
+
+    FORCE_INLINE static int32_t hsum(AccType acc) noexcept { return acc; }
+};
+
+#endif // GENERIC_QGEMM_MICROKERNEL_H
@@ -0,0 +1,94 @@
+#ifndef HALF_MICROKERNEL_H
+#define HALF_MICROKERNEL_H
+
+#include "config.h"
+#include "half.h"
+
+// ============================================================================
+// 16-bit storage microkernel (Half / BFloat16)
+// ============================================================================
+// Microkernel<H, Bits, Arch> for H ∈ {Half, BFloat16} is the float kernel of
+// the same arch with H-typed memory operations: VecType is the fp32 vector,
+// load / store go through Cvt, which widens simdWidth 16-bit lanes to fp32
+// and narrows them back with round to nearest even:
+//
+//   struct Cvt
+//   {
+//       static VecType load(const H *ptr);          // simdWidth lanes
+//       static void store(H *ptr, VecType val);
+//   };
+//
+// Everything else (arithmetic, FMA, min/max, the vector_math primitives) is
+// the float kernel's, so expressions and reductions compute in fp32.
+//
+// GEMM: KC = MC = NC = 0, so KernelGemm never packs. The packed path passes
+// partial sums through C between KC blocks, which would round them to 16
+// bits once per block; the register-blocked path accumulates each tile over
+// the whole of K in fp32 registers and narrows once, on the final store.
+
+template <typename H, typename FK, typename Cvt>
+struct HalfMicrokernel : FK
+{
+    using VecType = typename FK::VecType;
+    using ScalarType = H;
+    using FK::simdWidth;
+
+    static constexpr my_size_t KC = 0;
+    static constexpr my_size_t MC = 0;
+    static constexpr my_size_t NC = 0;
+
+    // The fp32 forms stay available (horizontal sums store to float lanes)
+    using FK::load;
+    using FK::loadu;
+    using FK::store;
+    using FK::storeu;
+    using FK::maskload;
+    using FK::maskstore;
+    using FK::set1;
+    using FK::gather;
+    using FK::scatter;
+
+    FORCE_INLINE static VecType load(const H *ptr) noexcept { return Cvt::load(ptr); }
+    FORCE_INLINE static VecType loadu(const H *ptr) noexcept { return Cvt::load(ptr); }
+    FORCE_INLINE static void store(H *ptr, VecType val) noexcept { Cvt::store(ptr, val); }
+    FORCE_INLINE static void storeu(H *ptr, VecType val) noexcept { Cvt::store(ptr, val); }
+
+    FORCE_INLINE static VecType set1(H scalar) noexcept { return FK::set1(static_cast<float>(scalar)); }
+
+    // Partial vectors go through a staging buffer: 16-bit lanes have no
+    // masked load below AVX-512 BW, and a wider masked access would touch
+    // memory past lane n.
+    FORCE_INLINE static VecType maskload(const H *ptr, my_size_t n) noexcept
+    {
+        H tmp[simdWidth] = {};
+        for (my_size_t l = 0; l < n; ++l)
+            tmp[l] = ptr[l];
+        return Cvt::load(tmp);
+    }
+
+    FORCE_INLINE static void maskstore(H *ptr, VecType val, my_size_t n) noexcept
+    {
+        H tmp[simdWidth];
+        Cvt::store(tmp, val);
+        for (my_size_t l = 0; l < n; ++l)
+            ptr[l] = tmp[l];
+    }
+
+    FORCE_INLINE static VecType gather(const H *base, const my_size_t *indices) noexcept
+    {
+        H tmp[simdWidth];
+        for (my_size_t l = 0; l < simdWidth; ++l)
+            tmp[l] = base[indices[l]];
+        return Cvt::load(tmp);
+    }
+
+    FORCE_INLINE static void scatter(H *base, const my_size_t *indices, VecType val) noexcept
+    {
+        H tmp[simdWidth];
+        Cvt::store(tmp, val);
+        for (my_size_t l = 0; l < simdWidth; ++l)
+            base[indices[l]] = tmp[l];
+    }
+};
+
+#endif // HALF_MICROKERNEL_H
@@ -0,0 +1,111 @@
+// Loop-invariant integer divisor for the SIMD integer kernels
+#ifndef INT_DIVISOR_H
+#define INT_DIVISOR_H
+
+#include "config.h"
+#include "simple_type_traits.h"
+
+// ============================================================================
+// IntDivisor<T>
+// ============================================================================
+//
+// x86 has no SIMD integer divide, so Microkernel<int32_t / int64_t>::div
+// divides lane by lane through the stack. When the divisor d is the same for
+// every element (tensor / scalar), it is replaced by a multiply-high and a
+// shift with a magic number computed once per expression (Hacker's Delight
+// §10-1, the libdivide scheme):
+//
+//   q = mulhi(n, magic)                  signed high half of n · magic
+//   q = q + n   (add = +1)  or  q − n   (add = −1)
+//   q = q >> shift                       arithmetic
+//   q = q + (q < 0)                      round toward zero, as C++ does
+//
+// The result equals n / d for every n, d with 2 ≤ |d|, including INT_MIN.
+// d = 0 and d = ±1 have no magic (magic = 0): kernels fall back to the lane
+// division, so x / 0 behaves as the scalar division would.
+//
+// ScalarExprRHS<EXPR, T, Div> holds one for int32_t and int64_t; kernels
+// that provide div(VecType, const IntDivisor<T> &) use it (AVX2, AVX-512),
+// the others divide by `divisor`.
+
+namespace detail
+{
+    // Other T only appear in Div's overload set and are never constructed
+    template <typename T>
+    struct int_divisor_unsigned
+    {
+        using type = T;
+    };
+
+    template <>
+    struct int_divisor_unsigned<int32_t>
+    {
+        using type = uint32_t;
+    };
+
+    template <>
+    struct int_divisor_unsigned<int64_t>
+    {
+        using type = uint64_t;
+    };
+} // namespace detail
+
+/// True for the integer types IntDivisor supports (int32_t, int64_t).
+template <typename T>
+inline constexpr bool has_int_divisor_v = is_same_v<T, int32_t> || is_same_v<T, int64_t>;
+
+template <typename T>
+struct IntDivisor
+{
+    using U = typename detail::int_divisor_unsigned<T>::type;
+    static constexpr int BITS_T = 8 * static_cast<int>(sizeof(T));
+
+    T divisor;
+    T magic;   ///< 0: no multiply-high form (d = 0, ±1)
+    int shift; ///< Arithmetic right shift after the multiply-high, 0 ≤ shift < BITS_T
+    int add;   ///< +1: add the dividend after the multiply-high, −1: subtract it, 0: neither
+
+    constexpr explicit IntDivisor(T d) noexcept : divisor(d), magic(0), shift(0), add(0)
+    {
+        if (d == 0 || d == 1 || d == -1)
+            return;
+
+        const U two = U(1) << (BITS_T - 1);
+        const U ad = d < 0 ? U(0) - static_cast<U>(d) : static_cast<U>(d);
+        const U t = two + (static_cast<U>(d) >> (BITS_T - 1));
+        const U anc = t - 1 - t % ad; // |nc|
+        int p = BITS_T - 1;
+        U q1 = two / anc, r1 = two - q1 * anc;
+        U q2 = two / ad, r2 = two - q2 * ad;
+        U delta;
+        do
+        {
+            ++p;
+            q1 *= 2;
+            r1 *= 2;
+            if (r1 >= anc)
+            {
+                ++q1;
+                r1 -= anc;
+            }
+            q2 *= 2;
+            r2 *= 2;
+            if (r2 >= ad)
+            {
+                ++q2;
+                r2 -= ad;
+            }
+            delta = ad - r2;
+        } while (q1 < delta || (q1 == delta && r1 == 0));
+
+        const U m = q2 + 1;
+        magic = static_cast<T>(d < 0 ? U(0) - m : m);
+        shift = p - BITS_T;
+        if (d > 0 && magic < 0)
+            add = 1;
+        else if (d < 0 && magic > 0)
+            add = -1;
+    }
+};
+
+#endif // INT_DIVISOR_H
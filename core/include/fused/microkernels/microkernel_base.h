@@ -4,10 +4,12 @@
 
 #include "config.h"
 #include "simple_type_traits.h"
+#include "half.h"
+#include "fused/microkernels/int_divisor.h"
 
 // Base microkernel interface - all architecture-specific kernels implement this
 // Template parameters:
-//   T    = scalar type (float, double, int, Complex<float>, etc.)
+//   T    = scalar type (float, double, int, Complex<float>, Q15, etc.)
 //   Bits = SIMD register width in bits (128, 256, 512, etc.)
 //   Arch = architecture tag (X86_AVX, NEONArch, etc.)
 
@@ -22,6 +24,12 @@ struct Microkernel
     FORCE_INLINE static VecType load(const T *ptr) noexcept;
     FORCE_INLINE static void store(T *ptr, VecType val) noexcept;
 
+    // Partial vector: only the first n lanes (n ≤ simdWidth) are read or
+    // written; masked-off lanes of maskload are zero. Used for the tail of a
+    // row whose length is not a multiple of simdWidth (unpadded storage).
+    FORCE_INLINE static VecType maskload(const T *ptr, my_size_t n) noexcept;
+    FORCE_INLINE static void maskstore(T *ptr, VecType val, my_size_t n) noexcept;
+
     // Broadcast scalar to vector (CRITICAL for tensor-scalar ops)
     FORCE_INLINE static VecType set1(T scalar) noexcept;
 
@@ -85,33 +93,85 @@ struct Microkernel
 // struct ARM_NEON_A72 {};  // 128-bit NEON on Cortex-A72 and newer (RPi4)
 // struct ARM_NEON_A55 {};  // 128-bit NEON on Cortex-A55 and older (many ARMv8 phones)
 
+// ============================================================================
+// Target entry points
+// ============================================================================
+// ArchTarget<Arch>::run<Bits>(f) calls f.template operator()<Bits, Arch>();
+// ArchTarget<Arch>::task<Fn> is a ParallelTask calling Fn. Both are plain
+// calls unless Arch is compiled for a wider target than the translation unit
+// (TESSERACT_RUNTIME_DISPATCH, see x86_dispatch.h), whose specialisations
+// enter that target first.
+
+template <typename Arch>
+struct ArchTarget
+{
+    template <my_size_t Bits, typename F>
+    FORCE_INLINE static decltype(auto) run(F &f)
+    {
+        return f.template operator()<Bits, Arch>();
+    }
+
+    template <auto Fn>
+    static void task(void *ctx, my_size_t index) noexcept
+    {
+        Fn(ctx, index);
+    }
+};
+
+// ============================================================================
+// Quantized GEMM kernels
+// ============================================================================
+// QGemmMicrokernel<Bits, Arch> is the int8 dot-product step of the quantized
+// GEMM (kernel_qgemm.h): KStep int8 pairs of two K-contiguous rows multiplied
+// and summed into int32 accumulators, exactly.
+//
+//   KStep   int8 elements consumed per dot()
+//   MR, NR  register tile: MR rows of A × NR rows of B
+//   B_BIAS  offset added to B's bytes when the instruction wants them
+//           unsigned (VNNI); the GEMM subtracts B_BIAS · Σₖ a(i,k)
+//   hsum    one accumulator's lanes summed; hsum4 (when NR = 4) four at once
+
+template <my_size_t Bits, typename Arch>
+struct QGemmMicrokernel;
+
 // Include all architecture implementations
 #include "fused/microkernels/generic/generic_microkernel.h"
-// #include "fused/microkernels/generic/generic_complex_microkernel.h"
+#include "fused/microkernels/generic/generic_complex_microkernel.h"
+#include "fused/microkernels/generic/generic_half_microkernel.h"
+#include "fused/microkernels/generic/generic_qgemm_microkernel.h"
 
 #if __AVX512F__
-#include "fused/microkernels/avx2/avx512_microkernel.h"
-// #include "fused/microkernels/avx2/avx512_complex_microkernel.h"
+#include "fused/microkernels/avx512/avx512_microkernel.h"
+#include "fused/microkernels/avx512/avx512_complex_microkernel.h"
+#include "fused/microkernels/avx512/avx512_half_microkernel.h"
+#include "fused/microkernels/avx512/avx512_qgemm_microkernel.h"
 #pragma message "[COMPILE-TIME] Using X86_AVX512F arch"
 constexpr my_size_t BITS = 512;
 using DefaultArch = X86_AVX512;
 
 #elif __AVX2__
 #include "fused/microkernels/avx2/avx2_microkernel.h"
-// #include "fused/microkernels/avx2/avx2_complex_microkernel.h"
+#include "fused/microkernels/avx2/avx2_complex_microkernel.h"
+#include "fused/microkernels/avx2/avx2_half_microkernel.h"
+#include "fused/microkernels/avx2/avx2_qgemm_microkernel.h"
 #pragma message "[COMPILE-TIME] Using X86_AVX arch"
 constexpr my_size_t BITS = 256;
 using DefaultArch = X86_AVX;
 
 #elif __SSE2__
 #include "fused/microkernels/sse2/sse2_microkernel.h"
-// #include "fused/microkernels/avx2/sse2_complex_microkernel.h"
+#include "fused/microkernels/sse2/sse2_complex_microkernel.h"
+#include "fused/microkernels/sse2/sse2_half_microkernel.h"
+#include "fused/microkernels/sse2/sse2_qgemm_microkernel.h"
 #pragma message "[COMPILE-TIME] Using X86_SSE2 arch"
 constexpr my_size_t BITS = 128;
 using DefaultArch = X86_SSE;
 
 #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
 #include "fused/microkernels/neon/neon_microkernel.h"
+#include "fused/microkernels/neon/neon_complex_microkernel.h"
+#include "fused/microkernels/neon/neon_half_microkernel.h"
+#include "fused/microkernels/neon/neon_qgemm_microkernel.h"
 constexpr my_size_t BITS = 128;
 
     // User override takes priority
@@ -142,6 +202,127 @@ constexpr my_size_t BITS = 0;
 using DefaultArch = GENERICARCH;
 #endif
 
-constexpr my_size_t DATA_ALIGNAS = BITS / 8;
+// After the arch block: packed Q15 takes the <Q15, BITS, DefaultArch> slot
+#include "fused/microkernels/fixed_point_microkernel.h"
+
+#if defined(TESSERACT_RUNTIME_DISPATCH) && defined(__GNUC__) && defined(__SSE2__)
+#include "fused/microkernels/x86_dispatch.h"
+#endif
+
+// ============================================================================
+// Runtime dispatch
+// ============================================================================
+
+/**
+ * @brief Run f.template operator()<Bits', Arch'>() on the kernel family to use.
+ *
+ * For the compile-time default (Bits == BITS, Arch == DefaultArch) with
+ * TESSERACT_RUNTIME_DISPATCH, that is the widest x86 family the CPU
+ * supports (see x86_dispatch.h). Otherwise it is <Bits, Arch> itself.
+ * Kernels wrap their hot, non-inlined entries in it.
+ */
+template <typename T, my_size_t Bits, typename Arch, typename F>
+FORCE_INLINE decltype(auto) runtime_dispatch(F &&f)
+{
+#ifdef TESSERACT_X86_DISPATCH
+    if constexpr (Bits == BITS && is_same_v<Arch, DefaultArch>)
+        return x86_dispatch<T>(f);
+    else
+#endif
+        return f.template operator()<Bits, Arch>();
+}
+
+/// Physical size (elements) from which KernelEval / KernelReduce go through
+/// runtime_dispatch. Smaller expressions stay inline on the default arch.
+constexpr my_size_t RUNTIME_DISPATCH_MIN_SIZE = 256;
+
+// ============================================================================
+// Padding width
+// ============================================================================
+// Tensors are padded and aligned for the widest kernel that may touch them:
+// the default arch, or AVX-512 when it can be dispatched to at runtime.
+
+#ifdef TESSERACT_X86_DISPATCH
+constexpr my_size_t PAD_BITS = 512;
+template <typename T>
+inline constexpr my_size_t PadSimdWidth =
+    Microkernel<T, 512, X86_AVX512>::simdWidth > Microkernel<T, BITS, DefaultArch>::simdWidth
+        ? Microkernel<T, 512, X86_AVX512>::simdWidth
+        : Microkernel<T, BITS, DefaultArch>::simdWidth;
+#else
+constexpr my_size_t PAD_BITS = BITS;
+template <typename T>
+inline constexpr my_size_t PadSimdWidth = Microkernel<T, BITS, DefaultArch>::simdWidth;
+#endif
+
+constexpr my_size_t DATA_ALIGNAS = PAD_BITS / 8;
+
+// ============================================================================
+// Masked tail adapter
+// ============================================================================
+// MaskedTail<Arch, N> is an arch tag whose microkernel is Arch's, except that
+// every memory access touches only the first N lanes (0 < N < simdWidth):
+// load / loadu become maskload and gather fetches N elements, the other
+// lanes are zero. Passing it as the Arch of evalu / logical_evalu evaluates
+// the last N elements of a row as one partial vector through the whole
+// expression tree, with no scalar remainder loop:
+//
+//   K::maskstore(out + i, expr.template evalu<T, Bits, MaskedTail<Arch, N>>(i), N);
+//
+// Integer division divides the live lanes only (the zero lanes would trap).
+// Nodes that compute gather indices ask live_lanes<K>() how many to compute,
+// so dead lanes never produce an out-of-range logical index.
+
+template <typename Arch, my_size_t N>
+struct MaskedTail
+{
+};
+
+template <typename T, my_size_t Bits, typename Arch, my_size_t N>
+struct Microkernel<T, Bits, MaskedTail<Arch, N>> : Microkernel<T, Bits, Arch>
+{
+    using Base = Microkernel<T, Bits, Arch>;
+    using typename Base::VecType;
+    static_assert(N > 0 && N < Base::simdWidth, "MaskedTail: N must be a proper partial vector");
+    static constexpr my_size_t liveLanes = N;
+
+    FORCE_INLINE static VecType load(const T *ptr) noexcept { return Base::maskload(ptr, N); }
+    FORCE_INLINE static VecType loadu(const T *ptr) noexcept { return Base::maskload(ptr, N); }
+
+    FORCE_INLINE static VecType gather(const T *base, const my_size_t *indices) noexcept
+    {
+        alignas(Bits / 8) T tmp[Base::simdWidth] = {};
+        for (my_size_t l = 0; l < N; ++l)
+            tmp[l] = base[indices[l]];
+        return Base::load(tmp);
+    }
+
+    using Base::div;
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        if constexpr (is_floating_point_v<T> || is_half_storage_v<T>)
+            return Base::div(a, b);
+        else
+        {
+            alignas(Bits / 8) T va[Base::simdWidth], vb[Base::simdWidth];
+            Base::store(va, a);
+            Base::store(vb, b);
+            for (my_size_t l = 0; l < N; ++l)
+                va[l] /= vb[l];
+            return Base::load(va);
+        }
+    }
+    FORCE_INLINE static VecType div(T a, VecType b) noexcept { return div(Base::set1(a), b); }
+};
+
+/// Number of lanes of K that hold data: N for MaskedTail, simdWidth otherwise.
+template <typename K>
+FORCE_INLINE constexpr my_size_t live_lanes() noexcept
+{
+    if constexpr (requires { K::liveLanes; })
+        return K::liveLanes;
+    else
+        return K::simdWidth;
+}
 
 #endif // MICROKERNEL_BASE_H
\ No newline at end of file
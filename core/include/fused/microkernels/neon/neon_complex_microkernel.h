@@ -0,0 +1,269 @@
+#ifndef __NEON_COMPLEX_MICROKERNEL_H__
+#define __NEON_COMPLEX_MICROKERNEL_H__
+
+#include "neon_microkernel.h"
+#include "complex.h"
+
+// ============================================================================
+// NEON (128-bit) complex intrinsics
+// ============================================================================
+// Interleaved storage: two Complex<float> per float32x4_t, one Complex<double>
+// per float64x2_t. NEON has no addsub, so the sign goes on the A side:
+//
+//   a·b + c = c + dup_re(a)·b + [−im(a), im(a)]·swap(b)
+//
+// two FMAs per complex multiply-add; dup via vtrn, swap via vrev64.
+
+struct NeonComplexFloatIntrinsics
+{
+    static constexpr my_size_t simdWidth = 2; // 128 bits / 64 bits per Complex<float> = 2
+    static constexpr my_size_t num_registers = 32;
+    using VecType = float32x4_t;
+    using ScalarType = Complex<float>;
+    using R = NeonFloatIntrinsics;
+
+    FORCE_INLINE static const float *flat(const ScalarType *p) noexcept { return reinterpret_cast<const float *>(p); }
+    FORCE_INLINE static float *flat(ScalarType *p) noexcept { return reinterpret_cast<float *>(p); }
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return vld1q_f32(flat(ptr)); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return vld1q_f32(flat(ptr)); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { vst1q_f32(flat(ptr), val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { vst1q_f32(flat(ptr), val); }
+    FORCE_INLINE static VecType set1(ScalarType s) noexcept
+    {
+        const float32x2_t z = vset_lane_f32(s.im, vdup_n_f32(s.re), 1);
+        return vcombine_f32(z, z);
+    }
+
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return R::maskload(flat(ptr), 2 * n); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { R::maskstore(flat(ptr), val, 2 * n); }
+
+    // In-pair shuffles: [re, re], [im, im], [im, re]
+    FORCE_INLINE static VecType dup_re(VecType v) noexcept { return vtrnq_f32(v, v).val[0]; }
+    FORCE_INLINE static VecType dup_im(VecType v) noexcept { return vtrnq_f32(v, v).val[1]; }
+    FORCE_INLINE static VecType swap(VecType v) noexcept { return vrev64q_f32(v); }
+
+    /// Flip the sign of the real (even = true) or imaginary lanes.
+    template <bool Even>
+    FORCE_INLINE static VecType flip(VecType v) noexcept
+    {
+        const uint32x4_t m = Even ? uint32x4_t{0x80000000u, 0u, 0x80000000u, 0u}
+                                  : uint32x4_t{0u, 0x80000000u, 0u, 0x80000000u};
+        return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v), m));
+    }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept { return flip<false>(v); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return vaddq_f32(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return vaddq_f32(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return vsubq_f32(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return vsubq_f32(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return vsubq_f32(set1(a), b); }
+
+    // fmadd: a*b + c
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept
+    {
+        return R::fmadd(flip<true>(dup_im(a)), swap(b), R::fmadd(dup_re(a), b, c));
+    }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+        return R::fmadd(flip<true>(dup_im(a)), swap(b), vmulq_f32(dup_re(a), b));
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(set1(b), a); }
+
+    // a·conj(b) / |b|²
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        const VecType bb = vmulq_f32(b, b);
+        return R::div(mul(a, conj(b)), vaddq_f32(bb, swap(bb)));
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return div(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return div(set1(a), b); }
+
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return vsubq_f32(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return vsubq_f32(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return vsubq_f32(vnegq_f32(mul(a, b)), c); }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(set1(b), a, c); }
+
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        return vcombine_f32(vld1_f32(flat(base + indices[0])), vld1_f32(flat(base + indices[1])));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        vst1_f32(flat(base + indices[0]), vget_low_f32(val));
+        vst1_f32(flat(base + indices[1]), vget_high_f32(val));
+    }
+
+    // |Δre| ≤ tol.re and |Δim| ≤ tol.re on every lane
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        return R::all_within_tolerance(a, b, tol.re);
+    }
+};
+
+struct NeonComplexDoubleIntrinsics
+{
+    static constexpr my_size_t simdWidth = 1; // 128 bits / 128 bits per Complex<double> = 1
+    static constexpr my_size_t num_registers = 32;
+    using VecType = float64x2_t;
+    using ScalarType = Complex<double>;
+    using R = NeonDoubleIntrinsics;
+
+    FORCE_INLINE static const double *flat(const ScalarType *p) noexcept { return reinterpret_cast<const double *>(p); }
+    FORCE_INLINE static double *flat(ScalarType *p) noexcept { return reinterpret_cast<double *>(p); }
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return vld1q_f64(flat(ptr)); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return vld1q_f64(flat(ptr)); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { vst1q_f64(flat(ptr), val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { vst1q_f64(flat(ptr), val); }
+    FORCE_INLINE static VecType set1(ScalarType s) noexcept { return vsetq_lane_f64(s.im, vdupq_n_f64(s.re), 1); }
+
+    // A vector is one number: n is 0 or 1
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return n ? load(ptr) : vdupq_n_f64(0.0); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept
+    {
+        if (n)
+            store(ptr, val);
+    }
+
+    FORCE_INLINE static VecType dup_re(VecType v) noexcept { return vdupq_laneq_f64(v, 0); }
+    FORCE_INLINE static VecType dup_im(VecType v) noexcept { return vdupq_laneq_f64(v, 1); }
+    FORCE_INLINE static VecType swap(VecType v) noexcept { return vextq_f64(v, v, 1); }
+
+    template <bool Even>
+    FORCE_INLINE static VecType flip(VecType v) noexcept
+    {
+        const uint64x2_t m = Even ? uint64x2_t{0x8000000000000000ull, 0ull} : uint64x2_t{0ull, 0x8000000000000000ull};
+        return vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(v), m));
+    }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept { return flip<false>(v); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return vaddq_f64(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return vaddq_f64(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return vsubq_f64(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return vsubq_f64(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return vsubq_f64(set1(a), b); }
+
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept
+    {
+        return vfmaq_f64(vfmaq_f64(c, dup_re(a), b), flip<true>(dup_im(a)), swap(b));
+    }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+        return vfmaq_f64(vmulq_f64(dup_re(a), b), flip<true>(dup_im(a)), swap(b));
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(set1(b), a); }
+
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        const VecType bb = vmulq_f64(b, b);
+        return vdivq_f64(mul(a, conj(b)), vaddq_f64(bb, swap(bb)));
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return div(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return div(set1(a), b); }
+
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return vsubq_f64(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return vsubq_f64(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return vsubq_f64(vnegq_f64(mul(a, b)), c); }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(set1(b), a, c); }
+
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept { return load(base + indices[0]); }
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept { store(base + indices[0], val); }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        return R::all_within_tolerance(a, b, tol.re);
+    }
+};
+
+// ============================================================================
+// Per-microarch specializations — only tiling differs
+//
+// Register tile: MR × NR_VECS accumulators + 2·NR_VECS (b, swap(b)) + 2
+// (dup_re / signed dup_im of a).
+// ============================================================================
+
+template <>
+struct Microkernel<Complex<float>, 128, ARM_NEON_A55> : NeonComplexFloatIntrinsics
+{
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 2;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 4
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 240;
+};
+
+template <>
+struct Microkernel<Complex<double>, 128, ARM_NEON_A55> : NeonComplexDoubleIntrinsics
+{
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 2;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 2
+    static constexpr my_size_t KC = 64;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 240;
+};
+
+template <>
+struct Microkernel<Complex<float>, 128, ARM_NEON_A72> : NeonComplexFloatIntrinsics
+{
+    static constexpr my_size_t MR = 6;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 6
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 60;
+    static constexpr my_size_t NC = 240;
+};
+
+template <>
+struct Microkernel<Complex<double>, 128, ARM_NEON_A72> : NeonComplexDoubleIntrinsics
+{
+    static constexpr my_size_t MR = 6;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 3
+    static constexpr my_size_t KC = 64;
+    static constexpr my_size_t MC = 60;
+    static constexpr my_size_t NC = 240;
+};
+
+template <>
+struct Microkernel<Complex<float>, 128, ARM_NEON_A76> : NeonComplexFloatIntrinsics
+{
+    static constexpr my_size_t MR = 6;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 6
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 60;
+    static constexpr my_size_t NC = 240;
+};
+
+template <>
+struct Microkernel<Complex<double>, 128, ARM_NEON_A76> : NeonComplexDoubleIntrinsics
+{
+    static constexpr my_size_t MR = 6;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 3
+    static constexpr my_size_t KC = 64;
+    static constexpr my_size_t MC = 60;
+    static constexpr my_size_t NC = 240;
+};
+
+#endif // __NEON_COMPLEX_MICROKERNEL_H__
@@ -0,0 +1,81 @@
+#ifndef __NEON_HALF_MICROKERNEL_H__
+#define __NEON_HALF_MICROKERNEL_H__
+
+#include "neon_microkernel.h"
+#include "fused/microkernels/half_microkernel.h"
+
+// ============================================================================
+// NEON (128-bit) Half / BFloat16 storage: 4 lanes, widened to float32x4_t
+// ============================================================================
+// binary16 through vcvt_f32_f16 / vcvt_f16_f32 (FPCR rounding, nearest even
+// by default); bfloat16 through a widening shift and a rounding narrow.
+
+struct NeonHalfConvert
+{
+    FORCE_INLINE static float32x4_t load(const Half *ptr) noexcept
+    {
+        return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr))));
+    }
+
+    FORCE_INLINE static void store(Half *ptr, float32x4_t val) noexcept
+    {
+        vst1_u16(reinterpret_cast<uint16_t *>(ptr), vreinterpret_u16_f16(vcvt_f16_f32(val)));
+    }
+};
+
+struct NeonBf16Convert
+{
+    FORCE_INLINE static float32x4_t load(const BFloat16 *ptr) noexcept
+    {
+        return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr)), 16));
+    }
+
+    // Round to nearest even; NaN stays (quiet) NaN
+    FORCE_INLINE static void store(BFloat16 *ptr, float32x4_t val) noexcept
+    {
+        const uint32x4_t u = vreinterpretq_u32_f32(val);
+        const uint32x4_t odd = vandq_u32(vshrq_n_u32(u, 16), vdupq_n_u32(1));
+        const uint32x4_t rounded = vaddq_u32(u, vaddq_u32(vdupq_n_u32(0x7fff), odd));
+        const uint32x4_t nan = vmvnq_u32(vceqq_f32(val, val));
+        const uint32x4_t b = vbslq_u32(nan, vorrq_u32(u, vdupq_n_u32(0x00400000)), rounded);
+        vst1_u16(reinterpret_cast<uint16_t *>(ptr), vshrn_n_u32(b, 16));
+    }
+};
+
+template <>
+struct Microkernel<Half, 128, ARM_NEON_A55>
+    : HalfMicrokernel<Half, Microkernel<float, 128, ARM_NEON_A55>, NeonHalfConvert>
+{
+};
+
+template <>
+struct Microkernel<BFloat16, 128, ARM_NEON_A55>
+    : HalfMicrokernel<BFloat16, Microkernel<float, 128, ARM_NEON_A55>, NeonBf16Convert>
+{
+};
+
+template <>
+struct Microkernel<Half, 128, ARM_NEON_A72>
+    : HalfMicrokernel<Half, Microkernel<float, 128, ARM_NEON_A72>, NeonHalfConvert>
+{
+};
+
+template <>
+struct Microkernel<BFloat16, 128, ARM_NEON_A72>
+    : HalfMicrokernel<BFloat16, Microkernel<float, 128, ARM_NEON_A72>, NeonBf16Convert>
+{
+};
+
+template <>
+struct Microkernel<Half, 128, ARM_NEON_A76>
+    : HalfMicrokernel<Half, Microkernel<float, 128, ARM_NEON_A76>, NeonHalfConvert>
+{
+};
+
+template <>
+struct Microkernel<BFloat16, 128, ARM_NEON_A76>
+    : HalfMicrokernel<BFloat16, Microkernel<float, 128, ARM_NEON_A76>, NeonBf16Convert>
+{
+};
+
+#endif // __NEON_HALF_MICROKERNEL_H__
@@ -20,6 +20,49 @@ struct NeonFloatIntrinsics
     FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { vst1q_f32(ptr, val); }
     FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return vdupq_n_f32(scalar); }
 
+    // Partial-lane helpers: lane loads / stores for the first n lanes only;
+    // masked-off lanes of maskload are zero.
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept
+    {
+        VecType v = vdupq_n_f32(0.0f);
+        switch (n)
+        {
+        case 4:
+            return vld1q_f32(ptr);
+        case 3:
+            v = vld1q_lane_f32(ptr + 2, v, 2);
+            [[fallthrough]];
+        case 2:
+            v = vld1q_lane_f32(ptr + 1, v, 1);
+            [[fallthrough]];
+        case 1:
+            v = vld1q_lane_f32(ptr, v, 0);
+            [[fallthrough]];
+        default:
+            return v;
+        }
+    }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept
+    {
+        switch (n)
+        {
+        case 4:
+            vst1q_f32(ptr, val);
+            return;
+        case 3:
+            vst1q_lane_f32(ptr + 2, val, 2);
+            [[fallthrough]];
+        case 2:
+            vst1q_lane_f32(ptr + 1, val, 1);
+            [[fallthrough]];
+        case 1:
+            vst1q_lane_f32(ptr, val, 0);
+            [[fallthrough]];
+        default:
+            return;
+        }
+    }
+
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return vaddq_f32(a, b); }
     FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return vaddq_f32(a, set1(b)); }
 
@@ -87,11 +130,83 @@ struct NeonFloatIntrinsics
             base[indices[i]] = tmp[i];
     }
 
+    /// In-register 4×4 transpose: lane j of r[i] ↔ lane i of r[j]
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        const float32x4x2_t p01 = vtrnq_f32(r[0], r[1]);
+        const float32x4x2_t p23 = vtrnq_f32(r[2], r[3]);
+        r[0] = vcombine_f32(vget_low_f32(p01.val[0]), vget_low_f32(p23.val[0]));
+        r[1] = vcombine_f32(vget_low_f32(p01.val[1]), vget_low_f32(p23.val[1]));
+        r[2] = vcombine_f32(vget_high_f32(p01.val[0]), vget_high_f32(p23.val[0]));
+        r[3] = vcombine_f32(vget_high_f32(p01.val[1]), vget_high_f32(p23.val[1]));
+    }
+
     FORCE_INLINE static VecType abs(VecType v) noexcept
     {
         return vabsq_f32(v);
     }
 
+    // ============================================================================
+    // Elementwise math primitives (building blocks of vector_math.h)
+    // ============================================================================
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept
+    {
+#ifdef __aarch64__
+        return vsqrtq_f32(v);
+#else
+        // v · rsqrt(v) with two Newton-Raphson steps; 0 → 0 instead of 0 · ∞
+        float32x4_t r = vrsqrteq_f32(v);
+        r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(v, r), r), r);
+        r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(v, r), r), r);
+        return vbslq_f32(vceqq_f32(v, vdupq_n_f32(0.0f)), v, vmulq_f32(v, r));
+#endif
+    }
+
+    // Round to nearest, ties to even
+    FORCE_INLINE static VecType round(VecType v) noexcept
+    {
+#ifdef __aarch64__
+        return vrndnq_f32(v);
+#else
+        // |v| + 2^23 - 2^23 drops the fraction; |v| ≥ 2^23 (and NaN) is already integral
+        const float32x4_t magic = vdupq_n_f32(8388608.0f);
+        float32x4_t a = vabsq_f32(v);
+        float32x4_t r = vbslq_f32(vcltq_f32(a, magic), vsubq_f32(vaddq_f32(a, magic), magic), a);
+        return vbslq_f32(vdupq_n_u32(0x80000000u), v, r);
+#endif
+    }
+
+    // a < b ? x : y, lane-wise (false for NaN)
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return vbslq_f32(vcltq_f32(a, b), x, y);
+    }
+
+    // Magnitude of mag, sign of sgn
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        return vbslq_f32(vdupq_n_u32(0x80000000u), sgn, mag);
+    }
+
+    // 2^n for integral n in [-126, 127]
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept
+    {
+        int32x4_t e = vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127));
+        return vreinterpretq_f32_s32(vshlq_n_s32(e, 23));
+    }
+
+    // Unbiased exponent floor(log2 v) and mantissa v / 2^e ∈ [1, 2), for positive normal v
+    FORCE_INLINE static VecType getexp(VecType v) noexcept
+    {
+        int32x4_t e = vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_f32(v), 23));
+        return vcvtq_f32_s32(vsubq_s32(e, vdupq_n_s32(127)));
+    }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept
+    {
+        uint32x4_t m = vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x007FFFFFu));
+        return vreinterpretq_f32_u32(vorrq_u32(m, vdupq_n_u32(0x3F800000u)));
+    }
+
     FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
     {
         float32x4_t diff = vsubq_f32(a, b);
@@ -120,6 +235,21 @@ struct NeonDoubleIntrinsics
     FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { vst1q_f64(ptr, val); }
     FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return vdupq_n_f64(scalar); }
 
+    // Partial-lane helpers (see NeonFloatIntrinsics)
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept
+    {
+        if (n >= 2)
+            return vld1q_f64(ptr);
+        return n ? vld1q_lane_f64(ptr, vdupq_n_f64(0.0), 0) : vdupq_n_f64(0.0);
+    }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept
+    {
+        if (n >= 2)
+            vst1q_f64(ptr, val);
+        else if (n)
+            vst1q_lane_f64(ptr, val, 0);
+    }
+
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return vaddq_f64(a, b); }
     FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return vaddq_f64(a, set1(b)); }
 
@@ -172,11 +302,58 @@ struct NeonDoubleIntrinsics
             base[indices[i]] = tmp[i];
     }
 
+    /// In-register 2×2 transpose: lane j of r[i] ↔ lane i of r[j]
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        const VecType lo = vzip1q_f64(r[0], r[1]);
+        r[1] = vzip2q_f64(r[0], r[1]);
+        r[0] = lo;
+    }
+
     FORCE_INLINE static VecType abs(VecType v) noexcept
     {
         return vabsq_f64(v);
     }
 
+    // ============================================================================
+    // Elementwise math primitives (building blocks of vector_math.h)
+    // ============================================================================
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept { return vsqrtq_f64(v); }
+
+    // Round to nearest, ties to even
+    FORCE_INLINE static VecType round(VecType v) noexcept { return vrndnq_f64(v); }
+
+    // a < b ? x : y, lane-wise (false for NaN)
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        return vbslq_f64(vcltq_f64(a, b), x, y);
+    }
+
+    // Magnitude of mag, sign of sgn
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        return vbslq_f64(vdupq_n_u64(0x8000000000000000ull), sgn, mag);
+    }
+
+    // 2^n for integral n in [-1022, 1023]
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept
+    {
+        int64x2_t e = vaddq_s64(vcvtq_s64_f64(n), vdupq_n_s64(1023));
+        return vreinterpretq_f64_s64(vshlq_n_s64(e, 52));
+    }
+
+    // Unbiased exponent floor(log2 v) and mantissa v / 2^e ∈ [1, 2), for positive normal v
+    FORCE_INLINE static VecType getexp(VecType v) noexcept
+    {
+        int64x2_t e = vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_f64(v), 52));
+        return vcvtq_f64_s64(vsubq_s64(e, vdupq_n_s64(1023)));
+    }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept
+    {
+        uint64x2_t m = vandq_u64(vreinterpretq_u64_f64(v), vdupq_n_u64(0x000FFFFFFFFFFFFFull));
+        return vreinterpretq_f64_u64(vorrq_u64(m, vdupq_n_u64(0x3FF0000000000000ull)));
+    }
+
     FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
     {
         float64x2_t diff = vsubq_f64(a, b);
@@ -18,6 +18,9 @@ struct ARM_NEON_A76
 
 // ============================================================================
 // Per-microarch specializations — only tiling differs
+//
+// MR/NR_VECS size the register tile; KC/MC/NC size the packed GEMM
+// panels for the L1/L2/L3 budget (KC×NR of B in L1, MC×KC of A in L2).
 // ============================================================================
 
 // --- A55 (in-order, narrow) ---
@@ -27,6 +30,9 @@ struct Microkernel<float, 128, ARM_NEON_A55> : NeonFloatIntrinsics
     static constexpr my_size_t MR = 4;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 12
+    static constexpr my_size_t KC = 256;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 240;
 };
 
 template <>
@@ -35,6 +41,9 @@ struct Microkernel<double, 128, ARM_NEON_A55> : NeonDoubleIntrinsics
     static constexpr my_size_t MR = 4;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 6
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 240;
 };
 
 // --- A72 (RPi4) ---
@@ -44,6 +53,9 @@ struct Microkernel<float, 128, ARM_NEON_A72> : NeonFloatIntrinsics
     static constexpr my_size_t MR = 8;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 12
+    static constexpr my_size_t KC = 256;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 240;
 };
 
 template <>
@@ -52,6 +64,9 @@ struct Microkernel<double, 128, ARM_NEON_A72> : NeonDoubleIntrinsics
     static constexpr my_size_t MR = 8;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 6
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 240;
 };
 
 // --- A76+ (RPi5, Graviton) ---
@@ -61,6 +76,9 @@ struct Microkernel<float, 128, ARM_NEON_A76> : NeonFloatIntrinsics
     static constexpr my_size_t MR = 8;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 12
+    static constexpr my_size_t KC = 256;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 240;
 };
 
 template <>
@@ -69,6 +87,9 @@ struct Microkernel<double, 128, ARM_NEON_A76> : NeonDoubleIntrinsics
     static constexpr my_size_t MR = 8;
     static constexpr my_size_t NR_VECS = 3;
     static constexpr my_size_t NR = NR_VECS * simdWidth; // 6
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 240;
 };
 
 #endif // __NEON_MICROKERNEL_H__
\ No newline at end of file
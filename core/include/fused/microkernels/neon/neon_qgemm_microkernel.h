@@ -0,0 +1,73 @@
+#ifndef __NEON_QGEMM_MICROKERNEL_H__
+#define __NEON_QGEMM_MICROKERNEL_H__
+
+#include "neon_microkernel.h"
+
+// ============================================================================
+// NEON (128-bit) int8 dot-product kernels for the quantized GEMM
+// ============================================================================
+// ARMv8.2 dot product (A76): sdot adds four int8 × int8 products into each
+// int32 lane, 16 pairs per instruction. Older cores: smull / smull2 widen
+// the products to int16 (|a·b| ≤ 2¹⁴, exact) and sadalp accumulates the
+// adjacent pairs into int32.
+
+struct NeonQGemmWideningIntrinsics
+{
+    static constexpr my_size_t KStep = 16;
+    static constexpr int32_t B_BIAS = 0;
+    using AccType = int32x4_t;
+    using Operand = int8x16_t;
+
+    FORCE_INLINE static AccType zero() noexcept { return vdupq_n_s32(0); }
+    FORCE_INLINE static Operand load_a(const int8_t *ptr) noexcept { return vld1q_s8(ptr); }
+    FORCE_INLINE static Operand load_b(const int8_t *ptr) noexcept { return vld1q_s8(ptr); }
+
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept
+    {
+        acc = vpadalq_s16(acc, vmull_s8(vget_low_s8(a), vget_low_s8(b)));
+        return vpadalq_s16(acc, vmull_high_s8(a, b));
+    }
+
+    FORCE_INLINE static int32_t hsum(AccType acc) noexcept { return vaddvq_s32(acc); }
+
+    /// out[c] = Σ lanes of acc[c], c < 4 — two levels of pairwise adds.
+    FORCE_INLINE static void hsum4(const AccType *acc, int32_t *out) noexcept
+    {
+        vst1q_s32(out, vpaddq_s32(vpaddq_s32(acc[0], acc[1]), vpaddq_s32(acc[2], acc[3])));
+    }
+};
+
+#if defined(__ARM_FEATURE_DOTPROD)
+struct NeonQGemmDotIntrinsics : NeonQGemmWideningIntrinsics
+{
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept { return vdotq_s32(acc, a, b); }
+};
+#else
+using NeonQGemmDotIntrinsics = NeonQGemmWideningIntrinsics;
+#endif
+
+// --- A55 (in-order, narrow): 8 accumulators ---
+template <>
+struct QGemmMicrokernel<128, ARM_NEON_A55> : NeonQGemmWideningIntrinsics
+{
+    static constexpr my_size_t MR = 2;
+    static constexpr my_size_t NR = 4;
+};
+
+// --- A72: 16 accumulators + 4 B + 1 A + 2 products of 32 V registers ---
+template <>
+struct QGemmMicrokernel<128, ARM_NEON_A72> : NeonQGemmWideningIntrinsics
+{
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR = 4;
+};
+
+// --- A76: sdot needs no temporaries, 16 accumulators + 4 B + 1 A ---
+template <>
+struct QGemmMicrokernel<128, ARM_NEON_A76> : NeonQGemmDotIntrinsics
+{
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR = 4;
+};
+
+#endif // __NEON_QGEMM_MICROKERNEL_H__
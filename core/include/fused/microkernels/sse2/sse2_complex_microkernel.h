@@ -0,0 +1,268 @@
+#ifndef __SSE2_COMPLEX_MICROKERNEL_H__
+#define __SSE2_COMPLEX_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+#include "complex.h"
+
+// ============================================================================
+// SSE (128-bit) complex specializations
+// ============================================================================
+// Interleaved storage [re, im, re, im]: a Complex<float> vector holds two
+// numbers, a Complex<double> vector one. Addition and subtraction are the
+// real kernel's. The product a·b is
+//
+//   re(a)·b  ∓  im(a)·swap(b)          swap(b) = [im, re] per number
+//
+// with the sign pattern of addsub (− on real lanes, + on imaginary lanes):
+// one dup of each part of a, one in-pair swap of b, two multiplies and an
+// addsub; fmaddsub folds the multiplies in when FMA3 is available. SSE3
+// moveldup / movehdup / addsub are used when the translation unit enables
+// them; plain SSE2 shuffles and flips the sign with an xor.
+
+namespace detail
+{
+    /// Sign mask of the real lanes: xor-ing it and adding gives addsub.
+    FORCE_INLINE __m128 sse_complex_re_sign_ps() noexcept { return _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f); }
+    FORCE_INLINE __m128 sse_complex_im_sign_ps() noexcept { return _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f); }
+    FORCE_INLINE __m128d sse_complex_re_sign_pd() noexcept { return _mm_setr_pd(-0.0, 0.0); }
+    FORCE_INLINE __m128d sse_complex_im_sign_pd() noexcept { return _mm_setr_pd(0.0, -0.0); }
+}
+
+template <>
+struct Microkernel<Complex<float>, 128, X86_SSE>
+{
+    static constexpr my_size_t simdWidth = 2; // 128 bits / 64 bits per Complex<float> = 2
+    // GEMM tiling constants: MR × NR_VECS accumulators + 2·NR_VECS (b, swap(b)) + 2 (re/im of a)
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 2;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 4
+    // GEMM cache-blocking constants (packed panels, same bytes as the double kernel)
+    static constexpr my_size_t KC = 128;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 504;
+    using VecType = __m128;
+    using ScalarType = Complex<float>;
+    using R = Microkernel<float, 128, X86_SSE>;
+
+    FORCE_INLINE static const float *flat(const ScalarType *p) noexcept { return reinterpret_cast<const float *>(p); }
+    FORCE_INLINE static float *flat(ScalarType *p) noexcept { return reinterpret_cast<float *>(p); }
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm_load_ps(flat(ptr)); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm_loadu_ps(flat(ptr)); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm_store_ps(flat(ptr), val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm_storeu_ps(flat(ptr), val); }
+    FORCE_INLINE static VecType set1(ScalarType s) noexcept { return _mm_setr_ps(s.re, s.im, s.re, s.im); }
+
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return R::maskload(flat(ptr), 2 * n); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept { R::maskstore(flat(ptr), val, 2 * n); }
+
+    // In-pair shuffles: [re, re], [im, im], [im, re]
+    FORCE_INLINE static VecType dup_re(VecType v) noexcept
+    {
+#ifdef __SSE3__
+        return _mm_moveldup_ps(v);
+#else
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+#endif
+    }
+    FORCE_INLINE static VecType dup_im(VecType v) noexcept
+    {
+#ifdef __SSE3__
+        return _mm_movehdup_ps(v);
+#else
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+#endif
+    }
+    FORCE_INLINE static VecType swap(VecType v) noexcept { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); }
+
+    // a − b on real lanes, a + b on imaginary lanes
+    FORCE_INLINE static VecType addsub(VecType a, VecType b) noexcept
+    {
+#ifdef __SSE3__
+        return _mm_addsub_ps(a, b);
+#else
+        return _mm_add_ps(a, _mm_xor_ps(b, detail::sse_complex_re_sign_ps()));
+#endif
+    }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept { return _mm_xor_ps(v, detail::sse_complex_im_sign_ps()); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm_add_ps(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm_add_ps(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm_sub_ps(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm_sub_ps(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm_sub_ps(set1(a), b); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fmaddsub_ps(dup_re(a), b, _mm_mul_ps(dup_im(a), swap(b)));
+#else
+        return addsub(_mm_mul_ps(dup_re(a), b), _mm_mul_ps(dup_im(a), swap(b)));
+#endif
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(set1(b), a); }
+
+    // a·conj(b) / |b|²
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        __m128 bb = _mm_mul_ps(b, b);
+        return _mm_div_ps(mul(a, conj(b)), _mm_add_ps(bb, swap(bb)));
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return div(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return div(set1(a), b); }
+
+    // fmadd: a*b + c
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fmaddsub_ps(dup_re(a), b, _mm_fmaddsub_ps(dup_im(a), swap(b), c));
+#else
+        return _mm_add_ps(mul(a, b), c);
+#endif
+    }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(set1(b), a, c); }
+
+    // fmsub: a*b - c
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm_sub_ps(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(set1(b), a, c); }
+
+    // fnmadd: -(a*b) + c
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm_sub_ps(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(set1(b), a, c); }
+
+    // fnmsub: -(a*b) - c
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm_sub_ps(_mm_xor_ps(mul(a, b), _mm_set1_ps(-0.0f)), c);
+    }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(set1(b), a, c); }
+
+    // One 64-bit load per number
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
+    {
+        __m128 v = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(base + indices[0]));
+        return _mm_loadh_pi(v, reinterpret_cast<const __m64 *>(base + indices[1]));
+    }
+
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
+    {
+        _mm_storel_pi(reinterpret_cast<__m64 *>(base + indices[0]), val);
+        _mm_storeh_pi(reinterpret_cast<__m64 *>(base + indices[1]), val);
+    }
+
+    // |Δre| ≤ tol.re and |Δim| ≤ tol.re on every lane
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        return R::all_within_tolerance(a, b, tol.re);
+    }
+};
+
+template <>
+struct Microkernel<Complex<double>, 128, X86_SSE>
+{
+    static constexpr my_size_t simdWidth = 1; // 128 bits / 128 bits per Complex<double> = 1
+    // GEMM tiling constants: MR × NR_VECS accumulators + 2·NR_VECS (b, swap(b)) + 2 (re/im of a)
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 2;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 2
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 64;
+    static constexpr my_size_t MC = 64;
+    static constexpr my_size_t NC = 252;
+    using VecType = __m128d;
+    using ScalarType = Complex<double>;
+
+    FORCE_INLINE static const double *flat(const ScalarType *p) noexcept { return reinterpret_cast<const double *>(p); }
+    FORCE_INLINE static double *flat(ScalarType *p) noexcept { return reinterpret_cast<double *>(p); }
+
+    FORCE_INLINE static VecType load(const ScalarType *ptr) noexcept { return _mm_load_pd(flat(ptr)); }
+    FORCE_INLINE static VecType loadu(const ScalarType *ptr) noexcept { return _mm_loadu_pd(flat(ptr)); }
+    FORCE_INLINE static void store(ScalarType *ptr, VecType val) noexcept { _mm_store_pd(flat(ptr), val); }
+    FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm_storeu_pd(flat(ptr), val); }
+    FORCE_INLINE static VecType set1(ScalarType s) noexcept { return _mm_setr_pd(s.re, s.im); }
+
+    // A vector is one number: n is 0 or 1
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept { return n ? loadu(ptr) : _mm_setzero_pd(); }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept
+    {
+        if (n)
+            storeu(ptr, val);
+    }
+
+    FORCE_INLINE static VecType dup_re(VecType v) noexcept { return _mm_unpacklo_pd(v, v); }
+    FORCE_INLINE static VecType dup_im(VecType v) noexcept { return _mm_unpackhi_pd(v, v); }
+    FORCE_INLINE static VecType swap(VecType v) noexcept { return _mm_shuffle_pd(v, v, 1); }
+
+    FORCE_INLINE static VecType addsub(VecType a, VecType b) noexcept
+    {
+#ifdef __SSE3__
+        return _mm_addsub_pd(a, b);
+#else
+        return _mm_add_pd(a, _mm_xor_pd(b, detail::sse_complex_re_sign_pd()));
+#endif
+    }
+
+    FORCE_INLINE static VecType conj(VecType v) noexcept { return _mm_xor_pd(v, detail::sse_complex_im_sign_pd()); }
+
+    FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm_add_pd(a, b); }
+    FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm_add_pd(a, set1(b)); }
+
+    FORCE_INLINE static VecType sub(VecType a, VecType b) noexcept { return _mm_sub_pd(a, b); }
+    FORCE_INLINE static VecType sub(VecType a, ScalarType b) noexcept { return _mm_sub_pd(a, set1(b)); }
+    FORCE_INLINE static VecType sub(ScalarType a, VecType b) noexcept { return _mm_sub_pd(set1(a), b); }
+
+    FORCE_INLINE static VecType mul(VecType a, VecType b) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fmaddsub_pd(dup_re(a), b, _mm_mul_pd(dup_im(a), swap(b)));
+#else
+        return addsub(_mm_mul_pd(dup_re(a), b), _mm_mul_pd(dup_im(a), swap(b)));
+#endif
+    }
+    FORCE_INLINE static VecType mul(VecType a, ScalarType b) noexcept { return mul(set1(b), a); }
+
+    FORCE_INLINE static VecType div(VecType a, VecType b) noexcept
+    {
+        __m128d bb = _mm_mul_pd(b, b);
+        return _mm_div_pd(mul(a, conj(b)), _mm_add_pd(bb, swap(bb)));
+    }
+    FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return div(a, set1(b)); }
+    FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return div(set1(a), b); }
+
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fmaddsub_pd(dup_re(a), b, _mm_fmaddsub_pd(dup_im(a), swap(b), c));
+#else
+        return _mm_add_pd(mul(a, b), c);
+#endif
+    }
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm_sub_pd(mul(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm_sub_pd(c, mul(a, b)); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(set1(b), a, c); }
+
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept
+    {
+        return _mm_sub_pd(_mm_xor_pd(mul(a, b), _mm_set1_pd(-0.0)), c);
+    }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(set1(b), a, c); }
+
+    FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept { return loadu(base + indices[0]); }
+    FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept { storeu(base + indices[0], val); }
+
+    FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
+    {
+        return Microkernel<double, 128, X86_SSE>::all_within_tolerance(a, b, tol.re);
+    }
+};
+
+#endif // __SSE2_COMPLEX_MICROKERNEL_H__
@@ -0,0 +1,127 @@
+#ifndef __SSE2_HALF_MICROKERNEL_H__
+#define __SSE2_HALF_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+#include "fused/microkernels/half_microkernel.h"
+
+// ============================================================================
+// SSE2 (128-bit) Half / BFloat16 storage: 4 lanes, widened to __m128
+// ============================================================================
+// binary16 uses F16C (vcvtph2ps / vcvtps2ph) when the target has it, and
+// otherwise the same conversions in SSE2 integer ops (exact widening, round
+// to nearest even narrowing — bit-identical to F16C except NaN payloads).
+
+namespace detail
+{
+    /// Four binary16 values (low 16 bits of each 32-bit lane) → float.
+    FORCE_INLINE __m128 sse_half_to_float(__m128i h) noexcept
+    {
+        const __m128i expmant = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+        const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h, expmant), 16);
+        // Shifted into float position, ×2^112 fixes the bias and normalizes subnormals
+        const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)),
+                                         _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+        const __m128i infnan = _mm_and_si128(_mm_cmpgt_epi32(expmant, _mm_set1_epi32(0x7bff)),
+                                             _mm_set1_epi32(255 << 23));
+        return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infnan)));
+    }
+
+    /// float → binary16 in the low 16 bits of each 32-bit lane, round to nearest even.
+    FORCE_INLINE __m128i sse_float_to_half(__m128 f) noexcept
+    {
+        __m128i u = _mm_castps_si128(f);
+        const __m128i sign = _mm_and_si128(u, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+        u = _mm_xor_si128(u, sign);
+
+        // Overflow → Inf, NaN → quiet NaN
+        const __m128i big = _mm_cmpgt_epi32(u, _mm_set1_epi32(((127 + 16) << 23) - 1));
+        const __m128i nan = _mm_cmpgt_epi32(u, _mm_set1_epi32(255 << 23));
+        const __m128i infnan = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(nan, _mm_set1_epi32(0x0200)));
+
+        // Subnormal: the float add rounds the mantissa into place
+        const __m128i magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+        const __m128i sub = _mm_cmpgt_epi32(_mm_set1_epi32(113 << 23), u);
+        const __m128i subv = _mm_sub_epi32(
+            _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_castsi128_ps(magic))), magic);
+
+        // Normal: rebias, round half to even
+        const __m128i odd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+        const __m128i normv = _mm_srli_epi32(
+            _mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32(static_cast<int>((15u - 127u) << 23) + 0xfff)), odd), 13);
+
+        __m128i h = _mm_or_si128(_mm_and_si128(sub, subv), _mm_andnot_si128(sub, normv));
+        h = _mm_or_si128(_mm_and_si128(big, infnan), _mm_andnot_si128(big, h));
+        return _mm_or_si128(h, _mm_srli_epi32(sign, 16));
+    }
+
+    /// float → bfloat16 in the low 16 bits of each 32-bit lane, round to nearest even.
+    FORCE_INLINE __m128i sse_float_to_bf16(__m128 f) noexcept
+    {
+        const __m128i u = _mm_castps_si128(f);
+        const __m128i hi = _mm_srli_epi32(u, 16);
+        const __m128i rounded = _mm_srli_epi32(
+            _mm_add_epi32(u, _mm_add_epi32(_mm_set1_epi32(0x7fff), _mm_and_si128(hi, _mm_set1_epi32(1)))), 16);
+        const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(f, f));
+        return _mm_or_si128(_mm_and_si128(nan, _mm_or_si128(hi, _mm_set1_epi32(0x40))),
+                            _mm_andnot_si128(nan, rounded));
+    }
+
+    /// Four 32-bit lanes holding 16-bit values → the low 64 bits, packed.
+    FORCE_INLINE __m128i sse_pack_u16(__m128i v) noexcept
+    {
+        v = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16); // sign-extend so packs doesn't saturate
+        return _mm_packs_epi32(v, v);
+    }
+} // namespace detail
+
+struct SseHalfConvert
+{
+    FORCE_INLINE static __m128 load(const Half *ptr) noexcept
+    {
+        const __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr));
+#ifdef __F16C__
+        return _mm_cvtph_ps(h);
+#else
+        return detail::sse_half_to_float(_mm_unpacklo_epi16(h, _mm_setzero_si128()));
+#endif
+    }
+
+    FORCE_INLINE static void store(Half *ptr, __m128 val) noexcept
+    {
+#ifdef __F16C__
+        const __m128i h = _mm_cvtps_ph(val, _MM_FROUND_TO_NEAREST_INT);
+#else
+        const __m128i h = detail::sse_pack_u16(detail::sse_float_to_half(val));
+#endif
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(ptr), h);
+    }
+};
+
+struct SseBf16Convert
+{
+    FORCE_INLINE static __m128 load(const BFloat16 *ptr) noexcept
+    {
+        const __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr));
+        return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), b));
+    }
+
+    FORCE_INLINE static void store(BFloat16 *ptr, __m128 val) noexcept
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(ptr), detail::sse_pack_u16(detail::sse_float_to_bf16(val)));
+    }
+};
+
+template <>
+struct Microkernel<Half, 128, X86_SSE>
+    : HalfMicrokernel<Half, Microkernel<float, 128, X86_SSE>, SseHalfConvert>
+{
+};
+
+template <>
+struct Microkernel<BFloat16, 128, X86_SSE>
+    : HalfMicrokernel<BFloat16, Microkernel<float, 128, X86_SSE>, SseBf16Convert>
+{
+};
+
+#endif // __SSE2_HALF_MICROKERNEL_H__
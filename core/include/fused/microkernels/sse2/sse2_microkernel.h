@@ -12,11 +12,27 @@ struct X86_SSE
 // ============================================================================
 // SSE (128-bit) specializations
 // ============================================================================
+// Tails: SSE2 has no masked moves, so maskload / maskstore go through a
+// register-sized buffer and copy only the first n lanes. Masked-off lanes of
+// maskload are zero.
+//
+// fmadd and gather use FMA3 / AVX2 instructions only when the translation
+// unit enables them; plain SSE2 (the x86-64 baseline, and the fallback target
+// of TESSERACT_RUNTIME_DISPATCH) gets mul + add and scalar loads.
 
 template <>
 struct Microkernel<float, 128, X86_SSE>
 {
     static constexpr my_size_t simdWidth = 4; // 128 bits / 32 bits per float = 4
+    // GEMM tiling constants (register-blocked)
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 12
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 256; // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 64;  // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 1008; // B block width    → KC × NC packed B in L3
     using VecType = __m128;
     using ScalarType = float;
 
@@ -26,6 +42,21 @@ struct Microkernel<float, 128, X86_SSE>
     FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm_storeu_ps(ptr, val); }
     FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm_set1_ps(scalar); }
 
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept
+    {
+        alignas(16) ScalarType tmp[simdWidth] = {};
+        for (my_size_t i = 0; i < n; ++i)
+            tmp[i] = ptr[i];
+        return _mm_load_ps(tmp);
+    }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept
+    {
+        alignas(16) ScalarType tmp[simdWidth];
+        _mm_store_ps(tmp, val);
+        for (my_size_t i = 0; i < n; ++i)
+            ptr[i] = tmp[i];
+    }
+
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm_add_ps(a, b); }
     FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm_add_ps(a, set1(b)); }
 
@@ -40,7 +71,26 @@ struct Microkernel<float, 128, X86_SSE>
     FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return _mm_div_ps(a, set1(b)); }
     FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return _mm_div_ps(set1(a), b); }
 
+#ifdef __FMA__
+    // fmadd: a*b + c
     FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return _mm_fmadd_ps(a, b, c); }
+    // fmsub: a*b - c
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm_fmsub_ps(a, b, c); }
+    // fnmadd: -(a*b) + c
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm_fnmadd_ps(a, b, c); }
+    // fnmsub: -(a*b) - c
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return _mm_fnmsub_ps(a, b, c); }
+#else
+    // Unfused (two roundings) without FMA3
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm_sub_ps(_mm_mul_ps(a, b), c); }
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm_sub_ps(c, _mm_mul_ps(a, b)); }
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(_mm_mul_ps(a, b), c)); }
+#endif
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(a, set1(b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(a, set1(b), c); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(a, set1(b), c); }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(a, set1(b), c); }
 
     FORCE_INLINE static VecType min(VecType a, VecType b) noexcept { return _mm_min_ps(a, b); }
     FORCE_INLINE static VecType min(VecType a, ScalarType b) noexcept { return _mm_min_ps(a, set1(b)); }
@@ -50,6 +100,9 @@ struct Microkernel<float, 128, X86_SSE>
 
     FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
     {
+#ifndef __AVX2__
+        return _mm_setr_ps(base[indices[0]], base[indices[1]], base[indices[2]], base[indices[3]]);
+#else
         // _mm_i32gather_ps requires 4 × 32-bit indices.
         // so we convert size_t → int32_t.
         alignas(16) int32_t idx32[simdWidth];
@@ -64,6 +117,7 @@ struct Microkernel<float, 128, X86_SSE>
         // does not depend on type alignment rules
         __m128i vindex = _mm_loadu_si128(reinterpret_cast<const __m128i *>(idx32));
         return _mm_i32gather_ps(base, vindex, sizeof(ScalarType));
+#endif
     }
 
     FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
@@ -74,12 +128,72 @@ struct Microkernel<float, 128, X86_SSE>
             base[indices[i]] = tmp[i];
     }
 
+    /// In-register 4×4 transpose: lane j of r[i] ↔ lane i of r[j]
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        _MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+    }
+
     FORCE_INLINE static VecType abs(VecType v) noexcept
     {
         __m128 sign_mask = _mm_set1_ps(-0.0f);
         return _mm_andnot_ps(sign_mask, v);
     }
 
+    // ============================================================================
+    // Elementwise math primitives (building blocks of vector_math.h)
+    // ============================================================================
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept { return _mm_sqrt_ps(v); }
+
+    // Round to nearest, ties to even
+    FORCE_INLINE static VecType round(VecType v) noexcept
+    {
+#ifdef __SSE4_1__
+        return _mm_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+        // |v| + 2^23 - 2^23 drops the fraction; |v| ≥ 2^23 (and NaN) is already integral
+        const __m128 magic = _mm_set1_ps(8388608.0f);
+        __m128 a = abs(v);
+        __m128 r = _mm_sub_ps(_mm_add_ps(a, magic), magic);
+        __m128 small = _mm_cmplt_ps(a, magic);
+        r = _mm_or_ps(_mm_and_ps(small, r), _mm_andnot_ps(small, a));
+        return _mm_or_ps(r, _mm_and_ps(v, _mm_set1_ps(-0.0f)));
+#endif
+    }
+
+    // a < b ? x : y, lane-wise (false for NaN)
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        __m128 m = _mm_cmplt_ps(a, b);
+        return _mm_or_ps(_mm_and_ps(m, x), _mm_andnot_ps(m, y));
+    }
+
+    // Magnitude of mag, sign of sgn
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        __m128 sign_mask = _mm_set1_ps(-0.0f);
+        return _mm_or_ps(_mm_andnot_ps(sign_mask, mag), _mm_and_ps(sign_mask, sgn));
+    }
+
+    // 2^n for integral n in [-126, 127]
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept
+    {
+        __m128i e = _mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127));
+        return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+    }
+
+    // Unbiased exponent floor(log2 v) and mantissa v / 2^e ∈ [1, 2), for positive normal v
+    FORCE_INLINE static VecType getexp(VecType v) noexcept
+    {
+        __m128i e = _mm_srli_epi32(_mm_castps_si128(v), 23);
+        return _mm_cvtepi32_ps(_mm_sub_epi32(e, _mm_set1_epi32(127)));
+    }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept
+    {
+        __m128i m = _mm_and_si128(_mm_castps_si128(v), _mm_set1_epi32(0x007FFFFF));
+        return _mm_castsi128_ps(_mm_or_si128(m, _mm_set1_epi32(0x3F800000)));
+    }
+
     FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
     {
         __m128 diff = _mm_sub_ps(a, b);
@@ -95,6 +209,15 @@ template <>
 struct Microkernel<double, 128, X86_SSE>
 {
     static constexpr my_size_t simdWidth = 2; // 128 bits / 64 bits per double = 2
+    // GEMM tiling constants (register-blocked)
+    static constexpr my_size_t num_registers = 16;
+    static constexpr my_size_t MR = 4;
+    static constexpr my_size_t NR_VECS = 3;
+    static constexpr my_size_t NR = NR_VECS * simdWidth; // 6
+    // GEMM cache-blocking constants (packed panels)
+    static constexpr my_size_t KC = 128; // A/B panel depth   → KC × NR B micro-panel in L1
+    static constexpr my_size_t MC = 64;  // A block height    → MC × KC packed A in L2
+    static constexpr my_size_t NC = 504; // B block width     → KC × NC packed B in L3
     using VecType = __m128d;
     using ScalarType = double;
 
@@ -104,6 +227,21 @@ struct Microkernel<double, 128, X86_SSE>
     FORCE_INLINE static void storeu(ScalarType *ptr, VecType val) noexcept { _mm_storeu_pd(ptr, val); }
     FORCE_INLINE static VecType set1(ScalarType scalar) noexcept { return _mm_set1_pd(scalar); }
 
+    FORCE_INLINE static VecType maskload(const ScalarType *ptr, my_size_t n) noexcept
+    {
+        alignas(16) ScalarType tmp[simdWidth] = {};
+        for (my_size_t i = 0; i < n; ++i)
+            tmp[i] = ptr[i];
+        return _mm_load_pd(tmp);
+    }
+    FORCE_INLINE static void maskstore(ScalarType *ptr, VecType val, my_size_t n) noexcept
+    {
+        alignas(16) ScalarType tmp[simdWidth];
+        _mm_store_pd(tmp, val);
+        for (my_size_t i = 0; i < n; ++i)
+            ptr[i] = tmp[i];
+    }
+
     FORCE_INLINE static VecType add(VecType a, VecType b) noexcept { return _mm_add_pd(a, b); }
     FORCE_INLINE static VecType add(VecType a, ScalarType b) noexcept { return _mm_add_pd(a, set1(b)); }
 
@@ -118,7 +256,26 @@ struct Microkernel<double, 128, X86_SSE>
     FORCE_INLINE static VecType div(VecType a, ScalarType b) noexcept { return _mm_div_pd(a, set1(b)); }
     FORCE_INLINE static VecType div(ScalarType a, VecType b) noexcept { return _mm_div_pd(set1(a), b); }
 
+#ifdef __FMA__
+    // fmadd: a*b + c
     FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return _mm_fmadd_pd(a, b, c); }
+    // fmsub: a*b - c
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm_fmsub_pd(a, b, c); }
+    // fnmadd: -(a*b) + c
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm_fnmadd_pd(a, b, c); }
+    // fnmsub: -(a*b) - c
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return _mm_fnmsub_pd(a, b, c); }
+#else
+    // Unfused (two roundings) without FMA3
+    FORCE_INLINE static VecType fmadd(VecType a, VecType b, VecType c) noexcept { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, VecType b, VecType c) noexcept { return _mm_sub_pd(_mm_mul_pd(a, b), c); }
+    FORCE_INLINE static VecType fnmadd(VecType a, VecType b, VecType c) noexcept { return _mm_sub_pd(c, _mm_mul_pd(a, b)); }
+    FORCE_INLINE static VecType fnmsub(VecType a, VecType b, VecType c) noexcept { return _mm_sub_pd(_mm_setzero_pd(), _mm_add_pd(_mm_mul_pd(a, b), c)); }
+#endif
+    FORCE_INLINE static VecType fmadd(VecType a, ScalarType b, VecType c) noexcept { return fmadd(a, set1(b), c); }
+    FORCE_INLINE static VecType fmsub(VecType a, ScalarType b, VecType c) noexcept { return fmsub(a, set1(b), c); }
+    FORCE_INLINE static VecType fnmadd(VecType a, ScalarType b, VecType c) noexcept { return fnmadd(a, set1(b), c); }
+    FORCE_INLINE static VecType fnmsub(VecType a, ScalarType b, VecType c) noexcept { return fnmsub(a, set1(b), c); }
 
     FORCE_INLINE static VecType min(VecType a, VecType b) noexcept { return _mm_min_pd(a, b); }
     FORCE_INLINE static VecType min(VecType a, ScalarType b) noexcept { return _mm_min_pd(a, set1(b)); }
@@ -128,8 +285,12 @@ struct Microkernel<double, 128, X86_SSE>
 
     FORCE_INLINE static VecType gather(const ScalarType *base, const my_size_t *indices) noexcept
     {
+#ifndef __AVX2__
+        return _mm_setr_pd(base[indices[0]], base[indices[1]]);
+#else
         __m128i vindex = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
         return _mm_i64gather_pd(base, vindex, sizeof(ScalarType));
+#endif
     }
 
     FORCE_INLINE static void scatter(ScalarType *base, const my_size_t *indices, VecType val) noexcept
@@ -140,12 +301,76 @@ struct Microkernel<double, 128, X86_SSE>
             base[indices[i]] = tmp[i];
     }
 
+    /// In-register 2×2 transpose: lane j of r[i] ↔ lane i of r[j]
+    FORCE_INLINE static void transpose(VecType (&r)[simdWidth]) noexcept
+    {
+        const VecType lo = _mm_unpacklo_pd(r[0], r[1]);
+        r[1] = _mm_unpackhi_pd(r[0], r[1]);
+        r[0] = lo;
+    }
+
     FORCE_INLINE static VecType abs(VecType v) noexcept
     {
         __m128d sign_mask = _mm_set1_pd(-0.0);
         return _mm_andnot_pd(sign_mask, v);
     }
 
+    // ============================================================================
+    // Elementwise math primitives (building blocks of vector_math.h)
+    // ============================================================================
+    FORCE_INLINE static VecType sqrt(VecType v) noexcept { return _mm_sqrt_pd(v); }
+
+    // Round to nearest, ties to even
+    FORCE_INLINE static VecType round(VecType v) noexcept
+    {
+#ifdef __SSE4_1__
+        return _mm_round_pd(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+        // |v| + 2^52 - 2^52 drops the fraction; |v| ≥ 2^52 (and NaN) is already integral
+        const __m128d magic = _mm_set1_pd(4503599627370496.0);
+        __m128d a = abs(v);
+        __m128d r = _mm_sub_pd(_mm_add_pd(a, magic), magic);
+        __m128d small = _mm_cmplt_pd(a, magic);
+        r = _mm_or_pd(_mm_and_pd(small, r), _mm_andnot_pd(small, a));
+        return _mm_or_pd(r, _mm_and_pd(v, _mm_set1_pd(-0.0)));
+#endif
+    }
+
+    // a < b ? x : y, lane-wise (false for NaN)
+    FORCE_INLINE static VecType select_lt(VecType a, VecType b, VecType x, VecType y) noexcept
+    {
+        __m128d m = _mm_cmplt_pd(a, b);
+        return _mm_or_pd(_mm_and_pd(m, x), _mm_andnot_pd(m, y));
+    }
+
+    // Magnitude of mag, sign of sgn
+    FORCE_INLINE static VecType copysign(VecType mag, VecType sgn) noexcept
+    {
+        __m128d sign_mask = _mm_set1_pd(-0.0);
+        return _mm_or_pd(_mm_andnot_pd(sign_mask, mag), _mm_and_pd(sign_mask, sgn));
+    }
+
+    // 2^n for integral n in [-1022, 1023]. No cvtpd_epi64 before AVX-512:
+    // n + 2^52 + 1023 holds the biased exponent in its low mantissa bits.
+    FORCE_INLINE static VecType pow2n(VecType n) noexcept
+    {
+        __m128d t = _mm_add_pd(n, _mm_set1_pd(4503599627370496.0 + 1023.0));
+        return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(t), 52));
+    }
+
+    // Unbiased exponent floor(log2 v) and mantissa v / 2^e ∈ [1, 2), for positive normal v
+    FORCE_INLINE static VecType getexp(VecType v) noexcept
+    {
+        __m128i e = _mm_srli_epi64(_mm_castpd_si128(v), 52);
+        __m128d t = _mm_castsi128_pd(_mm_or_si128(e, _mm_set1_epi64x(0x4330000000000000LL)));
+        return _mm_sub_pd(t, _mm_set1_pd(4503599627370496.0 + 1023.0));
+    }
+    FORCE_INLINE static VecType getmant(VecType v) noexcept
+    {
+        __m128i m = _mm_and_si128(_mm_castpd_si128(v), _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+        return _mm_castsi128_pd(_mm_or_si128(m, _mm_set1_epi64x(0x3FF0000000000000LL)));
+    }
+
     FORCE_INLINE static bool all_within_tolerance(VecType a, VecType b, ScalarType tol) noexcept
     {
         __m128d diff = _mm_sub_pd(a, b);
@@ -157,4 +382,22 @@ struct Microkernel<double, 128, X86_SSE>
     }
 };
 
+// ============================================================================
+// Integer types: scalar kernel
+// ============================================================================
+// SSE2 has no 32-bit mullo, 64-bit multiply or 64-bit compares, so int32_t
+// and int64_t use the generic scalar kernel at this width. Under
+// TESSERACT_RUNTIME_DISPATCH the AVX2 / AVX-512 integer kernels still run
+// when the CPU has them.
+
+template <>
+struct Microkernel<int32_t, 128, X86_SSE> : Microkernel<int32_t, 128, GENERICARCH>
+{
+};
+
+template <>
+struct Microkernel<int64_t, 128, X86_SSE> : Microkernel<int64_t, 128, GENERICARCH>
+{
+};
+
 #endif // __SSE2_MICROKERNEL_H__
\ No newline at end of file
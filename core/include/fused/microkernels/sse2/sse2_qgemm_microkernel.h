@@ -0,0 +1,60 @@
+#ifndef __SSE2_QGEMM_MICROKERNEL_H__
+#define __SSE2_QGEMM_MICROKERNEL_H__
+
+#include <immintrin.h>
+#include "config.h"
+
+// ============================================================================
+// SSE2 (128-bit) int8 dot-product kernel for the quantized GEMM
+// ============================================================================
+// Eight int8 values are sign-extended to int16 and pmaddwd sums adjacent
+// products into four int32 lanes. Exact: no intermediate saturates.
+
+template <>
+struct QGemmMicrokernel<128, X86_SSE>
+{
+    static constexpr my_size_t KStep = 8;
+    static constexpr my_size_t MR = 2; // 8 accumulators + 4 B + 1 A + 1 product of 16 XMM
+    static constexpr my_size_t NR = 4;
+    static constexpr int32_t B_BIAS = 0;
+    using AccType = __m128i;
+    using Operand = __m128i;
+
+    FORCE_INLINE static AccType zero() noexcept { return _mm_setzero_si128(); }
+
+    FORCE_INLINE static Operand load_a(const int8_t *ptr) noexcept
+    {
+        const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr));
+#ifdef __SSE4_1__
+        return _mm_cvtepi8_epi16(v);
+#else
+        return _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8);
+#endif
+    }
+
+    FORCE_INLINE static Operand load_b(const int8_t *ptr) noexcept { return load_a(ptr); }
+
+    FORCE_INLINE static AccType dot(AccType acc, Operand a, Operand b) noexcept
+    {
+        return _mm_add_epi32(acc, _mm_madd_epi16(a, b));
+    }
+
+    FORCE_INLINE static int32_t hsum(AccType acc) noexcept
+    {
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(acc);
+    }
+
+    /// out[c] = Σ lanes of acc[c], c < 4 — a 4 × 4 transpose, then three adds.
+    FORCE_INLINE static void hsum4(const AccType *acc, int32_t *out) noexcept
+    {
+        const __m128i t0 = _mm_unpacklo_epi32(acc[0], acc[1]), t1 = _mm_unpackhi_epi32(acc[0], acc[1]);
+        const __m128i t2 = _mm_unpacklo_epi32(acc[2], acc[3]), t3 = _mm_unpackhi_epi32(acc[2], acc[3]);
+        const __m128i s = _mm_add_epi32(_mm_add_epi32(_mm_unpacklo_epi64(t0, t2), _mm_unpackhi_epi64(t0, t2)),
+                                        _mm_add_epi32(_mm_unpacklo_epi64(t1, t3), _mm_unpackhi_epi64(t1, t3)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), s);
+    }
+};
+
+#endif // __SSE2_QGEMM_MICROKERNEL_H__
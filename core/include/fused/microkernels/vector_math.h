@@ -0,0 +1,360 @@
+// Vectorized elementwise math on top of the Microkernel primitives
+#ifndef VECTOR_MATH_H
+#define VECTOR_MATH_H
+
+#include "config.h"
+#include "simple_type_traits.h"
+#include "fused/microkernels/microkernel_base.h"
+
+// ============================================================================
+// VecMath<K>
+// ============================================================================
+//
+// exp, log, sqrt, rsqrt, sin, cos, tanh, sigmoid and atan2 for any float or
+// double Microkernel K, one full vector per call. The algorithms are written
+// once, here, against K's arithmetic plus seven primitives every floating
+// point microkernel provides:
+//
+//   sqrt, round (to nearest even), select_lt(a, b, x, y) = a < b ? x : y,
+//   copysign, pow2n(n) = 2^n, getexp(v) = floor(log2 v), getmant(v) ∈ [1, 2)
+//
+// so each arch only maps those onto its instructions (vscalef / vgetexp on
+// AVX-512, exponent-field bit tricks elsewhere). Range reduction is
+// Cody–Waite, the polynomials are the Cephes minimax / rational fits.
+//
+// Max error over the accurate domain, in ulp against the exact result
+// (measured by tests/test_vector_math.cpp against long double):
+//
+//   function    float  double  accurate domain / notes
+//   ---------   -----  ------  -----------------------------------------------
+//   exp           1      2     overflow → +inf, underflow → 0 (subnormal
+//                              results are produced, not flushed)
+//   log           1      1     log(0) = -inf, log(x < 0) = NaN, subnormal x ok
+//   sqrt        0.5    0.5     hardware, correctly rounded
+//   rsqrt       1.5    1.5     1 / sqrt(x): two correctly rounded steps
+//   sin, cos    2.5      2     |x| ≤ 8192 (float) / 1e6 (double); the error
+//                              grows slowly beyond (Cody–Waite π/2 reduction)
+//   tanh        1.5    1.5     saturates to ±1
+//   sigmoid     2.5    2.5     1 / (1 + exp(-x))
+//   atan2       3.5      2     all quadrants, signed zeros and infinities
+//                              as in IEEE 754 / C atan2
+//
+// NaN inputs give NaN. Denormal handling assumes the FPU is not in
+// flush-to-zero mode.
+//
+// Dead lanes of a MaskedTail vector are zero and go through the same code
+// (log(0) = -inf, no traps); their results are never stored.
+
+template <typename K>
+struct VecMath
+{
+    using V = typename K::VecType;
+    using T = compute_type_t<typename K::ScalarType>; // Half / BFloat16 kernels compute in float
+    static_assert(is_same_v<T, float> || is_same_v<T, double>,
+                  "VecMath: elementwise math needs a float, double, Half or BFloat16 microkernel");
+
+    static constexpr bool F32 = is_same_v<T, float>;
+
+    // ------------------------------------------------------------------------
+    // exp
+    // ------------------------------------------------------------------------
+    /**
+     * x = n·ln2 + r, |r| ≤ ln2/2; e^x = 2^n · e^r. 2^n is applied as two
+     * factors 2^(n/2) · 2^(n - n/2), so results reach into the subnormal
+     * range and overflow to +inf without special cases.
+     */
+    FORCE_INLINE static V exp(V x) noexcept
+    {
+        constexpr T LOG2E = T(1.44269504088896340736);
+        // Clamp (NaN passes through): below LO the result rounds to 0, above HI to +inf
+        constexpr T HI = F32 ? T(88.8) : T(709.9);
+        constexpr T LO = F32 ? T(-104.0) : T(-745.2);
+        x = K::select_lt(K::set1(HI), x, K::set1(HI), x);
+        x = K::select_lt(x, K::set1(LO), K::set1(LO), x);
+
+        V n = K::round(K::mul(x, K::set1(LOG2E)));
+        V p;
+        if constexpr (F32)
+        {
+            static constexpr T P[] = {5.0000001201E-1f, 1.6666665459E-1f, 4.1665795894E-2f,
+                                      8.3334519073E-3f, 1.3981999507E-3f, 1.9875691500E-4f};
+            V r = K::fnmadd(n, K::set1(0.693359375f), x);
+            r = K::fnmadd(n, K::set1(-2.12194440e-4f), r);
+            // e^r ≈ 1 + r + r²·P(r)
+            p = K::fmadd(horner(r, P), K::mul(r, r), r);
+            p = K::add(p, K::set1(1.0f));
+        }
+        else
+        {
+            static constexpr T P[] = {9.99999999999999999910E-1, 3.02994407707441961300E-2,
+                                      1.26177193074810590878E-4};
+            static constexpr T Q[] = {2.00000000000000000009E0, 2.27265548208155028766E-1,
+                                      2.52448340349684104192E-3, 3.00198505138664455042E-6};
+            V r = K::fnmadd(n, K::set1(6.93145751953125E-1), x);
+            r = K::fnmadd(n, K::set1(1.42860682030941723212E-6), r);
+            // Padé form: e^r ≈ 1 + 2·r·P(r²) / (Q(r²) - r·P(r²))
+            V rr = K::mul(r, r);
+            V px = K::mul(r, horner(rr, P));
+            p = K::div(px, K::sub(horner(rr, Q), px));
+            p = K::fmadd(p, K::set1(T(2)), K::set1(T(1)));
+        }
+
+        V n1 = K::round(K::mul(n, K::set1(T(0.5))));
+        return K::mul(K::mul(p, K::pow2n(n1)), K::pow2n(K::sub(n, n1)));
+    }
+
+    // ------------------------------------------------------------------------
+    // log
+    // ------------------------------------------------------------------------
+    /**
+     * x = m·2^e with m ∈ [√½, √2); log x = e·ln2 + log1p(m - 1), ln2 split
+     * in two so e·ln2_hi is exact.
+     */
+    FORCE_INLINE static V log(V x) noexcept
+    {
+        // Scale subnormals into the normal range first
+        constexpr T MIN_NORMAL = F32 ? T(1.17549435e-38f) : T(2.2250738585072014e-308);
+        constexpr T SCALE = F32 ? T(33554432.0f) : T(18014398509481984.0); // 2^25 / 2^54
+        constexpr T SCALE_EXP = F32 ? T(25) : T(54);
+        const V tiny = K::set1(MIN_NORMAL);
+        V xs = K::select_lt(x, tiny, K::mul(x, K::set1(SCALE)), x);
+        V e = K::sub(K::getexp(xs), K::select_lt(x, tiny, K::set1(SCALE_EXP), K::set1(T(0))));
+        V m = K::getmant(xs);
+
+        // m ≥ √2: halve it (exact) and bump the exponent
+        const V sqrt2 = K::set1(T(1.41421356237309504880));
+        const V one = K::set1(T(1));
+        V f = K::sub(K::select_lt(m, sqrt2, m, K::mul(m, K::set1(T(0.5)))), one);
+        e = K::add(e, K::select_lt(m, sqrt2, K::set1(T(0)), one));
+
+        V z = K::mul(f, f);
+        V y;
+        if constexpr (F32)
+        {
+            static constexpr T P[] = {3.3333331174E-1f, -2.4999993993E-1f, 2.0000714765E-1f,
+                                      -1.6668057665E-1f, 1.4249322787E-1f, -1.2420140846E-1f,
+                                      1.1676998740E-1f, -1.1514610310E-1f, 7.0376836292E-2f};
+            y = K::mul(K::mul(horner(f, P), f), z);
+            y = K::fmadd(e, K::set1(-2.12194440e-4f), y);
+        }
+        else
+        {
+            static constexpr T P[] = {7.70838733755885391666E0, 1.79368678507819816313E1,
+                                      1.44989225341610930846E1, 4.70579119878881725854E0,
+                                      4.97494994976747001425E-1, 1.01875663804580931796E-4};
+            static constexpr T Q[] = {2.31251620126765340583E1, 7.11544750618563894466E1,
+                                      8.29875266912776603211E1, 4.52279145837532221105E1,
+                                      1.12873587189167450590E1, 1.0};
+            y = K::mul(f, K::div(K::mul(z, horner(f, P)), horner(f, Q)));
+            y = K::fmadd(e, K::set1(-2.121944400546905827679e-4), y);
+        }
+        y = K::fnmadd(z, K::set1(T(0.5)), y);
+        V r = K::fmadd(e, K::set1(T(0.693359375)), K::add(f, y));
+
+        // log(±0) = -inf, log(x < 0) = NaN, log(+inf) = +inf, NaN → NaN
+        const V zero = K::set1(T(0));
+        r = K::select_lt(zero, x, r, K::set1(-__builtin_inf()));
+        r = K::select_lt(x, zero, K::set1(__builtin_nan("")), r);
+        return K::select_lt(x, K::set1(__builtin_inf()), r, x);
+    }
+
+    // ------------------------------------------------------------------------
+    // sqrt, rsqrt
+    // ------------------------------------------------------------------------
+    FORCE_INLINE static V sqrt(V x) noexcept { return K::sqrt(x); }
+
+    FORCE_INLINE static V rsqrt(V x) noexcept { return K::div(K::set1(T(1)), K::sqrt(x)); }
+
+    // ------------------------------------------------------------------------
+    // sin, cos
+    // ------------------------------------------------------------------------
+    FORCE_INLINE static V sin(V x) noexcept
+    {
+        V n = K::round(K::mul(x, K::set1(T(0.636619772367581343076)))); // x · 2/π
+        V s = sin_quadrant(reduce_pio2(x, n), n);
+        // sin x = x (correctly rounded) below 2^-12 / 2^-26; also keeps sin(-0) = -0
+        return K::select_lt(K::abs(x), K::set1(F32 ? T(2.44140625e-4) : T(1.4901161193847656e-8)), x, s);
+    }
+
+    FORCE_INLINE static V cos(V x) noexcept
+    {
+        // cos x = sin(x + π/2): same reduction, quadrant shifted by one
+        V n = K::round(K::mul(x, K::set1(T(0.636619772367581343076))));
+        return sin_quadrant(reduce_pio2(x, n), K::add(n, K::set1(T(1))));
+    }
+
+    // ------------------------------------------------------------------------
+    // tanh, sigmoid
+    // ------------------------------------------------------------------------
+    /**
+     * |x| < 0.625: odd polynomial / rational fit; otherwise
+     * 1 - 2 / (e^{2|x|} + 1) with the sign of x.
+     */
+    FORCE_INLINE static V tanh(V x) noexcept
+    {
+        const V one = K::set1(T(1));
+        V ax = K::abs(x);
+        V z = K::mul(x, x);
+        V small;
+        if constexpr (F32)
+        {
+            static constexpr T P[] = {-3.33332819422E-1f, 1.33314422036E-1f, -5.37397155531E-2f,
+                                      2.06390887954E-2f, -5.70498872745E-3f};
+            small = K::fmadd(K::mul(horner(z, P), z), x, x);
+        }
+        else
+        {
+            static constexpr T P[] = {-1.61468768441708447952E3, -9.92877231001918586564E1,
+                                      -9.64399179425052238628E-1};
+            static constexpr T Q[] = {4.84406305325125486048E3, 2.23548839060100448583E3,
+                                      1.12811678491632931402E2, 1.0};
+            small = K::fmadd(K::div(K::mul(z, horner(z, P)), horner(z, Q)), x, x);
+        }
+        V e = exp(K::add(ax, ax));
+        V large = K::copysign(K::sub(one, K::div(K::set1(T(2)), K::add(e, one))), x);
+        return K::select_lt(ax, K::set1(T(0.625)), small, large);
+    }
+
+    FORCE_INLINE static V sigmoid(V x) noexcept
+    {
+        const V one = K::set1(T(1));
+        return K::div(one, K::add(one, exp(K::mul(x, K::set1(T(-1))))));
+    }
+
+    // ------------------------------------------------------------------------
+    // atan2
+    // ------------------------------------------------------------------------
+    /**
+     * atan(min(|x|,|y|) / max(|x|,|y|)) on [0, 1], then mirrored into the
+     * octant: π/2 - a if |y| > |x|, π - a if x is negative (including -0),
+     * sign of y last.
+     */
+    FORCE_INLINE static V atan2(V y, V x) noexcept
+    {
+        const V zero = K::set1(T(0));
+        const V one = K::set1(T(1));
+        V ax = K::abs(x);
+        V ay = K::abs(y);
+        V num = K::min(ax, ay);
+        V den = K::max(ax, ay);
+
+        // num == den (±inf / ±inf) → 1, den == 0 (both zero) → 0
+        V t = K::select_lt(num, den, K::div(num, den), one);
+        t = K::select_lt(zero, den, t, zero);
+
+        V a = atan_unit(t);
+        a = K::select_lt(ax, ay, K::sub(K::set1(T(1.57079632679489661923)), a), a);
+        a = K::select_lt(K::copysign(one, x), zero, K::sub(K::set1(T(3.14159265358979323846)), a), a);
+        a = K::copysign(a, y);
+
+        // NaN in either operand → NaN (min / max above need not propagate it)
+        const V neg_one = K::set1(T(-1));
+        a = K::select_lt(neg_one, ax, a, x);
+        return K::select_lt(neg_one, ay, a, y);
+    }
+
+private:
+    /// Horner evaluation of c[0] + c[1]·x + … + c[N-1]·x^(N-1).
+    template <my_size_t N>
+    FORCE_INLINE static V horner(V x, const T (&c)[N]) noexcept
+    {
+        V p = K::set1(c[N - 1]);
+        for (my_size_t i = N - 1; i-- > 0;)
+            p = K::fmadd(p, x, K::set1(c[i]));
+        return p;
+    }
+
+    /// floor(v) for integral-or-half v (used on n/2, n/4 of integral n).
+    FORCE_INLINE static V floor(V v) noexcept
+    {
+        V r = K::round(v);
+        return K::sub(r, K::select_lt(v, r, K::set1(T(1)), K::set1(T(0))));
+    }
+
+    /// r = x - n·π/2, π/2 split (Cody–Waite) into short pieces so the leading
+    /// products are exact: four pieces for float, three for double.
+    FORCE_INLINE static V reduce_pio2(V x, V n) noexcept
+    {
+        if constexpr (F32)
+        {
+            V r = K::fnmadd(n, K::set1(1.5703125f), x);
+            r = K::fnmadd(n, K::set1(4.8351287841796875e-4f), r);
+            r = K::fnmadd(n, K::set1(3.13855707645416259765625e-7f), r);
+            return K::fnmadd(n, K::set1(6.077100628276710381e-11f), r);
+        }
+        else
+        {
+            V r = K::fnmadd(n, K::set1(1.57079625129699707031E0), x);
+            r = K::fnmadd(n, K::set1(7.54978941586159635335E-8), r);
+            return K::fnmadd(n, K::set1(5.39030285815811905290E-15), r);
+        }
+    }
+
+    /**
+     * sin(r + q·π/2) for |r| ≤ π/4 and integral q: quadrant q mod 4 picks
+     * ±sin r or ±cos r.
+     */
+    FORCE_INLINE static V sin_quadrant(V r, V q) noexcept
+    {
+        V z = K::mul(r, r);
+        V s, c;
+        if constexpr (F32)
+        {
+            static constexpr T SP[] = {-1.6666654611E-1f, 8.3321608736E-3f, -1.9515295891E-4f};
+            static constexpr T CP[] = {4.166664568298827E-2f, -1.388731625493765E-3f, 2.443315711809948E-5f};
+            s = K::fmadd(K::mul(horner(z, SP), z), r, r);
+            c = K::fmadd(K::mul(horner(z, CP), z), z, K::fnmadd(z, K::set1(0.5f), K::set1(1.0f)));
+        }
+        else
+        {
+            static constexpr T SP[] = {-1.66666666666666307295E-1, 8.33333333332211858878E-3,
+                                       -1.98412698295895385996E-4, 2.75573136213857245213E-6,
+                                       -2.50507477628578072866E-8, 1.58962301576546568060E-10};
+            static constexpr T CP[] = {4.16666666666665929218E-2, -1.38888888888730564116E-3,
+                                       2.48015872888517045348E-5, -2.75573141792967388112E-7,
+                                       2.08757008419747316778E-9, -1.13585365213876817300E-11};
+            s = K::fmadd(K::mul(horner(z, SP), z), r, r);
+            c = K::fmadd(K::mul(horner(z, CP), z), z, K::fnmadd(z, K::set1(0.5), K::set1(1.0)));
+        }
+
+        // q mod 4 ∈ {0, 1, 2, 3}, exact in floating point
+        q = K::sub(q, K::mul(floor(K::mul(q, K::set1(T(0.25)))), K::set1(T(4))));
+        const V half = K::set1(T(0.5));
+        const V three_half = K::set1(T(1.5));
+        V odd = K::select_lt(q, three_half, q, K::sub(q, K::set1(T(2)))); // q mod 2
+        V v = K::select_lt(odd, half, s, c);
+        return K::select_lt(three_half, q, K::mul(v, K::set1(T(-1))), v);
+    }
+
+    /// atan t for t ∈ [0, 1]; above tan(π/8) (0.66 for double) via π/4 + atan((t-1)/(t+1)).
+    FORCE_INLINE static V atan_unit(V t) noexcept
+    {
+        const V one = K::set1(T(1));
+        constexpr T SPLIT = F32 ? T(0.4142135623730950f) : T(0.66);
+        const V split = K::set1(SPLIT);
+        V u = K::select_lt(split, t, K::div(K::sub(t, one), K::add(t, one)), t);
+        V z = K::mul(u, u);
+        if constexpr (F32)
+        {
+            static constexpr T P[] = {-3.33329491539E-1f, 1.99777106478E-1f, -1.38776856032E-1f, 8.05374449538E-2f};
+            V p = K::fmadd(K::mul(horner(z, P), z), u, u);
+            return K::add(K::select_lt(split, t, K::set1(0.785398163397448309616f), K::set1(0.0f)), p);
+        }
+        else
+        {
+            static constexpr T P[] = {-6.485021904942025371773E1, -1.228866684490136173410E2,
+                                      -7.500855792314704667340E1, -1.615753718733365076637E1,
+                                      -8.750608600031904122785E-1};
+            static constexpr T Q[] = {1.945506571482613964425E2, 4.853903996359136964868E2,
+                                      4.328810604912902668951E2, 1.650270098316988542046E2,
+                                      2.485846490142306297962E1, 1.0};
+            V p = K::fmadd(K::div(K::mul(z, horner(z, P)), horner(z, Q)), u, u);
+            // π/4 = PIO4 + 0.5·MOREBITS: the low part restores the bits PIO4 drops
+            V hi = K::select_lt(split, t, K::set1(0.785398163397448309616), K::set1(0.0));
+            V lo = K::select_lt(split, t, K::set1(3.061616997868382943065E-17), K::set1(0.0));
+            return K::add(hi, K::add(p, lo));
+        }
+    }
+};
+
+#endif // VECTOR_MATH_H
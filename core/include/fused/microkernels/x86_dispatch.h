@@ -0,0 +1,209 @@
+// Runtime CPU dispatch across the x86 microkernels (TESSERACT_RUNTIME_DISPATCH)
+#ifndef X86_DISPATCH_H
+#define X86_DISPATCH_H
+
+#include "config.h"
+
+// ============================================================================
+// How one translation unit holds SSE2, AVX2 and AVX-512 kernels
+// ============================================================================
+//
+// The compile flags fix the baseline (BITS / DefaultArch), as without
+// dispatch. Microkernels the flags do not enable are compiled here under
+// `#pragma GCC target`, so their intrinsics are available, but with plain
+// `inline` instead of FORCE_INLINE: the kernel templates that call them are
+// built for the baseline target, and GCC refuses to force-inline wider code
+// into them.
+//
+// The wider code is instead entered through ArchTarget<Arch>::run(), a
+// function carrying the target attribute and `flatten`. flatten inlines the
+// whole call tree (KernelGemm, KernelEval, expression evaluation, microkernel ops)
+// into that one function, where the wider ops are legal and inline normally.
+// Out-of-line copies of the kernel templates for a wider Arch are still
+// emitted but never called; -Wpsabi would warn about their vector ABI.
+//
+// Tasks handed to a ParallelExecutor are called through a function pointer,
+// which flatten cannot follow. They go through ArchTarget<Arch>::task<Fn>,
+// a flattened trampoline with the same target.
+//
+//   baseline (flags)   dispatched on top
+//   ----------------   ------------------------------
+//   SSE2 (x86-64)      AVX2 + FMA + F16C, AVX-512 F/DQ
+//   AVX2 + FMA         AVX-512 F/DQ
+//   AVX-512            (nothing — already the widest)
+//
+// Tensors are padded for the widest target (PAD_BITS = 512), so every
+// dispatched kernel can use aligned full-vector loads on any tensor.
+
+#define TESSERACT_X86_DISPATCH
+
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+#define TESSERACT_TARGET_AVX2 "avx2,fma,f16c" // keep in sync with the #pragma GCC target strings below
+#define TESSERACT_TARGET_AVX512 "avx2,fma,f16c,avx512f,avx512dq"
+
+#include "fused/microkernels/sse2/sse2_microkernel.h"
+#include "fused/microkernels/sse2/sse2_complex_microkernel.h"
+#include "fused/microkernels/sse2/sse2_half_microkernel.h"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include "fused/microkernels/avx2/avx2_microkernel.h"
+#include "fused/microkernels/avx2/avx2_complex_microkernel.h"
+#include "fused/microkernels/avx2/avx2_half_microkernel.h"
+#else
+#define TESSERACT_DISPATCH_AVX2
+#pragma GCC push_options
+#pragma GCC target("avx2,fma,f16c")
+#pragma push_macro("FORCE_INLINE")
+#undef FORCE_INLINE
+#define FORCE_INLINE inline
+#include "fused/microkernels/avx2/avx2_microkernel.h"
+#include "fused/microkernels/avx2/avx2_complex_microkernel.h"
+#include "fused/microkernels/avx2/avx2_half_microkernel.h"
+#pragma pop_macro("FORCE_INLINE")
+#pragma GCC pop_options
+#endif
+
+#if defined(__AVX512F__)
+#include "fused/microkernels/avx512/avx512_microkernel.h"
+#include "fused/microkernels/avx512/avx512_complex_microkernel.h"
+#include "fused/microkernels/avx512/avx512_half_microkernel.h"
+#else
+#define TESSERACT_DISPATCH_AVX512
+#pragma GCC push_options
+#pragma GCC target("avx2,fma,f16c,avx512f,avx512dq")
+#pragma push_macro("FORCE_INLINE")
+#undef FORCE_INLINE
+#define FORCE_INLINE inline
+#include "fused/microkernels/avx512/avx512_microkernel.h"
+#include "fused/microkernels/avx512/avx512_complex_microkernel.h"
+#include "fused/microkernels/avx512/avx512_half_microkernel.h"
+#pragma pop_macro("FORCE_INLINE")
+#pragma GCC pop_options
+#endif
+
+// ============================================================================
+// Flattened entry points for the dispatched targets
+// ============================================================================
+
+#ifdef TESSERACT_DISPATCH_AVX2
+template <>
+struct ArchTarget<X86_AVX>
+{
+    template <my_size_t Bits, typename F>
+    __attribute__((target(TESSERACT_TARGET_AVX2), flatten)) static decltype(auto) run(F &f)
+    {
+        return f.template operator()<Bits, X86_AVX>();
+    }
+
+    template <auto Fn>
+    __attribute__((target(TESSERACT_TARGET_AVX2), flatten)) static void task(void *ctx, my_size_t index) noexcept
+    {
+        Fn(ctx, index);
+    }
+};
+#endif
+
+#ifdef TESSERACT_DISPATCH_AVX512
+template <>
+struct ArchTarget<X86_AVX512>
+{
+    template <my_size_t Bits, typename F>
+    __attribute__((target(TESSERACT_TARGET_AVX512), flatten)) static decltype(auto) run(F &f)
+    {
+        return f.template operator()<Bits, X86_AVX512>();
+    }
+
+    template <auto Fn>
+    __attribute__((target(TESSERACT_TARGET_AVX512), flatten)) static void task(void *ctx, my_size_t index) noexcept
+    {
+        Fn(ctx, index);
+    }
+};
+#endif
+
+// ============================================================================
+// CPU detection
+// ============================================================================
+
+/// Widest x86 microkernel family a CPU can run, in increasing order.
+enum class CpuTarget
+{
+    SSE2,
+    AVX2,   ///< AVX2 + FMA3 + F16C (Haswell and later)
+    AVX512, ///< AVX-512 F + DQ (Skylake-SP and later)
+};
+
+/**
+ * @brief Target the dispatched kernels run on.
+ *
+ * Detected with cpuid once, during static initialisation. set_target()
+ * lowers it (e.g. to compare targets in tests or benchmarks); it never
+ * raises it above what the CPU supports.
+ */
+struct CpuDispatch
+{
+    /// Widest target this CPU supports.
+    static CpuTarget detected() noexcept
+    {
+        static const CpuTarget target = detect();
+        return target;
+    }
+
+    /// Target currently selected for dispatched kernels.
+    static CpuTarget target() noexcept { return target_; }
+
+    /**
+     * @brief Select a target, clamped to detected().
+     *
+     * Not thread-safe with respect to concurrently running kernels; set it
+     * once during start-up.
+     */
+    static void set_target(CpuTarget target) noexcept
+    {
+        target_ = target < detected() ? target : detected();
+    }
+
+private:
+    static CpuTarget detect() noexcept
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+            return CpuTarget::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c"))
+            return CpuTarget::AVX2;
+        return CpuTarget::SSE2;
+    }
+
+    // Zero-initialised (SSE2) until the dynamic initialiser runs, so kernels
+    // called during static initialisation stay on the baseline.
+    static inline CpuTarget target_ = detected();
+};
+
+/// Microkernel<T, Bits, Arch> is implemented (has GEMM tiling constants).
+template <typename T, my_size_t Bits, typename Arch>
+inline constexpr bool has_microkernel = requires { Microkernel<T, Bits, Arch>::MR; };
+
+/**
+ * @brief Call f.template operator()<Bits, Arch>() for the widest target
+ * the CPU runs and T has a microkernel for; the baseline otherwise.
+ */
+template <typename T, typename F>
+decltype(auto) x86_dispatch(F &f)
+{
+    switch (CpuDispatch::target())
+    {
+    case CpuTarget::AVX512:
+        if constexpr (BITS < 512 && has_microkernel<T, 512, X86_AVX512>)
+            return ArchTarget<X86_AVX512>::template run<512>(f);
+        [[fallthrough]];
+    case CpuTarget::AVX2:
+        if constexpr (BITS < 256 && has_microkernel<T, 256, X86_AVX>)
+            return ArchTarget<X86_AVX>::template run<256>(f);
+        [[fallthrough]];
+    default:
+        return f.template operator()<BITS, DefaultArch>();
+    }
+}
+
+#endif // X86_DISPATCH_H
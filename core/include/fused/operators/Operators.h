@@ -1,5 +1,6 @@
 #pragma once
 #include "fused/operators/arithmetic.h"
 #include "fused/operators/comparison.h"
+#include "fused/operators/elementwise_math.h"
 #include "fused/operators/minmax.h"
 #include "fused/operators/reductions.h"
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+#include "config.h"
+#include "fused/BinaryExpr.h"
+#include "fused/ScalarExpr.h"
+#include "fused/UnaryExpr.h"
+#include "fused/Operations.h"
+#include "fused/operators/operators_common.h"
+#include "simple_type_traits.h"
+#include "algebra/algebraic_traits.h"
+
+// ===============================
+// Elementwise Math Functions
+// ===============================
+// Lazy, like the arithmetic operators: exp(-(x - mu) * (x - mu) * k) is one
+// expression tree, evaluated in a single vectorized pass on assignment.
+// float / double tensors, and Half / BFloat16 ones (computed in float).
+
+template <typename Expr>
+concept ElementwiseMathOperand =
+    algebra::is_tensor_v<Expr> &&
+    !algebra::is_algebra_v<Expr> &&
+    (is_floating_point_v<typename Expr::value_type> || is_half_storage_v<typename Expr::value_type>);
+
+template <typename Expr>
+    requires ElementwiseMathOperand<Expr>
+UnaryExpr<Expr, Exp> exp(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Exp>(expr.derived());
+}
+
+template <typename Expr>
+    requires ElementwiseMathOperand<Expr>
+UnaryExpr<Expr, Log> log(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Log>(expr.derived());
+}
+
+template <typename Expr>
+    requires ElementwiseMathOperand<Expr>
+UnaryExpr<Expr, Sqrt> sqrt(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Sqrt>(expr.derived());
+}
+
+template <typename Expr>
+    requires ElementwiseMathOperand<Expr>
+UnaryExpr<Expr, Rsqrt> rsqrt(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Rsqrt>(expr.derived());
+}
+
+template <typename Expr>
+    requires ElementwiseMathOperand<Expr>
+UnaryExpr<Expr, Sin> sin(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Sin>(expr.derived());
+}
+
+template <typename Expr>
+    requires ElementwiseMathOperand<Expr>
+UnaryExpr<Expr, Cos> cos(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Cos>(expr.derived());
+}
+
+template <typename Expr>
+    requires ElementwiseMathOperand<Expr>
+UnaryExpr<Expr, Tanh> tanh(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Tanh>(expr.derived());
+}
+
+template <typename Expr>
+    requires ElementwiseMathOperand<Expr>
+UnaryExpr<Expr, Sigmoid> sigmoid(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Sigmoid>(expr.derived());
+}
+
+// atan2(tensor, tensor)
+template <typename Y, typename X>
+    requires(ElementwiseMathOperand<Y> && ElementwiseMathOperand<X>)
+BinaryExpr<Y, X, Atan2> atan2(const BaseExpr<Y> &y, const BaseExpr<X> &x) TESSERACT_CONDITIONAL_NOEXCEPT
+{
+#if defined(RUNTIME_CHECK_DIMENSIONS_COUNT_MISMATCH) || defined(RUNTIME_CHECK_DIMENSIONS_SIZE_MISMATCH)
+    checkDimsMatch(y.derived(), x.derived(), "atan2");
+#endif
+    return BinaryExpr<Y, X, Atan2>(y.derived(), x.derived());
+}
+
+// atan2(tensor, scalar)
+template <typename Y, typename T>
+    requires(ElementwiseMathOperand<Y> &&
+             !is_base_of_v<detail::BaseExprTag, T>)
+ScalarExprRHS<Y, T, Atan2> atan2(const BaseExpr<Y> &y, T x) noexcept
+{
+    return ScalarExprRHS<Y, T, Atan2>(y.derived(), x);
+}
+
+// atan2(scalar, tensor)
+template <typename X, typename T>
+    requires(ElementwiseMathOperand<X> &&
+             !is_base_of_v<detail::BaseExprTag, T>)
+ScalarExprLHS<X, T, Atan2> atan2(T y, const BaseExpr<X> &x) noexcept
+{
+    return ScalarExprLHS<X, T, Atan2>(x.derived(), y);
+}
+
+// ===============================
+// Complex
+// ===============================
+
+template <typename Expr>
+concept ComplexOperand =
+    algebra::is_tensor_v<Expr> &&
+    !algebra::is_algebra_v<Expr> &&
+    is_complex_v<typename Expr::value_type>;
+
+template <typename Expr>
+    requires ComplexOperand<Expr>
+UnaryExpr<Expr, Conj> conj(const BaseExpr<Expr> &expr) noexcept
+{
+    return UnaryExpr<Expr, Conj>(expr.derived());
+}
@@ -30,4 +30,170 @@ template <typename Expr>
 typename Expr::value_type sum(const BaseExpr<Expr> &expr)
 {
     return KernelOps<typename Expr::value_type, BITS, DefaultArch>::reduce_sum(expr.derived());
-}
\ No newline at end of file
+}
+
+/// Summation selectors for sum(expr, mode) — float and double; other types ignore them
+namespace summation
+{
+    template <detail::Summation S>
+    struct tag
+    {
+        static constexpr detail::Summation value = S;
+    };
+
+    inline constexpr tag<detail::Summation::Unrolled> unrolled{};       // same as sum(expr)
+    inline constexpr tag<detail::Summation::Compensated> compensated{}; // TwoSum error term per lane
+    inline constexpr tag<detail::Summation::Pairwise> pairwise{};       // O(log n) error growth
+} // namespace summation
+
+/**
+ * @brief Sum with a chosen summation order.
+ *
+ *   float total = sum(X, summation::compensated);   // long float sums, accurate to about one rounding
+ */
+template <typename Expr, detail::Summation S>
+    requires(algebra::is_tensor_v<Expr> &&
+             !algebra::is_algebra_v<Expr>)
+typename Expr::value_type sum(const BaseExpr<Expr> &expr, summation::tag<S>)
+{
+    return KernelOps<typename Expr::value_type, BITS, DefaultArch>::template reduce_sum<S>(expr.derived());
+}
+
+// ===============================
+// Axis Reductions
+// ===============================
+
+/// Reduction selectors for reduce<Axis>(expr, op)
+namespace reduce_op
+{
+    template <detail::ReduceOp Op>
+    struct tag
+    {
+        static constexpr detail::ReduceOp value = Op;
+    };
+
+    inline constexpr tag<detail::ReduceOp::Sum> sum{};
+    inline constexpr tag<detail::ReduceOp::Min> min{};
+    inline constexpr tag<detail::ReduceOp::Max> max{};
+    inline constexpr tag<detail::ReduceOp::Mean> mean{};  // integer tensors: truncated, like T / T
+    inline constexpr tag<detail::ReduceOp::Prod> prod{};
+} // namespace reduce_op
+
+namespace detail
+{
+    template <typename V, typename Expr, my_size_t Axis, typename Seq>
+    struct AxisReducedTensorImpl
+    {
+    };
+
+    template <typename V, typename Expr, my_size_t Axis, my_size_t... Is>
+    struct AxisReducedTensorImpl<V, Expr, Axis, index_seq<Is...>>
+    {
+        using type = FusedTensorND<V, Expr::Dim[Is < Axis ? Is : Is + 1]...>;
+    };
+
+    /// Expr's shape with Axis removed, holding V
+    template <typename V, typename Expr, my_size_t Axis>
+    using AxisReducedTensor = typename AxisReducedTensorImpl<V, Expr, Axis, typename make_index_seq<Expr::NumDims - 1>::type>::type;
+
+    /// Logical coordinates of logical flat index `flat`
+    template <typename Expr>
+    Array<my_size_t, Expr::NumDims> unravel_index(my_size_t flat) noexcept
+    {
+        Array<my_size_t, Expr::NumDims> coords{};
+        for (my_size_t d = Expr::NumDims; d-- > 0;)
+        {
+            coords[d] = flat % Expr::Dim[d];
+            flat /= Expr::Dim[d];
+        }
+        return coords;
+    }
+} // namespace detail
+
+/**
+ * @brief Reduce an expression along one axis: a tensor with that axis removed.
+ *
+ *   auto colMeans = reduce<0>(A, reduce_op::mean);        // [M, N] → [N]
+ *   auto rowMax   = reduce<1>(A - B, reduce_op::max);     // [M, N] → [M], A - B not materialized
+ *
+ * Reduce a 1-D expression with min / max / sum instead.
+ */
+template <my_size_t Axis, typename Expr, detail::ReduceOp Op>
+    requires(algebra::is_tensor_v<Expr> &&
+             !algebra::is_algebra_v<Expr>)
+auto reduce(const BaseExpr<Expr> &expr, reduce_op::tag<Op>)
+{
+    static_assert(Expr::NumDims >= 2, "reduce<Axis>: needs at least 2 dimensions, use min/max/sum for a full reduction");
+    static_assert(Axis < Expr::NumDims, "reduce<Axis>: Axis out of range");
+
+    using T = typename Expr::value_type;
+    detail::AxisReducedTensor<T, Expr, Axis> result;
+    KernelOps<T, BITS, DefaultArch>::template reduce_axis<Op, Axis>(result.data(), expr.derived());
+    return result;
+}
+
+// ===============================
+// Argmin / Argmax
+// ===============================
+
+/**
+ * @brief Logical coordinates of the first minimum of an expression.
+ *
+ *   auto at = argmin(A);                 // [M, N] → {i, j}, A(at[0], at[1]) is the minimum
+ *
+ * Ties go to the lowest logical index. With NaNs present the result is unspecified.
+ */
+template <typename Expr>
+    requires(algebra::is_tensor_v<Expr> &&
+             !algebra::is_algebra_v<Expr>)
+Array<my_size_t, Expr::NumDims> argmin(const BaseExpr<Expr> &expr)
+{
+    return detail::unravel_index<Expr>(
+        KernelOps<typename Expr::value_type, BITS, DefaultArch>::template arg_reduce<detail::ReduceOp::Min>(expr.derived()));
+}
+
+/**
+ * @brief Logical coordinates of the first maximum of an expression.
+ */
+template <typename Expr>
+    requires(algebra::is_tensor_v<Expr> &&
+             !algebra::is_algebra_v<Expr>)
+Array<my_size_t, Expr::NumDims> argmax(const BaseExpr<Expr> &expr)
+{
+    return detail::unravel_index<Expr>(
+        KernelOps<typename Expr::value_type, BITS, DefaultArch>::template arg_reduce<detail::ReduceOp::Max>(expr.derived()));
+}
+
+/**
+ * @brief Index along Axis of the first minimum: a my_size_t tensor with Axis removed.
+ *
+ *   auto nearest = argmin<1>(dist);   // [M, N] → [M], column of the closest match per row
+ */
+template <my_size_t Axis, typename Expr>
+    requires(algebra::is_tensor_v<Expr> &&
+             !algebra::is_algebra_v<Expr>)
+auto argmin(const BaseExpr<Expr> &expr)
+{
+    static_assert(Expr::NumDims >= 2, "argmin<Axis>: needs at least 2 dimensions, use argmin(expr)");
+    static_assert(Axis < Expr::NumDims, "argmin<Axis>: Axis out of range");
+
+    detail::AxisReducedTensor<my_size_t, Expr, Axis> result;
+    KernelOps<typename Expr::value_type, BITS, DefaultArch>::template arg_reduce_axis<detail::ReduceOp::Min, Axis>(result.data(), expr.derived());
+    return result;
+}
+
+/**
+ * @brief Index along Axis of the first maximum: a my_size_t tensor with Axis removed.
+ */
+template <my_size_t Axis, typename Expr>
+    requires(algebra::is_tensor_v<Expr> &&
+             !algebra::is_algebra_v<Expr>)
+auto argmax(const BaseExpr<Expr> &expr)
+{
+    static_assert(Expr::NumDims >= 2, "argmax<Axis>: needs at least 2 dimensions, use argmax(expr)");
+    static_assert(Axis < Expr::NumDims, "argmax<Axis>: Axis out of range");
+
+    detail::AxisReducedTensor<my_size_t, Expr, Axis> result;
+    KernelOps<typename Expr::value_type, BITS, DefaultArch>::template arg_reduce_axis<detail::ReduceOp::Max, Axis>(result.data(), expr.derived());
+    return result;
+}
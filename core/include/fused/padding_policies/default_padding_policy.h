@@ -0,0 +1,20 @@
+#pragma once
+
+#include "config.h"                                     // for my_size_t, TESSERACT_NO_PADDING
+#include "fused/padding_policies/simd_padding_policy.h" // for SimdPaddingPolicy
+#include "fused/padding_policies/no_padding_policy.h"   // for NoPaddingPolicy
+
+/**
+ * @brief Padding policy of FusedTensorND and of kernel-evaluated results.
+ *
+ * SimdPaddingPolicy by default. With TESSERACT_NO_PADDING defined, tensors
+ * are stored compact (NoPaddingPolicy) and the kernels handle the partial
+ * vector at the end of each row with masked loads/stores.
+ */
+#ifdef TESSERACT_NO_PADDING
+template <typename T, my_size_t... Dims>
+using DefaultPaddingPolicy = NoPaddingPolicy<T, Dims...>;
+#else
+template <typename T, my_size_t... Dims>
+using DefaultPaddingPolicy = SimdPaddingPolicy<T, Dims...>;
+#endif
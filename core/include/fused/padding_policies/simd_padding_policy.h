@@ -159,7 +159,9 @@
  * DESIGN: MICROKERNEL AS SINGLE SOURCE OF TRUTH
  * ============================================================================
  *
- * The SimdWidth is obtained from Microkernel<T, BITS, DefaultArch>::SimdWidth.
+ * The SimdWidth is obtained from Microkernel<T, BITS, DefaultArch>::SimdWidth
+ * (through PadSimdWidth<T>, which widens it to the AVX-512 width when
+ * TESSERACT_RUNTIME_DISPATCH may run AVX-512 kernels on the same tensors).
  *
  * Why not compute it as DATA_ALIGNAS / sizeof(T)?
  *
@@ -344,6 +346,6 @@ struct SimdPaddingPolicyBase
     static constexpr Array<my_size_t, NumDims> PhysicalDims = computePhysicalDims();
 };
 
-// Production alias - gets SimdWidth from Microkernel
+// Production alias - gets SimdWidth from Microkernel (via PadSimdWidth)
 template <typename T, my_size_t... Dims>
-using SimdPaddingPolicy = SimdPaddingPolicyBase<T, Microkernel<T, BITS, DefaultArch>::simdWidth, Dims...>;
+using SimdPaddingPolicy = SimdPaddingPolicyBase<T, PadSimdWidth<T>, Dims...>;
@@ -0,0 +1,194 @@
+#ifndef FUSED_BROADCAST_VIEW_CONSTEXPR_H
+#define FUSED_BROADCAST_VIEW_CONSTEXPR_H
+
+#include "config.h"
+#include "fused/BaseExpr.h"
+#include "fused/layouts/strided_layout_constexpr.h"
+#include "fused/padding_policies/default_padding_policy.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "helper_traits.h"
+
+/**
+ * @brief Compile-time broadcast view of a tensor onto a larger shape.
+ *
+ * Does not own or copy data — references the underlying tensor's physical
+ * buffer. The source shape is aligned to the right of the target shape (as
+ * in NumPy); every source axis must equal the target axis or be 1. Missing
+ * leading axes and size-1 axes are broadcast: their stride into the source
+ * is 0.
+ *
+ *   Source b[4] (a bias row), target [3,4]:
+ *     SrcStrides = [0, 1]      view(i,j) → b[j]
+ *
+ *   Source w[3,1] (a column of weights, e.g. FusedVector<T, 3>), target [3,4]:
+ *     SrcStrides = [PaddedLastDim(w), 0]   view(i,j) → w[i]
+ *
+ * The view has the layout of a target-shaped tensor, so it takes part in
+ * expressions (A + b.broadcast_to<3, 4>()) and fuses into KernelEval's
+ * contiguous path like any tensor operand. A vector never crosses a row of
+ * padded storage, so evalu is one offset computation per vector: K::set1 of
+ * one source element when the last axis is broadcast, otherwise one load of
+ * the source row (which has the same length and padding as a target row).
+ *
+ * @tparam Tensor  The underlying tensor type (e.g., FusedTensorND<float, 4>)
+ * @tparam Dims    Target shape
+ */
+template <typename Tensor, my_size_t... Dims>
+class BroadcastViewConstExpr : public BaseExpr<BroadcastViewConstExpr<Tensor, Dims...>>
+{
+    static constexpr my_size_t Offset = sizeof...(Dims) - Tensor::NumDims;
+
+    static_assert(Tensor::NumDims <= sizeof...(Dims),
+                  "Broadcast target must have at least as many dimensions as the source");
+
+    static constexpr bool compatible() noexcept
+    {
+        constexpr my_size_t target[] = {Dims...};
+        for (my_size_t s = 0; s < Tensor::NumDims; ++s)
+            if (Tensor::Dim[s] != 1 && Tensor::Dim[s] != target[s + Offset])
+                return false;
+        return true;
+    }
+
+    static_assert(compatible(),
+                  "Every source dimension must equal the target dimension or be 1");
+
+public:
+    using value_type = typename Tensor::value_type;
+    using Layout = StridedLayoutConstExpr<DefaultPaddingPolicy<value_type, Dims...>>;
+
+    static constexpr my_size_t NumDims = sizeof...(Dims);
+    static constexpr my_size_t Dim[] = {Dims...};
+    static constexpr my_size_t TotalSize = (Dims * ...);
+
+private:
+    using PadPolicy = typename Layout::PadPolicyType;
+    static constexpr my_size_t LastDim = PadPolicy::LastDim;
+    static constexpr my_size_t PaddedLastDim = PadPolicy::PaddedLastDim;
+
+    static constexpr Array<my_size_t, NumDims> computeSrcStrides() noexcept
+    {
+        Array<my_size_t, NumDims> result{};
+        for (my_size_t d = Offset; d < NumDims; ++d)
+            result[d] = Tensor::Dim[d - Offset] == 1 ? 0 : Tensor::Layout::stride(d - Offset);
+        return result;
+    }
+
+    /// Stride into the source buffer per target axis (0: broadcast)
+    static constexpr Array<my_size_t, NumDims> SrcStrides = computeSrcStrides();
+
+    /// Last axis broadcast: one source element per target row
+    static constexpr bool LastBroadcast = SrcStrides[NumDims - 1] == 0;
+
+public:
+    explicit BroadcastViewConstExpr(const Tensor &t) noexcept
+        : t_(t) {}
+
+    // Views are non-copyable, non-movable — they're lightweight references.
+    BroadcastViewConstExpr(const BroadcastViewConstExpr &) = delete;
+    BroadcastViewConstExpr &operator=(const BroadcastViewConstExpr &) = delete;
+    BroadcastViewConstExpr(BroadcastViewConstExpr &&) = delete;
+    BroadcastViewConstExpr &operator=(BroadcastViewConstExpr &&) = delete;
+
+    template <typename Output>
+    bool may_alias(const Output &output) const noexcept
+    {
+        return t_.may_alias(output); // recurse to underlying tensor
+    }
+
+    template <typename... Indices>
+        requires(sizeof...(Indices) == NumDims)
+    FORCE_INLINE const value_type &operator()(Indices... indices) const TESSERACT_CONDITIONAL_NOEXCEPT
+    {
+        const my_size_t idxArray[] = {static_cast<my_size_t>(indices)...};
+        return (*this)(idxArray);
+    }
+
+    FORCE_INLINE const value_type &operator()(const my_size_t *indices) const TESSERACT_CONDITIONAL_NOEXCEPT
+    {
+        my_size_t offset = 0;
+        for (my_size_t d = 0; d < NumDims; ++d)
+        {
+            if (indices[d] >= Dim[d])
+            {
+                MyErrorHandler::error("BroadcastViewConstExpr: index out of bounds");
+            }
+            offset += indices[d] * SrcStrides[d];
+        }
+        return t_.data()[offset];
+    }
+
+    // ========================================================================
+    // BroadcastViewConstExpr::evalu — physical flat of the target layout
+    // ========================================================================
+
+    template <typename T, my_size_t Bits, typename Arch>
+    FORCE_INLINE typename Microkernel<T, Bits, Arch>::VecType evalu(my_size_t flat) const noexcept
+    {
+        return row_evalu<T, Bits, Arch, PaddedLastDim>(flat);
+    }
+
+    template <typename T, my_size_t Bits, typename Arch>
+    FORCE_INLINE typename Microkernel<T, Bits, Arch>::VecType logical_evalu(my_size_t logical_flat) const noexcept
+    {
+        return row_evalu<T, Bits, Arch, LastDim>(logical_flat);
+    }
+
+    FORCE_INLINE static constexpr my_size_t getDim(my_size_t i) TESSERACT_CONDITIONAL_NOEXCEPT
+    {
+        return Layout::logical_dim(i);
+    }
+
+    FORCE_INLINE static constexpr my_size_t getNumDims() noexcept { return NumDims; }
+
+    FORCE_INLINE static constexpr my_size_t getTotalSize() noexcept { return TotalSize; }
+
+private:
+    const Tensor &t_;
+
+    /// Source offset of the first element of target row `row` (row over all axes but the last).
+    FORCE_INLINE static constexpr my_size_t row_offset(my_size_t row) noexcept
+    {
+        my_size_t offset = 0;
+        for (my_size_t d = NumDims - 1; d-- > 0;)
+        {
+            offset += (row % Dim[d]) * SrcStrides[d];
+            row /= Dim[d];
+        }
+        return offset;
+    }
+
+    /**
+     * @brief Vector at flat index `flat` of a target laid out in rows of RowLen.
+     *
+     * RowLen is PaddedLastDim for physical offsets, LastDim for logical
+     * flats. Only unpadded or logical rows that are not a multiple of
+     * simdWidth have vectors crossing a row boundary; those are gathered.
+     */
+    template <typename T, my_size_t Bits, typename Arch, my_size_t RowLen>
+    FORCE_INLINE typename Microkernel<T, Bits, Arch>::VecType row_evalu(my_size_t flat) const noexcept
+    {
+        using K = Microkernel<T, Bits, Arch>;
+        const my_size_t row = flat / RowLen;
+        const my_size_t col = flat - row * RowLen;
+
+        if (col + live_lanes<K>() <= RowLen)
+        {
+            const value_type *src = t_.data() + row_offset(row);
+            if constexpr (LastBroadcast)
+                return K::set1(*src);
+            else
+                return K::loadu(src + col);
+        }
+
+        my_size_t idxList[K::simdWidth];
+        for (my_size_t i = 0; i < live_lanes<K>(); ++i)
+        {
+            const my_size_t r = (flat + i) / RowLen;
+            idxList[i] = row_offset(r) + (LastBroadcast ? 0 : flat + i - r * RowLen);
+        }
+        return K::gather(t_.data(), idxList);
+    }
+};
+
+#endif // FUSED_BROADCAST_VIEW_CONSTEXPR_H
@@ -81,7 +81,7 @@ public:
         constexpr my_size_t width = K::simdWidth;
 
         my_size_t idxList[width];
-        for (my_size_t i = 0; i < width; ++i)
+        for (my_size_t i = 0; i < live_lanes<K>(); ++i)
             idxList[i] = layout_.computeOffsetFromFlat(flat + i);
 
         return K::gather(t_.data_.data(), idxList);
@@ -114,6 +114,12 @@ public:
      * logical_flat 3 → coords(1,1) → physical 5
      * → gather from offsets [0, 4, 1, 5]
      *
+     * When the lanes stay inside one row of the last logical dimension (the
+     * common case: the permuted eval path iterates output rows), the offsets
+     * are one decomposition plus i * stride(last) — and a plain load when
+     * the permutation keeps the last axis in place. Only runs that cross a
+     * row boundary decompose every lane.
+     *
      * @tparam T   The value type for evaluation (e.g., float, double)
      * @tparam Bits Number of bits for the microkernel (e.g., 256 for AVX2)
      * @tparam Arch The target architecture for the microkernel (e.g., AVX2, AVX-512)
@@ -125,10 +131,24 @@ public:
     {
         using K = Microkernel<T, Bits, Arch>;
         constexpr my_size_t width = K::simdWidth;
+        constexpr my_size_t lastDim = Layout::logical_dim(NumDims - 1);
+        constexpr my_size_t lastStride = Layout::stride(NumDims - 1);
 
         my_size_t idxList[width];
-        for (my_size_t i = 0; i < width; ++i)
-            idxList[i] = Layout::logical_flat_to_physical_flat(logical_flat + i);
+        if (logical_flat % lastDim + live_lanes<K>() <= lastDim)
+        {
+            const my_size_t base = Layout::logical_flat_to_physical_flat(logical_flat);
+            if constexpr (lastStride == 1)
+                return K::loadu(t_.data_.data() + base);
+
+            for (my_size_t i = 0; i < live_lanes<K>(); ++i)
+                idxList[i] = base + i * lastStride;
+        }
+        else
+        {
+            for (my_size_t i = 0; i < live_lanes<K>(); ++i)
+                idxList[i] = Layout::logical_flat_to_physical_flat(logical_flat + i);
+        }
 
         return K::gather(t_.data_.data(), idxList);
     }
@@ -0,0 +1,200 @@
+#ifndef HALF_H
+#define HALF_H
+
+#include "simple_type_traits.h"
+#include "numeric_limits.h"
+
+/**
+ * @file half.h
+ * @brief 16-bit floating-point storage types: IEEE binary16 and bfloat16.
+ *
+ * Half and BFloat16 are storage formats, not arithmetic ones: a value
+ * converts to float for every operation and back (round to nearest even)
+ * when stored. Used as the element type of FusedTensorND / FusedMatrix,
+ * the microkernels widen 16-bit lanes to fp32 vectors on load (F16C /
+ * AVX-512 vcvtph2ps, NEON vcvt_f32_f16, a shift for bfloat16) and narrow
+ * them on store, so expressions, reductions and GEMM compute in fp32 while
+ * reading and writing half the bytes:
+ *
+ *   FusedMatrix<Half, 256, 256> samples, out;   // 128 KiB each instead of 256
+ *   out = (samples - offset) * gain;            // fp16 loads/stores, fp32 math
+ *
+ * Half:     1 + 5 + 10 bits, max 65504, ~3.3 decimal digits.
+ * BFloat16: 1 + 8 +  7 bits, float's range, ~2.4 decimal digits.
+ */
+
+namespace detail
+{
+    constexpr unsigned int float_bits(float f) noexcept { return __builtin_bit_cast(unsigned int, f); }
+    constexpr float bits_float(unsigned int u) noexcept { return __builtin_bit_cast(float, u); }
+
+    /// float → binary16, round to nearest even; NaN stays (quiet) NaN.
+    constexpr unsigned short float_to_half_bits(float f) noexcept
+    {
+        unsigned int u = float_bits(f);
+        const unsigned int sign = u & 0x80000000u;
+        u ^= sign;
+
+        unsigned int h;
+        if (u >= (127u + 16u) << 23) // overflow, Inf or NaN
+        {
+            h = (u > 255u << 23) ? 0x7e00u : 0x7c00u;
+        }
+        else if (u < 113u << 23) // subnormal or zero: let the FPU round
+        {
+            constexpr unsigned int magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+            h = float_bits(bits_float(u) + bits_float(magic)) - magic;
+        }
+        else
+        {
+            const unsigned int odd = (u >> 13) & 1u;
+            u += ((15u - 127u) << 23) + 0xfffu + odd; // rebias, round half to even
+            h = u >> 13;
+        }
+        return static_cast<unsigned short>(h | (sign >> 16));
+    }
+
+    /// binary16 → float (exact).
+    constexpr float half_bits_to_float(unsigned short h) noexcept
+    {
+        const unsigned int expmant = h & 0x7fffu;
+        const unsigned int sign = static_cast<unsigned int>(h & 0x8000u) << 16;
+        // Shifted into float position, ×2^112 fixes the bias and normalizes subnormals
+        unsigned int u = float_bits(bits_float(expmant << 13) * bits_float((254u - 15u) << 23));
+        if (expmant >= 0x7c00u) // Inf / NaN
+            u |= 255u << 23;
+        return bits_float(u | sign);
+    }
+
+    /// float → bfloat16, round to nearest even; NaN stays (quiet) NaN.
+    constexpr unsigned short float_to_bf16_bits(float f) noexcept
+    {
+        const unsigned int u = float_bits(f);
+        if ((u & 0x7fffffffu) > 0x7f800000u)
+            return static_cast<unsigned short>((u >> 16) | 0x40u);
+        return static_cast<unsigned short>((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+    }
+
+    /// bfloat16 → float (exact).
+    constexpr float bf16_bits_to_float(unsigned short b) noexcept
+    {
+        return bits_float(static_cast<unsigned int>(b) << 16);
+    }
+} // namespace detail
+
+/**
+ * @brief IEEE 754 binary16 storage type.
+ *
+ * Converts implicitly to and from float; arithmetic on Half operands is
+ * float arithmetic.
+ */
+struct Half
+{
+    unsigned short bits;
+
+    constexpr Half() noexcept : bits(0) {}
+    constexpr Half(float f) noexcept : bits(detail::float_to_half_bits(f)) {}
+    constexpr operator float() const noexcept { return detail::half_bits_to_float(bits); }
+
+    static constexpr Half from_bits(unsigned short b) noexcept
+    {
+        Half h;
+        h.bits = b;
+        return h;
+    }
+};
+
+/**
+ * @brief bfloat16 storage type (the upper half of a float).
+ *
+ * Converts implicitly to and from float; arithmetic on BFloat16 operands is
+ * float arithmetic.
+ */
+struct BFloat16
+{
+    unsigned short bits;
+
+    constexpr BFloat16() noexcept : bits(0) {}
+    constexpr BFloat16(float f) noexcept : bits(detail::float_to_bf16_bits(f)) {}
+    constexpr operator float() const noexcept { return detail::bf16_bits_to_float(bits); }
+
+    static constexpr BFloat16 from_bits(unsigned short b) noexcept
+    {
+        BFloat16 h;
+        h.bits = b;
+        return h;
+    }
+};
+
+/**
+ * @brief Compile-time check for the 16-bit storage types (Half, BFloat16).
+ * @tparam T Type to test.
+ */
+template <typename T>
+struct is_half_storage
+{
+    static constexpr bool value = false;
+};
+
+/// @cond
+template <>
+struct is_half_storage<Half>
+{
+    static constexpr bool value = true;
+};
+template <>
+struct is_half_storage<BFloat16>
+{
+    static constexpr bool value = true;
+};
+/// @endcond
+
+/** @brief Helper variable template for is_half_storage. */
+template <typename T>
+inline constexpr bool is_half_storage_v = is_half_storage<T>::value;
+
+/**
+ * @brief Type arithmetic on T is carried out in: float for the 16-bit
+ * storage types, T itself otherwise. Kernels accumulate in it.
+ */
+template <typename T>
+struct compute_type
+{
+    using type = T;
+};
+
+/// @cond
+template <>
+struct compute_type<Half>
+{
+    using type = float;
+};
+template <>
+struct compute_type<BFloat16>
+{
+    using type = float;
+};
+/// @endcond
+
+template <typename T>
+using compute_type_t = typename compute_type<T>::type;
+
+/// @cond
+template <>
+struct NumericLimits<Half>
+{
+    static constexpr Half max() noexcept { return Half::from_bits(0x7bff); }
+    static constexpr Half lowest() noexcept { return Half::from_bits(0xfbff); }
+    static constexpr Half infinity() noexcept { return Half::from_bits(0x7c00); }
+};
+
+template <>
+struct NumericLimits<BFloat16>
+{
+    static constexpr BFloat16 max() noexcept { return BFloat16::from_bits(0x7f7f); }
+    static constexpr BFloat16 lowest() noexcept { return BFloat16::from_bits(0xff7f); }
+    static constexpr BFloat16 infinity() noexcept { return BFloat16::from_bits(0x7f80); }
+};
+/// @endcond
+
+#endif // HALF_H
@@ -247,6 +247,9 @@ namespace expr_diag
             skip_ws(s, pos);
             pos++; // skip '>'
 
+            if (op == "Atan2")
+                return "atan2(" + lhs + ", " + rhs + ")";
+
             std::string sym = (op == "Add")   ? " + "
                               : (op == "Sub") ? " − "
                               : (op == "Mul") ? " · "
@@ -310,6 +313,22 @@ namespace expr_diag
                                               : " ? ";
             return "(" + scalar + sym + expr + ")";
         }
+        else if (name == "UnaryExpr")
+        {
+            pos++; // skip '<'
+            std::string expr = parse_expr(s, pos);
+            skip_ws(s, pos);
+            pos++; // skip ','
+            skip_ws(s, pos);
+            std::string op = read_ident(s, pos);
+            skip_ws(s, pos);
+            pos++; // skip '>'
+
+            std::string fn = op;
+            if (!fn.empty())
+                fn[0] = static_cast<char>(fn[0] - 'A' + 'a'); // Exp → exp
+            return fn + "(" + expr + ")";
+        }
         else if (name == "FmaExpr")
         {
             pos++; // skip '<'
@@ -0,0 +1,126 @@
+#ifndef PARALLEL_EXECUTOR_H
+#define PARALLEL_EXECUTOR_H
+
+#include "config.h"
+
+/**
+ * @file parallel_executor.h
+ * @brief STL-free executor interface for opt-in parallel kernels.
+ *
+ * The library never spawns threads on its own. Parallel kernels (currently
+ * the packed GEMM behind einsum/matmul) look up a globally registered
+ * ParallelExecutor and fall back to the serial path when none is set, when
+ * the problem is below the configured size threshold, or when called from
+ * inside a task that is already running on the executor.
+ *
+ * Any executor can be injected by implementing the two-method interface;
+ * a ready-made std::thread pool lives in utilities/thread_pool.h.
+ *
+ * @code
+ *   ThreadPool pool(16);
+ *   ParallelContext::set_executor(&pool);          // opt in
+ *   auto C = matmul(A, B);                         // large products now run on 16 threads
+ *   ParallelContext::set_executor(nullptr);        // back to serial
+ * @endcode
+ */
+
+/**
+ * @brief Task callback: invoked once per index in [0, count).
+ *
+ * @param ctx   Opaque pointer passed through from parallel_for().
+ * @param index Task index.
+ */
+using ParallelTask = void (*)(void *ctx, my_size_t index);
+
+/**
+ * @brief Abstract fork-join executor.
+ *
+ * Implementations must run @p task for every index in [0, count) and
+ * return only after all invocations have completed. The order and the
+ * thread on which each index runs are unspecified; kernels only submit
+ * tasks that write disjoint outputs.
+ */
+struct ParallelExecutor
+{
+    virtual ~ParallelExecutor() = default;
+
+    /// Number of threads that may execute tasks concurrently (including the caller, if it participates).
+    virtual my_size_t num_workers() const noexcept = 0;
+
+    /// Run task(ctx, i) for i in [0, count) and block until all have finished.
+    virtual void parallel_for(my_size_t count, ParallelTask task, void *ctx) noexcept = 0;
+};
+
+/**
+ * @brief Global opt-in switch for parallel kernels.
+ *
+ * Holds the injected executor and the work threshold (in multiply-adds,
+ * M·N·K for GEMM) below which kernels stay single-threaded.
+ */
+struct ParallelContext
+{
+    /// Default threshold: ~2M multiply-adds, about a 128×128×128 product.
+    static constexpr my_size_t DEFAULT_MIN_VOLUME = 128 * 128 * 128;
+
+    /**
+     * @brief Register an executor (nullptr disables parallel execution).
+     *
+     * @p min_volume is honoured as given: a GEMM of at least that volume
+     * runs on the executor through the packed path, even when it is small
+     * enough that the serial kernel would skip packing
+     * (KernelGemm::PACK_MIN_VOLUME).
+     *
+     * Not thread-safe with respect to concurrently running kernels; set it
+     * once during start-up.
+     */
+    static void set_executor(ParallelExecutor *executor,
+                             my_size_t min_volume = DEFAULT_MIN_VOLUME) noexcept
+    {
+        executor_ = executor;
+        min_volume_ = min_volume;
+    }
+
+    /// Currently registered executor, or nullptr.
+    static ParallelExecutor *executor() noexcept { return executor_; }
+
+    /// Work threshold below which kernels run serially.
+    static my_size_t min_volume() noexcept { return min_volume_; }
+
+    /**
+     * @brief Executor to use for a kernel of the given volume, or nullptr for serial.
+     *
+     * Returns nullptr when no executor is set, the executor has a single
+     * worker, the volume is below the threshold, or the calling thread is
+     * itself executing a parallel task (prevents nested fork-join deadlock).
+     */
+    static ParallelExecutor *executor_for(my_size_t volume) noexcept
+    {
+        if (executor_ == nullptr || in_task_ || volume < min_volume_)
+            return nullptr;
+        return executor_->num_workers() > 1 ? executor_ : nullptr;
+    }
+
+    /**
+     * @brief RAII marker set by kernels around each task body.
+     *
+     * While alive, executor_for() returns nullptr on this thread, so
+     * kernels invoked from inside a task run serially.
+     */
+    struct TaskScope
+    {
+        TaskScope() noexcept : prev_(in_task_) { in_task_ = true; }
+        ~TaskScope() { in_task_ = prev_; }
+        TaskScope(const TaskScope &) = delete;
+        TaskScope &operator=(const TaskScope &) = delete;
+
+    private:
+        bool prev_;
+    };
+
+private:
+    static inline ParallelExecutor *executor_ = nullptr;
+    static inline my_size_t min_volume_ = DEFAULT_MIN_VOLUME;
+    static inline thread_local bool in_task_ = false;
+};
+
+#endif // PARALLEL_EXECUTOR_H
@@ -0,0 +1,136 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "config.h"
+#include "utilities/parallel_executor.h"
+
+/**
+ * @file thread_pool.h
+ * @brief Small built-in fork-join thread pool implementing ParallelExecutor.
+ *
+ * Hosted targets only (uses std::thread). Workers are spawned once and
+ * sleep between jobs. The calling thread participates in every
+ * parallel_for(), so a pool of N threads spawns N-1 workers.
+ *
+ * Indices are handed out through an atomic counter, so uneven tasks
+ * balance automatically. Concurrent parallel_for() calls from different
+ * threads are serialized.
+ */
+class ThreadPool final : public ParallelExecutor
+{
+public:
+    /**
+     * @brief Create a pool with @p num_threads total threads (caller included).
+     *
+     * @param num_threads Total concurrency; 0 selects std::thread::hardware_concurrency().
+     */
+    explicit ThreadPool(my_size_t num_threads = 0)
+    {
+        if (num_threads == 0)
+            num_threads = std::thread::hardware_concurrency();
+        if (num_threads == 0)
+            num_threads = 1;
+
+        workers_.reserve(num_threads - 1);
+        for (my_size_t t = 1; t < num_threads; ++t)
+            workers_.emplace_back([this]
+                                  { worker_loop(); });
+    }
+
+    ~ThreadPool() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            stop_ = true;
+        }
+        cv_start_.notify_all();
+        for (auto &w : workers_)
+            w.join();
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    my_size_t num_workers() const noexcept override { return workers_.size() + 1; }
+
+    void parallel_for(my_size_t count, ParallelTask task, void *ctx) noexcept override
+    {
+        if (count == 0)
+            return;
+
+        std::lock_guard<std::mutex> submit(submit_mtx_);
+
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            task_ = task;
+            ctx_ = ctx;
+            count_ = count;
+            next_.store(0, std::memory_order_relaxed);
+            active_ = workers_.size();
+            ++generation_;
+        }
+        cv_start_.notify_all();
+
+        run_tasks();
+
+        std::unique_lock<std::mutex> lock(mtx_);
+        cv_done_.wait(lock, [this]
+                      { return active_ == 0; });
+    }
+
+private:
+    /// Claim and run indices until the current job is exhausted.
+    void run_tasks() noexcept
+    {
+        for (my_size_t i = next_.fetch_add(1, std::memory_order_relaxed); i < count_;
+             i = next_.fetch_add(1, std::memory_order_relaxed))
+            task_(ctx_, i);
+    }
+
+    void worker_loop() noexcept
+    {
+        unsigned long long seen = 0;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mtx_);
+                cv_start_.wait(lock, [&]
+                               { return stop_ || generation_ != seen; });
+                if (stop_)
+                    return;
+                seen = generation_;
+            }
+
+            run_tasks();
+
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+                if (--active_ == 0)
+                    cv_done_.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+
+    std::mutex submit_mtx_; ///< Serializes concurrent parallel_for() callers
+    std::mutex mtx_;        ///< Guards job state below
+    std::condition_variable cv_start_;
+    std::condition_variable cv_done_;
+
+    ParallelTask task_ = nullptr;
+    void *ctx_ = nullptr;
+    my_size_t count_ = 0;
+    std::atomic<my_size_t> next_{0};
+    my_size_t active_ = 0;
+    unsigned long long generation_ = 0;
+    bool stop_ = false;
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,259 @@
+/**
+ * @file test_argminmax.cpp
+ * @brief Catch2 tests for argmin / argmax, whole-tensor and per axis.
+ *
+ * Tests cover:
+ *   - whole-tensor argmin/argmax returning logical coordinates, with the
+ *     extremum in the first element, in a full vector, in a tail and repeated
+ *     (lowest index wins)
+ *   - argmin<Axis>/argmax<Axis> along every axis of 3-D tensors, against a
+ *     scalar loop over operator(): last axis (lane indices + horizontal
+ *     resolve) and outer axes (vertical index blend)
+ *   - rows and tensors of +inf (argmin) / -inf (argmax): index of the
+ *     first element
+ *   - fused expressions and permuted views as input
+ *
+ * Input padding is poisoned with a value that would win, so reading padding
+ * fails the comparison.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <limits>
+#include <type_traits>
+
+#include "config.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+template <typename Tensor, typename T>
+static void fill_padding(Tensor &X, T v)
+{
+    using P = typename Tensor::Layout::PadPolicyType;
+    for (my_size_t s = 0; s < P::PhysicalSize / P::PaddedLastDim; ++s)
+        for (my_size_t l = P::LastDim; l < P::PaddedLastDim; ++l)
+            X.data()[s * P::PaddedLastDim + l] = v;
+}
+
+/// Few distinct values, so every row and column has ties.
+template <typename T>
+static T value_at(my_size_t n)
+{
+    return static_cast<T>(static_cast<int>((n * 7 + 3) % 11) - 5);
+}
+
+/// Scalar reference: index of the first extremum of the 3-D tensor X over Axis at (a, b).
+template <bool Max, my_size_t Axis, typename T, my_size_t D0, my_size_t D1, my_size_t D2>
+static my_size_t reference(const FusedTensorND<T, D0, D1, D2> &X, my_size_t a, my_size_t b)
+{
+    constexpr my_size_t D[] = {D0, D1, D2};
+    auto at = [&](my_size_t k)
+    { return Axis == 0 ? X(k, a, b) : Axis == 1 ? X(a, k, b) : X(a, b, k); };
+    my_size_t best = 0;
+    for (my_size_t k = 1; k < D[Axis]; ++k)
+        if (Max ? at(k) > at(best) : at(k) < at(best))
+            best = k;
+    return best;
+}
+
+template <bool Max, my_size_t Axis, typename T, my_size_t D0, my_size_t D1, my_size_t D2, typename Result>
+static void check_axis(const FusedTensorND<T, D0, D1, D2> &X, const Result &R)
+{
+    constexpr my_size_t D[] = {D0, D1, D2};
+    constexpr my_size_t A = D[Axis == 0 ? 1 : 0];
+    constexpr my_size_t B = D[Axis == 2 ? 1 : 2];
+    STATIC_REQUIRE(std::is_same_v<typename Result::value_type, my_size_t>);
+    STATIC_REQUIRE(Result::Dim[0] == A);
+    STATIC_REQUIRE(Result::Dim[1] == B);
+
+    int bad = 0;
+    for (my_size_t a = 0; a < A; ++a)
+        for (my_size_t b = 0; b < B; ++b)
+            bad += R(a, b) != reference<Max, Axis>(X, a, b);
+    CHECK(bad == 0);
+}
+
+template <typename T, my_size_t D0, my_size_t D1, my_size_t D2>
+static void check_all_axes()
+{
+    FusedTensorND<T, D0, D1, D2> X;
+    for (my_size_t i = 0; i < D0; ++i)
+        for (my_size_t j = 0; j < D1; ++j)
+            for (my_size_t k = 0; k < D2; ++k)
+                X(i, j, k) = value_at<T>((i * D1 + j) * D2 + k);
+
+    fill_padding(X, std::numeric_limits<T>::lowest());
+    check_axis<false, 0>(X, argmin<0>(X));
+    check_axis<false, 1>(X, argmin<1>(X));
+    check_axis<false, 2>(X, argmin<2>(X));
+
+    fill_padding(X, std::numeric_limits<T>::max());
+    check_axis<true, 0>(X, argmax<0>(X));
+    check_axis<true, 1>(X, argmax<1>(X));
+    check_axis<true, 2>(X, argmax<2>(X));
+}
+
+// ============================================================================
+// WHOLE TENSOR
+// ============================================================================
+
+TEMPLATE_TEST_CASE("argmin / argmax: logical coordinates of the first extremum", "[argminmax]",
+                   double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    constexpr my_size_t A = 3, B = 5, C = 19;
+    FusedTensorND<T, A, B, C> X;
+    for (my_size_t i = 0; i < A; ++i)
+        for (my_size_t j = 0; j < B; ++j)
+            for (my_size_t k = 0; k < C; ++k)
+                X(i, j, k) = value_at<T>((i * B + j) * C + k);
+
+    // Plain data: the first -5 and the first 5
+    {
+        const auto lo = argmin(X);
+        const auto hi = argmax(X);
+        my_size_t first_lo = 0, first_hi = 0;
+        for (my_size_t n = 0; n < A * B * C; ++n)
+        {
+            if (value_at<T>(n) < value_at<T>(first_lo))
+                first_lo = n;
+            if (value_at<T>(n) > value_at<T>(first_hi))
+                first_hi = n;
+        }
+        CHECK(lo[0] * B * C + lo[1] * C + lo[2] == first_lo);
+        CHECK(hi[0] * B * C + hi[1] * C + hi[2] == first_hi);
+    }
+
+    // A unique extremum at the first element, in a full vector, in the tail, at the last element
+    const my_size_t spots[][3] = {{0, 0, 0}, {1, 2, 3}, {2, 1, C - 2}, {A - 1, B - 1, C - 1}};
+    for (const auto &s : spots)
+    {
+        X(s[0], s[1], s[2]) = T(-50);
+        fill_padding(X, std::numeric_limits<T>::lowest());
+        const auto lo = argmin(X);
+        X(s[0], s[1], s[2]) = T(50);
+        fill_padding(X, std::numeric_limits<T>::max());
+        const auto hi = argmax(X);
+        X(s[0], s[1], s[2]) = value_at<T>((s[0] * B + s[1]) * C + s[2]);
+        for (my_size_t d = 0; d < 3; ++d)
+        {
+            CHECK(lo[d] == s[d]);
+            CHECK(hi[d] == s[d]);
+        }
+    }
+
+    // Ties: the same extremum twice, the lower logical index wins
+    {
+        X(2, 4, 18) = T(-50);
+        X(1, 0, 1) = T(-50);
+        X(0, 3, 17) = T(60);
+        X(2, 0, 0) = T(60);
+        const auto lo = argmin(X);
+        const auto hi = argmax(X);
+        CHECK((lo[0] == 1 && lo[1] == 0 && lo[2] == 1));
+        CHECK((hi[0] == 0 && hi[1] == 3 && hi[2] == 17));
+    }
+}
+
+// ============================================================================
+// PER AXIS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("argmin<Axis> / argmax<Axis> along every axis", "[argminmax]",
+                   double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    check_all_axes<T, 2, 3, 5>();  // rows shorter than a vector
+    check_all_axes<T, 3, 4, 16>(); // whole vectors
+    check_all_axes<T, 4, 6, 37>(); // vectors and a tail
+    check_all_axes<T, 7, 2, 1>();  // last axis of size 1
+}
+
+TEMPLATE_TEST_CASE("argmin / argmax of infinite rows: the first element, never a sentinel", "[argminmax]",
+                   double, float)
+{
+    using T = TestType;
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    const auto check = []<my_size_t D0, my_size_t D1, my_size_t D2>()
+    {
+        // Every row +inf for argmin, -inf for argmax; row 1 of block 0 finite
+        FusedTensorND<T, D0, D1, D2> X;
+        for (my_size_t i = 0; i < D0; ++i)
+            for (my_size_t j = 0; j < D1; ++j)
+                for (my_size_t k = 0; k < D2; ++k)
+                    X(i, j, k) = (i == 0 && j == 1) ? value_at<T>(k) : inf;
+        fill_padding(X, std::numeric_limits<T>::lowest());
+        check_axis<false, 0>(X, argmin<0>(X));
+        check_axis<false, 2>(X, argmin<2>(X));
+        const auto lo = argmin(X);
+        CHECK((lo[0] == 0 && lo[1] == 1 && lo[2] == reference<false, 2>(X, 0, 1)));
+
+        for (my_size_t i = 0; i < D0; ++i)
+            for (my_size_t j = 0; j < D1; ++j)
+                for (my_size_t k = 0; k < D2; ++k)
+                    X(i, j, k) = -inf;
+        fill_padding(X, std::numeric_limits<T>::max());
+        check_axis<true, 1>(X, argmax<1>(X));
+        check_axis<true, 2>(X, argmax<2>(X));
+        const auto hi = argmax(X);
+        CHECK((hi[0] == 0 && hi[1] == 0 && hi[2] == 0));
+
+        for (my_size_t i = 0; i < D0; ++i)
+            for (my_size_t j = 0; j < D1; ++j)
+                for (my_size_t k = 0; k < D2; ++k)
+                    X(i, j, k) = inf;
+        const auto all = argmin(X);
+        CHECK((all[0] == 0 && all[1] == 0 && all[2] == 0));
+    };
+    check.template operator()<2, 3, 5>();  // tail only
+    check.template operator()<3, 4, 16>(); // whole vectors
+    check.template operator()<2, 3, 37>(); // vectors and a tail
+}
+
+TEMPLATE_TEST_CASE("argmin / argmax over fused expressions and permuted views", "[argminmax]",
+                   double, float)
+{
+    using T = TestType;
+    constexpr my_size_t R = 7, C = 20;
+    FusedMatrix<T, R, C> A, B;
+    FusedMatrix<T, C, R> At;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            A(i, j) = value_at<T>(i * C + j);
+            B(i, j) = value_at<T>(3 * (i * C + j) + 2);
+            At(j, i) = A(i, j);
+        }
+
+    // Best match per row of a cost expression, and per column of a transposed view
+    auto rowBest = argmin<1>(A * A - B);
+    auto colBest = argmax<0>(At.transpose_view());
+    for (my_size_t i = 0; i < R; ++i)
+    {
+        my_size_t best = 0;
+        for (my_size_t j = 1; j < C; ++j)
+            if (A(i, j) * A(i, j) - B(i, j) < A(i, best) * A(i, best) - B(i, best))
+                best = j;
+        CHECK(rowBest(i) == best);
+    }
+    for (my_size_t j = 0; j < C; ++j)
+    {
+        my_size_t best = 0;
+        for (my_size_t i = 1; i < R; ++i)
+            if (A(i, j) > A(best, j))
+                best = i;
+        CHECK(colBest(j) == best);
+    }
+
+    // Whole-tensor on an expression and on a permuted view
+    A(4, 13) = T(-40);
+    const auto lo = argmin(A + B * T(0));
+    CHECK((lo[0] == 4 && lo[1] == 13));
+    At(13, 4) = T(40);
+    const auto hi = argmax(At.transpose_view());
+    CHECK((hi[0] == 4 && hi[1] == 13));
+}
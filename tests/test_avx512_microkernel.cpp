@@ -0,0 +1,163 @@
+/**
+ * @file test_avx512_microkernel.cpp
+ * @brief Catch2 tests for the AVX-512 microkernels (float, double, int32_t, int64_t).
+ *
+ * Tests cover:
+ *   - register tile and width constants
+ *   - load / store, arithmetic, fused multiply-add family, min / max / abs
+ *     lane by lane against scalar arithmetic
+ *   - the 64-bit low multiply, and its AVX-512F emulation used without DQ
+ *   - maskload / maskstore for every tail length: dead lanes load as zero,
+ *     memory past n is never written
+ *   - gather / scatter with strided indices, and all_within_tolerance
+ *
+ * Built without AVX-512 the file compiles to nothing.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <cstdint>
+
+#include "config.h"
+#include "fused/microkernels/microkernel_base.h"
+
+#ifdef __AVX512F__
+
+TEMPLATE_TEST_CASE("AVX-512 microkernel: width and register tile", "[avx512][microkernel]",
+                   float, double, int32_t, int64_t)
+{
+    using T = TestType;
+    using K = Microkernel<T, 512, X86_AVX512>;
+    STATIC_REQUIRE(K::simdWidth == 64 / sizeof(T));
+    STATIC_REQUIRE(K::MR * K::NR_VECS + K::NR_VECS + 1 <= K::num_registers);
+    STATIC_REQUIRE(K::NR == K::NR_VECS * K::simdWidth);
+}
+
+TEMPLATE_TEST_CASE("AVX-512 microkernel: lanewise operations match scalar arithmetic", "[avx512][microkernel]",
+                   float, double, int32_t, int64_t)
+{
+    using T = TestType;
+    using K = Microkernel<T, 512, X86_AVX512>;
+    constexpr my_size_t W = K::simdWidth;
+
+    // Small integers of both signs: every result is exact in every type
+    alignas(64) T a[W], b[W], c[W], r[W];
+    for (my_size_t l = 0; l < W; ++l)
+    {
+        a[l] = static_cast<T>(static_cast<int>(l) - 5);
+        b[l] = static_cast<T>(static_cast<int>(l % 3) + 1);
+        c[l] = static_cast<T>(7 - 2 * static_cast<int>(l));
+    }
+    const auto va = K::load(a), vb = K::load(b), vc = K::load(c);
+
+    const auto lanes_are = [&](typename K::VecType v, auto ref)
+    {
+        K::store(r, v);
+        int bad = 0;
+        for (my_size_t l = 0; l < W; ++l)
+            bad += r[l] != static_cast<T>(ref(l));
+        return bad;
+    };
+
+    CHECK(lanes_are(K::add(va, vb), [&](my_size_t l) { return a[l] + b[l]; }) == 0);
+    CHECK(lanes_are(K::add(va, T(3)), [&](my_size_t l) { return a[l] + T(3); }) == 0);
+    CHECK(lanes_are(K::sub(va, vb), [&](my_size_t l) { return a[l] - b[l]; }) == 0);
+    CHECK(lanes_are(K::sub(T(2), vb), [&](my_size_t l) { return T(2) - b[l]; }) == 0);
+    CHECK(lanes_are(K::mul(va, vb), [&](my_size_t l) { return a[l] * b[l]; }) == 0);
+    CHECK(lanes_are(K::mul(va, T(-4)), [&](my_size_t l) { return a[l] * T(-4); }) == 0);
+    CHECK(lanes_are(K::div(va, vb), [&](my_size_t l) { return a[l] / b[l]; }) == 0);
+    CHECK(lanes_are(K::div(va, T(2)), [&](my_size_t l) { return a[l] / T(2); }) == 0);
+    CHECK(lanes_are(K::fmadd(va, vb, vc), [&](my_size_t l) { return a[l] * b[l] + c[l]; }) == 0);
+    CHECK(lanes_are(K::fmsub(va, vb, vc), [&](my_size_t l) { return a[l] * b[l] - c[l]; }) == 0);
+    CHECK(lanes_are(K::fnmadd(va, vb, vc), [&](my_size_t l) { return c[l] - a[l] * b[l]; }) == 0);
+    CHECK(lanes_are(K::fnmsub(va, vb, vc), [&](my_size_t l) { return -(a[l] * b[l]) - c[l]; }) == 0);
+    CHECK(lanes_are(K::min(va, vc), [&](my_size_t l) { return a[l] < c[l] ? a[l] : c[l]; }) == 0);
+    CHECK(lanes_are(K::max(va, vc), [&](my_size_t l) { return a[l] > c[l] ? a[l] : c[l]; }) == 0);
+    CHECK(lanes_are(K::abs(va), [&](my_size_t l) { return a[l] < T(0) ? -a[l] : a[l]; }) == 0);
+    CHECK(lanes_are(K::set1(T(9)), [&](my_size_t) { return T(9); }) == 0);
+}
+
+TEST_CASE("AVX-512 microkernel: 64-bit multiply keeps the low 64 bits", "[avx512][microkernel]")
+{
+    using K = Microkernel<int64_t, 512, X86_AVX512>;
+    // Operands past 32 bits, both signs: the high partial products matter
+    alignas(64) int64_t a[8] = {0x123456789LL, -0x123456789LL, 0x7FFFFFFF00000001LL, -1,
+                                1LL << 40, -(1LL << 33) + 5, 0x0F0F0F0F0F0F0F0FLL, 3};
+    alignas(64) int64_t b[8] = {0x987654321LL, 0x1000000001LL, 0x100000003LL, -1,
+                                (1LL << 30) + 7, -(1LL << 31), -0x0101010101010101LL, -(1LL << 62)};
+    alignas(64) int64_t r[8], e[8];
+    K::store(r, K::mul(K::load(a), K::load(b)));
+    // mul takes _mm512_mullo_epi64 when DQ is there; check the emulation directly
+    K::store(e, K::mullo_emulated(K::load(a), K::load(b)));
+    for (my_size_t l = 0; l < 8; ++l)
+    {
+        const uint64_t ref = static_cast<uint64_t>(a[l]) * static_cast<uint64_t>(b[l]);
+        CHECK(static_cast<uint64_t>(r[l]) == ref);
+        CHECK(static_cast<uint64_t>(e[l]) == ref);
+    }
+}
+
+TEMPLATE_TEST_CASE("AVX-512 microkernel: masked tails touch the first n lanes only", "[avx512][microkernel]",
+                   float, double, int32_t, int64_t)
+{
+    using T = TestType;
+    using K = Microkernel<T, 512, X86_AVX512>;
+    constexpr my_size_t W = K::simdWidth;
+
+    T src[W];
+    for (my_size_t l = 0; l < W; ++l)
+        src[l] = static_cast<T>(l + 1);
+
+    int load_bad = 0, store_bad = 0;
+    for (my_size_t n = 0; n <= W; ++n)
+    {
+        alignas(64) T r[W];
+        K::store(r, K::maskload(src, n));
+        for (my_size_t l = 0; l < W; ++l)
+            load_bad += r[l] != (l < n ? src[l] : T(0));
+
+        // One guard element past the vector
+        T dst[W + 1];
+        for (my_size_t l = 0; l <= W; ++l)
+            dst[l] = T(-1);
+        K::maskstore(dst, K::set1(T(5)), n);
+        for (my_size_t l = 0; l <= W; ++l)
+            store_bad += dst[l] != (l < n ? T(5) : T(-1));
+    }
+    CHECK(load_bad == 0);
+    CHECK(store_bad == 0);
+}
+
+TEMPLATE_TEST_CASE("AVX-512 microkernel: gather / scatter and tolerance", "[avx512][microkernel]",
+                   float, double, int32_t, int64_t)
+{
+    using T = TestType;
+    using K = Microkernel<T, 512, X86_AVX512>;
+    constexpr my_size_t W = K::simdWidth;
+    constexpr my_size_t stride = 3;
+
+    T base[W * stride];
+    for (my_size_t i = 0; i < W * stride; ++i)
+        base[i] = static_cast<T>(i);
+    my_size_t idx[W];
+    for (my_size_t l = 0; l < W; ++l)
+        idx[l] = (W - 1 - l) * stride; // reversed, strided
+
+    alignas(64) T r[W];
+    K::store(r, K::gather(base, idx));
+    int bad = 0;
+    for (my_size_t l = 0; l < W; ++l)
+        bad += r[l] != base[idx[l]];
+    CHECK(bad == 0);
+
+    T out[W * stride] = {};
+    K::scatter(out, idx, K::add(K::gather(base, idx), T(1)));
+    bad = 0;
+    for (my_size_t i = 0; i < W * stride; ++i)
+        bad += out[i] != (i % stride == 0 ? base[i] + T(1) : T(0));
+    CHECK(bad == 0);
+
+    CHECK(K::all_within_tolerance(K::set1(T(10)), K::set1(T(12)), T(2)));
+    CHECK_FALSE(K::all_within_tolerance(K::set1(T(10)), K::set1(T(13)), T(2)));
+}
+
+#endif // __AVX512F__
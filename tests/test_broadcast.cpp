@@ -0,0 +1,219 @@
+/**
+ * @file test_broadcast.cpp
+ * @brief Catch2 tests for BroadcastViewConstExpr (broadcast_to).
+ *
+ * Tests cover:
+ *   - row broadcast (bias vector added to every row) and column broadcast
+ *     (FusedVector scaling every row), 1-D and size-1-axis sources
+ *   - 3-D targets with leading, middle and last axes broadcast
+ *   - element access through operator()
+ *   - fusion with FMA, scalars, permuted operands and compound assignment
+ *   - reductions and comparisons over a broadcast operand
+ *
+ * Input padding is poisoned, so a broadcast that reads past a source row
+ * fails the comparison.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <limits>
+#include <type_traits>
+
+#include "config.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+#include "fused/fused_vector.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+template <typename T>
+static T poison()
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return std::numeric_limits<T>::quiet_NaN();
+    else
+        return T(1) << 20;
+}
+
+template <typename Tensor, typename T>
+static void fill_padding(Tensor &X, T v)
+{
+    using P = typename Tensor::Layout::PadPolicyType;
+    for (my_size_t s = 0; s < P::PhysicalSize / P::PaddedLastDim; ++s)
+        for (my_size_t l = P::LastDim; l < P::PaddedLastDim; ++l)
+            X.data()[s * P::PaddedLastDim + l] = v;
+}
+
+template <typename T>
+static T value_at(my_size_t n)
+{
+    return static_cast<T>(static_cast<int>((n * 7) % 23) - 11);
+}
+
+// ============================================================================
+// ROWS AND COLUMNS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Row and column broadcast in 2-D expressions", "[broadcast]", double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    constexpr my_size_t R = 7, C = 13;
+    FusedMatrix<T, R, C> X, Y;
+    FusedTensorND<T, C> bias;  // 1-D: one value per column
+    FusedMatrix<T, 1, C> bias2; // size-1 leading axis
+    FusedVector<T, R> w;        // [R, 1]: one value per row
+
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            X(i, j) = value_at<T>(i * C + j);
+    for (my_size_t j = 0; j < C; ++j)
+    {
+        bias(j) = value_at<T>(3 * j + 1);
+        bias2(0, j) = value_at<T>(5 * j + 2);
+    }
+    for (my_size_t i = 0; i < R; ++i)
+        w(i) = value_at<T>(i + 4);
+    fill_padding(X, poison<T>());
+    fill_padding(bias, poison<T>());
+    fill_padding(bias2, poison<T>());
+    fill_padding(w, poison<T>());
+
+    Y = X + bias.template broadcast_to<R, C>();
+    int bad = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            bad += Y(i, j) != X(i, j) + bias(j);
+    CHECK(bad == 0);
+
+    Y = X * w.template broadcast_to<R, C>() - bias2.template broadcast_to<R, C>();
+    bad = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            bad += Y(i, j) != X(i, j) * w(i) - bias2(0, j);
+    CHECK(bad == 0);
+
+    // Element access
+    const auto bw = w.template broadcast_to<R, C>();
+    const auto bb = bias.template broadcast_to<R, C>();
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            CHECK(bw(i, j) == w(i));
+            CHECK(bb(i, j) == bias(j));
+        }
+}
+
+TEMPLATE_TEST_CASE("3-D broadcast over leading, middle and last axes", "[broadcast]", double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    constexpr my_size_t A = 3, B = 4, C = 10;
+    FusedTensorND<T, A, B, C> X, Y;
+    FusedTensorND<T, B, C> plane; // leading axis missing
+    FusedTensorND<T, A, 1, C> mid;
+    FusedTensorND<T, A, B, 1> last;
+    FusedTensorND<T, 1, 1, 1> one;
+
+    for (my_size_t i = 0; i < A; ++i)
+        for (my_size_t j = 0; j < B; ++j)
+            for (my_size_t k = 0; k < C; ++k)
+                X(i, j, k) = value_at<T>((i * B + j) * C + k);
+    for (my_size_t j = 0; j < B; ++j)
+        for (my_size_t k = 0; k < C; ++k)
+            plane(j, k) = value_at<T>(j * C + k + 100);
+    for (my_size_t i = 0; i < A; ++i)
+        for (my_size_t k = 0; k < C; ++k)
+            mid(i, 0, k) = value_at<T>(i * C + k + 200);
+    for (my_size_t i = 0; i < A; ++i)
+        for (my_size_t j = 0; j < B; ++j)
+            last(i, j, 0) = value_at<T>(i * B + j + 300);
+    one(0, 0, 0) = T(3);
+    fill_padding(plane, poison<T>());
+    fill_padding(mid, poison<T>());
+    fill_padding(last, poison<T>());
+    fill_padding(one, poison<T>());
+
+    Y = X + plane.template broadcast_to<A, B, C>() + mid.template broadcast_to<A, B, C>() +
+        last.template broadcast_to<A, B, C>() * one.template broadcast_to<A, B, C>();
+
+    int bad = 0;
+    for (my_size_t i = 0; i < A; ++i)
+        for (my_size_t j = 0; j < B; ++j)
+            for (my_size_t k = 0; k < C; ++k)
+                bad += Y(i, j, k) != X(i, j, k) + plane(j, k) + mid(i, 0, k) + last(i, j, 0) * T(3);
+    CHECK(bad == 0);
+}
+
+// ============================================================================
+// FUSION
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Broadcast operands fuse with FMA, permuted operands and compound assignment", "[broadcast]",
+                   double, float)
+{
+    using T = TestType;
+    constexpr my_size_t R = 9, C = 6;
+    FusedMatrix<T, R, C> X, Y;
+    FusedMatrix<T, C, R> Xt;
+    FusedTensorND<T, C> gamma, beta;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            X(i, j) = value_at<T>(i * C + j);
+            Xt(j, i) = value_at<T>(2 * (i * C + j) + 1);
+        }
+    for (my_size_t j = 0; j < C; ++j)
+    {
+        gamma(j) = value_at<T>(j + 7);
+        beta(j) = value_at<T>(j + 9);
+    }
+    fill_padding(X, poison<T>());
+    fill_padding(gamma, poison<T>());
+    fill_padding(beta, poison<T>());
+
+    // Normalization step: x * gamma + beta, one fmadd per vector
+    Y = X * gamma.template broadcast_to<R, C>() + beta.template broadcast_to<R, C>();
+    int bad = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            bad += Y(i, j) != X(i, j) * gamma(j) + beta(j);
+    CHECK(bad == 0);
+
+    // Mixed with a permuted view: permuted path, logical_evalu
+    Y = Xt.transpose_view() - gamma.template broadcast_to<R, C>() * T(2);
+    bad = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            bad += Y(i, j) != Xt(j, i) - gamma(j) * T(2);
+    CHECK(bad == 0);
+
+    // In place
+    Y = X;
+    Y += beta.template broadcast_to<R, C>();
+    Y *= gamma.template broadcast_to<R, C>();
+    bad = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            bad += Y(i, j) != (X(i, j) + beta(j)) * gamma(j);
+    CHECK(bad == 0);
+}
+
+TEMPLATE_TEST_CASE("Reductions and comparisons over a broadcast operand", "[broadcast]", double, float)
+{
+    using T = TestType;
+    constexpr my_size_t R = 5, C = 11;
+    FusedVector<T, R> w;
+    FusedMatrix<T, R, C> M;
+    for (my_size_t i = 0; i < R; ++i)
+    {
+        w(i) = static_cast<T>(i + 1);
+        for (my_size_t j = 0; j < C; ++j)
+            M(i, j) = static_cast<T>(i + 1);
+    }
+    fill_padding(w, poison<T>());
+
+    CHECK(min(w.template broadcast_to<R, C>()) == T(1));
+    CHECK(max(w.template broadcast_to<R, C>()) == T(R));
+    CHECK(sum(w.template broadcast_to<R, C>()) == T(C * R * (R + 1) / 2));
+    CHECK(M == w.template broadcast_to<R, C>());
+}
@@ -0,0 +1,303 @@
+/**
+ * @file test_complex.cpp
+ * @brief Catch2 tests for Complex<T> tensors and the complex microkernels.
+ *
+ * Tests cover:
+ *   - Complex<T> scalar arithmetic, conj and norm
+ *   - Elementwise expressions with tensor and scalar operands, conj(),
+ *     row tails and transposed operands
+ *   - The complex microkernel (mul / fmadd / div / gather / scatter / masked
+ *     tails) against the scalar GENERICARCH kernel
+ *   - Complex GEMM through matmul: unrolled small, register-blocked and
+ *     packed paths, transposed operands, epilogues and gemv
+ *   - operator== with the tolerance applied to both components
+ *
+ * Entries are small Gaussian integers so every product and every summation
+ * order is exact; GEMM results are compared with ==.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <cmath>
+
+#include "config.h"
+#include "complex.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "fused/fused_matrix.h"
+#include "fused/kernel_ops/kernel_gemm.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// C = A·B for logical A[M,K], B[K,N], with op(A) = Aᵀ when A is stored K×M.
+template <typename C, my_size_t M, my_size_t K, my_size_t N, bool TransA = false>
+static void check_matmul()
+{
+    using SA = std::conditional_t<TransA, FusedMatrix<C, K, M>, FusedMatrix<C, M, K>>;
+    static SA A;
+    static FusedMatrix<C, K, N> B;
+    A.setSequencial();
+    B.setSequencial();
+    A *= C(2, 1);
+    B *= C(1, -3);
+
+    FusedMatrix<C, M, N> P;
+    if constexpr (TransA)
+        P = FusedMatrix<C, M, N>::matmul(A.transpose_view(), B);
+    else
+        P = FusedMatrix<C, M, N>::matmul(A, B);
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+        {
+            C sum{};
+            for (my_size_t k = 0; k < K; ++k)
+                sum += (TransA ? A(k, i) : A(i, k)) * B(k, j);
+            REQUIRE(P(i, j).re == Approx(sum.re));
+            REQUIRE(P(i, j).im == Approx(sum.im));
+        }
+}
+
+// ============================================================================
+// Complex<T>
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Complex: scalar arithmetic", "[complex][scalar]", double, float)
+{
+    using C = Complex<TestType>;
+    const C a(3, -2), b(-1, 4);
+
+    REQUIRE(a + b == C(2, 2));
+    REQUIRE(a - b == C(4, -6));
+    REQUIRE(a * b == C(5, 14));
+    REQUIRE((a * b) / b == a);
+    REQUIRE(-a == C(-3, 2));
+    REQUIRE(conj(a) == C(3, 2));
+    REQUIRE(norm(a) == TestType(13));
+    REQUIRE(C(2) == C(2, 0));
+    REQUIRE(a != b);
+
+    C c = a;
+    c *= b;
+    c -= a;
+    c += b;
+    REQUIRE(c == C(1, 20));
+}
+
+// ============================================================================
+// MICROKERNEL
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Complex microkernel: lanes match the scalar kernel", "[complex][microkernel]", double, float)
+{
+    using C = Complex<TestType>;
+    using K = Microkernel<C, BITS, DefaultArch>;
+    using S = Microkernel<C, 1, GENERICARCH>;
+    constexpr my_size_t W = K::simdWidth;
+
+    alignas(DATA_ALIGNAS) C a[W], b[W], c[W], out[W];
+    for (my_size_t i = 0; i < W; ++i)
+    {
+        a[i] = C(TestType(i) + 1, TestType(2) - TestType(i));
+        b[i] = C(TestType(-3) + TestType(i), TestType(i) + 2);
+        c[i] = C(TestType(5), TestType(-1) * TestType(i));
+    }
+    const auto va = K::load(a), vb = K::load(b), vc = K::load(c);
+
+    K::store(out, K::mul(va, vb));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == S::mul(a[i], b[i]));
+
+    K::store(out, K::fmadd(va, vb, vc));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == S::fmadd(a[i], b[i], c[i]));
+
+    K::store(out, K::fmsub(va, vb, vc));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == S::fmsub(a[i], b[i], c[i]));
+
+    K::store(out, K::fnmadd(va, vb, vc));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == S::fnmadd(a[i], b[i], c[i]));
+
+    K::store(out, K::fnmsub(va, vb, vc));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == S::fnmsub(a[i], b[i], c[i]));
+
+    K::store(out, K::div(K::mul(va, vb), vb));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == a[i]);
+
+    K::store(out, K::conj(va));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == conj(a[i]));
+
+    K::store(out, K::set1(C(2, -7)));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == C(2, -7));
+
+    REQUIRE(K::all_within_tolerance(va, K::add(va, K::set1(C(TestType(0.01), TestType(-0.01)))), C(TestType(0.1))));
+    REQUIRE_FALSE(K::all_within_tolerance(va, K::add(va, K::set1(C(0, 1))), C(TestType(0.1))));
+}
+
+TEMPLATE_TEST_CASE("Complex microkernel: gather, scatter and masked tails", "[complex][microkernel]", double, float)
+{
+    using C = Complex<TestType>;
+    using K = Microkernel<C, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+
+    C src[4 * W], dst[4 * W];
+    for (my_size_t i = 0; i < 4 * W; ++i)
+        src[i] = C(TestType(i), -TestType(i));
+
+    my_size_t idx[W];
+    for (my_size_t i = 0; i < W; ++i)
+        idx[i] = (3 * i + 1) % (4 * W);
+
+    C out[W];
+    K::storeu(out, K::gather(src, idx));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i] == src[idx[i]]);
+
+    for (auto &d : dst)
+        d = C{};
+    K::scatter(dst, idx, K::loadu(src));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(dst[idx[i]] == src[i]);
+
+    for (my_size_t n = 0; n <= W; ++n)
+    {
+        for (auto &d : dst)
+            d = C(-9, 9);
+        K::maskstore(dst, K::maskload(src + 1, n), n);
+        for (my_size_t i = 0; i < W; ++i)
+            REQUIRE(dst[i] == (i < n ? src[1 + i] : C(-9, 9)));
+    }
+}
+
+// ============================================================================
+// EXPRESSIONS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Complex expressions: tensor and scalar operands, row tails", "[complex][expr]", double, float)
+{
+    using T = TestType;
+    using C = Complex<T>;
+
+    FusedMatrix<C, 5, 7> A, B, R;
+    A.setSequencial();
+    B.setSequencial();
+    A *= C(2, 1);
+    B *= C(1, -3);
+    const C s(2, -1);
+
+    R = A * B + B / s - s * A;
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 7; ++j)
+        {
+            const C e = A(i, j) * B(i, j) + B(i, j) / s - s * A(i, j);
+            REQUIRE(R(i, j).re == Approx(e.re));
+            REQUIRE(R(i, j).im == Approx(e.im));
+        }
+
+    R = A + conj(B);
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 7; ++j)
+            REQUIRE(R(i, j) == A(i, j) + conj(B(i, j)));
+
+    // a·conj(a) = |a|² on the real axis
+    R = A * conj(A);
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 7; ++j)
+            REQUIRE(R(i, j) == C(norm(A(i, j))));
+
+    FusedMatrix<C, 7, 5> Rt;
+    Rt = conj(A.transpose_view()) - B.transpose_view();
+    for (my_size_t i = 0; i < 7; ++i)
+        for (my_size_t j = 0; j < 5; ++j)
+            REQUIRE(Rt(i, j) == conj(A(j, i)) - B(j, i));
+}
+
+TEMPLATE_TEST_CASE("Complex expressions: operator== compares both components", "[complex][compare]", double, float)
+{
+    using C = Complex<TestType>;
+
+    FusedMatrix<C, 5, 7> A, B;
+    A.setSequencial();
+    A *= C(2, 1);
+    B = A;
+    REQUIRE(A == B);
+
+    // A change in the imaginary part only, in the row tail and in a full vector
+    B(4, 6).im += 1;
+    REQUIRE_FALSE(A == B);
+    B = A;
+    B(0, 0).im -= 1;
+    REQUIRE(A != B);
+
+    B = A;
+    B(2, 3).re += TestType(PRECISION_TOLERANCE / 10);
+    REQUIRE(A == B);
+}
+
+// ============================================================================
+// GEMM
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Complex matmul: unrolled small path", "[complex][gemm][small]", double, float)
+{
+    check_matmul<Complex<TestType>, 2, 3, 4>();
+    check_matmul<Complex<TestType>, 5, 7, 3>();
+    check_matmul<Complex<TestType>, 8, 8, 8>();
+}
+
+TEMPLATE_TEST_CASE("Complex matmul: register-blocked path with M, N and K remainders", "[complex][gemm][register]", double, float)
+{
+    check_matmul<Complex<TestType>, 13, 17, 11>();
+    check_matmul<Complex<TestType>, 31, 9, 29>();
+    check_matmul<Complex<TestType>, 13, 17, 11, true>();
+}
+
+TEMPLATE_TEST_CASE("Complex matmul: packed path across KC / MC / NC blocks", "[complex][gemm][packed]", double, float)
+{
+    check_matmul<Complex<TestType>, 150, 140, 130>();
+    check_matmul<Complex<TestType>, 67, 131, 70, true>();
+}
+
+TEMPLATE_TEST_CASE("Complex matmul: matrix-vector products", "[complex][gemm][gemv]", double, float)
+{
+    check_matmul<Complex<TestType>, 19, 23, 1>();
+    check_matmul<Complex<TestType>, 1, 23, 19>();
+    check_matmul<Complex<TestType>, 19, 23, 1, true>();
+}
+
+TEMPLATE_TEST_CASE("Complex matmul: epilogue alpha · A·B + beta · C", "[complex][gemm][epilogue]", double, float)
+{
+    using C = Complex<TestType>;
+    constexpr my_size_t M = 11, K = 6, N = 13;
+
+    FusedMatrix<C, M, K> A;
+    FusedMatrix<C, K, N> B;
+    FusedMatrix<C, M, N> Y, Y0;
+    A.setSequencial();
+    B.setSequencial();
+    Y0.setSequencial();
+    A *= C(2, 1);
+    B *= C(1, -3);
+    Y0 *= C(-1, 2);
+    Y = Y0;
+
+    const C alpha(0, 1), beta(2, -1);
+    Y.matmul_update(A, B, GemmEpilogue<C>{}.scale(alpha, beta));
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+        {
+            C sum{};
+            for (my_size_t k = 0; k < K; ++k)
+                sum += A(i, k) * B(k, j);
+            REQUIRE(Y(i, j) == alpha * sum + beta * Y0(i, j));
+        }
+}
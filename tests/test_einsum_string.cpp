@@ -0,0 +1,427 @@
+/**
+ * @file test_einsum_string.cpp
+ * @brief Catch2 tests for the compile-time string einsum (fused/einsum.h).
+ *
+ * Tests cover:
+ *   - Plain GEMM with operands and output used in place
+ *   - Transposed operands (read in place) and permuted outputs
+ *   - Shared batch axes, multiple contracted axes, sum-only axes
+ *   - GEMV (plain, transposed, batched), outer product and rank-0 (scalar) results
+ *   - Implicit output subscripts
+ *   - Views and lazy expressions as operands
+ *   - Result types deduced from the subscripts
+ */
+
+#include <catch_amalgamated.hpp>
+
+#include "config.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+#include "fused/einsum.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// RESULT TYPES
+// ============================================================================
+
+TEST_CASE("einsum<>: result types follow the subscripts", "[einsum][string][types]")
+{
+    FusedTensorND<double, 2, 3, 4> A;
+    FusedTensorND<double, 2, 4, 5> B;
+    FusedTensorND<double, 3, 4> M;
+    FusedTensorND<double, 4, 5> N;
+
+    STATIC_REQUIRE(is_same_v<decltype(einsum<"bij,bjk->bik">(A, B)), FusedTensorND<double, 2, 3, 5>>);
+    STATIC_REQUIRE(is_same_v<decltype(einsum<"bij,bjk->kib">(A, B)), FusedTensorND<double, 5, 3, 2>>);
+    STATIC_REQUIRE(is_same_v<decltype(einsum<"ij,jk">(M, N)), FusedTensorND<double, 3, 5>>);
+    STATIC_REQUIRE(is_same_v<decltype(einsum<"ij,ij->">(M, M)), double>);
+}
+
+// ============================================================================
+// 2-D: ALL TRANSPOSE COMBINATIONS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("einsum<>: 2-D products match the runtime-axis einsum", "[einsum][string][gemm]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 5, 7> A;
+    FusedTensorND<T, 7, 6> B;
+    FusedTensorND<T, 6, 7> Bt;
+    FusedTensorND<T, 7, 5> At;
+    A.setSequencial();
+    B.setSequencial();
+    Bt.setSequencial();
+    At.setSequencial();
+
+    SECTION("ij,jk->ik (in place)")
+    {
+        auto C = einsum<"ij,jk->ik">(A, B);
+        auto R = FusedTensorND<T, 5, 6>::einsum(A, B, 1, 0);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 6; ++j)
+                REQUIRE(C(i, j) == Approx(R(i, j)));
+    }
+
+    SECTION("ik,jk->ij (B transposed)")
+    {
+        auto C = einsum<"ik,jk->ij">(A, Bt);
+        auto R = FusedTensorND<T, 5, 6>::einsum(A, Bt, 1, 1);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 6; ++j)
+                REQUIRE(C(i, j) == Approx(R(i, j)));
+    }
+
+    SECTION("ki,kj->ij (A transposed)")
+    {
+        auto C = einsum<"ki,kj->ij">(At, B);
+        auto R = FusedTensorND<T, 5, 6>::einsum(At, B, 0, 0);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 6; ++j)
+                REQUIRE(C(i, j) == Approx(R(i, j)));
+    }
+
+    SECTION("ij,jk->ki (output transposed)")
+    {
+        auto C = einsum<"ij,jk->ki">(A, B);
+        auto R = FusedTensorND<T, 5, 6>::einsum(A, B, 1, 0);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 6; ++j)
+                REQUIRE(C(j, i) == Approx(R(i, j)));
+    }
+
+    SECTION("implicit output: ij,jk")
+    {
+        auto C = einsum<"ij,jk">(A, B);
+        auto R = FusedTensorND<T, 5, 6>::einsum(A, B, 1, 0);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 6; ++j)
+                REQUIRE(C(i, j) == Approx(R(i, j)));
+    }
+}
+
+// ============================================================================
+// BATCH AND MULTI-AXIS CONTRACTIONS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("einsum<>: shared batch axis bij,bjk->bik", "[einsum][string][batched]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 3, 5, 7> A;
+    FusedTensorND<T, 3, 7, 6> B;
+    A.setSequencial();
+    B.setSequencial();
+
+    auto C = einsum<"bij,bjk->bik">(A, B);
+
+    for (my_size_t b = 0; b < 3; ++b)
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t k = 0; k < 6; ++k)
+            {
+                T ref = T{0};
+                for (my_size_t j = 0; j < 7; ++j)
+                    ref += A(b, i, j) * B(b, j, k);
+                REQUIRE(C(b, i, k) == Approx(ref));
+            }
+}
+
+TEMPLATE_TEST_CASE("einsum<>: batched transposed operands read in place", "[einsum][string][batched][transposed]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 3, 5, 7> Q;  // b i k
+    FusedTensorND<T, 3, 6, 7> Kt; // b j k
+    FusedTensorND<T, 3, 7, 5> Qt; // b k i
+    Q.setSequencial();
+    Kt.setSequencial();
+    Qt.setSequencial();
+
+    constexpr auto P_nt = detail::make_einsum_plan<"bik,bjk->bij", decltype(Q), decltype(Kt)>();
+    constexpr auto P_tt = detail::make_einsum_plan<"bki,bjk->bij", decltype(Qt), decltype(Kt)>();
+    STATIC_REQUIRE((P_nt.a_direct && P_nt.b_trans));
+    STATIC_REQUIRE((P_tt.a_trans && P_tt.b_trans));
+
+    SECTION("bik,bjk->bij (B transposed)")
+    {
+        auto C = einsum<"bik,bjk->bij">(Q, Kt);
+        for (my_size_t b = 0; b < 3; ++b)
+            for (my_size_t i = 0; i < 5; ++i)
+                for (my_size_t j = 0; j < 6; ++j)
+                {
+                    T ref = T{0};
+                    for (my_size_t k = 0; k < 7; ++k)
+                        ref += Q(b, i, k) * Kt(b, j, k);
+                    REQUIRE(C(b, i, j) == Approx(ref));
+                }
+    }
+
+    SECTION("bki,bjk->bij (both transposed)")
+    {
+        auto C = einsum<"bki,bjk->bij">(Qt, Kt);
+        for (my_size_t b = 0; b < 3; ++b)
+            for (my_size_t i = 0; i < 5; ++i)
+                for (my_size_t j = 0; j < 6; ++j)
+                {
+                    T ref = T{0};
+                    for (my_size_t k = 0; k < 7; ++k)
+                        ref += Qt(b, k, i) * Kt(b, j, k);
+                    REQUIRE(C(b, i, j) == Approx(ref));
+                }
+    }
+}
+
+TEMPLATE_TEST_CASE("einsum<>: batch axis in non-leading position", "[einsum][string][batched]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 5, 3, 7> A; // i b j
+    FusedTensorND<T, 7, 3, 6> B; // j b k
+    A.setSequencial();
+    B.setSequencial();
+
+    auto C = einsum<"ibj,jbk->kbi">(A, B);
+
+    for (my_size_t b = 0; b < 3; ++b)
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t k = 0; k < 6; ++k)
+            {
+                T ref = T{0};
+                for (my_size_t j = 0; j < 7; ++j)
+                    ref += A(i, b, j) * B(j, b, k);
+                REQUIRE(C(k, b, i) == Approx(ref));
+            }
+}
+
+TEMPLATE_TEST_CASE("einsum<>: two contracted axes ijk,jkl->il", "[einsum][string][multi]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 4, 3, 5> A;
+    FusedTensorND<T, 3, 5, 6> B;
+    A.setSequencial();
+    B.setSequencial();
+
+    auto C = einsum<"ijk,jkl->il">(A, B);
+
+    for (my_size_t i = 0; i < 4; ++i)
+        for (my_size_t l = 0; l < 6; ++l)
+        {
+            T ref = T{0};
+            for (my_size_t j = 0; j < 3; ++j)
+                for (my_size_t k = 0; k < 5; ++k)
+                    ref += A(i, j, k) * B(j, k, l);
+            REQUIRE(C(i, l) == Approx(ref));
+        }
+}
+
+TEMPLATE_TEST_CASE("einsum<>: batched A against shared weights bij,jk->bik", "[einsum][string][batched]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 2, 5, 9> A;
+    FusedTensorND<T, 9, 7> W;
+    A.setSequencial();
+    W.setSequencial();
+
+    auto C = einsum<"bij,jk->bik">(A, W);
+    auto R = FusedTensorND<T, 2, 5, 7>::einsum(A, W, 2, 0);
+
+    for (my_size_t b = 0; b < 2; ++b)
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t k = 0; k < 7; ++k)
+                REQUIRE(C(b, i, k) == Approx(R(b, i, k)));
+}
+
+// ============================================================================
+// REDUCTIONS, GEMV, OUTER AND SCALAR RESULTS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("einsum<>: sum-only axis ij,jk->i", "[einsum][string][reduction]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 5, 7> A;
+    FusedTensorND<T, 7, 6> B;
+    A.setSequencial();
+    B.setSequencial();
+
+    auto c = einsum<"ij,jk->i">(A, B);
+
+    for (my_size_t i = 0; i < 5; ++i)
+    {
+        T ref = T{0};
+        for (my_size_t j = 0; j < 7; ++j)
+            for (my_size_t k = 0; k < 6; ++k)
+                ref += A(i, j) * B(j, k);
+        REQUIRE(c(i) == Approx(ref));
+    }
+}
+
+TEMPLATE_TEST_CASE("einsum<>: GEMV, outer product and dot", "[einsum][string][gemv]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 5, 7> A;
+    FusedTensorND<T, 5, 7> B;
+    FusedTensorND<T, 7> x;
+    FusedTensorND<T, 5> y;
+    A.setSequencial();
+    B.setSequencial();
+    x.setSequencial();
+    y.setSequencial();
+
+    SECTION("ij,j->i")
+    {
+        auto r = einsum<"ij,j->i">(A, x);
+        for (my_size_t i = 0; i < 5; ++i)
+        {
+            T ref = T{0};
+            for (my_size_t j = 0; j < 7; ++j)
+                ref += A(i, j) * x(j);
+            REQUIRE(r(i) == Approx(ref));
+        }
+    }
+
+    SECTION("i,ij->j")
+    {
+        auto r = einsum<"i,ij->j">(y, A);
+        for (my_size_t j = 0; j < 7; ++j)
+        {
+            T ref = T{0};
+            for (my_size_t i = 0; i < 5; ++i)
+                ref += y(i) * A(i, j);
+            REQUIRE(r(j) == Approx(ref));
+        }
+    }
+
+    SECTION("ji,j->i and j,ji->i (matrix stored transposed)")
+    {
+        FusedTensorND<T, 7, 5> At;
+        At.setSequencial();
+        auto r = einsum<"ji,j->i">(At, x);
+        auto s = einsum<"j,ji->i">(x, At);
+        for (my_size_t i = 0; i < 5; ++i)
+        {
+            T ref = T{0};
+            for (my_size_t j = 0; j < 7; ++j)
+                ref += At(j, i) * x(j);
+            REQUIRE(r(i) == Approx(ref));
+            REQUIRE(s(i) == Approx(ref));
+        }
+    }
+
+    SECTION("bij,bj->bi and bi,bij->bj (batched)")
+    {
+        FusedTensorND<T, 3, 5, 7> Ab;
+        FusedTensorND<T, 3, 7> xb;
+        FusedTensorND<T, 3, 5> yb;
+        Ab.setSequencial();
+        xb.setSequencial();
+        yb.setSequencial();
+        auto r = einsum<"bij,bj->bi">(Ab, xb);
+        auto s = einsum<"bi,bij->bj">(yb, Ab);
+        for (my_size_t b = 0; b < 3; ++b)
+        {
+            for (my_size_t i = 0; i < 5; ++i)
+            {
+                T ref = T{0};
+                for (my_size_t j = 0; j < 7; ++j)
+                    ref += Ab(b, i, j) * xb(b, j);
+                REQUIRE(r(b, i) == Approx(ref));
+            }
+            for (my_size_t j = 0; j < 7; ++j)
+            {
+                T ref = T{0};
+                for (my_size_t i = 0; i < 5; ++i)
+                    ref += yb(b, i) * Ab(b, i, j);
+                REQUIRE(s(b, j) == Approx(ref));
+            }
+        }
+    }
+
+    SECTION("i,j->ij")
+    {
+        auto r = einsum<"i,j->ij">(y, x);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 7; ++j)
+                REQUIRE(r(i, j) == Approx(y(i) * x(j)));
+    }
+
+    SECTION("ij,ij-> (Frobenius inner product)")
+    {
+        T ref = T{0};
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 7; ++j)
+                ref += A(i, j) * B(i, j);
+        REQUIRE(einsum<"ij,ij->">(A, B) == Approx(ref));
+    }
+}
+
+// ============================================================================
+// VIEWS AND EXPRESSIONS AS OPERANDS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("einsum<>: views and lazy expressions", "[einsum][string][views]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 6, 5> At;
+    FusedMatrix<T, 6, 4> B;
+    At.setSequencial();
+    B.setSequencial();
+
+    SECTION("transpose_view operand")
+    {
+        auto C = einsum<"ij,jk->ik">(At.transpose_view(), B);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t k = 0; k < 4; ++k)
+            {
+                T ref = T{0};
+                for (my_size_t j = 0; j < 6; ++j)
+                    ref += At(j, i) * B(j, k);
+                REQUIRE(C(i, k) == Approx(ref));
+            }
+    }
+
+    SECTION("binary expression operand")
+    {
+        auto C = einsum<"ji,jk->ik">(At + At, B);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t k = 0; k < 4; ++k)
+            {
+                T ref = T{0};
+                for (my_size_t j = 0; j < 6; ++j)
+                    ref += T(2) * At(j, i) * B(j, k);
+                REQUIRE(C(i, k) == Approx(ref));
+            }
+    }
+}
+
+// ============================================================================
+// LARGE: PACKED GEMM THROUGH THE STRING API
+// ============================================================================
+
+TEMPLATE_TEST_CASE("einsum<>: large batched product", "[einsum][string][batched][packed]", double, float)
+{
+    using T = TestType;
+
+    static FusedTensorND<T, 2, 130, 140> A;
+    static FusedTensorND<T, 2, 140, 120> B;
+    A.setSequencial();
+    B.setSequencial();
+
+    static FusedTensorND<T, 2, 130, 120> C;
+    C = einsum<"bij,bjk->bik">(A, B);
+
+    for (my_size_t b = 0; b < 2; ++b)
+        for (my_size_t i = 0; i < 130; i += 11)
+            for (my_size_t k = 0; k < 120; ++k)
+            {
+                T ref = T{0};
+                for (my_size_t j = 0; j < 140; ++j)
+                    ref += A(b, i, j) * B(b, j, k);
+                REQUIRE(C(b, i, k) == Approx(ref));
+            }
+}
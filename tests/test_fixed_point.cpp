@@ -0,0 +1,488 @@
+/**
+ * @file test_fixed_point.cpp
+ * @brief Catch2 tests for the Q15 / Q31 fixed-point types and their microkernel.
+ *
+ * Tests cover:
+ *   - Scalar arithmetic: conversion and saturation, saturating add / sub /
+ *     negate, rounding multiply, rounding divide and division by zero
+ *   - The 64-bit microkernel: every operation matches the scalar operator
+ *     bit for bit (division within one LSB for Q15)
+ *   - The packed Q15 kernel: lanewise operations, the pair layout and the
+ *     dual multiply-accumulate, exact across −1 · −1
+ *   - Elementwise expressions with tensor and scalar operands, saturated
+ *     once at the store
+ *   - sum / min / max and operator==
+ *   - GEMM, gemv and transposed products accumulating in 64 bits and
+ *     rounding once per element
+ *
+ * The fused kernel is the same portable integer code on every arch, so
+ * these tests run the MCU path on the host; build with
+ * -DTESSERACT_FIXED_POINT_PACKED to run them on the packed Q15 kernel.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <cmath>
+#include <type_traits>
+
+#include "config.h"
+#include "fixed_point.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "fused/fused_matrix.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// Raw values spread over the whole range, extremes included.
+template <typename Q>
+static typename Q::raw_type raw_sample(unsigned n)
+{
+    using R = typename Q::raw_type;
+    if (n == 0)
+        return static_cast<R>(Q::raw_min);
+    if (n == 1)
+        return static_cast<R>(Q::raw_max);
+    if (n == 2)
+        return R(0);
+    unsigned long long s = n * 0x9E3779B97F4A7C15ull;
+    s ^= s >> 29;
+    return static_cast<R>(static_cast<long long>(s >> (64 - 8 * sizeof(R))) + Q::raw_min);
+}
+
+template <typename Q, my_size_t R, my_size_t C>
+static void fill(FusedMatrix<Q, R, C> &X, my_size_t seed, double amplitude = 0.9)
+{
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            X(i, j) = Q(amplitude * std::sin(0.7 * static_cast<double>(i * C + j) + static_cast<double>(seed)));
+}
+
+/// One a·b term in the kernel's 64-bit format: exact for Q15 (Q30), rounded to Q31 for Q31.
+template <typename Q>
+static long long wide_product(Q a, Q b)
+{
+    const long long p = static_cast<long long>(a.raw) * b.raw;
+    if constexpr (Q::frac_bits == 15)
+        return p;
+    else
+        return (p >> 31) + ((p >> 30) & 1);
+}
+
+/// A sum of wide_product terms, rounded once to Q (the reference for a 64-bit accumulator).
+template <typename Q>
+static Q round_products(long long wide_sum)
+{
+    if constexpr (Q::frac_bits == 15)
+        return Q::saturate((wide_sum >> 15) + ((wide_sum >> 14) & 1));
+    else
+        return Q::saturate(wide_sum);
+}
+
+/// Q runs on the packed Q15 kernel (TESSERACT_FIXED_POINT_PACKED), which saturates every operation.
+template <typename Q>
+inline constexpr bool packed_kernel = std::is_base_of_v<FixedPointQ15x2Microkernel, Microkernel<Q, BITS, DefaultArch>>;
+
+// ============================================================================
+// SCALAR ARITHMETIC
+// ============================================================================
+
+TEMPLATE_TEST_CASE("FixedPoint: conversion rounds to nearest and saturates", "[fixed][scalar]", Q15, Q31)
+{
+    using Q = TestType;
+    constexpr double lsb = 1.0 / static_cast<double>(1LL << Q::frac_bits);
+
+    CHECK(Q(0.5).raw == (1LL << (Q::frac_bits - 1)));
+    CHECK(Q(-1.0).raw == Q::raw_min);
+    CHECK(Q(1.0).raw == Q::raw_max);
+    CHECK(Q(-3.0).raw == Q::raw_min);
+    CHECK(Q(7.5).raw == Q::raw_max);
+    CHECK(Q(0.0).raw == 0);
+    CHECK(Q{0}.raw == 0);
+
+    CHECK(Q(0.49 * lsb).raw == 0);
+    CHECK(Q(0.51 * lsb).raw == 1);
+    CHECK(Q(-0.51 * lsb).raw == -1);
+
+    CHECK(static_cast<double>(Q(0.25)) == 0.25);
+    CHECK(static_cast<double>(Q(-0.3)) == Catch::Approx(-0.3).margin(lsb));
+    CHECK(static_cast<float>(NumericLimits<Q>::lowest()) == -1.0f);
+    CHECK(NumericLimits<Q>::max().raw == Q::raw_max);
+}
+
+TEMPLATE_TEST_CASE("FixedPoint: add, subtract and negate saturate", "[fixed][scalar]", Q15, Q31)
+{
+    using Q = TestType;
+    const Q max = NumericLimits<Q>::max(), min = NumericLimits<Q>::lowest();
+
+    CHECK((Q(0.25) + Q(0.5)) == Q(0.75));
+    CHECK((Q(0.75) + Q(0.5)) == max);
+    CHECK((Q(-0.75) - Q(0.5)) == min);
+    CHECK((Q(-0.75) + Q(0.5)) == Q(-0.25));
+    CHECK(-min == max);
+    CHECK(-Q(0.5) == Q(-0.5));
+
+    Q acc = Q(0.9);
+    acc += Q(0.9);
+    CHECK(acc == max);
+    acc -= Q(0.5);
+    CHECK(acc == Q::from_raw(static_cast<typename Q::raw_type>(Q::raw_max - Q(0.5).raw)));
+}
+
+TEMPLATE_TEST_CASE("FixedPoint: multiply rounds to nearest, −1 · −1 saturates", "[fixed][scalar]", Q15, Q31)
+{
+    using Q = TestType;
+    using R = typename Q::raw_type;
+
+    CHECK((Q(0.5) * Q(0.5)) == Q(0.25));
+    CHECK((Q(-0.5) * Q(0.5)) == Q(-0.25));
+    CHECK((NumericLimits<Q>::lowest() * NumericLimits<Q>::lowest()) == NumericLimits<Q>::max());
+
+    // 3 · 2^-F · 0.5 = 1.5 LSB → 2 (ties up), −1.5 LSB → −1
+    CHECK((Q::from_raw(R(3)) * Q(0.5)).raw == 2);
+    CHECK((Q::from_raw(R(-3)) * Q(0.5)).raw == -1);
+    CHECK((Q::from_raw(R(1)) * Q(0.25)).raw == 0);
+}
+
+TEMPLATE_TEST_CASE("FixedPoint: divide rounds and saturates, x / 0 is ±max", "[fixed][scalar]", Q15, Q31)
+{
+    using Q = TestType;
+    const Q max = NumericLimits<Q>::max(), min = NumericLimits<Q>::lowest();
+
+    CHECK((Q(0.25) / Q(0.5)) == Q(0.5));
+    CHECK((Q(-0.25) / Q(0.5)) == Q(-0.5));
+    CHECK((Q(0.5) / Q(0.25)) == max);
+    CHECK((Q(-0.5) / Q(0.25)) == min);
+    CHECK((Q(0.3) / Q(0.0)) == max);
+    CHECK((Q(-0.3) / Q(0.0)) == min);
+    CHECK((Q(0.0) / Q(0.0)) == Q(0.0));
+    CHECK(static_cast<double>(Q(0.1) / Q(0.3)) == Catch::Approx(1.0 / 3.0).margin(1e-4));
+}
+
+// ============================================================================
+// MICROKERNEL
+// ============================================================================
+
+TEMPLATE_TEST_CASE("FixedPoint microkernel: single operations match the scalar operators", "[fixed][microkernel]", Q15, Q31)
+{
+    using Q = TestType;
+    using K = Microkernel<Q, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+    STATIC_REQUIRE((W == 1 || packed_kernel<Q>));
+
+    int add_bad = 0, sub_bad = 0, mul_bad = 0, div_bad = 0, fma_bad = 0;
+    for (unsigned n = 0; n < 4000; ++n)
+    {
+        Q a[W], b[W], c[W];
+        for (my_size_t l = 0; l < W; ++l)
+        {
+            a[l] = Q::from_raw(raw_sample<Q>(n + 4000 * l));
+            b[l] = Q::from_raw(raw_sample<Q>((n + 4000 * l) * 7 + 3));
+            c[l] = Q::from_raw(raw_sample<Q>((n + 4000 * l) * 13 + 5));
+        }
+        const auto va = K::loadu(a), vb = K::loadu(b), vc = K::loadu(c);
+
+        Q sum[W], diff[W], prod[W], quot[W], fma[W];
+        K::storeu(sum, K::add(va, vb));
+        K::storeu(diff, K::sub(va, vb));
+        K::storeu(prod, K::mul(va, vb));
+        K::storeu(quot, K::div(va, vb));
+        K::storeu(fma, K::fmadd(va, vb, vc));
+
+        for (my_size_t l = 0; l < W; ++l)
+        {
+            add_bad += sum[l] != a[l] + b[l];
+            sub_bad += diff[l] != a[l] - b[l];
+            mul_bad += prod[l] != a[l] * b[l];
+
+            // Q15 divides in Q30 and rounds again at the store: one LSB at most
+            const long long d = static_cast<long long>(quot[l].raw) - (a[l] / b[l]).raw;
+            div_bad += (d < -1 || d > 1) || (Q::frac_bits == 31 && d != 0);
+
+            // The wide kernel rounds the product once and saturates the sum
+            // once: a·b + c in exact arithmetic lies within half an LSB.
+            // The packed kernel saturates both steps, as the scalar operators.
+            if constexpr (packed_kernel<Q>)
+                fma_bad += fma[l] != a[l] * b[l] + c[l];
+            else
+            {
+                const double exact = static_cast<double>(a[l] * b[l]) + static_cast<double>(c[l]);
+                const double lsb = 1.0 / static_cast<double>(1LL << Q::frac_bits);
+                const double clamped = exact < -1.0 ? -1.0 : (exact > 1.0 - lsb ? 1.0 - lsb : exact);
+                fma_bad += std::fabs(static_cast<double>(fma[l]) - clamped) > 0.5 * lsb;
+            }
+        }
+    }
+    CHECK(add_bad == 0);
+    CHECK(sub_bad == 0);
+    CHECK(mul_bad == 0);
+    CHECK(div_bad == 0);
+    CHECK(fma_bad == 0);
+}
+
+TEMPLATE_TEST_CASE("FixedPoint microkernel: masked loads, gather / scatter and tolerance", "[fixed][microkernel]", Q15, Q31)
+{
+    using Q = TestType;
+    using K = Microkernel<Q, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+
+    const Q src[4] = {Q(0.1), Q(-0.2), Q(0.3), Q(-0.4)};
+    Q dst[4] = {};
+    my_size_t idx[W];
+    for (my_size_t l = 0; l < W; ++l)
+        idx[l] = 2 + l;
+
+    Q out[W];
+    for (my_size_t l = 0; l < W; ++l)
+        out[l] = Q(0.7);
+    K::storeu(out, K::maskload(src, 0));
+    CHECK(out[0] == Q(0.0));
+    CHECK(out[W - 1] == Q(0.0));
+    K::maskstore(out, K::maskload(src + 1, 1), 0);
+    CHECK(out[0] == Q(0.0));
+    K::storeu(out, K::maskload(src + 1, 1));
+    CHECK(out[W - 1] == (W == 1 ? Q(-0.2) : Q(0.0)));
+    K::maskstore(out, K::set1(Q(0.6)), 1);
+    CHECK(out[0] == Q(0.6));
+    CHECK(out[W - 1] == (W == 1 ? Q(0.6) : Q(0.0)));
+
+    K::scatter(dst, idx, K::gather(src, idx));
+    CHECK(dst[2] == Q(0.3));
+    CHECK(dst[3] == (W == 1 ? Q(0.0) : Q(-0.4)));
+    CHECK(dst[0] == Q(0.0));
+
+    CHECK(K::all_within_tolerance(K::set1(Q(0.5)), K::set1(Q(0.5001)), Q(0.001)));
+    CHECK_FALSE(K::all_within_tolerance(K::set1(Q(0.5)), K::set1(Q(0.51)), Q(0.001)));
+}
+
+TEST_CASE("Packed Q15 microkernel: lanewise operations, pair layout and dual MAC", "[fixed][microkernel]")
+{
+    using K = FixedPointQ15x2Microkernel;
+    using P = K::VecType;
+
+    int lane_bad = 0, mac_bad = 0;
+    long long acc = 0, ref = 0;
+    for (unsigned n = 0; n < 4000; ++n)
+    {
+        const Q15 a0 = Q15::from_raw(raw_sample<Q15>(n)), a1 = Q15::from_raw(raw_sample<Q15>(n * 3 + 1));
+        const Q15 b0 = Q15::from_raw(raw_sample<Q15>(n * 7 + 3)), b1 = Q15::from_raw(raw_sample<Q15>(n * 11 + 2));
+        const P a = K::lanes(a0, a1), b = K::lanes(b0, b1);
+
+        const auto lanes_are = [&](P v, Q15 lo, Q15 hi)
+        { lane_bad += v.lo() != lo || v.hi() != hi; };
+        lanes_are(K::add(a, b), a0 + b0, a1 + b1);
+        lanes_are(K::sub(a, b), a0 - b0, a1 - b1);
+        lanes_are(K::mul(a, b), a0 * b0, a1 * b1);
+        lanes_are(K::div(a, b), a0 / b0, a1 / b1);
+        lanes_are(K::min(a, b), a0 < b0 ? a0 : b0, a1 < b1 ? a1 : b1);
+        lanes_are(K::max(a, b), a0 > b0 ? a0 : b0, a1 > b1 ? a1 : b1);
+        lanes_are(K::abs(a), a0 < Q15{} ? -a0 : a0, a1 < Q15{} ? -a1 : a1);
+
+        // Exact Q30 products, −1 · −1 included: no 32-bit wrap
+        acc = K::mac(acc, a, b);
+        ref += static_cast<long long>(a0.raw) * b0.raw + static_cast<long long>(a1.raw) * b1.raw;
+        mac_bad += acc != ref;
+    }
+    CHECK(lane_bad == 0);
+    CHECK(mac_bad == 0);
+    CHECK(K::round_acc(ref) == round_products<Q15>(ref));
+
+    // Lane 0 in the low halfword: a q15_t pair in memory
+    const Q15 pair[2] = {Q15(0.25), Q15(-0.5)};
+    const P v = K::loadu(pair);
+    CHECK(v.v == ((static_cast<unsigned int>(static_cast<unsigned short>(Q15(-0.5).raw)) << 16) |
+                  static_cast<unsigned short>(Q15(0.25).raw)));
+    CHECK(v.lo() == Q15(0.25));
+    CHECK(v.hi() == Q15(-0.5));
+
+    // Broadcast in, lane 0 out: scalar code through the kernel slot
+    const P one = Q15(0.125);
+    CHECK(one.hi() == Q15(0.125));
+    CHECK(static_cast<Q15>(one) == Q15(0.125));
+
+    const P big = K::set1(NumericLimits<Q15>::max());
+    CHECK(K::add(big, big).lo() == NumericLimits<Q15>::max());
+    CHECK(K::sub(K::set1(NumericLimits<Q15>::lowest()), big).hi() == NumericLimits<Q15>::lowest());
+}
+
+// ============================================================================
+// EXPRESSIONS AND REDUCTIONS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("FixedPoint expressions: tensor and scalar operands", "[fixed][expr]", Q15, Q31)
+{
+    using Q = TestType;
+    FusedMatrix<Q, 5, 7> A, B, C;
+    // Small enough that the scalar reference chain never saturates
+    fill(A, 1, 0.4);
+    fill(B, 2, 0.3);
+
+    C = A * B + A - B;
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 7; ++j)
+        {
+            const Q ref = A(i, j) * B(i, j) + A(i, j) - B(i, j);
+            CHECK(std::abs(static_cast<long long>(C(i, j).raw) - ref.raw) <= 1);
+        }
+
+    C = A * Q(0.5) - Q(0.25);
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 7; ++j)
+            CHECK(C(i, j) == A(i, j) * Q(0.5) - Q(0.25));
+
+    C = A / (B + Q(0.6));
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 7; ++j)
+            CHECK(std::abs(static_cast<long long>(C(i, j).raw) - (A(i, j) / (B(i, j) + Q(0.6))).raw) <= 1);
+}
+
+TEMPLATE_TEST_CASE("FixedPoint expressions: saturation at the store, or per operation when packed", "[fixed][expr]", Q15, Q31)
+{
+    using Q = TestType;
+    FusedMatrix<Q, 3, 4> A, B, C;
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 4; ++j)
+        {
+            A(i, j) = Q(0.8);
+            B(i, j) = Q(-0.9);
+        }
+
+    // 0.8 + 0.8 − 0.8: the scalar chain clips at 1 first, the wide kernel
+    // does not; the packed one clips as the scalar chain does
+    C = A + A - A;
+    CHECK((A(1, 2) + A(1, 2) - A(1, 2)) != Q(0.8));
+    if constexpr (packed_kernel<Q>)
+        CHECK(C(1, 2) == A(1, 2) + A(1, 2) - A(1, 2));
+    else
+        CHECK(C(1, 2) == Q(0.8));
+
+    // Out of range at the end: saturated
+    C = A - B;
+    CHECK(C(0, 0) == NumericLimits<Q>::max());
+    C = B - A;
+    CHECK(C(2, 3) == NumericLimits<Q>::lowest());
+}
+
+TEMPLATE_TEST_CASE("FixedPoint reductions: sum, min, max and operator==", "[fixed][reduce]", Q15, Q31)
+{
+    using Q = TestType;
+    FusedMatrix<Q, 6, 9> A;
+    // Partial sums past ±1 are kept by the wide kernel; the packed one
+    // saturates each add, in its own order, so its input keeps them in range
+    fill(A, 3, packed_kernel<Q> ? 0.015 : 0.3);
+
+    long long raw_sum = 0;
+    Q mn = NumericLimits<Q>::max(), mx = NumericLimits<Q>::lowest();
+    for (my_size_t i = 0; i < 6; ++i)
+        for (my_size_t j = 0; j < 9; ++j)
+        {
+            raw_sum += A(i, j).raw;
+            mn = A(i, j) < mn ? A(i, j) : mn;
+            mx = A(i, j) > mx ? A(i, j) : mx;
+        }
+
+    CHECK(sum(A) == Q::saturate(raw_sum));
+    CHECK(min(A) == mn);
+    CHECK(max(A) == mx);
+
+    FusedMatrix<Q, 6, 9> B = A;
+    CHECK(A == B);
+    B(4, 5) = B(4, 5) + Q(0.01);
+    CHECK_FALSE(A == B);
+}
+
+// ============================================================================
+// GEMM
+// ============================================================================
+
+TEMPLATE_TEST_CASE("FixedPoint matmul: 64-bit accumulation, rounded once", "[fixed][gemm]", Q15, Q31)
+{
+    using Q = TestType;
+
+    // Partial sums run far past ±1 before cancelling: a Q-typed running sum
+    // would clip at 2.43 and end at 0.81 instead of 0.
+    FusedMatrix<Q, 1, 6> a;
+    FusedMatrix<Q, 6, 1> b;
+    for (my_size_t k = 0; k < 6; ++k)
+    {
+        a(0, k) = Q(k < 3 ? 0.9 : -0.9);
+        b(k, 0) = Q(0.9);
+    }
+    auto d = FusedMatrix<Q, 1, 1>::matmul(a, b);
+    CHECK(d(0, 0) == Q(0.0));
+
+    FusedMatrix<Q, 4, 600> X;
+    FusedMatrix<Q, 600, 3> Y;
+    fill(X, 4, 0.05);
+    fill(Y, 5, 0.05);
+    auto P = FusedMatrix<Q, 4, 3>::matmul(X, Y);
+    for (my_size_t i = 0; i < 4; ++i)
+        for (my_size_t j = 0; j < 3; ++j)
+        {
+            long long s = 0;
+            for (my_size_t k = 0; k < 600; ++k)
+                s += wide_product(X(i, k), Y(k, j));
+            CHECK(P(i, j) == round_products<Q>(s));
+        }
+}
+
+TEMPLATE_TEST_CASE("FixedPoint matmul: small, register-blocked, transposed and gemv", "[fixed][gemm]", Q15, Q31)
+{
+    using Q = TestType;
+
+    const auto check_product = [](const auto &P, const auto &A, const auto &B, my_size_t M, my_size_t Kd, my_size_t N)
+    {
+        int bad = 0;
+        for (my_size_t i = 0; i < M; ++i)
+            for (my_size_t j = 0; j < N; ++j)
+            {
+                long long s = 0;
+                for (my_size_t k = 0; k < Kd; ++k)
+                    s += wide_product<Q>(A(i, k), B(k, j));
+                bad += P(i, j) != round_products<Q>(s);
+            }
+        return bad;
+    };
+
+    SECTION("small unrolled 5 × 7 · 7 × 4")
+    {
+        FusedMatrix<Q, 5, 7> A;
+        FusedMatrix<Q, 7, 4> B;
+        fill(A, 6, 0.4);
+        fill(B, 7, 0.4);
+        CHECK(check_product(FusedMatrix<Q, 5, 4>::matmul(A, B), A, B, 5, 7, 4) == 0);
+    }
+
+    SECTION("register-blocked 13 × 21 · 21 × 11")
+    {
+        FusedMatrix<Q, 13, 21> A;
+        FusedMatrix<Q, 21, 11> B;
+        fill(A, 8, 0.3);
+        fill(B, 9, 0.3);
+        CHECK(check_product(FusedMatrix<Q, 13, 11>::matmul(A, B), A, B, 13, 21, 11) == 0);
+    }
+
+    SECTION("transposed operands")
+    {
+        FusedMatrix<Q, 17, 10> At;
+        FusedMatrix<Q, 12, 17> Bt;
+        fill(At, 10, 0.3);
+        fill(Bt, 11, 0.3);
+        FusedMatrix<Q, 10, 17> A;
+        FusedMatrix<Q, 17, 12> B;
+        A = At.transpose_view();
+        B = Bt.transpose_view();
+        CHECK(check_product(FusedMatrix<Q, 10, 12>::matmul(At.transpose_view(), Bt.transpose_view()), A, B, 10, 17, 12) == 0);
+    }
+
+    SECTION("gemv: matrix × vector and row × matrix")
+    {
+        FusedMatrix<Q, 19, 33> A;
+        FusedMatrix<Q, 33, 1> x;
+        FusedMatrix<Q, 1, 19> y;
+        fill(A, 12, 0.2);
+        fill(x, 13, 0.2);
+        fill(y, 14, 0.2);
+        CHECK(check_product(FusedMatrix<Q, 19, 1>::matmul(A, x), A, x, 19, 33, 1) == 0);
+        CHECK(check_product(FusedMatrix<Q, 1, 33>::matmul(y, A), y, A, 1, 19, 33) == 0);
+    }
+}
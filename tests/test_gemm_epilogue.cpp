@@ -0,0 +1,355 @@
+/**
+ * @file test_gemm_epilogue.cpp
+ * @brief Catch2 tests for fused GEMM epilogues (matmul/einsum overloads).
+ *
+ * Tests cover:
+ *   - Expression addend (A·B + R), including a compound expression and a transposed view
+ *   - Row and column bias from FusedVector ([N,1], strided) and [1,N] tensors
+ *   - Addend and bias extents checked against the output at compile time
+ *   - alpha scaling; alpha/beta in-place update via matmul_update / einsum_update
+ *   - Elementwise ops: SIMD functor (ClampOp) and plain lambda (lane fallback)
+ *   - Both GEMM paths: register-blocked (small) and packed (large, multiple K blocks)
+ *   - einsum axis combos with an epilogue, error paths
+ */
+
+#include <catch_amalgamated.hpp>
+
+#include "config.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+#include "fused/fused_vector.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// Reference: plain matmul, then the epilogue applied in a second pass.
+template <typename T, my_size_t M, my_size_t K, my_size_t N, typename F>
+static void check_against_two_pass(const FusedMatrix<T, M, K> &A,
+                                   const FusedMatrix<T, K, N> &B,
+                                   const FusedMatrix<T, M, N> &fused,
+                                   F expected_at)
+{
+    static FusedMatrix<T, M, N> plain;
+    plain = FusedMatrix<T, M, N>::matmul(A, B);
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+            REQUIRE(fused(i, j) == Approx(expected_at(plain(i, j), i, j)));
+}
+
+// ============================================================================
+// EXPRESSION ADDEND
+// ============================================================================
+
+TEMPLATE_TEST_CASE("epilogue: A·B + R, remainder shapes", "[epilogue][add]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 7, 5> A;
+    FusedMatrix<T, 5, 11> B;
+    FusedMatrix<T, 7, 11> R;
+    A.setSequencial();
+    B.setSequencial();
+    R.setSequencial();
+
+    auto C = FusedMatrix<T, 7, 11>::matmul(A, B, GemmEpilogue<T>{}.add(R));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t i, my_size_t j)
+                           { return v + R(i, j); });
+}
+
+TEMPLATE_TEST_CASE("epilogue: A·B + (R + Q) compound expression", "[epilogue][add]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 6, 6> A, B, R, Q;
+    A.setSequencial();
+    B.setSequencial();
+    R.setSequencial();
+    Q.setSequencial();
+
+    auto C = FusedMatrix<T, 6, 6>::matmul(A, B, GemmEpilogue<T>{}.add(R + Q));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t i, my_size_t j)
+                           { return v + R(i, j) + Q(i, j); });
+}
+
+TEMPLATE_TEST_CASE("epilogue: addend is a transposed view", "[epilogue][add][permuted]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 9, 4> A;
+    FusedMatrix<T, 4, 9> B;
+    FusedMatrix<T, 9, 9> R;
+    A.setSequencial();
+    B.setSequencial();
+    R.setSequencial();
+
+    auto C = FusedMatrix<T, 9, 9>::matmul(A, B, GemmEpilogue<T>{}.add(R.transpose_view()));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t i, my_size_t j)
+                           { return v + R(j, i); });
+}
+
+// ============================================================================
+// BIAS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("epilogue: row bias from FusedVector", "[epilogue][bias]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 5, 3> A;
+    FusedMatrix<T, 3, 13> B;
+    FusedVector<T, 13> bias;
+    A.setSequencial();
+    B.setSequencial();
+    for (my_size_t j = 0; j < 13; ++j)
+        bias(j) = static_cast<T>(j) * T(0.5);
+
+    auto C = FusedMatrix<T, 5, 13>::matmul(A, B, GemmEpilogue<T>{}.add_row_bias(bias));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t, my_size_t j)
+                           { return v + bias(j); });
+}
+
+TEMPLATE_TEST_CASE("epilogue: row bias from dense [1,N] row", "[epilogue][bias]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 6, 4> A;
+    FusedMatrix<T, 4, 17> B;
+    FusedMatrix<T, 1, 17> bias;
+    A.setSequencial();
+    B.setSequencial();
+    bias.setSequencial();
+
+    auto C = FusedMatrix<T, 6, 17>::matmul(A, B, GemmEpilogue<T>{}.add_row_bias(bias));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t, my_size_t j)
+                           { return v + bias(0, j); });
+}
+
+TEMPLATE_TEST_CASE("epilogue: column bias", "[epilogue][bias]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 11, 3> A;
+    FusedMatrix<T, 3, 10> B;
+    FusedVector<T, 11> bias;
+    A.setSequencial();
+    B.setSequencial();
+    for (my_size_t i = 0; i < 11; ++i)
+        bias(i) = T(1) - static_cast<T>(i);
+
+    auto C = FusedMatrix<T, 11, 10>::matmul(A, B, GemmEpilogue<T>{}.add_col_bias(bias));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t i, my_size_t)
+                           { return v + bias(i); });
+}
+
+TEMPLATE_TEST_CASE("epilogue: addend extents are checked against the output", "[epilogue][add][bias]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 6, 6> R;
+    FusedMatrix<T, 2, 2> X;
+    FusedVector<T, 6> b6;
+    FusedMatrix<T, 1, 4> b4;
+
+    // matmul / einsum static_assert FitsOutput<Rows, Cols>
+    using AddR = decltype(GemmEpilogue<T>{}.add(R));
+    using AddX = decltype(GemmEpilogue<T>{}.add(X));
+    STATIC_REQUIRE(AddR::template FitsOutput<6, 6>);
+    STATIC_REQUIRE(!AddX::template FitsOutput<6, 6>);
+    STATIC_REQUIRE(!AddR::template FitsOutput<6, 4>);
+
+    // Row bias: one value per column; column bias: one value per row
+    using Row4 = decltype(GemmEpilogue<T>{}.add_row_bias(b4));
+    using Col6 = decltype(GemmEpilogue<T>{}.add_col_bias(b6));
+    STATIC_REQUIRE(Row4::template FitsOutput<6, 4>);
+    STATIC_REQUIRE(!Row4::template FitsOutput<4, 6>);
+    STATIC_REQUIRE(Col6::template FitsOutput<6, 4>);
+    STATIC_REQUIRE(!Col6::template FitsOutput<4, 6>);
+
+    STATIC_REQUIRE(GemmEpilogue<T>::template FitsOutput<3, 5>);
+}
+
+// ============================================================================
+// SCALING AND IN-PLACE UPDATE
+// ============================================================================
+
+TEMPLATE_TEST_CASE("epilogue: alpha scaling", "[epilogue][scale]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 8, 8> A, B;
+    A.setSequencial();
+    B.setSequencial();
+
+    auto C = FusedMatrix<T, 8, 8>::matmul(A, B, GemmEpilogue<T>{}.scale(T(-2)));
+
+    check_against_two_pass(A, B, C, [](T v, my_size_t, my_size_t)
+                           { return T(-2) * v; });
+}
+
+TEMPLATE_TEST_CASE("epilogue: matmul_update computes alpha·A·B + beta·C", "[epilogue][scale][update]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 7, 6> A;
+    FusedMatrix<T, 6, 9> B;
+    FusedMatrix<T, 7, 9> C, C_old;
+    A.setSequencial();
+    B.setSequencial();
+    C.setSequencial();
+    C_old = C;
+
+    C.matmul_update(A, B, GemmEpilogue<T>{}.scale(T(3), T(-1)));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t i, my_size_t j)
+                           { return T(3) * v - C_old(i, j); });
+}
+
+TEMPLATE_TEST_CASE("epilogue: matmul_update without beta overwrites", "[epilogue][update]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 4, 4> A, B;
+    FusedMatrix<T, 4, 4> C(T(99));
+    A.setSequencial();
+    B.setSequencial();
+
+    C.matmul_update(A, B);
+
+    check_against_two_pass(A, B, C, [](T v, my_size_t, my_size_t)
+                           { return v; });
+}
+
+TEMPLATE_TEST_CASE("epilogue: matmul_update rejects aliasing operands", "[epilogue][update][error]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 4, 4> A, C;
+    A.setSequencial();
+    C.setSequencial();
+
+    CHECK_THROWS(C.matmul_update(C, A));
+}
+
+TEMPLATE_TEST_CASE("epilogue: beta on a fresh result is rejected", "[epilogue][error]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 4, 4> A, B;
+    A.setSequencial();
+    B.setSequencial();
+
+    CHECK_THROWS(FusedMatrix<T, 4, 4>::matmul(A, B, GemmEpilogue<T>{}.scale(T(1), T(1))));
+}
+
+// ============================================================================
+// ELEMENTWISE OPS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("epilogue: ClampOp (SIMD op) after addend", "[epilogue][op]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 9, 5> A;
+    FusedMatrix<T, 5, 14> B;
+    FusedMatrix<T, 9, 14> R;
+    A.setSequencial();
+    B.setSequencial();
+    R.setSequencial();
+
+    // A·B + R runs from 420 to 8875: the window clips both ends
+    auto C = FusedMatrix<T, 9, 14>::matmul(
+        A, B, GemmEpilogue<T>{}.add(R).map(ClampOp<T>{T(2000), T(6000)}));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t i, my_size_t j)
+                           { T x = v + R(i, j); return x < 2000 ? T(2000) : (x > 6000 ? T(6000) : x); });
+}
+
+TEMPLATE_TEST_CASE("epilogue: plain lambda op applied lane by lane", "[epilogue][op]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 6, 3> A;
+    FusedMatrix<T, 3, 10> B;
+    A.setSequencial();
+    B.setSequencial();
+    B -= T(15); // mixed-sign products, so relu clips some of them
+
+    auto relu = [](T x)
+    { return x > T(0) ? x : T(0); };
+    auto C = FusedMatrix<T, 6, 10>::matmul(A, B, GemmEpilogue<T>{}.scale(T(0.5)).map(relu));
+
+    check_against_two_pass(A, B, C, [](T v, my_size_t, my_size_t)
+                           { T x = T(0.5) * v; return x > 0 ? x : T(0); });
+}
+
+// ============================================================================
+// EINSUM AXIS COMBOS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("epilogue: einsum with transposed operands", "[epilogue][einsum]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 5, 7> A;  // contract axis 0 → Aᵀ[7,5]
+    FusedTensorND<T, 3, 5> B;  // contract axis 1 → Bᵀ[5,3]
+    FusedTensorND<T, 7, 3> R;
+    A.setSequencial();
+    B.setSequencial();
+    for (my_size_t i = 0; i < 7; ++i)
+        for (my_size_t j = 0; j < 3; ++j)
+            R(i, j) = static_cast<T>(i) - static_cast<T>(j);
+
+    auto plain = FusedTensorND<T, 7, 3>::einsum(A, B, 0, 1);
+    auto fused = FusedTensorND<T, 7, 3>::einsum(A, B, 0, 1, GemmEpilogue<T>{}.add(R));
+
+    for (my_size_t i = 0; i < 7; ++i)
+        for (my_size_t j = 0; j < 3; ++j)
+            REQUIRE(fused(i, j) == Approx(plain(i, j) + R(i, j)));
+}
+
+// ============================================================================
+// PACKED PATH (multiple K blocks)
+// ============================================================================
+
+TEMPLATE_TEST_CASE("epilogue: packed path, alpha/beta + bias + clamp across K blocks", "[epilogue][packed][large]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    constexpr my_size_t M = 133;
+    constexpr my_size_t K = (Gemm::KC != 0 ? 2 * Gemm::KC : 64) + 5;
+    constexpr my_size_t N = 141;
+
+    static FusedMatrix<T, M, K> A;
+    static FusedMatrix<T, K, N> B;
+    static FusedMatrix<T, M, N> C, C_old;
+    static FusedVector<T, N> bias;
+    A.setSequencial();
+    B.setSequencial();
+    C.setSequencial();
+    C_old = C;
+    bias.setSequencial();
+
+    // Results grow with the row: clamp to the span of two rows so both bounds bite
+    static FusedMatrix<T, M, N> plain;
+    plain = FusedMatrix<T, M, N>::matmul(A, B);
+    const T lo = T(0.25) * plain(M / 4, 0);
+    const T hi = T(0.25) * plain(3 * M / 4, 0);
+
+    C.matmul_update(A, B, GemmEpilogue<T>{}.scale(T(0.25), T(2)).add_row_bias(bias).map(ClampOp<T>{lo, hi}));
+
+    check_against_two_pass(A, B, C, [&](T v, my_size_t i, my_size_t j)
+                           {
+                               T x = T(0.25) * v + T(2) * C_old(i, j) + bias(j);
+                               return x < lo ? lo : (x > hi ? hi : x); });
+}
@@ -0,0 +1,285 @@
+/**
+ * @file test_gemmt.cpp
+ * @brief Catch2 tests for the symmetric-output GEMM family (gemmt / syrk).
+ *
+ * Tests cover:
+ *   - gemmt() Lower / Upper triangles match the full gemm() bit for bit
+ *   - Entries away from the diagonal in the other triangle are untouched
+ *   - Register-blocked, packed and parallel paths, remainder rows and columns
+ *   - Transposed operands and epilogues (addend, beta accumulation)
+ *   - syrk() for A·Aᵀ and Aᵀ·A, symmetrize() in both directions
+ *   - symmetric_rank_k_update() and joseph_update() routed through gemmt
+ */
+
+#include <catch_amalgamated.hpp>
+
+#include "config.h"
+#include "fused/fused_matrix.h"
+#include "fused/kernel_ops/kernel_gemm.h"
+#include "utilities/parallel_executor.h"
+#include "algorithms/operations/rank_update.h"
+#include "algorithms/examples/kalman.h"
+
+using Catch::Approx;
+using detail::GemmUplo;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// Distance from the diagonal beyond which a tile can never reach.
+/// With runtime dispatch the widest kernel family (largest tiles) may run.
+template <typename T>
+static constexpr my_size_t overhang()
+{
+#ifdef TESSERACT_X86_DISPATCH
+    using Gemm = detail::KernelGemm<T, 512, X86_AVX512>;
+#else
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+#endif
+    return Gemm::MR + Gemm::NR + Gemm::simdWidth;
+}
+
+/// Compare the Uplo triangle of C with the full product and check that the
+/// rest of the other triangle still holds the sentinel.
+template <GemmUplo Uplo, typename T, my_size_t N>
+static void check_triangle(const FusedMatrix<T, N, N> &C, const FusedMatrix<T, N, N> &full, T sentinel)
+{
+    for (my_size_t i = 0; i < N; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+        {
+            const bool inside = (Uplo == GemmUplo::Lower) ? j <= i : j >= i;
+            const my_size_t dist = (i > j) ? i - j : j - i;
+            if (inside)
+                REQUIRE(C(i, j) == full(i, j));
+            else if (dist >= overhang<T>())
+                REQUIRE(C(i, j) == sentinel);
+        }
+}
+
+template <GemmUplo Uplo, typename T, my_size_t N, my_size_t K>
+static void run_gemmt_case()
+{
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    constexpr my_size_t ldA = FusedMatrix<T, N, K>::Layout::stride(0);
+    constexpr my_size_t ldB = FusedMatrix<T, K, N>::Layout::stride(0);
+    constexpr my_size_t ldC = FusedMatrix<T, N, N>::Layout::stride(0);
+
+    // Large operands: keep them off the stack
+    static FusedMatrix<T, N, K> A;
+    static FusedMatrix<T, K, N> B;
+    static FusedMatrix<T, N, N> C;
+    static FusedMatrix<T, N, N> full;
+    A.setSequencial();
+    B.setSequencial();
+
+    const T sentinel = T(-777);
+    C = FusedMatrix<T, N, N>(sentinel);
+    Gemm::gemm(A.data(), N, K, ldA, B.data(), N, ldB, full.data(), ldC);
+    Gemm::template gemmt<Uplo>(A.data(), N, K, ldA, B.data(), ldB, C.data(), ldC);
+
+    check_triangle<Uplo>(C, full, sentinel);
+}
+
+// ============================================================================
+// GEMMT — TRIANGLE MATCHES THE FULL PRODUCT
+// ============================================================================
+
+TEMPLATE_TEST_CASE("gemmt: lower and upper triangles, register path", "[gemmt][test_gemmt]", double, float)
+{
+    using T = TestType;
+
+    SECTION("1x1") { run_gemmt_case<GemmUplo::Lower, T, 1, 3>(); }
+    SECTION("7x7 lower") { run_gemmt_case<GemmUplo::Lower, T, 7, 5>(); }
+    SECTION("7x7 upper") { run_gemmt_case<GemmUplo::Upper, T, 7, 5>(); }
+    SECTION("37x37 lower") { run_gemmt_case<GemmUplo::Lower, T, 37, 11>(); }
+    SECTION("37x37 upper") { run_gemmt_case<GemmUplo::Upper, T, 37, 11>(); }
+    SECTION("64x64 lower") { run_gemmt_case<GemmUplo::Lower, T, 64, 64>(); }
+}
+
+TEMPLATE_TEST_CASE("gemmt: packed path skips blocks outside the triangle", "[gemmt][packed][test_gemmt]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    if constexpr (Gemm::KC != 0)
+    {
+        constexpr my_size_t N = 2 * Gemm::MC + Gemm::MR + 3; // several MC blocks
+        constexpr my_size_t K = 2 * Gemm::KC + 5;            // several K blocks
+        static_assert(N * N * K >= Gemm::PACK_MIN_VOLUME);
+
+        SECTION("lower") { run_gemmt_case<GemmUplo::Lower, T, N, K>(); }
+        SECTION("upper") { run_gemmt_case<GemmUplo::Upper, T, N, K>(); }
+    }
+}
+
+/// Runs tasks serially on the caller in reverse order.
+struct ReverseExecutor final : ParallelExecutor
+{
+    my_size_t num_workers() const noexcept override { return 5; }
+    void parallel_for(my_size_t count, ParallelTask task, void *ctx) noexcept override
+    {
+        for (my_size_t i = count; i-- > 0;)
+            task(ctx, i);
+    }
+};
+
+TEMPLATE_TEST_CASE("gemmt: parallel packed path skips tasks outside the triangle", "[gemmt][packed][parallel][test_gemmt]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    if constexpr (Gemm::KC != 0)
+    {
+        constexpr my_size_t N = Gemm::MC + 2 * Gemm::MR + 1;
+        constexpr my_size_t K = Gemm::PACK_MIN_VOLUME / (N * N) + 1;
+
+        ReverseExecutor ex;
+        ParallelContext::set_executor(&ex, 0);
+        run_gemmt_case<GemmUplo::Lower, T, N, K>();
+        run_gemmt_case<GemmUplo::Upper, T, N, K>();
+        ParallelContext::set_executor(nullptr);
+    }
+}
+
+TEMPLATE_TEST_CASE("gemmt: transposed B with addend epilogue", "[gemmt][epilogue][test_gemmt]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    constexpr my_size_t N = 19;
+    constexpr my_size_t ld = FusedMatrix<T, N, N>::Layout::stride(0);
+
+    FusedMatrix<T, N, N> F, P, Q;
+    F.setSequencial();
+    P.setSequencial();
+    Q.setSequencial();
+    auto FP = FusedMatrix<T, N, N>::matmul(F, P);
+
+    auto full = FusedMatrix<T, N, N>::matmul(FP, F.transpose_view(), GemmEpilogue<T>{}.add(Q));
+
+    FusedMatrix<T, N, N> C(T(-777));
+    Gemm::template gemmt<GemmUplo::Lower, false, true>(
+        FP.data(), N, N, ld, F.data(), ld, C.data(), ld, GemmEpilogue<T>{}.add(Q));
+
+    check_triangle<GemmUplo::Lower>(C, full, T(-777));
+}
+
+// ============================================================================
+// SYRK AND SYMMETRIZE
+// ============================================================================
+
+TEMPLATE_TEST_CASE("syrk: A·Aᵀ and Aᵀ·A are symmetric after mirroring", "[gemmt][syrk][test_gemmt]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    FusedMatrix<T, 13, 6> A;
+    A.setSequencial();
+    constexpr my_size_t ldA = FusedMatrix<T, 13, 6>::Layout::stride(0);
+
+    SECTION("A·Aᵀ from the lower triangle")
+    {
+        constexpr my_size_t ld = FusedMatrix<T, 13, 13>::Layout::stride(0);
+        FusedMatrix<T, 13, 13> C;
+        Gemm::template syrk<GemmUplo::Lower>(A.data(), 13, 6, ldA, C.data(), ld);
+        Gemm::template symmetrize<GemmUplo::Lower>(C.data(), 13, ld);
+
+        auto ref = FusedMatrix<T, 13, 13>::matmul(A, A.transpose_view());
+        for (my_size_t i = 0; i < 13; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+            {
+                REQUIRE(C(i, j) == Approx(ref(i, j)));
+                REQUIRE(C(i, j) == C(j, i));
+            }
+    }
+
+    SECTION("Aᵀ·A from the upper triangle")
+    {
+        constexpr my_size_t ld = FusedMatrix<T, 6, 6>::Layout::stride(0);
+        FusedMatrix<T, 6, 6> C;
+        Gemm::template syrk<GemmUplo::Upper, true>(A.data(), 6, 13, ldA, C.data(), ld);
+        Gemm::template symmetrize<GemmUplo::Upper>(C.data(), 6, ld);
+
+        auto ref = FusedMatrix<T, 6, 6>::matmul(A.transpose_view(), A);
+        for (my_size_t i = 0; i < 6; ++i)
+            for (my_size_t j = 0; j < 6; ++j)
+            {
+                REQUIRE(C(i, j) == Approx(ref(i, j)));
+                REQUIRE(C(i, j) == C(j, i));
+            }
+    }
+}
+
+// ============================================================================
+// COVARIANCE ROUTINES
+// ============================================================================
+
+TEMPLATE_TEST_CASE("symmetric_rank_k_update: gemmt matches the two full products", "[gemmt][rank_update][test_gemmt]", double, float)
+{
+    using T = TestType;
+    constexpr my_size_t N = 15;
+
+    FusedMatrix<T, N, N> F, P0, P, Q0, Q;
+    F.setSequencial();
+    P0.setSequencial();
+    P = FusedMatrix<T, N, N>::matmul(P0, P0.transpose_view());
+    Q0.setSequencial();
+    Q = Q0 + Q0.transpose_view();
+
+    auto FP = FusedMatrix<T, N, N>::matmul(F, P);
+    auto ref = FusedMatrix<T, N, N>::matmul(FP, F.transpose_view(), GemmEpilogue<T>{}.add(Q));
+
+    SECTION("full result is exactly symmetric")
+    {
+        auto R = matrix_algorithms::symmetric_rank_k_update(F, P, Q);
+        for (my_size_t i = 0; i < N; ++i)
+            for (my_size_t j = 0; j < N; ++j)
+            {
+                REQUIRE(R(i, j) == Approx(ref(i, j)));
+                REQUIRE(R(i, j) == R(j, i));
+            }
+    }
+
+    SECTION("lower triangle only")
+    {
+        auto R = matrix_algorithms::symmetric_rank_k_update<GemmUplo::Lower>(F, P, Q);
+        for (my_size_t i = 0; i < N; ++i)
+            for (my_size_t j = 0; j <= i; ++j)
+                REQUIRE(R(i, j) == Approx(ref(i, j)));
+    }
+}
+
+TEMPLATE_TEST_CASE("joseph_update: gemmt result matches the explicit formula", "[gemmt][joseph_update][test_gemmt]", double, float)
+{
+    using T = TestType;
+    constexpr my_size_t N = 9, M = 3;
+
+    FusedMatrix<T, N, M> K;
+    FusedMatrix<T, M, N> H;
+    FusedMatrix<T, N, N> P0, P;
+    FusedMatrix<T, M, M> R(T(0));
+    K.setSequencial();
+    H.setSequencial();
+    P0.setSequencial();
+    P = FusedMatrix<T, N, N>::matmul(P0, P0.transpose_view());
+    for (my_size_t i = 0; i < M; ++i)
+        R(i, i) = T(2);
+
+    FusedMatrix<T, N, N> I;
+    I.setIdentity();
+    auto KH = FusedMatrix<T, N, N>::matmul(K, H);
+    FusedMatrix<T, N, N> IKH;
+    IKH = I - KH;
+    auto IKHP = FusedMatrix<T, N, N>::matmul(IKH, P);
+    auto term1 = FusedMatrix<T, N, N>::matmul(IKHP, IKH.transpose_view());
+    auto KR = FusedMatrix<T, N, M>::matmul(K, R);
+    auto ref = FusedMatrix<T, N, N>::matmul(KR, K.transpose_view(), GemmEpilogue<T>{}.add(term1));
+
+    auto Pn = matrix_algorithms::joseph_update(K, H, P, R);
+    for (my_size_t i = 0; i < N; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+        {
+            REQUIRE(Pn(i, j) == Approx(ref(i, j)).epsilon(1e-4));
+            REQUIRE(Pn(i, j) == Pn(j, i));
+        }
+}
@@ -0,0 +1,294 @@
+/**
+ * @file test_gemv.cpp
+ * @brief Catch2 tests for the matrix-vector path (KernelGemm::gemv).
+ *
+ * Tests cover:
+ *   - Dot form (A as stored) and axpy form (A stored transposed)
+ *   - Row-block remainders, K tails and partial vectors of y
+ *   - Column-vector x strided by the padded row, staged and unstaged
+ *   - 1 × N results (RowY) with vector stores through the epilogue
+ *   - matmul / einsum dispatch: F·x, Fᵀ·x, xᵀ·F, FusedVector, epilogues
+ *
+ * Entries are small integers so every summation order is exact.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <type_traits>
+
+#include "config.h"
+#include "fused/fused_matrix.h"
+#include "fused/fused_vector.h"
+#include "fused/kernel_ops/kernel_gemm.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// y = A·x for logical A[M,K], x[K,1].
+template <typename T, my_size_t M, my_size_t K>
+static FusedMatrix<T, M, 1> naive_gemv(const FusedMatrix<T, M, K> &A, const FusedMatrix<T, K, 1> &x)
+{
+    FusedMatrix<T, M, 1> y;
+    for (my_size_t i = 0; i < M; ++i)
+    {
+        T sum = T{0};
+        for (my_size_t k = 0; k < K; ++k)
+            sum += A(i, k) * x(k, 0);
+        y(i, 0) = sum;
+    }
+    return y;
+}
+
+/// Run gemv<TransA> on an M×K product and compare with the naive one.
+/// A is stored K×M when TransA; x is a column vector (strided) or a row (contiguous).
+template <typename T, bool TransA, bool RowX, my_size_t M, my_size_t K>
+static void check_gemv()
+{
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    using SA = std::conditional_t<TransA, FusedMatrix<T, K, M>, FusedMatrix<T, M, K>>;
+    using SX = std::conditional_t<RowX, FusedMatrix<T, 1, K>, FusedMatrix<T, K, 1>>;
+
+    static SA A;
+    static SX x;
+    static FusedMatrix<T, M, K> A_nn;
+    static FusedMatrix<T, K, 1> x_col;
+    static FusedMatrix<T, M, 1> y;
+    A.setSequencial();
+    x.setSequencial();
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t k = 0; k < K; ++k)
+            A_nn(i, k) = TransA ? A(k, i) : A(i, k);
+    for (my_size_t k = 0; k < K; ++k)
+        x_col(k, 0) = RowX ? x(0, k) : x(k, 0);
+
+    y.setToZero();
+    Gemm::template gemv<TransA>(A.data(), M, K, A.getStride(0),
+                                x.data(), RowX ? 1 : x.getStride(0),
+                                y.data(), y.getStride(0));
+
+    // Long float rows sum past 2^24, where the order of additions matters
+    auto ref = naive_gemv(A_nn, x_col);
+    for (my_size_t i = 0; i < M; ++i)
+        REQUIRE(y(i, 0) == Approx(ref(i, 0)));
+
+    // Padding lanes of y are never written
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t p = 1; p < y.getStride(0); ++p)
+            REQUIRE(y.data()[i * y.getStride(0) + p] == T{0});
+}
+
+// ============================================================================
+// DIRECT KernelGemm::gemv
+// ============================================================================
+
+TEMPLATE_TEST_CASE("gemv dot form: row blocks, remainders and K tails", "[gemv][dot]", double, float)
+{
+    using T = TestType;
+    check_gemv<T, false, false, 1, 1>();
+    check_gemv<T, false, false, 3, 5>();
+    check_gemv<T, false, false, 6, 6>();
+    check_gemv<T, false, false, 15, 15>();
+    check_gemv<T, false, false, 13, 37>();
+    check_gemv<T, false, true, 13, 37>();
+    check_gemv<T, false, false, 64, 64>();
+}
+
+TEMPLATE_TEST_CASE("gemv dot form: x longer than the staging buffer", "[gemv][dot][large]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    check_gemv<T, false, false, 5, Gemm::GEMV_STAGE + 11>();
+}
+
+TEMPLATE_TEST_CASE("gemv axpy form: full passes, single vectors and a partial vector", "[gemv][axpy]", double, float)
+{
+    using T = TestType;
+    check_gemv<T, true, false, 1, 1>();
+    check_gemv<T, true, false, 6, 6>();
+    check_gemv<T, true, false, 15, 15>();
+    check_gemv<T, true, false, 37, 13>();
+    check_gemv<T, true, true, 37, 13>();
+    check_gemv<T, true, false, 64, 64>();
+}
+
+TEMPLATE_TEST_CASE("gemv RowY: 1×N result stored through the epilogue", "[gemv][axpy][epilogue]", double, float)
+{
+    // yᵀ = xᵀ·B + r, B stored K×N: axpy form with vector stores
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    constexpr my_size_t K = 9, N = 35;
+
+    FusedMatrix<T, 1, K> x;
+    FusedMatrix<T, K, N> B;
+    FusedMatrix<T, 1, N> r;
+    FusedMatrix<T, 1, N> y;
+    x.setSequencial();
+    B.setSequencial();
+    r.setSequencial();
+
+    Gemm::template gemv<true, true>(B.data(), N, K, B.getStride(0), x.data(), 1, y.data(), 1,
+                                    GemmEpilogue<T>{}.add(r));
+
+    for (my_size_t j = 0; j < N; ++j)
+    {
+        T sum = r(0, j);
+        for (my_size_t k = 0; k < K; ++k)
+            sum += x(0, k) * B(k, j);
+        REQUIRE(y(0, j) == sum);
+    }
+}
+
+// ============================================================================
+// einsum / matmul DISPATCH
+// ============================================================================
+
+TEMPLATE_TEST_CASE("matmul: F·x and Fᵀ·x with a column vector", "[gemv][matmul]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 15, 15> F;
+    FusedMatrix<T, 15, 1> x;
+    F.setSequencial();
+    x.setSequencial();
+
+    SECTION("F·x")
+    {
+        auto y = FusedMatrix<T, 15, 1>::matmul(F, x);
+        auto ref = naive_gemv(F, x);
+        for (my_size_t i = 0; i < 15; ++i)
+            REQUIRE(y(i, 0) == ref(i, 0));
+    }
+
+    SECTION("Fᵀ·x")
+    {
+        FusedMatrix<T, 15, 15> Ft;
+        Ft = F.transpose_view();
+        auto y = FusedMatrix<T, 15, 1>::matmul(F.transpose_view(), x);
+        auto ref = naive_gemv(Ft, x);
+        for (my_size_t i = 0; i < 15; ++i)
+            REQUIRE(y(i, 0) == ref(i, 0));
+    }
+}
+
+TEMPLATE_TEST_CASE("matmul: row vector times matrix", "[gemv][matmul]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 1, 11> x;
+    FusedMatrix<T, 11, 21> B;
+    x.setSequencial();
+    B.setSequencial();
+
+    SECTION("xᵀ·B")
+    {
+        auto y = FusedMatrix<T, 1, 21>::matmul(x, B);
+        for (my_size_t j = 0; j < 21; ++j)
+        {
+            T sum = T{0};
+            for (my_size_t k = 0; k < 11; ++k)
+                sum += x(0, k) * B(k, j);
+            REQUIRE(y(0, j) == sum);
+        }
+    }
+
+    SECTION("xᵀ·Cᵀ")
+    {
+        FusedMatrix<T, 21, 11> C;
+        C.setSequencial();
+        auto y = FusedMatrix<T, 1, 21>::matmul(x, C.transpose_view());
+        for (my_size_t j = 0; j < 21; ++j)
+        {
+            T sum = T{0};
+            for (my_size_t k = 0; k < 11; ++k)
+                sum += x(0, k) * C(j, k);
+            REQUIRE(y(0, j) == sum);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("einsum: every axis combination with a unit free dimension", "[gemv][einsum]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 13, 10> A;
+    FusedMatrix<T, 13, 1> u;
+    FusedMatrix<T, 1, 13> v;
+    A.setSequencial();
+    u.setSequencial();
+    v.setSequencial();
+
+    // y[j] = Σᵢ A(i, j)·u(i): contract A's axis 0 with u's axis 0 (A read transposed)
+    auto y1 = FusedMatrix<T, 10, 1>::einsum(A, u, 0, 0);
+    // y[j] = Σᵢ A(i, j)·v(0, i): u as a row vector, contracted on axis 1
+    auto y2 = FusedMatrix<T, 10, 1>::einsum(A, v, 0, 1);
+    // z[j] = Σᵢ v(0, i)·A(i, j): 1 × N result
+    auto z = FusedMatrix<T, 1, 10>::einsum(v, A, 1, 0);
+
+    for (my_size_t j = 0; j < 10; ++j)
+    {
+        T su = T{0}, sv = T{0};
+        for (my_size_t i = 0; i < 13; ++i)
+        {
+            su += A(i, j) * u(i, 0);
+            sv += A(i, j) * v(0, i);
+        }
+        REQUIRE(y1(j, 0) == su);
+        REQUIRE(y2(j, 0) == sv);
+        REQUIRE(z(0, j) == sv);
+    }
+}
+
+TEMPLATE_TEST_CASE("gemv: state prediction and innovation", "[gemv][kalman]", double, float)
+{
+    // x' = F·x and y = z − H·x, the per-cycle vector products of a filter
+    using T = TestType;
+
+    FusedMatrix<T, 12, 12> F;
+    FusedVector<T, 12> x;
+    FusedMatrix<T, 4, 12> H;
+    FusedVector<T, 4> z;
+    F.setSequencial();
+    x.setSequencial();
+    H.setSequencial();
+    z.setSequencial();
+
+    auto xp = FusedMatrix<T, 12, 1>::matmul(F, x);
+    auto y = FusedMatrix<T, 4, 1>::matmul(H, xp, GemmEpilogue<T>{}.scale(T(-1)).add(z));
+
+    for (my_size_t i = 0; i < 12; ++i)
+    {
+        T sum = T{0};
+        for (my_size_t k = 0; k < 12; ++k)
+            sum += F(i, k) * x(k);
+        REQUIRE(xp(i, 0) == sum);
+    }
+    for (my_size_t i = 0; i < 4; ++i)
+    {
+        T sum = T{0};
+        for (my_size_t k = 0; k < 12; ++k)
+            sum += H(i, k) * xp(k, 0);
+        REQUIRE(y(i, 0) == Approx(z(i) - sum));
+    }
+}
+
+TEMPLATE_TEST_CASE("matmul_update: y = α·A·x + β·y on the gemv path", "[gemv][epilogue]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 19, 23> A;
+    FusedMatrix<T, 23, 1> x;
+    FusedMatrix<T, 19, 1> y;
+    A.setSequencial();
+    x.setSequencial();
+    y.setSequencial();
+    auto y0 = y;
+
+    y.matmul_update(A, x, GemmEpilogue<T>{}.scale(T(2), T(-1)));
+
+    auto ref = naive_gemv(A, x);
+    for (my_size_t i = 0; i < 19; ++i)
+        REQUIRE(y(i, 0) == T(2) * ref(i, 0) - y0(i, 0));
+}
@@ -0,0 +1,390 @@
+/**
+ * @file test_half.cpp
+ * @brief Catch2 tests for Half / BFloat16 storage tensors and their microkernels.
+ *
+ * Tests cover:
+ *   - Scalar conversion: round to nearest even, subnormals, overflow to Inf,
+ *     NaN, signed zero, and the round trip of every 16-bit pattern
+ *   - The convert-on-load microkernel (load / store / masked tails / gather /
+ *     scatter) against the scalar conversion
+ *   - Elementwise expressions and math functions with row tails, computed in
+ *     float and rounded once at the store
+ *   - sum / min / max and operator==
+ *   - GEMM and gemv accumulating over the whole of K in float
+ */
+
+#include <catch_amalgamated.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "config.h"
+#include "half.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "fused/fused_matrix.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static float float_from_bits(std::uint32_t u)
+{
+    float f;
+    std::memcpy(&f, &u, sizeof f);
+    return f;
+}
+
+static bool same_value(float a, float b)
+{
+    return (std::isnan(a) && std::isnan(b)) || a == b;
+}
+
+/// Independent reference: nearest representable value, ties to even mantissa.
+template <typename H>
+static float round_reference(double x)
+{
+    // Bracket x between two neighbouring 16-bit values by scanning the grid
+    float lo = -INFINITY, hi = INFINITY;
+    std::uint16_t lo_bits = 0;
+    for (std::uint32_t b = 0; b < 0x10000; ++b)
+    {
+        const float v = H::from_bits(static_cast<std::uint16_t>(b));
+        if (std::isnan(v))
+            continue;
+        if (v <= x && v > lo)
+            lo = v, lo_bits = static_cast<std::uint16_t>(b);
+        if (v >= x && v < hi)
+            hi = v;
+    }
+    if (lo == hi)
+        return lo;
+    const double dl = x - lo, dh = hi - x;
+    if (dl != dh)
+        return dl < dh ? lo : hi;
+    return (lo_bits & 1) ? hi : lo;
+}
+
+template <typename H, my_size_t R, my_size_t C>
+static void fill(FusedMatrix<H, R, C> &X, my_size_t seed)
+{
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            X(i, j) = H(static_cast<float>(static_cast<int>((i * 7 + j * 3 + seed * 5) % 23) - 11) * 0.125f);
+}
+
+// ============================================================================
+// SCALAR CONVERSION
+// ============================================================================
+
+TEST_CASE("Half: scalar conversion edge cases", "[half][scalar]")
+{
+    REQUIRE(Half(1.0f).bits == 0x3c00);
+    REQUIRE(Half(-2.0f).bits == 0xc000);
+    REQUIRE(Half(65504.0f).bits == 0x7bff);
+    REQUIRE(Half(0.0f).bits == 0x0000);
+    REQUIRE(Half(-0.0f).bits == 0x8000);
+
+    // Overflow: 65520 is the halfway point to the next binade and rounds up to Inf
+    REQUIRE(Half(65519.0f).bits == 0x7bff);
+    REQUIRE(Half(65520.0f).bits == 0x7c00);
+    REQUIRE(Half(1e10f).bits == 0x7c00);
+    REQUIRE(Half(-INFINITY).bits == 0xfc00);
+    REQUIRE(std::isnan(static_cast<float>(Half(NAN))));
+
+    // Ties to even: 1 + 2⁻¹¹ lies halfway between 1 and 1 + 2⁻¹⁰
+    REQUIRE(Half(1.0f + 0x1p-11f).bits == 0x3c00);
+    REQUIRE(Half(1.0f + 3 * 0x1p-11f).bits == 0x3c02);
+
+    // Subnormals: smallest is 2⁻²⁴; half of it ties to zero, just above rounds up
+    REQUIRE(Half(0x1p-24f).bits == 0x0001);
+    REQUIRE(Half(0x1p-25f).bits == 0x0000);
+    REQUIRE(Half(0x1.01p-25f).bits == 0x0001);
+    REQUIRE(Half(3 * 0x1p-25f).bits == 0x0002);
+    REQUIRE(static_cast<float>(Half::from_bits(0x03ff)) == 1023 * 0x1p-24f);
+
+    REQUIRE(static_cast<float>(NumericLimits<Half>::max()) == 65504.0f);
+    REQUIRE(static_cast<float>(NumericLimits<Half>::lowest()) == -65504.0f);
+    REQUIRE(std::isinf(static_cast<float>(NumericLimits<Half>::infinity())));
+}
+
+TEST_CASE("BFloat16: scalar conversion edge cases", "[half][bf16][scalar]")
+{
+    REQUIRE(BFloat16(1.0f).bits == 0x3f80);
+    REQUIRE(BFloat16(-0.0f).bits == 0x8000);
+    REQUIRE(BFloat16(INFINITY).bits == 0x7f80);
+
+    // Ties to even on the 7-bit mantissa
+    REQUIRE(BFloat16(1.0f + 0x1p-8f).bits == 0x3f80);
+    REQUIRE(BFloat16(1.0f + 3 * 0x1p-8f).bits == 0x3f82);
+
+    // Float's largest finite value rounds past bfloat16's to Inf
+    REQUIRE(BFloat16(3.4028235e38f).bits == 0x7f80);
+
+    // A NaN whose payload sits in the discarded bits stays NaN
+    REQUIRE(std::isnan(static_cast<float>(BFloat16(float_from_bits(0x7f800001u)))));
+
+    REQUIRE(static_cast<float>(NumericLimits<BFloat16>::max()) == float_from_bits(0x7f7f0000u));
+}
+
+TEMPLATE_TEST_CASE("Half / BFloat16: every bit pattern survives a round trip", "[half][scalar]", Half, BFloat16)
+{
+    using H = TestType;
+    my_size_t mismatches = 0;
+    for (std::uint32_t b = 0; b < 0x10000; ++b)
+    {
+        const H h = H::from_bits(static_cast<std::uint16_t>(b));
+        const float f = h;
+        if (std::isnan(f))
+            mismatches += !std::isnan(static_cast<float>(H(f)));
+        else
+            mismatches += H(f).bits != h.bits;
+    }
+    REQUIRE(mismatches == 0);
+}
+
+TEMPLATE_TEST_CASE("Half / BFloat16: rounding matches the nearest-even reference", "[half][scalar]", Half, BFloat16)
+{
+    using H = TestType;
+    const float samples[] = {0.1f, -0.3f, 1.0f / 3, 2.71828f, 1000.7f, -12345.6f, 3e-5f, 7e-8f, 1.00048828125f, 0.0999f};
+    for (float x : samples)
+        REQUIRE(static_cast<float>(H(x)) == round_reference<H>(x));
+}
+
+// ============================================================================
+// MICROKERNEL
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Half microkernel: load / store match the scalar conversion", "[half][microkernel]", Half, BFloat16)
+{
+    using H = TestType;
+    using K = Microkernel<H, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+
+    // Widening: every 16-bit pattern
+    alignas(DATA_ALIGNAS) H in[W];
+    alignas(DATA_ALIGNAS) float wide[W];
+    my_size_t bad = 0;
+    for (std::uint32_t b = 0; b < 0x10000; b += W)
+    {
+        for (my_size_t l = 0; l < W; ++l)
+            in[l] = H::from_bits(static_cast<std::uint16_t>(b + l));
+        Microkernel<float, BITS, DefaultArch>::store(wide, K::load(in));
+        for (my_size_t l = 0; l < W; ++l)
+            bad += !same_value(wide[l], static_cast<float>(in[l]));
+    }
+    REQUIRE(bad == 0);
+
+    // Narrowing: a stride through all float bit patterns, plus ties and edges
+    alignas(DATA_ALIGNAS) H out[W];
+    std::uint32_t u = 0;
+    for (my_size_t n = 0; n < (1u << 20); n += W)
+    {
+        for (my_size_t l = 0; l < W; ++l, u += 4099u)
+            wide[l] = float_from_bits(u);
+        K::store(out, Microkernel<float, BITS, DefaultArch>::load(wide));
+        for (my_size_t l = 0; l < W; ++l)
+        {
+            const H ref(wide[l]);
+            bad += std::isnan(wide[l]) ? !std::isnan(static_cast<float>(out[l])) : out[l].bits != ref.bits;
+        }
+    }
+    REQUIRE(bad == 0);
+
+    const float edges[] = {1.0f + 0x1p-11f, 1.0f + 3 * 0x1p-11f, 1.0f + 0x1p-8f, 65520.0f, 0x1p-25f,
+                           3 * 0x1p-25f, -0.0f, INFINITY, -INFINITY, 3.4028235e38f};
+    for (float e : edges)
+    {
+        K::store(out, Microkernel<float, BITS, DefaultArch>::set1(e));
+        REQUIRE(out[W - 1].bits == H(e).bits);
+    }
+}
+
+TEMPLATE_TEST_CASE("Half microkernel: gather, scatter and masked tails", "[half][microkernel]", Half, BFloat16)
+{
+    using H = TestType;
+    using K = Microkernel<H, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+
+    H src[4 * W], dst[4 * W];
+    for (my_size_t i = 0; i < 4 * W; ++i)
+        src[i] = H(static_cast<float>(i) * 0.5f - 3.0f);
+
+    my_size_t idx[W];
+    for (my_size_t i = 0; i < W; ++i)
+        idx[i] = (3 * i + 1) % (4 * W);
+
+    H out[W];
+    K::storeu(out, K::gather(src, idx));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(out[i].bits == src[idx[i]].bits);
+
+    for (auto &d : dst)
+        d = H(0.0f);
+    K::scatter(dst, idx, K::loadu(src));
+    for (my_size_t i = 0; i < W; ++i)
+        REQUIRE(dst[idx[i]].bits == src[i].bits);
+
+    for (my_size_t n = 0; n <= W; ++n)
+    {
+        for (auto &d : dst)
+            d = H(-9.0f);
+        K::maskstore(dst, K::maskload(src + 1, n), n);
+        for (my_size_t i = 0; i < W; ++i)
+            REQUIRE(dst[i].bits == (i < n ? src[1 + i] : H(-9.0f)).bits);
+    }
+}
+
+// ============================================================================
+// EXPRESSIONS AND REDUCTIONS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Half expressions: computed in float, rounded once at the store", "[half][expr]", Half, BFloat16)
+{
+    using H = TestType;
+
+    FusedMatrix<H, 5, 37> A, B, R;
+    fill(A, 1);
+    fill(B, 2);
+    const H s(1.3f);
+
+    R = A * B + A / s - B * s;
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 37; ++j)
+        {
+            const float a = A(i, j), b = B(i, j), fs = s;
+            REQUIRE(R(i, j).bits == H(a * b + a / fs - b * fs).bits);
+        }
+
+    FusedMatrix<H, 37, 5> Rt;
+    Rt = A.transpose_view() - B.transpose_view();
+    for (my_size_t i = 0; i < 37; ++i)
+        for (my_size_t j = 0; j < 5; ++j)
+            REQUIRE(Rt(i, j).bits == H(static_cast<float>(A(j, i)) - static_cast<float>(B(j, i))).bits);
+}
+
+TEMPLATE_TEST_CASE("Half expressions: elementwise math functions", "[half][expr][math]", Half, BFloat16)
+{
+    using H = TestType;
+
+    FusedMatrix<H, 3, 21> X, R;
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 21; ++j)
+            X(i, j) = H(static_cast<float>(j) * 0.1f - static_cast<float>(i) + 0.05f);
+
+    // Half keeps ~3 decimal digits, bfloat16 ~2: compare to one 16-bit ulp
+    const float rel = std::is_same_v<H, Half> ? 0x1p-10f : 0x1p-7f;
+
+    R = exp(X) + tanh(X);
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 21; ++j)
+        {
+            const float x = X(i, j), e = std::exp(x) + std::tanh(x);
+            REQUIRE(std::fabs(static_cast<float>(R(i, j)) - e) <= rel * std::fabs(e) + 1e-3f);
+        }
+
+    R = sqrt(X * X) * sigmoid(X);
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 21; ++j)
+        {
+            const float x = X(i, j), e = std::fabs(x) / (1.0f + std::exp(-x));
+            REQUIRE(std::fabs(static_cast<float>(R(i, j)) - e) <= rel * std::fabs(e) + 1e-3f);
+        }
+}
+
+TEMPLATE_TEST_CASE("Half reductions: sum, min, max and operator==", "[half][reduce]", Half, BFloat16)
+{
+    using H = TestType;
+
+    FusedMatrix<H, 7, 45> A;
+    fill(A, 3);
+
+    float s = 0, mn = INFINITY, mx = -INFINITY;
+    for (my_size_t i = 0; i < 7; ++i)
+        for (my_size_t j = 0; j < 45; ++j)
+        {
+            const float a = A(i, j);
+            s += a, mn = std::fmin(mn, a), mx = std::fmax(mx, a);
+        }
+    // Multiples of 1/8 within a small range: the float sum is exact in any order
+    REQUIRE(static_cast<float>(sum(A)) == static_cast<float>(H(s)));
+    REQUIRE(static_cast<float>(min(A)) == mn);
+    REQUIRE(static_cast<float>(max(A)) == mx);
+
+    FusedMatrix<H, 7, 45> B;
+    B = A;
+    REQUIRE(A == B);
+    B(6, 44) = H(static_cast<float>(B(6, 44)) + 1.0f);
+    REQUIRE_FALSE(A == B);
+}
+
+// ============================================================================
+// GEMM
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Half matmul: products and partial sums stay in float", "[half][gemm]", Half, BFloat16)
+{
+    using H = TestType;
+
+    // 600 terms of 1/16: a bfloat16 running sum would stall at 32, where its
+    // ulp is 1/4; the float accumulator reaches 37.5 exactly and rounds once
+    constexpr my_size_t M = 19, K = 600, N = 21;
+    static FusedMatrix<H, M, K> A;
+    static FusedMatrix<H, K, N> B;
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t k = 0; k < K; ++k)
+            A(i, k) = H(1.0f + static_cast<float>(i % 3));
+    for (my_size_t k = 0; k < K; ++k)
+        for (my_size_t j = 0; j < N; ++j)
+            B(k, j) = H(0.0625f * static_cast<float>(1 + j % 2));
+
+    auto P = FusedMatrix<H, M, N>::matmul(A, B);
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+            REQUIRE(static_cast<float>(P(i, j)) ==
+                    static_cast<float>(H(37.5f * static_cast<float>((1 + i % 3) * (1 + j % 2)))));
+}
+
+TEMPLATE_TEST_CASE("Half matmul: register path, transposed operands and gemv", "[half][gemm]", Half, BFloat16)
+{
+    using H = TestType;
+
+    static FusedMatrix<H, 70, 45> A;
+    static FusedMatrix<H, 45, 61> B;
+    static FusedMatrix<H, 70, 1> x;
+    fill(A, 1);
+    fill(B, 2);
+    fill(x, 3);
+
+    // Entries are multiples of 1/8 with magnitude ≤ 11/8: every float partial
+    // sum is exact, so each result is the exact product rounded once
+    auto P = FusedMatrix<H, 70, 61>::matmul(A, B);
+    for (my_size_t i = 0; i < 70; ++i)
+        for (my_size_t j = 0; j < 61; ++j)
+        {
+            float s = 0;
+            for (my_size_t k = 0; k < 45; ++k)
+                s += static_cast<float>(A(i, k)) * static_cast<float>(B(k, j));
+            REQUIRE(P(i, j).bits == H(s).bits);
+        }
+
+    auto Q = FusedMatrix<H, 45, 45>::matmul(A.transpose_view(), A);
+    for (my_size_t i = 0; i < 45; ++i)
+        for (my_size_t j = 0; j < 45; ++j)
+        {
+            float s = 0;
+            for (my_size_t k = 0; k < 70; ++k)
+                s += static_cast<float>(A(k, i)) * static_cast<float>(A(k, j));
+            REQUIRE(Q(i, j).bits == H(s).bits);
+        }
+
+    auto y = FusedMatrix<H, 45, 1>::matmul(A.transpose_view(), x);
+    auto z = FusedMatrix<H, 1, 45>::matmul(x.transpose_view(), A);
+    for (my_size_t j = 0; j < 45; ++j)
+    {
+        float s = 0;
+        for (my_size_t i = 0; i < 70; ++i)
+            s += static_cast<float>(A(i, j)) * static_cast<float>(x(i, 0));
+        REQUIRE(y(j, 0).bits == H(s).bits);
+        REQUIRE(z(0, j).bits == H(s).bits);
+    }
+}
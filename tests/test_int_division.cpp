@@ -0,0 +1,184 @@
+/**
+ * @file test_int_division.cpp
+ * @brief Catch2 tests for integer division by an invariant divisor and the 64-bit multiplies.
+ *
+ * Tests cover:
+ *   - IntDivisor<T> through Microkernel::div: equal to C++ division for
+ *     small, large, negative and power-of-two divisors, INT_MIN / INT_MAX
+ *     dividends and divisors, and the d = ±1 fallback
+ *   - Microkernel::mulhi (signed high half, 64-bit from 32-bit partial
+ *     products) and the low-half 64-bit mul
+ *   - tensor / scalar expressions, row tails (MaskedTail) and permuted views
+ */
+
+#include <catch_amalgamated.hpp>
+#include <cstdint>
+#include <limits>
+
+#include "config.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "fused/fused_matrix.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// Dividends: the extremes, small values and a 64-bit LCG spread over the range.
+template <typename T>
+static T dividend(unsigned n)
+{
+    const T special[] = {0, 1, -1, 2, -2, 7, -7, 12345, -12345,
+                         std::numeric_limits<T>::max(), std::numeric_limits<T>::min(),
+                         static_cast<T>(std::numeric_limits<T>::min() + 1)};
+    if (n < sizeof(special) / sizeof(special[0]))
+        return special[n];
+    unsigned long long s = n * 6364136223846793005ull + 1442695040888963407ull;
+    s ^= s >> 31;
+    return static_cast<T>(s >> ((n % 3) * 8 * sizeof(T) / 4)); // full-width, shorter and short values
+}
+
+template <typename T>
+static const T *divisors(my_size_t &count)
+{
+    static T d[160];
+    my_size_t n = 0;
+    for (T k = 2; k < 70; ++k)
+    {
+        d[n++] = k;
+        d[n++] = -k;
+    }
+    const T extra[] = {1, -1, 641, 1000003, -999983, T(1) << 20, -(T(1) << 27),
+                       std::numeric_limits<T>::max(), std::numeric_limits<T>::min(),
+                       static_cast<T>(std::numeric_limits<T>::min() + 1)};
+    for (T e : extra)
+        d[n++] = e;
+    count = n;
+    return d;
+}
+
+/// Signed high half of a 64 × 64 product, from 32-bit halves (reference for mulhi).
+static int64_t mulhi_reference(int64_t a, int64_t b)
+{
+    const uint64_t ua = static_cast<uint64_t>(a), ub = static_cast<uint64_t>(b);
+    const uint64_t a_lo = ua & 0xFFFFFFFFu, a_hi = ua >> 32;
+    const uint64_t b_lo = ub & 0xFFFFFFFFu, b_hi = ub >> 32;
+
+    const uint64_t lo_lo = a_lo * b_lo;
+    const uint64_t mid1 = a_hi * b_lo + (lo_lo >> 32);
+    const uint64_t mid2 = a_lo * b_hi + (mid1 & 0xFFFFFFFFu);
+    uint64_t hi = a_hi * b_hi + (mid1 >> 32) + (mid2 >> 32);
+
+    // Unsigned to signed: a negative operand counts as itself + 2^64
+    if (a < 0)
+        hi -= ub;
+    if (b < 0)
+        hi -= ua;
+    return static_cast<int64_t>(hi);
+}
+
+// ============================================================================
+// MICROKERNEL
+// ============================================================================
+
+TEMPLATE_TEST_CASE("IntDivisor: kernel division matches C++ division", "[int_division][microkernel]", int32_t, int64_t)
+{
+    using T = TestType;
+    using K = Microkernel<T, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+
+    my_size_t nd = 0;
+    const T *ds = divisors<T>(nd);
+    int bad = 0;
+    for (my_size_t i = 0; i < nd; ++i)
+    {
+        const IntDivisor<T> d(ds[i]);
+        CHECK((d.magic == 0) == (ds[i] == 1 || ds[i] == -1));
+
+        for (unsigned base = 0; base < 2000; base += W)
+        {
+            alignas(DATA_ALIGNAS) T n[W], q[W];
+            for (my_size_t l = 0; l < W; ++l)
+            {
+                n[l] = dividend<T>(base + static_cast<unsigned>(l));
+                if (ds[i] == -1 && n[l] == std::numeric_limits<T>::min())
+                    n[l] = 0; // overflows in C++ too
+            }
+            K::store(q, Div<T, BITS, DefaultArch>::apply(K::load(n), d));
+            for (my_size_t l = 0; l < W; ++l)
+                bad += q[l] != n[l] / ds[i];
+        }
+    }
+    CHECK(bad == 0);
+}
+
+TEMPLATE_TEST_CASE("Microkernel: signed mulhi and 64-bit mullo", "[int_division][microkernel]", int32_t, int64_t)
+{
+    using T = TestType;
+    using K = Microkernel<T, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+
+    int hi_bad = 0, lo_bad = 0;
+    for (unsigned base = 0; base < 3000; base += W)
+    {
+        alignas(DATA_ALIGNAS) T a[W], b[W], r[W];
+        for (my_size_t l = 0; l < W; ++l)
+        {
+            a[l] = dividend<T>(base + static_cast<unsigned>(l));
+            b[l] = dividend<T>(7 * (base + static_cast<unsigned>(l)) + 5);
+        }
+
+        if constexpr (requires { K::mulhi(K::load(a), K::load(b)); })
+        {
+            K::store(r, K::mulhi(K::load(a), K::load(b)));
+            for (my_size_t l = 0; l < W; ++l)
+            {
+                if constexpr (sizeof(T) == 4)
+                    hi_bad += r[l] != static_cast<T>((static_cast<int64_t>(a[l]) * b[l]) >> 32);
+                else
+                    hi_bad += r[l] != static_cast<T>(mulhi_reference(a[l], b[l]));
+            }
+        }
+
+        // Low half wraps: compare in unsigned arithmetic
+        using U = typename IntDivisor<T>::U;
+        K::store(r, K::mul(K::load(a), K::load(b)));
+        for (my_size_t l = 0; l < W; ++l)
+            lo_bad += static_cast<U>(r[l]) != static_cast<U>(static_cast<U>(a[l]) * static_cast<U>(b[l]));
+    }
+    CHECK(hi_bad == 0);
+    CHECK(lo_bad == 0);
+}
+
+// ============================================================================
+// EXPRESSIONS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Integer tensor / scalar expressions", "[int_division][expr]", int32_t, int64_t)
+{
+    using T = TestType;
+    FusedMatrix<T, 5, 13> A, C; // 13: every row ends in a partial vector
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 13; ++j)
+            A(i, j) = dividend<T>(static_cast<unsigned>(i * 13 + j)) / T(4);
+
+    for (T d : {T(7), T(-7), T(10), T(16), T(-1024), T(1), T(-1), T(1000003)})
+    {
+        C = A / d;
+        int bad = 0;
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+                bad += C(i, j) != A(i, j) / d;
+        CHECK(bad == 0);
+    }
+
+    C = (A + T(3)) / T(9) - A / T(-5);
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 13; ++j)
+            CHECK(C(i, j) == (A(i, j) + T(3)) / T(9) - A(i, j) / T(-5));
+
+    FusedMatrix<T, 13, 5> Ct;
+    Ct = A.transpose_view() / T(11);
+    for (my_size_t i = 0; i < 13; ++i)
+        for (my_size_t j = 0; j < 5; ++j)
+            CHECK(Ct(i, j) == A(j, i) / T(11));
+}
@@ -4,7 +4,12 @@
  *
  * Tests cover:
  *   - Direct KernelGemm::gemm() with raw pointers and strides
+ *   - Cache-blocked gemm_packed(): MC/KC/NC block boundaries, partial panels
+ *   - Per-thread packing buffers: fresh and concurrent threads
+ *   - Transposed operands (NN/NT/TN/TT) on the register and packed paths
+ *   - Fully unrolled gemm_small() for compile-time extents ≤ 8
  *   - einsum() GEMM dispatch for all 4 axis combos (a,b ∈ {0,1})
+ *   - N-D einsum: batched GEMM slices and the odometer fallback
  *   - Remainder handling: M%MR, N%NR, N%simdWidth
  *   - Padding-inducing dimensions (lastDim not multiple of simdWidth)
  *   - Degenerate shapes: single row, single column, 1×1
@@ -32,6 +37,9 @@
  */
 
 #include <catch_amalgamated.hpp>
+#include <functional>
+#include <thread>
+#include <type_traits>
 
 #include "config.h"
 #include "fused/microkernels/microkernel_base.h"
@@ -369,6 +377,387 @@ TEMPLATE_TEST_CASE("gemm direct: 100x100 — performance case vs naive", "[gemm]
             REQUIRE(C(i, j) == Approx(C_ref(i, j)).epsilon(1e-6));
 }
 
+// ============================================================================
+// PACKED (CACHE-BLOCKED) PATH
+// ============================================================================
+//
+// gemm_packed() splits M/K/N into MC/KC/NC blocks and packs panels.
+// Dimensions are chosen relative to the per-arch block sizes so every
+// block boundary and every partial micro-panel is crossed at least once.
+// Skipped on architectures with packing disabled (KC == 0).
+
+TEMPLATE_TEST_CASE("gemm packed: 7x13 * 13x11 — partial panels in every direction", "[gemm][packed][remainder][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    if constexpr (Gemm::KC != 0)
+    {
+        FusedTensorND<T, 7, 13> A;
+        FusedTensorND<T, 13, 11> B;
+        FusedTensorND<T, 7, 11> C;
+        FusedTensorND<T, 7, 11> C_ref;
+        A.setSequencial();
+        B.setSequencial();
+
+        using LayoutA = typename decltype(A)::Layout;
+        using LayoutB = typename decltype(B)::Layout;
+        using LayoutC = typename decltype(C)::Layout;
+
+        C.setToZero();
+        C_ref.setToZero();
+        Gemm::gemm_packed(
+            A.data(), 7, 13, LayoutA::stride(0),
+            B.data(), 11, LayoutB::stride(0),
+            C.data(), LayoutC::stride(0));
+
+        Gemm::gemm_register_blocked(
+            A.data(), 7, 13, LayoutA::stride(0),
+            B.data(), 11, LayoutB::stride(0),
+            C_ref.data(), LayoutC::stride(0));
+
+        for (my_size_t i = 0; i < 7; ++i)
+            for (my_size_t j = 0; j < 11; ++j)
+                REQUIRE(C(i, j) == C_ref(i, j));
+
+        // Padding columns of C must be left untouched
+        for (my_size_t i = 0; i < 7; ++i)
+            for (my_size_t j = 11; j < LayoutC::stride(0); ++j)
+                REQUIRE(C.data()[i * LayoutC::stride(0) + j] == T{0});
+    }
+}
+
+TEMPLATE_TEST_CASE("gemm packed: each thread packs into its own buffers", "[gemm][packed][thread][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    if constexpr (Gemm::KC != 0)
+    {
+        using MatA = FusedTensorND<T, 7, 13>;
+        using MatB = FusedTensorND<T, 13, 11>;
+        using MatC = FusedTensorND<T, 7, 11>;
+        MatA A;
+        MatB B;
+        A.setSequencial();
+        B.setSequencial();
+
+        const auto run = [&](MatC &C)
+        {
+            Gemm::gemm_packed(
+                A.data(), 7, 13, MatA::Layout::stride(0),
+                B.data(), 11, MatB::Layout::stride(0),
+                C.data(), MatC::Layout::stride(0));
+        };
+
+        MatC C_main;
+        run(C_main);
+
+        // Threads that allocate their panels on first use and free them on exit,
+        // two of them packing at the same time
+        MatC C_first, C_second, C_third;
+        std::thread(run, std::ref(C_first)).join();
+        std::thread t2(run, std::ref(C_second));
+        std::thread t3(run, std::ref(C_third));
+        t2.join();
+        t3.join();
+
+        for (my_size_t i = 0; i < 7; ++i)
+            for (my_size_t j = 0; j < 11; ++j)
+            {
+                REQUIRE(C_first(i, j) == C_main(i, j));
+                REQUIRE(C_second(i, j) == C_main(i, j));
+                REQUIRE(C_third(i, j) == C_main(i, j));
+            }
+    }
+}
+
+TEMPLATE_TEST_CASE("gemm packed: crosses MC, KC and NC block boundaries", "[gemm][packed][large][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    if constexpr (Gemm::KC != 0)
+    {
+        constexpr my_size_t M = Gemm::MC + Gemm::MR + 1;
+        constexpr my_size_t K = Gemm::KC + 7;
+        constexpr my_size_t N = Gemm::NC + Gemm::NR + 3;
+
+        // Large operands: keep them off the stack
+        static FusedTensorND<T, M, K> A;
+        static FusedTensorND<T, K, N> B;
+        static FusedTensorND<T, M, N> C;
+        static FusedTensorND<T, M, N> C_ref;
+        A.setSequencial();
+        B.setSequencial();
+
+        using LayoutA = typename FusedTensorND<T, M, K>::Layout;
+        using LayoutB = typename FusedTensorND<T, K, N>::Layout;
+        using LayoutC = typename FusedTensorND<T, M, N>::Layout;
+
+        Gemm::gemm_packed(
+            A.data(), M, K, LayoutA::stride(0),
+            B.data(), N, LayoutB::stride(0),
+            C.data(), LayoutC::stride(0));
+
+        naive_gemm(
+            A.data(), M, K, LayoutA::stride(0),
+            B.data(), N, LayoutB::stride(0),
+            C_ref.data(), LayoutC::stride(0));
+
+        for (my_size_t i = 0; i < M; ++i)
+            for (my_size_t j = 0; j < N; ++j)
+                REQUIRE(C(i, j) == Approx(C_ref(i, j)));
+    }
+}
+
+TEMPLATE_TEST_CASE("gemm dispatch: above PACK_MIN_VOLUME matches naive", "[gemm][packed][large][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    constexpr my_size_t M = 131, K = 129, N = 133;
+    static_assert(M * N * K >= Gemm::PACK_MIN_VOLUME);
+
+    static FusedTensorND<T, M, K> A;
+    static FusedTensorND<T, K, N> B;
+    static FusedTensorND<T, M, N> C;
+    static FusedTensorND<T, M, N> C_ref;
+    A.setSequencial();
+    B.setSequencial();
+
+    using LayoutA = typename FusedTensorND<T, M, K>::Layout;
+    using LayoutB = typename FusedTensorND<T, K, N>::Layout;
+    using LayoutC = typename FusedTensorND<T, M, N>::Layout;
+
+    Gemm::gemm(
+        A.data(), M, K, LayoutA::stride(0),
+        B.data(), N, LayoutB::stride(0),
+        C.data(), LayoutC::stride(0));
+
+    naive_gemm(
+        A.data(), M, K, LayoutA::stride(0),
+        B.data(), N, LayoutB::stride(0),
+        C_ref.data(), LayoutC::stride(0));
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+            REQUIRE(C(i, j) == Approx(C_ref(i, j)));
+}
+
+// ============================================================================
+// TRANSPOSED OPERANDS — NN / NT / TN / TT read in place
+// ============================================================================
+//
+// A is stored K×M when TransA, B is stored N×K when TransB. Each variant
+// must match the naive product of the logical (transposed) operands.
+
+template <typename T, bool TransA, bool TransB, my_size_t M, my_size_t K, my_size_t N, typename Run>
+static void check_transposed_gemm(Run run)
+{
+    using SA = std::conditional_t<TransA, FusedTensorND<T, K, M>, FusedTensorND<T, M, K>>;
+    using SB = std::conditional_t<TransB, FusedTensorND<T, N, K>, FusedTensorND<T, K, N>>;
+
+    // Large operands: keep them off the stack
+    static SA A;
+    static SB B;
+    static FusedTensorND<T, M, K> A_nn;
+    static FusedTensorND<T, K, N> B_nn;
+    static FusedTensorND<T, M, N> C;
+    static FusedTensorND<T, M, N> C_ref;
+    A.setSequencial();
+    B.setSequencial();
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t k = 0; k < K; ++k)
+            A_nn(i, k) = TransA ? A(k, i) : A(i, k);
+    for (my_size_t k = 0; k < K; ++k)
+        for (my_size_t j = 0; j < N; ++j)
+            B_nn(k, j) = TransB ? B(j, k) : B(k, j);
+
+    C.setToZero();
+    run(A.data(), SA::Layout::stride(0), B.data(), SB::Layout::stride(0),
+        C.data(), FusedTensorND<T, M, N>::Layout::stride(0));
+
+    naive_gemm(
+        A_nn.data(), M, K, FusedTensorND<T, M, K>::Layout::stride(0),
+        B_nn.data(), N, FusedTensorND<T, K, N>::Layout::stride(0),
+        C_ref.data(), FusedTensorND<T, M, N>::Layout::stride(0));
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+            REQUIRE(C(i, j) == Approx(C_ref(i, j)));
+
+    // Padding columns of C must be left untouched
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = N; j < FusedTensorND<T, M, N>::Layout::stride(0); ++j)
+            REQUIRE(C.data()[i * FusedTensorND<T, M, N>::Layout::stride(0) + j] == T{0});
+}
+
+TEMPLATE_TEST_CASE("gemm transposed: 7x13 * 13x11 — register path, all variants", "[gemm][transposed][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    auto via = [](auto ta, auto tb)
+    {
+        return [](const T *A, my_size_t lda, const T *B, my_size_t ldb, T *C, my_size_t ldc)
+        { Gemm::template gemm<decltype(ta)::value, decltype(tb)::value>(A, 7, 13, lda, B, 11, ldb, C, ldc); };
+    };
+    using F = std::false_type;
+    using Tr = std::true_type;
+
+    SECTION("NN") { check_transposed_gemm<T, false, false, 7, 13, 11>(via(F{}, F{})); }
+    SECTION("NT") { check_transposed_gemm<T, false, true, 7, 13, 11>(via(F{}, Tr{})); }
+    SECTION("TN") { check_transposed_gemm<T, true, false, 7, 13, 11>(via(Tr{}, F{})); }
+    SECTION("TT") { check_transposed_gemm<T, true, true, 7, 13, 11>(via(Tr{}, Tr{})); }
+}
+
+TEMPLATE_TEST_CASE("gemm transposed: register kernels read transposed B directly", "[gemm][transposed][test_kernel_gemm]", double, float)
+{
+    // gemm() stages Bᵀ when it can; the register kernels must also be
+    // correct on their own (vector gathers, or scalar loads on generic).
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    check_transposed_gemm<T, false, true, 9, 5, 29>(
+        [](const T *A, my_size_t lda, const T *B, my_size_t ldb, T *C, my_size_t ldc)
+        { Gemm::template gemm_register_blocked<false, true>(A, 9, 5, lda, B, 29, ldb, C, ldc); });
+    check_transposed_gemm<T, true, true, 9, 5, 29>(
+        [](const T *A, my_size_t lda, const T *B, my_size_t ldb, T *C, my_size_t ldc)
+        { Gemm::template gemm_register_blocked<true, true>(A, 9, 5, lda, B, 29, ldb, C, ldc); });
+}
+
+TEMPLATE_TEST_CASE("gemm transposed: packed path crosses block boundaries", "[gemm][transposed][packed][large][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    if constexpr (Gemm::KC != 0)
+    {
+        constexpr my_size_t M = Gemm::MC + Gemm::MR + 1;
+        constexpr my_size_t K = Gemm::KC + 7;
+        constexpr my_size_t N = Gemm::NR * 2 + 3;
+
+        auto via = [](auto ta, auto tb)
+        {
+            return [](const T *A, my_size_t lda, const T *B, my_size_t ldb, T *C, my_size_t ldc)
+            { Gemm::template gemm_packed<decltype(ta)::value, decltype(tb)::value>(A, M, K, lda, B, N, ldb, C, ldc); };
+        };
+        using F = std::false_type;
+        using Tr = std::true_type;
+
+        SECTION("NT") { check_transposed_gemm<T, false, true, M, K, N>(via(F{}, Tr{})); }
+        SECTION("TN") { check_transposed_gemm<T, true, false, M, K, N>(via(Tr{}, F{})); }
+        SECTION("TT") { check_transposed_gemm<T, true, true, M, K, N>(via(Tr{}, Tr{})); }
+    }
+}
+
+// ============================================================================
+// SMALL FIXED-SIZE GEMM — fully unrolled, extents ≤ SMALL_DIM_MAX
+// ============================================================================
+
+template <typename T, my_size_t M, my_size_t K, my_size_t N>
+static void check_small_gemm()
+{
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    auto via = [](auto ta, auto tb)
+    {
+        return [](const T *A, my_size_t lda, const T *B, my_size_t ldb, T *C, my_size_t ldc)
+        { Gemm::template gemm_small<M, K, N, decltype(ta)::value, decltype(tb)::value>(A, lda, B, ldb, C, ldc); };
+    };
+    using F = std::false_type;
+    using Tr = std::true_type;
+
+    check_transposed_gemm<T, false, false, M, K, N>(via(F{}, F{}));
+    check_transposed_gemm<T, false, true, M, K, N>(via(F{}, Tr{}));
+    check_transposed_gemm<T, true, false, M, K, N>(via(Tr{}, F{}));
+    check_transposed_gemm<T, true, true, M, K, N>(via(Tr{}, Tr{}));
+}
+
+TEMPLATE_TEST_CASE("gemm small: square shapes 1..8, all variants", "[gemm][small][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    check_small_gemm<T, 1, 1, 1>();
+    check_small_gemm<T, 2, 2, 2>();
+    check_small_gemm<T, 3, 3, 3>();
+    check_small_gemm<T, 4, 4, 4>();
+    check_small_gemm<T, 5, 5, 5>();
+    check_small_gemm<T, 6, 6, 6>();
+    check_small_gemm<T, 7, 7, 7>();
+    check_small_gemm<T, 8, 8, 8>();
+}
+
+TEMPLATE_TEST_CASE("gemm small: rectangular shapes, all variants", "[gemm][small][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    check_small_gemm<T, 6, 3, 6>();
+    check_small_gemm<T, 3, 6, 3>();
+    check_small_gemm<T, 8, 1, 5>();
+    check_small_gemm<T, 1, 8, 7>();
+    check_small_gemm<T, 7, 2, 8>();
+}
+
+TEMPLATE_TEST_CASE("gemm small: epilogue addend is indexed by output element", "[gemm][small][epilogue][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    FusedTensorND<T, 5, 3> A;
+    FusedTensorND<T, 3, 6> B;
+    FusedTensorND<T, 5, 6> R;
+    FusedTensorND<T, 5, 6> C;
+    FusedTensorND<T, 5, 6> C_ref;
+    A.setSequencial();
+    B.setSequencial();
+    R.setSequencial();
+
+    Gemm::template gemm_small<5, 3, 6>(A.data(), A.getStride(0), B.data(), B.getStride(0),
+                                        C.data(), C.getStride(0), GemmEpilogue<T>{}.scale(T(2)).add(R));
+    naive_gemm(A.data(), 5, 3, A.getStride(0), B.data(), 6, B.getStride(0), C_ref.data(), C_ref.getStride(0));
+
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t j = 0; j < 6; ++j)
+            REQUIRE(C(i, j) == Approx(T(2) * C_ref(i, j) + R(i, j)));
+}
+
+TEMPLATE_TEST_CASE("einsum gemm: small shapes select the unrolled kernel", "[gemm][einsum][small][test_kernel_gemm]", double, float)
+{
+    // Every einsum axis combination on a 3×3 / 6×4 pair goes through
+    // gemm_small; results must match the naive contraction.
+    using T = TestType;
+
+    FusedTensorND<T, 3, 3> A3;
+    FusedTensorND<T, 3, 3> B3;
+    FusedTensorND<T, 6, 4> A;
+    FusedTensorND<T, 4, 6> B;
+    A3.setSequencial();
+    B3.setSequencial();
+    A.setSequencial();
+    B.setSequencial();
+
+    for (my_size_t a = 0; a < 2; ++a)
+        for (my_size_t b = 0; b < 2; ++b)
+        {
+            auto C = FusedTensorND<T, 3, 3>::einsum(A3, B3, a, b);
+            auto ref = naive_einsum<T, 3, 3>(A3, B3, a, b);
+            for (my_size_t i = 0; i < 3; ++i)
+                for (my_size_t j = 0; j < 3; ++j)
+                    REQUIRE(C(i, j) == Approx(ref(i, j)));
+        }
+
+    auto C = FusedTensorND<T, 6, 6>::einsum(A, B, 1, 0);
+    auto ref = naive_einsum<T, 6, 6>(A, B, 1, 0);
+    for (my_size_t i = 0; i < 6; ++i)
+        for (my_size_t j = 0; j < 6; ++j)
+            REQUIRE(C(i, j) == Approx(ref(i, j)));
+
+    auto Ct = FusedTensorND<T, 6, 6>::einsum(A.transpose_view(), B.transpose_view(), 0, 1);
+    for (my_size_t i = 0; i < 6; ++i)
+        for (my_size_t j = 0; j < 6; ++j)
+            REQUIRE(Ct(i, j) == Approx(ref(i, j)));
+}
+
 // ============================================================================
 // EINSUM GEMM DISPATCH — all 4 axis combinations
 // ============================================================================
@@ -685,6 +1074,146 @@ TEMPLATE_TEST_CASE("einsum gemm: 5x7 * 7x5, all axis combos vs naive", "[gemm][e
     }
 }
 
+// ============================================================================
+// N-D EINSUM — batched GEMM slices and odometer fallback
+// ============================================================================
+
+TEMPLATE_TEST_CASE("einsum batched: [B,M,K] x [K,N] folds batch into rows", "[gemm][einsum][batched][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 3, 5, 7> A;
+    FusedTensorND<T, 7, 6> B;
+    A.setSequencial();
+    B.setSequencial();
+
+    auto C = FusedTensorND<T, 3, 5, 6>::einsum(A, B, 2, 0);
+
+    for (my_size_t b = 0; b < 3; ++b)
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 6; ++j)
+            {
+                T ref = T{0};
+                for (my_size_t k = 0; k < 7; ++k)
+                    ref += A(b, i, k) * B(k, j);
+                REQUIRE(C(b, i, j) == Approx(ref));
+            }
+}
+
+TEMPLATE_TEST_CASE("einsum batched: [M,K] x [B,K,N] loops over B slices", "[gemm][einsum][batched][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 5, 7> A;
+    FusedTensorND<T, 4, 7, 6> B;
+    A.setSequencial();
+    B.setSequencial();
+
+    auto C = FusedTensorND<T, 5, 4, 6>::einsum(A, B, 1, 1);
+
+    for (my_size_t i = 0; i < 5; ++i)
+        for (my_size_t b = 0; b < 4; ++b)
+            for (my_size_t j = 0; j < 6; ++j)
+            {
+                T ref = T{0};
+                for (my_size_t k = 0; k < 7; ++k)
+                    ref += A(i, k) * B(b, k, j);
+                REQUIRE(C(i, b, j) == Approx(ref));
+            }
+}
+
+TEMPLATE_TEST_CASE("einsum batched: [B,M,K] x [B',K,N] → [B,M,B',N]", "[gemm][einsum][batched][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 2, 5, 9> A;
+    FusedTensorND<T, 3, 9, 7> B;
+    A.setSequencial();
+    B.setSequencial();
+
+    auto C = FusedTensorND<T, 2, 5, 3, 7>::einsum(A, B, 2, 1);
+
+    for (my_size_t b = 0; b < 2; ++b)
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t b2 = 0; b2 < 3; ++b2)
+                for (my_size_t j = 0; j < 7; ++j)
+                {
+                    T ref = T{0};
+                    for (my_size_t k = 0; k < 9; ++k)
+                        ref += A(b, i, k) * B(b2, k, j);
+                    REQUIRE(C(b, i, b2, j) == Approx(ref));
+                }
+}
+
+TEMPLATE_TEST_CASE("einsum batched: large batch reaches the packed GEMM", "[gemm][einsum][batched][packed][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+
+    // 4·64 folded rows × 70 cols × 130 depth ≥ PACK_MIN_VOLUME
+    static FusedTensorND<T, 4, 64, 130> A;
+    static FusedTensorND<T, 130, 70> B;
+    A.setSequencial();
+    B.setSequencial();
+
+    static FusedTensorND<T, 4, 64, 70> C;
+    C = FusedTensorND<T, 4, 64, 70>::einsum(A, B, 2, 0);
+
+    for (my_size_t b = 0; b < 4; b += 3)
+        for (my_size_t i = 0; i < 64; i += 7)
+            for (my_size_t j = 0; j < 70; ++j)
+            {
+                T ref = T{0};
+                for (my_size_t k = 0; k < 130; ++k)
+                    ref += A(b, i, k) * B(k, j);
+                REQUIRE(C(b, i, j) == Approx(ref));
+            }
+}
+
+TEMPLATE_TEST_CASE("einsum N-D fallback: non-GEMM axis pairs vs naive", "[gemm][einsum][fallback][test_kernel_gemm]", double, float)
+{
+    using T = TestType;
+
+    SECTION("contract leading axis: [K,M,P] x [K,N]")
+    {
+        FusedTensorND<T, 7, 5, 3> A;
+        FusedTensorND<T, 7, 6> B;
+        A.setSequencial();
+        B.setSequencial();
+
+        auto C = FusedTensorND<T, 5, 3, 6>::einsum(A, B, 0, 0);
+
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t p = 0; p < 3; ++p)
+                for (my_size_t j = 0; j < 6; ++j)
+                {
+                    T ref = T{0};
+                    for (my_size_t k = 0; k < 7; ++k)
+                        ref += A(k, i, p) * B(k, j);
+                    REQUIRE(C(i, p, j) == Approx(ref));
+                }
+    }
+
+    SECTION("contract both last axes: [B,M,K] x [N,K]")
+    {
+        FusedTensorND<T, 3, 5, 7> A;
+        FusedTensorND<T, 6, 7> B;
+        A.setSequencial();
+        B.setSequencial();
+
+        auto C = FusedTensorND<T, 3, 5, 6>::einsum(A, B, 2, 1);
+
+        for (my_size_t b = 0; b < 3; ++b)
+            for (my_size_t i = 0; i < 5; ++i)
+                for (my_size_t j = 0; j < 6; ++j)
+                {
+                    T ref = T{0};
+                    for (my_size_t k = 0; k < 7; ++k)
+                        ref += A(b, i, k) * B(j, k);
+                    REQUIRE(C(b, i, j) == Approx(ref));
+                }
+    }
+}
+
 // ============================================================================
 // IDENTITY AND SPECIAL MATRICES
 // ============================================================================
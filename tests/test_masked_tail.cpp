@@ -0,0 +1,363 @@
+/**
+ * @file test_masked_tail.cpp
+ * @brief Catch2 tests for masked tail loads/stores and the kernels built on them.
+ *
+ * Tests cover:
+ *   - Microkernel::maskload / maskstore touch exactly the first n lanes
+ *   - MaskedTail<Arch, N>: partial-vector evaluation, integer division
+ *   - KernelEval (contiguous and permuted), KernelReduce, KernelCompare
+ *     on shapes whose last dimension is not a multiple of simdWidth
+ *   - KernelDot contiguous K tails
+ *   - KernelGemm N tails (register path, NN and NT, plain and scaled
+ *     epilogues), gemm_small and gemv K / M tails
+ *
+ * Padding slots of every input are poisoned (NaN, or a large value for
+ * integers), so a tail that reads past the logical row and lets the value
+ * reach a result fails the comparison. Output padding is checked to be
+ * untouched. Under TESSERACT_NO_PADDING there is no padding to poison and
+ * the same tests exercise the compact layout.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <limits>
+#include <type_traits>
+
+#include "config.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "fused/kernel_ops/kernel_ops.h"
+#include "fused/kernel_ops/kernel_gemm.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+template <typename T>
+static T poison()
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return std::numeric_limits<T>::quiet_NaN();
+    else
+        return T(1) << 20;
+}
+
+/// Overwrite every padding slot of X's physical buffer with v.
+template <typename Tensor, typename T>
+static void fill_padding(Tensor &X, T v)
+{
+    using P = typename Tensor::Layout::PadPolicyType;
+    for (my_size_t s = 0; s < P::PhysicalSize / P::PaddedLastDim; ++s)
+        for (my_size_t l = P::LastDim; l < P::PaddedLastDim; ++l)
+            X.data()[s * P::PaddedLastDim + l] = v;
+}
+
+/// True if every padding slot of X still holds v.
+template <typename Tensor, typename T>
+static bool padding_is(const Tensor &X, T v)
+{
+    using P = typename Tensor::Layout::PadPolicyType;
+    for (my_size_t s = 0; s < P::PhysicalSize / P::PaddedLastDim; ++s)
+        for (my_size_t l = P::LastDim; l < P::PaddedLastDim; ++l)
+            if (X.data()[s * P::PaddedLastDim + l] != v)
+                return false;
+    return true;
+}
+
+// ============================================================================
+// MICROKERNEL
+// ============================================================================
+
+TEMPLATE_TEST_CASE("maskload / maskstore touch exactly n lanes", "[masked_tail][microkernel]",
+                   double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    using K = Microkernel<T, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+
+    T src[W + 2];
+    for (my_size_t l = 0; l < W + 2; ++l)
+        src[l] = static_cast<T>(l + 1);
+
+    for (my_size_t n = 0; n <= W; ++n)
+    {
+        alignas(DATA_ALIGNAS) T lanes[W];
+        K::store(lanes, K::maskload(src, n));
+        for (my_size_t l = 0; l < W; ++l)
+            REQUIRE(lanes[l] == (l < n ? src[l] : T{0}));
+
+        T dst[W + 2];
+        for (my_size_t l = 0; l < W + 2; ++l)
+            dst[l] = T(-1);
+        K::maskstore(dst, K::set1(T(9)), n);
+        for (my_size_t l = 0; l < W + 2; ++l)
+            REQUIRE(dst[l] == (l < n ? T(9) : T(-1)));
+    }
+}
+
+TEMPLATE_TEST_CASE("MaskedTail: partial vector through an expression", "[masked_tail][microkernel]",
+                   double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    using K = Microkernel<T, BITS, DefaultArch>;
+    constexpr my_size_t W = K::simdWidth;
+
+    if constexpr (W > 1)
+    {
+        constexpr my_size_t N = W - 1;
+        using KM = Microkernel<T, BITS, MaskedTail<DefaultArch, N>>;
+
+        FusedMatrix<T, 2, W> A, B;
+        for (my_size_t j = 0; j < W; ++j)
+        {
+            A(0, j) = static_cast<T>(12 * (j + 1));
+            B(0, j) = static_cast<T>(j + 1);
+        }
+
+        alignas(DATA_ALIGNAS) T lanes[W];
+        K::store(lanes, (A + B).template evalu<T, BITS, MaskedTail<DefaultArch, N>>(0));
+        for (my_size_t l = 0; l < W; ++l)
+            REQUIRE(lanes[l] == (l < N ? static_cast<T>(13 * (l + 1)) : T{0}));
+
+        // Dead lanes divide 0 by 0: must not trap for integers
+        K::store(lanes, KM::div(KM::load(A.data()), KM::load(B.data())));
+        for (my_size_t l = 0; l < N; ++l)
+            REQUIRE(lanes[l] == T(12));
+        K::store(lanes, KM::div(T(24), KM::load(B.data())));
+        for (my_size_t l = 0; l < N; ++l)
+            REQUIRE(lanes[l] == T(24) / static_cast<T>(l + 1));
+    }
+}
+
+// ============================================================================
+// EVAL / REDUCE / COMPARE
+// ============================================================================
+
+TEMPLATE_TEST_CASE("eval, reduce and compare with row tails", "[masked_tail][eval][reduce]",
+                   double, float, int32_t, int64_t)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 5, 3> A, B;
+    FusedMatrix<T, 3, 13> C, D;
+    A.setSequencial();
+    B.setSequencial();
+    C.setSequencial();
+    D.setHomogen(T(3)); // C - D changes sign
+    fill_padding(A, poison<T>());
+    fill_padding(B, poison<T>());
+    fill_padding(C, poison<T>());
+    fill_padding(D, poison<T>());
+
+    SECTION("contiguous eval")
+    {
+        FusedMatrix<T, 3, 13> E;
+        fill_padding(E, T(77));
+        E = C + D * T(2);
+        for (my_size_t i = 0; i < 3; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+                REQUIRE(E(i, j) == C(i, j) + D(i, j) * T(2));
+    }
+
+    SECTION("permuted eval leaves output padding untouched")
+    {
+        FusedMatrix<T, 3, 5> E;
+        fill_padding(E, T(77));
+        E = A.transpose_view() + B.transpose_view();
+        for (my_size_t i = 0; i < 3; ++i)
+            for (my_size_t j = 0; j < 5; ++j)
+                REQUIRE(E(i, j) == A(j, i) + B(j, i));
+        REQUIRE(padding_is(E, T(77)));
+    }
+
+    SECTION("min / max / sum ignore padding")
+    {
+        T mn = C(0, 0) - D(0, 0), mx = mn, sm = T{0};
+        for (my_size_t i = 0; i < 3; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+            {
+                const T v = C(i, j) - D(i, j);
+                mn = v < mn ? v : mn;
+                mx = v > mx ? v : mx;
+                sm += v;
+            }
+        REQUIRE(min(C - D) == mn);
+        REQUIRE(max(C - D) == mx);
+        REQUIRE(sum(C - D) == sm);
+
+        // Tail-only shape: every element is in the partial vector
+        T amn = A(0, 0), amx = A(0, 0) + B(0, 0);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 3; ++j)
+            {
+                amn = A(i, j) < amn ? A(i, j) : amn;
+                amx = A(i, j) + B(i, j) > amx ? A(i, j) + B(i, j) : amx;
+            }
+        REQUIRE(min(A) == amn);
+        REQUIRE(max(A + B) == amx);
+    }
+
+    SECTION("compare checks the tail lanes only")
+    {
+        FusedMatrix<T, 3, 13> E;
+        E = C;
+        fill_padding(E, T(55));
+        REQUIRE(E == C);
+
+        E(2, 12) = C(2, 12) + T(1);
+        REQUIRE_FALSE(E == C);
+    }
+}
+
+TEMPLATE_TEST_CASE("reduce over a 3-D tensor with a tail", "[masked_tail][reduce]", double, float)
+{
+    using T = TestType;
+
+    FusedTensorND<T, 2, 3, 7> X;
+    X.setSequencial();
+    fill_padding(X, poison<T>());
+
+    REQUIRE(min(X) == T(0));
+    REQUIRE(max(X) == T(41));
+    REQUIRE(sum(X) == Approx(41.0 * 42.0 / 2.0));
+}
+
+// ============================================================================
+// DOT
+// ============================================================================
+
+TEMPLATE_TEST_CASE("dot contiguous: K tails of every length", "[masked_tail][dot]", double, float)
+{
+    using T = TestType;
+    using Kernel = KernelOps<T, BITS, DefaultArch>;
+
+    FusedMatrix<T, 2, 19> A;
+    A.setSequencial();
+    fill_padding(A, poison<T>());
+    const my_size_t stride0 = A.getStride(0);
+
+    for (my_size_t len = 1; len <= 19; ++len)
+    {
+        T ref = T{0};
+        for (my_size_t k = 0; k < len; ++k)
+            ref += A(0, k) * A(1, k);
+        REQUIRE(Kernel::dot(A, 0, 1, A, stride0, 1, len) == ref);
+    }
+}
+
+// ============================================================================
+// GEMM
+// ============================================================================
+
+/// C = A·op(B) (+ scaled epilogue) through KernelGemm::gemm, checked against a naive product.
+template <typename T, bool TransB, bool Scaled, my_size_t M, my_size_t Kd, my_size_t N>
+static void check_gemm_tail()
+{
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    using SB = std::conditional_t<TransB, FusedMatrix<T, N, Kd>, FusedMatrix<T, Kd, N>>;
+
+    static FusedMatrix<T, M, Kd> A;
+    static SB B;
+    static FusedMatrix<T, M, N> C;
+    A.setSequencial();
+    B.setSequencial();
+    fill_padding(A, poison<T>());
+    fill_padding(B, poison<T>());
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+            C(i, j) = T(1);
+    fill_padding(C, T(77));
+
+    if constexpr (Scaled)
+        Gemm::template gemm<false, TransB>(A.data(), M, Kd, A.getStride(0), B.data(), N, B.getStride(0),
+                                           C.data(), C.getStride(0), GemmEpilogue<T>{}.scale(T(2), T(1)));
+    else
+        Gemm::template gemm<false, TransB>(A.data(), M, Kd, A.getStride(0), B.data(), N, B.getStride(0),
+                                           C.data(), C.getStride(0));
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+        {
+            T sum = T{0};
+            for (my_size_t k = 0; k < Kd; ++k)
+                sum += A(i, k) * (TransB ? B(j, k) : B(k, j));
+            REQUIRE(C(i, j) == (Scaled ? T(2) * sum + T(1) : sum));
+        }
+    REQUIRE(padding_is(C, T(77)));
+}
+
+TEMPLATE_TEST_CASE("gemm: N tails as one partial vector", "[masked_tail][gemm]", double, float)
+{
+    using T = TestType;
+    check_gemm_tail<T, false, false, 5, 7, 3>();
+    check_gemm_tail<T, false, false, 7, 13, 11>();
+    check_gemm_tail<T, false, false, 13, 9, 37>();
+    check_gemm_tail<T, true, false, 7, 13, 11>();
+    check_gemm_tail<T, true, false, 13, 9, 37>();
+    check_gemm_tail<T, false, true, 7, 13, 11>();
+    check_gemm_tail<T, true, true, 9, 4, 21>();
+}
+
+TEMPLATE_TEST_CASE("gemm_small and gemv with poisoned padding", "[masked_tail][gemm][gemv]", double, float)
+{
+    using T = TestType;
+
+    SECTION("matmul 5×7 · 7×6 (unrolled)")
+    {
+        FusedMatrix<T, 5, 7> A;
+        FusedMatrix<T, 7, 6> B;
+        A.setSequencial();
+        B.setSequencial();
+        fill_padding(A, poison<T>());
+        fill_padding(B, poison<T>());
+        auto C = FusedMatrix<T, 5, 6>::matmul(A, B);
+        for (my_size_t i = 0; i < 5; ++i)
+            for (my_size_t j = 0; j < 6; ++j)
+            {
+                T sum = T{0};
+                for (my_size_t k = 0; k < 7; ++k)
+                    sum += A(i, k) * B(k, j);
+                REQUIRE(C(i, j) == sum);
+            }
+    }
+
+    SECTION("F·x dot form with a K tail")
+    {
+        FusedMatrix<T, 13, 37> F;
+        FusedMatrix<T, 37, 1> x;
+        F.setSequencial();
+        x.setSequencial();
+        fill_padding(F, poison<T>());
+        fill_padding(x, poison<T>());
+        auto y = FusedMatrix<T, 13, 1>::matmul(F, x);
+        for (my_size_t i = 0; i < 13; ++i)
+        {
+            T sum = T{0};
+            for (my_size_t k = 0; k < 37; ++k)
+                sum += F(i, k) * x(k, 0);
+            REQUIRE(y(i, 0) == sum);
+        }
+    }
+
+    SECTION("xᵀ·B axpy form with a partial vector of y")
+    {
+        FusedMatrix<T, 1, 11> x;
+        FusedMatrix<T, 11, 21> B;
+        x.setSequencial();
+        B.setSequencial();
+        fill_padding(x, poison<T>());
+        fill_padding(B, poison<T>());
+        FusedMatrix<T, 1, 21> y;
+        fill_padding(y, T(77));
+        y = FusedMatrix<T, 1, 21>::matmul(x, B);
+        for (my_size_t j = 0; j < 21; ++j)
+        {
+            T sum = T{0};
+            for (my_size_t k = 0; k < 11; ++k)
+                sum += x(0, k) * B(k, j);
+            REQUIRE(y(0, j) == sum);
+        }
+    }
+}
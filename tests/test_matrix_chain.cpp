@@ -0,0 +1,144 @@
+#include <catch_amalgamated.hpp>
+
+#include "fused/fused_matrix.h"
+#include "algorithms/operations/matrix_chain.h"
+
+using Catch::Approx;
+
+template <typename T, my_size_t R, my_size_t C>
+static void require_close(const FusedMatrix<T, R, C> &A, const FusedMatrix<T, R, C> &B)
+{
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            REQUIRE(A(i, j) == Approx(B(i, j)).epsilon(1e-4));
+}
+
+// ============================================================================
+// COMPILE-TIME ORDERING
+// ============================================================================
+
+TEST_CASE("matrix_chain_order: textbook six-matrix chain", "[matrix_chain]")
+{
+    // CLRS 15.2: 30×35, 35×15, 15×5, 5×10, 10×20, 20×25 → ((A1(A2A3))((A4A5)A6))
+    constexpr my_size_t d[] = {30, 35, 15, 5, 10, 20, 25};
+    constexpr auto plan = matrix_algorithms::detail::matrix_chain_order<6>(d);
+
+    STATIC_REQUIRE(plan.cost[0][5] == 15125);
+    STATIC_REQUIRE(plan.split[0][5] == 2);
+    STATIC_REQUIRE(plan.split[0][2] == 0);
+    STATIC_REQUIRE(plan.split[3][5] == 4);
+}
+
+TEST_CASE("prod: picks the cheap association for a tall-skinny chain", "[matrix_chain]")
+{
+    // Hᵀ·H·P with N=15, M=3: Hᵀ·(H·P) costs 1350, (Hᵀ·H)·P costs 4050
+    using Chain = matrix_algorithms::detail::MatrixChain<double,
+                                                         FusedMatrix<double, 15, 3>,
+                                                         FusedMatrix<double, 3, 15>,
+                                                         FusedMatrix<double, 15, 15>>;
+    STATIC_REQUIRE(Chain::plan.split[0][2] == 0);
+    STATIC_REQUIRE(Chain::plan.cost[0][2] == 1350);
+}
+
+// ============================================================================
+// RESULTS MATCH LEFT-TO-RIGHT MATMUL
+// ============================================================================
+
+TEMPLATE_TEST_CASE("prod: matches nested matmul", "[matrix_chain]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 15, 3> A;
+    FusedMatrix<T, 3, 15> B;
+    FusedMatrix<T, 15, 15> C;
+    FusedMatrix<T, 15, 7> D;
+    A.setSequencial();
+    B.setSequencial();
+    C.setSequencial();
+    D.setSequencial();
+
+    SECTION("two operands")
+    {
+        auto ref = FusedMatrix<T, 15, 15>::matmul(A, B);
+        require_close(matrix_algorithms::prod(A, B), ref);
+    }
+
+    SECTION("three operands")
+    {
+        auto AB = FusedMatrix<T, 15, 15>::matmul(A, B);
+        auto ref = FusedMatrix<T, 15, 15>::matmul(AB, C);
+        require_close(matrix_algorithms::prod(A, B, C), ref);
+    }
+
+    SECTION("four operands")
+    {
+        auto AB = FusedMatrix<T, 15, 15>::matmul(A, B);
+        auto ABC = FusedMatrix<T, 15, 15>::matmul(AB, C);
+        auto ref = FusedMatrix<T, 15, 7>::matmul(ABC, D);
+        require_close(matrix_algorithms::prod(A, B, C, D), ref);
+    }
+
+    SECTION("single operand is a copy")
+    {
+        auto r = matrix_algorithms::prod(D);
+        require_close(r, D);
+    }
+}
+
+TEMPLATE_TEST_CASE("prod: views and expressions as operands", "[matrix_chain]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 6, 3> K;
+    FusedMatrix<T, 3, 3> R;
+    FusedMatrix<T, 6, 6> P;
+    K.setSequencial();
+    R.setSequencial();
+    P.setSequencial();
+
+    SECTION("K·R·Kᵀ")
+    {
+        auto KR = FusedMatrix<T, 6, 3>::matmul(K, R);
+        auto ref = FusedMatrix<T, 6, 6>::matmul(KR, K.transpose_view());
+        require_close(matrix_algorithms::prod(K, R, K.transpose_view()), ref);
+    }
+
+    SECTION("Kᵀ·P·K with a transposed leading operand")
+    {
+        auto KtP = FusedMatrix<T, 3, 6>::matmul(K.transpose_view(), P);
+        auto ref = FusedMatrix<T, 3, 3>::matmul(KtP, K);
+        require_close(matrix_algorithms::prod(K.transpose_view(), P, K), ref);
+    }
+
+    SECTION("(P + P)·K·R")
+    {
+        FusedMatrix<T, 6, 6> P2;
+        P2 = P + P;
+        auto PK = FusedMatrix<T, 6, 3>::matmul(P2, K);
+        auto ref = FusedMatrix<T, 6, 3>::matmul(PK, R);
+        require_close(matrix_algorithms::prod(P + P, K, R), ref);
+    }
+}
+
+TEMPLATE_TEST_CASE("prod: odd shapes with padding", "[matrix_chain]", double, float)
+{
+    using T = TestType;
+
+    FusedMatrix<T, 5, 9> A;
+    FusedMatrix<T, 9, 2> B;
+    FusedMatrix<T, 2, 11> C;
+    FusedMatrix<T, 11, 3> D;
+    FusedMatrix<T, 3, 13> E;
+    A.setSequencial();
+    B.setSequencial();
+    C.setSequencial();
+    D.setSequencial();
+    E.setSequencial();
+
+    auto AB = FusedMatrix<T, 5, 2>::matmul(A, B);
+    auto ABC = FusedMatrix<T, 5, 11>::matmul(AB, C);
+    auto ABCD = FusedMatrix<T, 5, 3>::matmul(ABC, D);
+    auto ref = FusedMatrix<T, 5, 13>::matmul(ABCD, E);
+
+    require_close(matrix_algorithms::prod(A, B, C, D, E), ref);
+}
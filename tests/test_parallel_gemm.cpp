@@ -0,0 +1,248 @@
+/**
+ * @file test_parallel_gemm.cpp
+ * @brief Catch2 tests for the opt-in parallel GEMM path.
+ *
+ * Tests cover:
+ *   - ThreadPool runs every index exactly once, including reuse across jobs
+ *   - gemm_packed() with an executor is bit-identical to the serial path
+ *   - Row-band / column-chunk partitioning for tall, wide and odd shapes
+ *   - Size threshold keeps small products off the executor; a lower threshold
+ *     sends them through the packed path onto it
+ *   - Injected custom executor is used by einsum/matmul
+ *   - Nested calls from inside a task fall back to serial
+ */
+
+#include <catch_amalgamated.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include "config.h"
+#include "fused/kernel_ops/kernel_ops.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+#include "utilities/parallel_executor.h"
+#include "utilities/thread_pool.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// Restores the global executor on scope exit so tests stay independent.
+struct ExecutorGuard
+{
+    ExecutorGuard(ParallelExecutor *ex, my_size_t min_volume = ParallelContext::DEFAULT_MIN_VOLUME)
+    {
+        ParallelContext::set_executor(ex, min_volume);
+    }
+    ~ExecutorGuard() { ParallelContext::set_executor(nullptr); }
+};
+
+/// Executor that runs tasks serially on the caller, in reverse order,
+/// and counts submissions. Reverse order catches tasks that depend on
+/// each other's output.
+struct CountingExecutor final : ParallelExecutor
+{
+    my_size_t workers;
+    my_size_t jobs = 0;
+    my_size_t tasks = 0;
+
+    explicit CountingExecutor(my_size_t w) : workers(w) {}
+
+    my_size_t num_workers() const noexcept override { return workers; }
+
+    void parallel_for(my_size_t count, ParallelTask task, void *ctx) noexcept override
+    {
+        ++jobs;
+        tasks += count;
+        for (my_size_t i = count; i-- > 0;)
+            task(ctx, i);
+    }
+};
+
+/// Run gemm_packed serially and with @p ex; require bit-identical outputs.
+template <typename T, my_size_t M, my_size_t K, my_size_t N>
+static void check_bit_identical(ParallelExecutor &ex)
+{
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    static FusedTensorND<T, M, K> A;
+    static FusedTensorND<T, K, N> B;
+    static FusedTensorND<T, M, N> C_serial;
+    static FusedTensorND<T, M, N> C_parallel;
+    A.setSequencial();
+    B.setSequencial();
+
+    constexpr my_size_t sA = FusedTensorND<T, M, K>::Layout::stride(0);
+    constexpr my_size_t sB = FusedTensorND<T, K, N>::Layout::stride(0);
+    constexpr my_size_t sC = FusedTensorND<T, M, N>::Layout::stride(0);
+
+    Gemm::gemm_packed(A.data(), M, K, sA, B.data(), N, sB, C_serial.data(), sC);
+    {
+        ExecutorGuard guard(&ex, 0);
+        Gemm::gemm_packed(A.data(), M, K, sA, B.data(), N, sB, C_parallel.data(), sC);
+    }
+
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+            REQUIRE(C_parallel(i, j) == C_serial(i, j));
+}
+
+// ============================================================================
+// THREAD POOL
+// ============================================================================
+
+TEST_CASE("ThreadPool: every index runs exactly once", "[parallel][thread_pool]")
+{
+    ThreadPool pool(4);
+    REQUIRE(pool.num_workers() == 4);
+
+    for (my_size_t count : {my_size_t(0), my_size_t(1), my_size_t(3), my_size_t(1000)})
+    {
+        std::vector<std::atomic<int>> hits(count);
+        pool.parallel_for(count, [](void *ctx, my_size_t i)
+                          { (*static_cast<std::vector<std::atomic<int>> *>(ctx))[i]++; },
+                          &hits);
+        for (my_size_t i = 0; i < count; ++i)
+            REQUIRE(hits[i].load() == 1);
+    }
+}
+
+TEST_CASE("ThreadPool: single-thread pool runs on caller", "[parallel][thread_pool]")
+{
+    ThreadPool pool(1);
+    REQUIRE(pool.num_workers() == 1);
+
+    my_size_t sum = 0;
+    pool.parallel_for(10, [](void *ctx, my_size_t i)
+                      { *static_cast<my_size_t *>(ctx) += i; },
+                      &sum);
+    REQUIRE(sum == 45);
+}
+
+// ============================================================================
+// BIT-IDENTICAL TO SERIAL
+// ============================================================================
+
+TEMPLATE_TEST_CASE("parallel gemm: bit-identical to serial (thread pool)", "[parallel][gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    if constexpr (Gemm::KC != 0)
+    {
+        ThreadPool pool(4);
+
+        SECTION("square, crosses KC") { check_bit_identical<T, 150, Gemm::KC + 9, 150>(pool); }
+        SECTION("tall: more row bands than workers") { check_bit_identical<T, 301, 40, 37>(pool); }
+        SECTION("wide: fewer row bands than workers") { check_bit_identical<T, 5, 70, Gemm::NC + 29>(pool); }
+    }
+}
+
+TEMPLATE_TEST_CASE("parallel gemm: bit-identical to serial (reverse-order executor)", "[parallel][gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    if constexpr (Gemm::KC != 0)
+    {
+        CountingExecutor ex(7);
+        check_bit_identical<T, 67, 33, 101>(ex);
+        REQUIRE(ex.jobs == 1);
+        REQUIRE(ex.tasks >= 7);
+    }
+}
+
+// ============================================================================
+// THRESHOLD AND INJECTION
+// ============================================================================
+
+TEMPLATE_TEST_CASE("parallel gemm: small products stay serial", "[parallel][gemm][threshold]", double, float)
+{
+    using T = TestType;
+
+    CountingExecutor ex(8);
+    ExecutorGuard guard(&ex);
+
+    FusedMatrix<T, 24, 24> A, B;
+    A.setSequencial();
+    B.setSequencial();
+    auto C = FusedMatrix<T, 24, 24>::matmul(A, B);
+    (void)C;
+
+    REQUIRE(ex.jobs == 0);
+}
+
+TEMPLATE_TEST_CASE("parallel gemm: a threshold below the packing volume is honoured", "[parallel][gemm][threshold]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    using Mat = FusedMatrix<T, 40, 40>;
+    STATIC_REQUIRE(40 * 40 * 40 < Gemm::PACK_MIN_VOLUME);
+
+    Mat A, B;
+    A.setSequencial();
+    B.setSequencial();
+    const Mat C_serial = Mat::matmul(A, B);
+
+    CountingExecutor ex(4);
+    ExecutorGuard guard(&ex, 32 * 32 * 32);
+    const Mat C_parallel = Mat::matmul(A, B);
+
+    if constexpr (Gemm::KC != 0)
+        REQUIRE(ex.jobs > 0);
+
+    // Packed and register paths sum in different orders
+    for (my_size_t i = 0; i < 40; ++i)
+        for (my_size_t j = 0; j < 40; ++j)
+            REQUIRE(C_parallel(i, j) == Approx(C_serial(i, j)));
+}
+
+TEMPLATE_TEST_CASE("parallel gemm: single-worker executor is ignored", "[parallel][gemm][threshold]", double, float)
+{
+    CountingExecutor ex(1);
+    ExecutorGuard guard(&ex, 0);
+
+    REQUIRE(ParallelContext::executor_for(1u << 30) == nullptr);
+}
+
+TEMPLATE_TEST_CASE("parallel gemm: injected executor drives matmul", "[parallel][gemm][einsum]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    using Mat = FusedMatrix<T, 160, 160>;
+
+    static Mat A, B;
+    A.setSequencial();
+    B.setSequencial();
+
+    static Mat C_serial;
+    C_serial = Mat::matmul(A, B);
+
+    CountingExecutor ex(4);
+    ExecutorGuard guard(&ex);
+    static Mat C_parallel;
+    C_parallel = Mat::matmul(A, B);
+
+    if constexpr (Gemm::KC != 0)
+        REQUIRE(ex.jobs > 0);
+
+    for (my_size_t i = 0; i < 160; ++i)
+        for (my_size_t j = 0; j < 160; ++j)
+            REQUIRE(C_parallel(i, j) == C_serial(i, j));
+}
+
+TEST_CASE("ParallelContext: nested calls inside a task run serially", "[parallel][nested]")
+{
+    CountingExecutor ex(4);
+    ExecutorGuard guard(&ex, 0);
+
+    REQUIRE(ParallelContext::executor_for(1) == &ex);
+    {
+        ParallelContext::TaskScope scope;
+        REQUIRE(ParallelContext::executor_for(1) == nullptr);
+    }
+    REQUIRE(ParallelContext::executor_for(1) == &ex);
+}
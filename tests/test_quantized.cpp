@@ -0,0 +1,319 @@
+/**
+ * @file test_quantized.cpp
+ * @brief Catch2 tests for QuantizedMatrix and the int8 quantized GEMM.
+ *
+ * Tests cover:
+ *   - Affine and symmetric quantization: parameters, round-trip error,
+ *     per-tensor and per-row
+ *   - set() / row_sum() bookkeeping and the zero padding past Cols
+ *   - qlinear to int32 against a brute-force reference with zero points,
+ *     on shapes that leave M, N and K remainders for every kernel
+ *   - Dequantize and requantize epilogues, with and without bias
+ *   - Chaining two requantized layers
+ *
+ * int32 results are exact and compared with ==. Requantized values may
+ * differ by one from the reference where float rounding lands on a tie.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <cmath>
+
+#include "config.h"
+#include "fused/fused_quantized.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+template <my_size_t R, my_size_t C>
+static void fill_real(FusedMatrix<float, R, C> &X, unsigned seed, float lo, float hi)
+{
+    unsigned s = seed * 2654435761u;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            s = s * 1664525u + 1013904223u;
+            X(i, j) = lo + (hi - lo) * static_cast<float>((s >> 8) & 0xffff) / 65535.0f;
+        }
+}
+
+/// Σₖ (x − zx)(w − zw) computed one element at a time.
+template <my_size_t M, my_size_t N, my_size_t K, QuantAxis AX, QuantAxis AW>
+static int64_t reference_dot(const QuantizedMatrix<M, K, AX> &X, const QuantizedMatrix<N, K, AW> &W,
+                             my_size_t i, my_size_t j)
+{
+    int64_t acc = 0;
+    for (my_size_t k = 0; k < K; ++k)
+        acc += static_cast<int64_t>(X(i, k) - X.zero_point(i)) * (W(j, k) - W.zero_point(j));
+    return acc;
+}
+
+template <my_size_t M, my_size_t N, my_size_t K, QuantAxis AW>
+static void check_qlinear_int32(unsigned seed)
+{
+    static FusedMatrix<float, M, K> X;
+    static FusedMatrix<float, N, K> W;
+    fill_real(X, seed, -1.0f, 2.0f);
+    fill_real(W, seed + 1, -0.7f, 0.4f);
+    static auto Xq = QuantizedMatrix<M, K>::quantize(X);
+    static auto Wq = QuantizedMatrix<N, K, AW>::quantize(W);
+    Xq = QuantizedMatrix<M, K>::quantize(X);
+    Wq = QuantizedMatrix<N, K, AW>::quantize(W);
+
+    static FusedMatrix<int32_t, M, N> Y;
+    qlinear(Xq, Wq, Y);
+
+    my_size_t wrong = 0;
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+            wrong += (Y(i, j) != reference_dot(Xq, Wq, i, j));
+    CHECK(wrong == 0);
+}
+
+// ============================================================================
+// QUANTIZATION
+// ============================================================================
+
+TEST_CASE("QuantizedMatrix: default is all zeros with scale 1", "[quantized]")
+{
+    QuantizedMatrix<3, 5> Q;
+    for (my_size_t i = 0; i < 3; ++i)
+    {
+        CHECK(Q.row_sum(i) == 0);
+        for (my_size_t j = 0; j < 5; ++j)
+            CHECK(Q(i, j) == 0);
+    }
+    CHECK(Q.scale(0) == 1.0f);
+    CHECK(Q.zero_point(0) == 0);
+}
+
+TEST_CASE("QuantizedMatrix: affine quantize round-trips within half a step", "[quantized]")
+{
+    FusedMatrix<float, 4, 37> X;
+    fill_real(X, 7, -0.5f, 3.0f);
+    X(2, 9) = 0.0f;
+    auto Q = QuantizedMatrix<4, 37>::quantize(X);
+
+    CHECK(Q.scale(0) == Approx(3.5f / 255.0f));
+    CHECK(Q.zero_point(0) >= -128);
+    CHECK(Q.zero_point(0) <= 127);
+
+    // The real zero is exactly representable
+    CHECK(Q(2, 9) == Q.zero_point(0));
+    CHECK(Q.value(2, 9) == 0.0f);
+
+    const auto D = Q.dequantize();
+    const float half = 0.5f * Q.scale(0) * 1.001f;
+    for (my_size_t i = 0; i < 4; ++i)
+        for (my_size_t j = 0; j < 37; ++j)
+        {
+            CHECK(std::fabs(D(i, j) - X(i, j)) <= half);
+            CHECK(Q.value(i, j) == D(i, j));
+        }
+}
+
+TEST_CASE("QuantizedMatrix: range is widened to include zero", "[quantized]")
+{
+    FusedMatrix<float, 2, 8> X;
+    fill_real(X, 3, 1.0f, 2.0f);
+    auto Q = QuantizedMatrix<2, 8>::quantize(X);
+
+    CHECK(Q.zero_point(0) == -128);
+    CHECK(Q.value(0, 0) == Approx(X(0, 0)).margin(Q.scale(0)));
+}
+
+TEST_CASE("QuantizedMatrix: symmetric quantize has zero point 0 and maps max |x| to 127", "[quantized]")
+{
+    FusedMatrix<float, 3, 20> X;
+    fill_real(X, 5, -2.0f, 1.0f);
+    X(1, 4) = -2.54f;
+    auto Q = QuantizedMatrix<3, 20>::quantize_symmetric(X);
+
+    CHECK(Q.zero_point(0) == 0);
+    CHECK(Q.scale(0) == Approx(2.54f / 127.0f));
+    CHECK(Q(1, 4) == -127);
+}
+
+TEST_CASE("QuantizedMatrix: per-row parameters follow each row's range", "[quantized]")
+{
+    FusedMatrix<float, 3, 16> X;
+    fill_real(X, 11, -1.0f, 1.0f);
+    for (my_size_t j = 0; j < 16; ++j)
+    {
+        X(1, j) *= 100.0f;
+        X(2, j) = 0.0f;
+    }
+    auto Q = QuantizedMatrix<3, 16, QuantAxis::PerRow>::quantize_symmetric(X);
+
+    CHECK(Q.scale(1) > 50.0f * Q.scale(0));
+    CHECK(Q.scale(2) == 1.0f);
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 16; ++j)
+            CHECK(std::fabs(Q.value(i, j) - X(i, j)) <= 0.5f * Q.scale(i) * 1.001f);
+}
+
+TEST_CASE("QuantizedMatrix: explicit parameters saturate out-of-range values", "[quantized]")
+{
+    FusedMatrix<float, 1, 4> X;
+    X(0, 0) = 100.0f;
+    X(0, 1) = -100.0f;
+    X(0, 2) = 0.26f;
+    X(0, 3) = 0.0f;
+    auto Q = QuantizedMatrix<1, 4>::quantize(X, 0.1f, 5);
+
+    CHECK(Q(0, 0) == 127);
+    CHECK(Q(0, 1) == -128);
+    CHECK(Q(0, 2) == 8);
+    CHECK(Q(0, 3) == 5);
+    CHECK(Q.row_sum(0) == 127 - 128 + 8 + 5);
+}
+
+TEST_CASE("QuantizedMatrix: set keeps row sums and leaves the padding zero", "[quantized]")
+{
+    QuantizedMatrix<2, 5, QuantAxis::PerRow> Q;
+    Q.set(0, 1, 100);
+    Q.set(0, 4, -30);
+    Q.set(1, 0, -128);
+    Q.set(0, 1, 7);
+    Q.set_params(1, 0.25f, -3);
+
+    CHECK(Q.row_sum(0) == -23);
+    CHECK(Q.row_sum(1) == -128);
+    CHECK(Q.scale(0) == 1.0f);
+    CHECK(Q.scale(1) == 0.25f);
+    CHECK(Q.zero_point(1) == -3);
+    CHECK(Q.value(1, 0) == Approx(0.25f * -125.0f));
+
+    using QM = QuantizedMatrix<2, 5, QuantAxis::PerRow>;
+    for (my_size_t i = 0; i < 2; ++i)
+        for (my_size_t j = 5; j < QM::Stride; ++j)
+            CHECK(Q.data()[i * QM::Stride + j] == 0);
+}
+
+// ============================================================================
+// QUANTIZED GEMM
+// ============================================================================
+
+TEST_CASE("qlinear: int32 accumulators match the reference", "[quantized][qgemm]")
+{
+    SECTION("tiny, K below one step") { check_qlinear_int32<5, 7, 3, QuantAxis::PerTensor>(1); }
+    SECTION("single row (gemv)") { check_qlinear_int32<1, 33, 129, QuantAxis::PerRow>(2); }
+    SECTION("M, N, K remainders") { check_qlinear_int32<9, 13, 70, QuantAxis::PerRow>(3); }
+    SECTION("full tiles") { check_qlinear_int32<16, 32, 128, QuantAxis::PerTensor>(4); }
+    SECTION("larger, per-row") { check_qlinear_int32<17, 64, 256, QuantAxis::PerRow>(5); }
+}
+
+TEST_CASE("qlinear: extreme int8 values do not overflow an intermediate", "[quantized][qgemm]")
+{
+    // −128 · −128 pairs everywhere: a saturating int16 pair sum would clip.
+    QuantizedMatrix<3, 200> X;
+    QuantizedMatrix<5, 200, QuantAxis::PerRow> W;
+    for (my_size_t k = 0; k < 200; ++k)
+    {
+        for (my_size_t i = 0; i < 3; ++i)
+            X.set(i, k, (i == 1) ? 127 : -128);
+        for (my_size_t j = 0; j < 5; ++j)
+            W.set(j, k, (j % 2) ? 127 : -128);
+    }
+    W.set_params(4, 1.0f, 100);
+
+    FusedMatrix<int32_t, 3, 5> Y;
+    qlinear(X, W, Y);
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 5; ++j)
+            CHECK(Y(i, j) == reference_dot(X, W, i, j));
+    CHECK(Y(0, 0) == 200 * 128 * 128);
+}
+
+TEST_CASE("qlinear: dequantized output with bias", "[quantized][qgemm]")
+{
+    static FusedMatrix<float, 6, 45> X;
+    static FusedMatrix<float, 11, 45> W;
+    FusedMatrix<float, 11, 1> bias;
+    fill_real(X, 21, -1.0f, 1.5f);
+    fill_real(W, 22, -0.3f, 0.3f);
+    fill_real(bias, 23, -0.5f, 0.5f);
+    const auto Xq = QuantizedMatrix<6, 45>::quantize(X);
+    const auto Wq = QuantizedMatrix<11, 45, QuantAxis::PerRow>::quantize_symmetric(W);
+
+    FusedMatrix<float, 6, 11> Y, Yb;
+    qlinear(Xq, Wq, Y);
+    qlinear(Xq, Wq, Yb, bias);
+
+    const auto Yf = FusedMatrix<float, 6, 11>::matmul(X, W.transpose_view());
+    for (my_size_t i = 0; i < 6; ++i)
+        for (my_size_t j = 0; j < 11; ++j)
+        {
+            const float exact = Xq.scale(i) * Wq.scale(j) * static_cast<float>(reference_dot(Xq, Wq, i, j));
+            CHECK(Y(i, j) == Approx(exact).epsilon(1e-5).margin(1e-6));
+            CHECK(Yb(i, j) == Approx(exact + bias(j, 0)).epsilon(1e-5).margin(1e-6));
+            // And close to the float product it approximates
+            CHECK(Y(i, j) == Approx(Yf(i, j)).margin(0.05));
+        }
+}
+
+TEST_CASE("qlinear: requantized output and its row sums", "[quantized][qgemm]")
+{
+    static FusedMatrix<float, 7, 90> X;
+    static FusedMatrix<float, 10, 90> W;
+    FusedMatrix<float, 1, 10> bias;
+    fill_real(X, 31, -1.0f, 1.0f);
+    fill_real(W, 32, -0.2f, 0.25f);
+    fill_real(bias, 33, -0.3f, 0.3f);
+    const auto Xq = QuantizedMatrix<7, 90>::quantize(X);
+    const auto Wq = QuantizedMatrix<10, 90, QuantAxis::PerRow>::quantize(W);
+
+    QuantizedMatrix<7, 10> Y;
+    Y.set_params(0.02f, -7);
+    qlinear(Xq, Wq, Y, bias);
+
+    for (my_size_t i = 0; i < 7; ++i)
+    {
+        int32_t sum = 0;
+        for (my_size_t j = 0; j < 10; ++j)
+        {
+            const float real = Xq.scale(i) * Wq.scale(j) * static_cast<float>(reference_dot(Xq, Wq, i, j)) + bias(0, j);
+            float q = std::nearbyint(real / 0.02f) - 7.0f;
+            q = q < -128.0f ? -128.0f : (q > 127.0f ? 127.0f : q);
+            CHECK(std::fabs(Y(i, j) - q) <= 1.0f);
+            sum += Y(i, j);
+        }
+        CHECK(Y.row_sum(i) == sum);
+    }
+    CHECK(Y.scale(0) == 0.02f);
+    CHECK(Y.zero_point(0) == -7);
+}
+
+TEST_CASE("qlinear: two requantized layers chain through row sums", "[quantized][qgemm]")
+{
+    static FusedMatrix<float, 3, 64> X;
+    static FusedMatrix<float, 24, 64> W1;
+    static FusedMatrix<float, 8, 24> W2;
+    fill_real(X, 41, -1.0f, 1.0f);
+    fill_real(W1, 42, -0.2f, 0.2f);
+    fill_real(W2, 43, -0.3f, 0.3f);
+    const auto Xq = QuantizedMatrix<3, 64>::quantize(X);
+    const auto W1q = QuantizedMatrix<24, 64, QuantAxis::PerRow>::quantize_symmetric(W1);
+    const auto W2q = QuantizedMatrix<8, 24, QuantAxis::PerRow>::quantize_symmetric(W2);
+
+    QuantizedMatrix<3, 24> H;
+    H.set_params(0.01f, 12);
+    qlinear(Xq, W1q, H);
+
+    FusedMatrix<int32_t, 3, 8> Y;
+    qlinear(H, W2q, Y);
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 8; ++j)
+            CHECK(Y(i, j) == reference_dot(H, W2q, i, j));
+
+    // The int8 pipeline tracks the float one
+    FusedMatrix<float, 3, 8> Yq;
+    qlinear(H, W2q, Yq);
+    const auto Hf = FusedMatrix<float, 3, 24>::matmul(X, W1.transpose_view());
+    const auto Yf = FusedMatrix<float, 3, 8>::matmul(Hf, W2.transpose_view());
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 8; ++j)
+            CHECK(Yq(i, j) == Approx(Yf(i, j)).margin(0.05));
+}
@@ -0,0 +1,261 @@
+/**
+ * @file test_reduce_axis.cpp
+ * @brief Catch2 tests for axis reductions: reduce<Axis>(expr, op).
+ *
+ * Tests cover:
+ *   - sum / min / max / mean / prod along every axis of 2-D and 3-D tensors,
+ *     against a scalar loop over operator()
+ *   - last-axis (SIMD row + horizontal combine) and outer-axis (vertical
+ *     accumulation across slices) paths, rows shorter and longer than a
+ *     vector, with and without a partial tail vector
+ *   - fused expressions, broadcast operands and permuted views as input,
+ *     without materializing them
+ *   - result shape and untouched output padding
+ *
+ * Input padding is poisoned, so a reduction that reads padding fails.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <limits>
+#include <type_traits>
+
+#include "config.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+template <typename T>
+static T poison()
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return std::numeric_limits<T>::quiet_NaN();
+    else
+        return T(1) << 20;
+}
+
+template <typename Tensor, typename T>
+static void fill_padding(Tensor &X, T v)
+{
+    using P = typename Tensor::Layout::PadPolicyType;
+    for (my_size_t s = 0; s < P::PhysicalSize / P::PaddedLastDim; ++s)
+        for (my_size_t l = P::LastDim; l < P::PaddedLastDim; ++l)
+            X.data()[s * P::PaddedLastDim + l] = v;
+}
+
+template <typename Tensor, typename T>
+static bool padding_is(const Tensor &X, T v)
+{
+    using P = typename Tensor::Layout::PadPolicyType;
+    for (my_size_t s = 0; s < P::PhysicalSize / P::PaddedLastDim; ++s)
+        for (my_size_t l = P::LastDim; l < P::PaddedLastDim; ++l)
+            if (X.data()[s * P::PaddedLastDim + l] != v)
+                return false;
+    return true;
+}
+
+/// Small nonzero values in [-3, 3]: sums are exact and min/max have ties.
+template <typename T>
+static T value_at(my_size_t n)
+{
+    const int v = static_cast<int>((n * 5 + 2) % 7) - 3;
+    return static_cast<T>(v == 0 ? 1 : v);
+}
+
+enum class Ref
+{
+    Sum,
+    Min,
+    Max,
+    Mean,
+    Prod
+};
+
+/// Scalar reference: reduce the 3-D tensor X over Axis at (i, j) of the remaining axes.
+template <Ref Op, my_size_t Axis, typename T, my_size_t D0, my_size_t D1, my_size_t D2>
+static T reference(const FusedTensorND<T, D0, D1, D2> &X, my_size_t a, my_size_t b)
+{
+    constexpr my_size_t D[] = {D0, D1, D2};
+    T acc = Op == Ref::Prod ? T(1) : Op == Ref::Min ? std::numeric_limits<T>::max()
+                                  : Op == Ref::Max  ? std::numeric_limits<T>::lowest()
+                                                    : T(0);
+    for (my_size_t k = 0; k < D[Axis]; ++k)
+    {
+        const T v = Axis == 0 ? X(k, a, b) : Axis == 1 ? X(a, k, b) : X(a, b, k);
+        if constexpr (Op == Ref::Sum || Op == Ref::Mean)
+            acc += v;
+        else if constexpr (Op == Ref::Prod && std::is_integral_v<T>)
+            acc = static_cast<T>(static_cast<std::make_unsigned_t<T>>(acc) * static_cast<std::make_unsigned_t<T>>(v)); // wraps, like the vector multiply
+        else if constexpr (Op == Ref::Prod)
+            acc *= v;
+        else if constexpr (Op == Ref::Min)
+            acc = v < acc ? v : acc;
+        else
+            acc = v > acc ? v : acc;
+    }
+    return Op == Ref::Mean ? acc / static_cast<T>(D[Axis]) : acc;
+}
+
+template <Ref Op, my_size_t Axis, typename T, my_size_t D0, my_size_t D1, my_size_t D2, typename Result>
+static void check_axis(const FusedTensorND<T, D0, D1, D2> &X, const Result &R)
+{
+    constexpr my_size_t D[] = {D0, D1, D2};
+    constexpr my_size_t A = D[Axis == 0 ? 1 : 0];
+    constexpr my_size_t B = D[Axis == 2 ? 1 : 2];
+    STATIC_REQUIRE(Result::NumDims == 2);
+    STATIC_REQUIRE(Result::Dim[0] == A);
+    STATIC_REQUIRE(Result::Dim[1] == B);
+
+    int bad = 0;
+    for (my_size_t a = 0; a < A; ++a)
+        for (my_size_t b = 0; b < B; ++b)
+        {
+            const T ref = reference<Op, Axis>(X, a, b);
+            if constexpr (std::is_floating_point_v<T>)
+                bad += R(a, b) != Catch::Approx(ref).epsilon(1e-5);
+            else
+                bad += R(a, b) != ref;
+        }
+    CHECK(bad == 0);
+    CHECK(padding_is(R, T(0)));
+}
+
+template <typename T, my_size_t D0, my_size_t D1, my_size_t D2>
+static void check_all_axes()
+{
+    FusedTensorND<T, D0, D1, D2> X;
+    for (my_size_t i = 0; i < D0; ++i)
+        for (my_size_t j = 0; j < D1; ++j)
+            for (my_size_t k = 0; k < D2; ++k)
+                X(i, j, k) = value_at<T>((i * D1 + j) * D2 + k);
+    fill_padding(X, poison<T>());
+
+    [&]<my_size_t... Axis>(index_seq<Axis...>)
+    {
+        ((check_axis<Ref::Sum, Axis>(X, reduce<Axis>(X, reduce_op::sum)),
+          check_axis<Ref::Min, Axis>(X, reduce<Axis>(X, reduce_op::min)),
+          check_axis<Ref::Max, Axis>(X, reduce<Axis>(X, reduce_op::max)),
+          check_axis<Ref::Mean, Axis>(X, reduce<Axis>(X, reduce_op::mean)),
+          check_axis<Ref::Prod, Axis>(X, reduce<Axis>(X, reduce_op::prod))),
+         ...);
+    }(index_seq<0, 1, 2>{});
+}
+
+// ============================================================================
+// SHAPES
+// ============================================================================
+
+TEMPLATE_TEST_CASE("reduce<Axis>: every op along every axis of a 3-D tensor", "[reduce_axis]",
+                   double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    check_all_axes<T, 2, 3, 5>();   // rows shorter than a vector
+    check_all_axes<T, 3, 4, 16>();  // whole vectors, no tail
+    check_all_axes<T, 4, 2, 37>();  // vectors and a tail
+    check_all_axes<T, 5, 7, 1>();   // last axis of size 1
+    check_all_axes<T, 1, 9, 70>();  // leading axis of size 1, long rows
+}
+
+TEMPLATE_TEST_CASE("reduce<Axis>: column means and row maxima of a matrix", "[reduce_axis]",
+                   double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    constexpr my_size_t R = 11, C = 19;
+    FusedMatrix<T, R, C> M;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            M(i, j) = static_cast<T>(static_cast<int>((i * C + j) * 13 % 29) - 14);
+    fill_padding(M, poison<T>());
+
+    auto colSum = reduce<0>(M, reduce_op::sum);
+    auto colMean = reduce<0>(M, reduce_op::mean);
+    auto rowMax = reduce<1>(M, reduce_op::max);
+    auto rowMin = reduce<1>(M, reduce_op::min);
+    STATIC_REQUIRE(std::is_same_v<decltype(colMean), FusedTensorND<T, C>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(rowMax), FusedTensorND<T, R>>);
+
+    for (my_size_t j = 0; j < C; ++j)
+    {
+        T s = 0;
+        for (my_size_t i = 0; i < R; ++i)
+            s += M(i, j);
+        CHECK(colSum(j) == s);
+        if constexpr (std::is_floating_point_v<T>)
+            CHECK(colMean(j) == Catch::Approx(s / T(R)));
+        else
+            CHECK(colMean(j) == s / T(R)); // integer mean truncates, as T / T does
+    }
+    for (my_size_t i = 0; i < R; ++i)
+    {
+        T hi = M(i, 0), lo = M(i, 0);
+        for (my_size_t j = 1; j < C; ++j)
+        {
+            hi = M(i, j) > hi ? M(i, j) : hi;
+            lo = M(i, j) < lo ? M(i, j) : lo;
+        }
+        CHECK(rowMax(i) == hi);
+        CHECK(rowMin(i) == lo);
+    }
+    CHECK(padding_is(colSum, T(0)));
+    CHECK(padding_is(rowMax, T(0)));
+}
+
+// ============================================================================
+// EXPRESSIONS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("reduce<Axis> over fused expressions, broadcasts and permuted views", "[reduce_axis]",
+                   double, float)
+{
+    using T = TestType;
+    constexpr my_size_t R = 6, C = 21;
+    FusedMatrix<T, R, C> A, B;
+    FusedMatrix<T, C, R> At;
+    FusedTensorND<T, C> bias;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            A(i, j) = value_at<T>(i * C + j);
+            B(i, j) = value_at<T>(3 * (i * C + j) + 1);
+            At(j, i) = A(i, j);
+        }
+    for (my_size_t j = 0; j < C; ++j)
+        bias(j) = value_at<T>(j + 5);
+    fill_padding(A, poison<T>());
+    fill_padding(B, poison<T>());
+    fill_padding(At, poison<T>());
+    fill_padding(bias, poison<T>());
+
+    // Row sums of A * B + bias: one pass, no temporary
+    auto rows = reduce<1>(A * B + bias.template broadcast_to<R, C>(), reduce_op::sum);
+    // Column maxima of A - 2B
+    auto cols = reduce<0>(A - B * T(2), reduce_op::max);
+    // A permuted view reduces in logical order: At^T == A
+    auto rowsT = reduce<1>(At.transpose_view(), reduce_op::sum);
+    auto colsT = reduce<0>(At.transpose_view() * T(3), reduce_op::min);
+
+    for (my_size_t i = 0; i < R; ++i)
+    {
+        T s = 0, sA = 0;
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            s += A(i, j) * B(i, j) + bias(j);
+            sA += A(i, j);
+        }
+        CHECK(rows(i) == Catch::Approx(s));
+        CHECK(rowsT(i) == Catch::Approx(sA));
+    }
+    for (my_size_t j = 0; j < C; ++j)
+    {
+        T hi = std::numeric_limits<T>::lowest(), lo = std::numeric_limits<T>::max();
+        for (my_size_t i = 0; i < R; ++i)
+        {
+            hi = A(i, j) - B(i, j) * T(2) > hi ? A(i, j) - B(i, j) * T(2) : hi;
+            lo = A(i, j) * T(3) < lo ? A(i, j) * T(3) : lo;
+        }
+        CHECK(cols(j) == hi);
+        CHECK(colsT(j) == lo);
+    }
+}
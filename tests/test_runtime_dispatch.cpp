@@ -0,0 +1,194 @@
+/**
+ * @file test_runtime_dispatch.cpp
+ * @brief Catch2 tests for the opt-in runtime CPU dispatch.
+ *
+ * Tests cover:
+ *   - Padding is wide enough for every kernel family dispatch may pick
+ *   - KernelGemm::gemm / gemmt, including a product large enough for the
+ *     packed path, on every target the CPU supports
+ *   - Large contiguous eval and reduce on every target, on a shape with a
+ *     row tail
+ *   - CpuDispatch::set_target never raises the target above detected()
+ *
+ * Without TESSERACT_RUNTIME_DISPATCH the same tests run once on the
+ * compile-time kernels. On SSE2 the integer cases run on the scalar
+ * kernel.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <vector>
+
+#include "config.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "fused/kernel_ops/kernel_ops.h"
+#include "fused/kernel_ops/kernel_gemm.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// Run @p body once per target the CPU supports, then restore the detected one.
+template <typename F>
+static void for_each_target(F &&body)
+{
+#ifdef TESSERACT_X86_DISPATCH
+    for (CpuTarget t : {CpuTarget::SSE2, CpuTarget::AVX2, CpuTarget::AVX512})
+    {
+        if (t > CpuDispatch::detected())
+            break;
+        CpuDispatch::set_target(t);
+        INFO("target " << static_cast<int>(t));
+        body();
+    }
+    CpuDispatch::set_target(CpuDispatch::detected());
+#else
+    body();
+#endif
+}
+
+/// C = A·B through KernelGemm::gemm, checked against a naive product.
+template <typename T, my_size_t M, my_size_t Kd, my_size_t N>
+static void check_gemm()
+{
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+
+    static FusedMatrix<T, M, Kd> A;
+    static FusedMatrix<T, Kd, N> B;
+    static FusedMatrix<T, M, N> C;
+    A.setSequencial();
+    B.setSequencial();
+
+    std::vector<T> ref(M * N);
+    for (my_size_t i = 0; i < M; ++i)
+        for (my_size_t j = 0; j < N; ++j)
+        {
+            T sum = T{0};
+            for (my_size_t k = 0; k < Kd; ++k)
+                sum += A(i, k) * B(k, j);
+            ref[i * N + j] = sum;
+        }
+
+    for_each_target([&]
+                    {
+        Gemm::gemm(A.data(), M, Kd, A.getStride(0), B.data(), N, B.getStride(0),
+                   C.data(), C.getStride(0));
+        for (my_size_t i = 0; i < M; ++i)
+            for (my_size_t j = 0; j < N; ++j)
+                REQUIRE(C(i, j) == Approx(ref[i * N + j])); });
+}
+
+// ============================================================================
+// PADDING
+// ============================================================================
+
+TEMPLATE_TEST_CASE("padding fits the widest dispatched kernel", "[dispatch][padding]", double, float)
+{
+    using T = TestType;
+    using Layout = typename FusedMatrix<T, 3, 5>::Layout::PadPolicyType;
+
+#ifndef TESSERACT_NO_PADDING
+    STATIC_REQUIRE(Layout::PaddedLastDim % PadSimdWidth<T> == 0);
+#endif
+    STATIC_REQUIRE(PadSimdWidth<T> >= Microkernel<T, BITS, DefaultArch>::simdWidth);
+    STATIC_REQUIRE(DATA_ALIGNAS == PAD_BITS / 8);
+#ifdef TESSERACT_X86_DISPATCH
+    STATIC_REQUIRE(PadSimdWidth<T> == 64 / sizeof(T));
+#endif
+}
+
+// ============================================================================
+// GEMM
+// ============================================================================
+
+TEMPLATE_TEST_CASE("gemm on every target", "[dispatch][gemm]", double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    check_gemm<T, 7, 13, 11>();
+    check_gemm<T, 16, 16, 16>();
+    // The sequential 67×129·129×71 product overflows int32_t
+    if constexpr (!is_same_v<T, int32_t>)
+        check_gemm<T, 67, 129, 71>();
+}
+
+TEMPLATE_TEST_CASE("gemmt on every target", "[dispatch][gemm]", double, float)
+{
+    using T = TestType;
+    using Gemm = detail::KernelGemm<T, BITS, DefaultArch>;
+    constexpr my_size_t N = 37, Kd = 19;
+
+    static FusedMatrix<T, N, Kd> A;
+    static FusedMatrix<T, Kd, N> B;
+    static FusedMatrix<T, N, N> C;
+    A.setSequencial();
+    for (my_size_t i = 0; i < N; ++i)
+        for (my_size_t k = 0; k < Kd; ++k)
+            B(k, i) = A(i, k);
+
+    for_each_target([&]
+                    {
+        Gemm::template gemmt<detail::GemmUplo::Lower>(A.data(), N, Kd, A.getStride(0), B.data(), B.getStride(0),
+                                                      C.data(), C.getStride(0));
+        for (my_size_t i = 0; i < N; ++i)
+            for (my_size_t j = 0; j <= i; ++j)
+            {
+                T sum = T{0};
+                for (my_size_t k = 0; k < Kd; ++k)
+                    sum += A(i, k) * A(j, k);
+                REQUIRE(C(i, j) == Approx(sum));
+            } });
+}
+
+// ============================================================================
+// EVAL / REDUCE
+// ============================================================================
+
+TEMPLATE_TEST_CASE("large contiguous eval and reduce on every target", "[dispatch][eval][reduce]", double, float, int32_t, int64_t)
+{
+    using T = TestType;
+
+    static FusedMatrix<T, 24, 29> A, B, E;
+    A.setSequencial();
+    B.setSequencial();
+
+    T mn = A(0, 0) * T(2) - B(0, 0), mx = mn, sm = T{0};
+    for (my_size_t i = 0; i < 24; ++i)
+        for (my_size_t j = 0; j < 29; ++j)
+        {
+            const T v = A(i, j) * T(2) - B(i, j);
+            mn = v < mn ? v : mn;
+            mx = v > mx ? v : mx;
+            sm += v;
+        }
+
+    for_each_target([&]
+                    {
+        E = A * T(2) - B;
+        for (my_size_t i = 0; i < 24; ++i)
+            for (my_size_t j = 0; j < 29; ++j)
+                REQUIRE(E(i, j) == A(i, j) * T(2) - B(i, j));
+
+        REQUIRE(min(E) == mn);
+        REQUIRE(max(E) == mx);
+        REQUIRE(sum(E) == Approx(sm)); });
+}
+
+// ============================================================================
+// TARGET SELECTION
+// ============================================================================
+
+#ifdef TESSERACT_X86_DISPATCH
+TEST_CASE("set_target is clamped to the detected target", "[dispatch]")
+{
+    CpuDispatch::set_target(CpuTarget::AVX512);
+    REQUIRE(CpuDispatch::target() == CpuDispatch::detected());
+
+    CpuDispatch::set_target(CpuTarget::SSE2);
+    REQUIRE(CpuDispatch::target() == CpuTarget::SSE2);
+
+    CpuDispatch::set_target(CpuDispatch::detected());
+}
+#endif
@@ -0,0 +1,177 @@
+/**
+ * @file test_summation.cpp
+ * @brief Catch2 tests for the summation modes of sum(expr, mode).
+ *
+ * Tests cover:
+ *   - unrolled (default), compensated and pairwise sums against an exact
+ *     reference, on dense storage, short padded rows (fewer vectors than
+ *     accumulators), long rows with a tail, 3-D tensors and tensors smaller
+ *     than one group of accumulators
+ *   - expressions and permuted views as input (scalar logical path)
+ *   - compensated summation recovering small terms next to a large one
+ *     that cancels, exactly
+ *   - pairwise and compensated error on a long float sum
+ *   - integer tensors ignore the mode
+ *
+ * Input padding is poisoned, so a sum that reads padding fails.
+ */
+
+#include <catch_amalgamated.hpp>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "config.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+template <typename T>
+static T poison()
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return std::numeric_limits<T>::quiet_NaN();
+    else
+        return T(1) << 20;
+}
+
+template <typename Tensor, typename T>
+static void fill_padding(Tensor &X, T v)
+{
+    using P = typename Tensor::Layout::PadPolicyType;
+    for (my_size_t s = 0; s < P::PhysicalSize / P::PaddedLastDim; ++s)
+        for (my_size_t l = P::LastDim; l < P::PaddedLastDim; ++l)
+            X.data()[s * P::PaddedLastDim + l] = v;
+}
+
+/// Small integers: every partial sum is exact, in any order.
+template <typename T>
+static T value_at(my_size_t n)
+{
+    return static_cast<T>(static_cast<int>((n * 7 + 3) % 19) - 9);
+}
+
+/// Fill a matrix with value_at and return the exact sum.
+template <typename T, my_size_t R, my_size_t C>
+static T fill(FusedMatrix<T, R, C> &X)
+{
+    T total = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            X(i, j) = value_at<T>(i * C + j);
+            total += X(i, j);
+        }
+    fill_padding(X, poison<T>());
+    return total;
+}
+
+template <typename T, my_size_t R, my_size_t C>
+static void check_modes()
+{
+    FusedMatrix<T, R, C> X;
+    const T total = fill(X);
+    CHECK(sum(X) == total);
+    CHECK(sum(X, summation::unrolled) == total);
+    CHECK(sum(X, summation::compensated) == total);
+    CHECK(sum(X, summation::pairwise) == total);
+}
+
+// ============================================================================
+// SHAPES
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Every summation mode gives the exact sum on every shape", "[summation]",
+                   double, float, int32_t, int64_t)
+{
+    using T = TestType;
+    check_modes<T, 1, 3>();     // fewer elements than one vector
+    check_modes<T, 3, 5>();     // tails only
+    check_modes<T, 2, 16>();    // one group of accumulators or less
+    check_modes<T, 200, 20>();  // short padded rows: the walk crosses rows
+    check_modes<T, 5, 301>();   // long rows, groups and a tail per row
+    check_modes<T, 32, 64>();   // dense, no tail
+    check_modes<T, 1, 1000>();  // one long row
+
+    FusedTensorND<T, 3, 7, 45> X3;
+    T total = 0;
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 7; ++j)
+            for (my_size_t k = 0; k < 45; ++k)
+            {
+                X3(i, j, k) = value_at<T>((i * 7 + j) * 45 + k);
+                total += X3(i, j, k);
+            }
+    fill_padding(X3, poison<T>());
+    CHECK(sum(X3, summation::compensated) == total);
+    CHECK(sum(X3, summation::pairwise) == total);
+}
+
+TEMPLATE_TEST_CASE("Summation modes over expressions and permuted views", "[summation]", double, float)
+{
+    using T = TestType;
+    constexpr my_size_t R = 9, C = 70;
+    FusedMatrix<T, R, C> A, B;
+    FusedMatrix<T, C, R> At;
+    const T totalA = fill(A);
+    fill(B);
+    T totalAB = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            At(j, i) = A(i, j);
+            totalAB += A(i, j) * B(i, j) - A(i, j);
+        }
+    fill_padding(At, poison<T>());
+
+    CHECK(sum(A * B - A, summation::compensated) == totalAB);
+    CHECK(sum(A * B - A, summation::pairwise) == totalAB);
+    CHECK(sum(At.transpose_view(), summation::compensated) == totalA);
+    CHECK(sum(At.transpose_view(), summation::pairwise) == totalA);
+}
+
+// ============================================================================
+// ACCURACY
+// ============================================================================
+
+TEMPLATE_TEST_CASE("Compensated summation keeps small terms next to a cancelling large one", "[summation]",
+                   double, float)
+{
+    using T = TestType;
+    constexpr my_size_t R = 40, C = 37;
+    FusedMatrix<T, R, C> X;
+    // big + 1 rounds back to big: unrolled drops the ones that share its accumulator
+    const T big = T(16) / std::numeric_limits<T>::epsilon();
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+            X(i, j) = T(1);
+    X(0, 0) = big;
+    X(R - 1, C - 1) = -big;
+    X(R / 2, C - 2) = big; // in a tail vector
+    X(R / 2, 3) = -big;
+    fill_padding(X, poison<T>());
+
+    CHECK(sum(X, summation::compensated) == T(R * C - 4));
+}
+
+TEST_CASE("Long float sums: compensated and pairwise stay within a few roundings", "[summation]")
+{
+    constexpr my_size_t R = 256, C = 250;
+    static FusedMatrix<float, R, C> X;
+    double exact = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            X(i, j) = 0.1f + static_cast<float>((i * C + j) % 1013) * 1e-4f;
+            exact += static_cast<double>(X(i, j));
+        }
+    fill_padding(X, poison<float>());
+
+    const double eps = std::numeric_limits<float>::epsilon();
+    CHECK(std::fabs(sum(X, summation::compensated) - exact) <= eps * exact);
+    CHECK(std::fabs(sum(X, summation::pairwise) - exact) <= 4 * eps * exact);
+    CHECK(std::fabs(sum(X) - exact) <= 64 * eps * exact);
+}
@@ -0,0 +1,453 @@
+/**
+ * @file test_vector_math.cpp
+ * @brief Catch2 tests for the vectorized elementwise math functions.
+ *
+ * Tests cover:
+ *   - Max ulp error of exp, log, sqrt, rsqrt, sin, cos, tanh, sigmoid and
+ *     atan2 against long double references, evaluated through tensor
+ *     expressions (the bounds are the table in vector_math.h)
+ *   - Special values: overflow / underflow, subnormals, zeros, infinities,
+ *     NaN, atan2 quadrants and signed zeros
+ *   - Fusion into larger expressions (Gaussian likelihood), row tails,
+ *     transposed operands and the scalar operator() path
+ *   - The scalar (GENERICARCH) microkernel against the same bounds
+ */
+
+#include <catch_amalgamated.hpp>
+#include <cmath>
+#include <limits>
+
+#include "config.h"
+#include "fused/microkernels/microkernel_base.h"
+#include "fused/microkernels/vector_math.h"
+#include "fused/fused_tensor.h"
+#include "fused/fused_matrix.h"
+
+using Catch::Approx;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/// |got - ref| in units of the ulp of ref rounded to T; 0 when both are the
+/// same infinity or both NaN, huge for any other mismatch in kind.
+template <typename T>
+static long double ulp_error(T got, long double ref)
+{
+    constexpr long double miss = 1e30L;
+    if (std::isnan(ref))
+        return std::isnan(got) ? 0 : miss;
+    const T r = static_cast<T>(ref);
+    if (std::isinf(r))
+        return got == r ? 0 : miss;
+    if (!std::isfinite(got))
+        return miss;
+    const T a = std::fabs(r);
+    const long double ulp = static_cast<long double>(std::nextafter(a, std::numeric_limits<T>::infinity())) - a;
+    return std::fabs(static_cast<long double>(got) - ref) / ulp;
+}
+
+/// Fill X with R·C points spread over [lo, hi], linearly or logarithmically.
+template <typename T, my_size_t R, my_size_t C>
+static void fill_range(FusedMatrix<T, R, C> &X, long double lo, long double hi, bool log_spaced = false)
+{
+    const long double n = static_cast<long double>(R * C - 1);
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            const long double t = static_cast<long double>(i * C + j) / n;
+            X(i, j) = static_cast<T>(log_spaced ? std::exp(std::log(lo) + t * (std::log(hi) - std::log(lo)))
+                                                : lo + t * (hi - lo));
+        }
+}
+
+template <typename T, my_size_t R, my_size_t C, typename Ref>
+static long double max_ulp(const FusedMatrix<T, R, C> &Y, const FusedMatrix<T, R, C> &X, Ref ref)
+{
+    long double worst = 0;
+    for (my_size_t i = 0; i < R; ++i)
+        for (my_size_t j = 0; j < C; ++j)
+        {
+            const long double e = ulp_error(Y(i, j), ref(static_cast<long double>(X(i, j))));
+            worst = e > worst ? e : worst;
+        }
+    return worst;
+}
+
+/// Max ulp error of VecMath<K>::fn over [lo, hi], one K vector at a time.
+template <typename K, typename Fn, typename Ref>
+static long double kernel_max_ulp(Fn fn, Ref ref, long double lo, long double hi, bool log_spaced = false)
+{
+    using T = typename K::ScalarType;
+    constexpr my_size_t W = K::simdWidth;
+    constexpr int N = 20000;
+    long double worst = 0;
+    alignas(DATA_ALIGNAS) T in[W], out[W];
+    for (int i = 0; i < N; i += W)
+    {
+        for (my_size_t l = 0; l < W; ++l)
+        {
+            const long double t = static_cast<long double>(i + l) / N;
+            in[l] = static_cast<T>(log_spaced ? std::exp(std::log(lo) + t * (std::log(hi) - std::log(lo)))
+                                              : lo + t * (hi - lo));
+        }
+        K::store(out, fn(K::load(in)));
+        for (my_size_t l = 0; l < W; ++l)
+        {
+            const long double e = ulp_error(out[l], ref(static_cast<long double>(in[l])));
+            worst = e > worst ? e : worst;
+        }
+    }
+    return worst;
+}
+
+template <typename T>
+static constexpr bool is_f32 = std::is_same_v<T, float>;
+
+// ============================================================================
+// ACCURACY
+// ============================================================================
+
+TEMPLATE_TEST_CASE("elementwise math: max ulp error", "[vector_math][accuracy]", double, float)
+{
+    using T = TestType;
+    constexpr bool F = is_f32<T>;
+
+    // 97 x 101: rows end in a partial vector on every arch
+    FusedMatrix<T, 97, 101> X, Y;
+
+    SECTION("exp")
+    {
+        fill_range(X, F ? -103.9L : -745.0L, F ? 88.7L : 709.7L);
+        Y = exp(X);
+        REQUIRE(max_ulp(Y, X, [](long double x) { return std::exp(x); }) <= (F ? 1.0L : 2.0L));
+        fill_range(X, -1.0L, 1.0L);
+        Y = exp(X);
+        REQUIRE(max_ulp(Y, X, [](long double x) { return std::exp(x); }) <= (F ? 1.0L : 2.0L));
+    }
+
+    SECTION("log")
+    {
+        fill_range(X, F ? 1e-44L : 1e-320L, F ? 3e38L : 1e308L, true);
+        Y = log(X);
+        REQUIRE(max_ulp(Y, X, [](long double x) { return std::log(x); }) <= 1.0L);
+        fill_range(X, 0.5L, 2.0L);
+        Y = log(X);
+        REQUIRE(max_ulp(Y, X, [](long double x) { return std::log(x); }) <= 1.0L);
+    }
+
+    SECTION("sqrt / rsqrt")
+    {
+        fill_range(X, 1e-30L, 1e30L, true);
+        Y = sqrt(X);
+        REQUIRE(max_ulp(Y, X, [](long double x) { return std::sqrt(x); }) <= 0.5L);
+        Y = rsqrt(X);
+        REQUIRE(max_ulp(Y, X, [](long double x) { return 1.0L / std::sqrt(x); }) <= 1.5L);
+    }
+
+    SECTION("sin / cos")
+    {
+        const long double big = F ? 8192.0L : 1e6L;
+        const long double bound = F ? 2.5L : 2.0L;
+        for (long double range : {4.0L, big})
+        {
+            fill_range(X, -range, range);
+            Y = sin(X);
+            REQUIRE(max_ulp(Y, X, [](long double x) { return std::sin(x); }) <= bound);
+            Y = cos(X);
+            REQUIRE(max_ulp(Y, X, [](long double x) { return std::cos(x); }) <= bound);
+        }
+    }
+
+    SECTION("tanh / sigmoid")
+    {
+        fill_range(X, -20.0L, 20.0L);
+        Y = tanh(X);
+        REQUIRE(max_ulp(Y, X, [](long double x) { return std::tanh(x); }) <= 1.5L);
+        fill_range(X, F ? -80.0L : -700.0L, F ? 80.0L : 700.0L);
+        Y = sigmoid(X);
+        REQUIRE(max_ulp(Y, X, [](long double x) { return 1.0L / (1.0L + std::exp(-x)); }) <= 2.5L);
+    }
+
+    SECTION("atan2")
+    {
+        FusedMatrix<T, 97, 101> Yc, Xc;
+        for (my_size_t i = 0; i < 97; ++i)
+            for (my_size_t j = 0; j < 101; ++j)
+            {
+                const long double t = static_cast<long double>(i * 101 + j) * 0.0237L;
+                const long double r = 0.001L + static_cast<long double>((i * 101 + j) % 1000) * 0.37L;
+                Yc(i, j) = static_cast<T>(r * std::sin(t));
+                Xc(i, j) = static_cast<T>(r * std::cos(t * 1.0001L));
+            }
+        Y = atan2(Yc, Xc);
+        long double worst = 0;
+        for (my_size_t i = 0; i < 97; ++i)
+            for (my_size_t j = 0; j < 101; ++j)
+            {
+                const long double ref = std::atan2(static_cast<long double>(Yc(i, j)), static_cast<long double>(Xc(i, j)));
+                const long double e = ulp_error(Y(i, j), ref);
+                worst = e > worst ? e : worst;
+            }
+        REQUIRE(worst <= (F ? 3.5L : 2.0L));
+    }
+}
+
+TEMPLATE_TEST_CASE("elementwise math: scalar microkernel accuracy", "[vector_math][accuracy][microkernel]",
+                   double, float)
+{
+    using T = TestType;
+    using K = Microkernel<T, 0, GENERICARCH>;
+    using VM = VecMath<K>;
+    constexpr bool F = is_f32<T>;
+
+    using V = typename K::VecType;
+
+    REQUIRE(kernel_max_ulp<K>([](V v) { return VM::exp(v); }, [](long double x) { return std::exp(x); },
+                              F ? -103.9L : -745.0L, F ? 88.7L : 709.7L) <= (F ? 1.0L : 2.0L));
+    REQUIRE(kernel_max_ulp<K>([](V v) { return VM::log(v); }, [](long double x) { return std::log(x); },
+                              F ? 1e-44L : 1e-320L, F ? 3e38L : 1e308L, true) <= 1.0L);
+    REQUIRE(kernel_max_ulp<K>([](V v) { return VM::sin(v); }, [](long double x) { return std::sin(x); },
+                              -100.0L, 100.0L) <= 2.0L);
+    REQUIRE(kernel_max_ulp<K>([](V v) { return VM::cos(v); }, [](long double x) { return std::cos(x); },
+                              -100.0L, 100.0L) <= 2.0L);
+    REQUIRE(kernel_max_ulp<K>([](V v) { return VM::tanh(v); }, [](long double x) { return std::tanh(x); },
+                              -20.0L, 20.0L) <= 1.5L);
+}
+
+// ============================================================================
+// SPECIAL VALUES
+// ============================================================================
+
+TEMPLATE_TEST_CASE("elementwise math: special values", "[vector_math][special]", double, float)
+{
+    using T = TestType;
+    using lim = std::numeric_limits<T>;
+    const T inf = lim::infinity();
+    const T nan = lim::quiet_NaN();
+
+    FusedMatrix<T, 2, 5> X, Y;
+
+    SECTION("exp")
+    {
+        X(0, 0) = inf;
+        X(0, 1) = -inf;
+        X(0, 2) = nan;
+        X(0, 3) = T(1000);  // overflow
+        X(0, 4) = T(-1000); // underflow
+        X(1, 0) = T(0);
+        X(1, 1) = is_f32<T> ? T(-100) : T(-740); // subnormal result
+        X(1, 2) = is_f32<T> ? T(88.5) : T(709.5);
+        X(1, 3) = T(-0.0);
+        X(1, 4) = T(1);
+        Y = exp(X);
+        REQUIRE(Y(0, 0) == inf);
+        REQUIRE(Y(0, 1) == T(0));
+        REQUIRE(std::isnan(Y(0, 2)));
+        REQUIRE(Y(0, 3) == inf);
+        REQUIRE(Y(0, 4) == T(0));
+        REQUIRE(Y(1, 0) == T(1));
+        REQUIRE(Y(1, 1) > T(0));
+        REQUIRE(Y(1, 1) < lim::min());
+        REQUIRE(ulp_error(Y(1, 1), std::exp(static_cast<long double>(X(1, 1)))) <= 1.0L);
+        REQUIRE(std::isfinite(Y(1, 2)));
+        REQUIRE(Y(1, 3) == T(1));
+        REQUIRE(ulp_error(Y(1, 4), std::exp(1.0L)) <= 1.0L);
+    }
+
+    SECTION("log")
+    {
+        X(0, 0) = T(0);
+        X(0, 1) = T(-0.0);
+        X(0, 2) = T(-1);
+        X(0, 3) = inf;
+        X(0, 4) = nan;
+        X(1, 0) = T(1);
+        X(1, 1) = lim::denorm_min();
+        X(1, 2) = lim::min();
+        X(1, 3) = lim::max();
+        X(1, 4) = -inf;
+        Y = log(X);
+        REQUIRE(Y(0, 0) == -inf);
+        REQUIRE(Y(0, 1) == -inf);
+        REQUIRE(std::isnan(Y(0, 2)));
+        REQUIRE(Y(0, 3) == inf);
+        REQUIRE(std::isnan(Y(0, 4)));
+        REQUIRE(Y(1, 0) == T(0));
+        for (my_size_t j = 1; j < 4; ++j)
+            REQUIRE(ulp_error(Y(1, j), std::log(static_cast<long double>(X(1, j)))) <= 1.0L);
+        REQUIRE(std::isnan(Y(1, 4)));
+    }
+
+    SECTION("sqrt / rsqrt / tanh / sigmoid")
+    {
+        X(0, 0) = T(0);
+        X(0, 1) = inf;
+        X(0, 2) = T(-1);
+        X(0, 3) = T(4);
+        X(0, 4) = nan;
+        Y = sqrt(X);
+        REQUIRE(Y(0, 0) == T(0));
+        REQUIRE(Y(0, 1) == inf);
+        REQUIRE(std::isnan(Y(0, 2)));
+        REQUIRE(Y(0, 3) == T(2));
+        REQUIRE(std::isnan(Y(0, 4)));
+        Y = rsqrt(X);
+        REQUIRE(Y(0, 0) == inf);
+        REQUIRE(Y(0, 1) == T(0));
+        REQUIRE(Y(0, 3) == T(0.5));
+
+        X(1, 0) = inf;
+        X(1, 1) = -inf;
+        X(1, 2) = T(1000);
+        X(1, 3) = T(-1000);
+        X(1, 4) = T(0);
+        Y = tanh(X);
+        REQUIRE(Y(1, 0) == T(1));
+        REQUIRE(Y(1, 1) == T(-1));
+        REQUIRE(Y(1, 2) == T(1));
+        REQUIRE(Y(1, 3) == T(-1));
+        REQUIRE(Y(1, 4) == T(0));
+        REQUIRE(std::isnan(Y(0, 4)));
+        Y = sigmoid(X);
+        REQUIRE(Y(1, 0) == T(1));
+        REQUIRE(Y(1, 1) == T(0));
+        REQUIRE(Y(1, 2) == T(1));
+        REQUIRE(Y(1, 3) == T(0));
+        REQUIRE(Y(1, 4) == T(0.5));
+    }
+
+    SECTION("sin / cos")
+    {
+        X(0, 0) = T(0);
+        X(0, 1) = T(-0.0);
+        X(0, 2) = inf;
+        X(0, 3) = nan;
+        X(0, 4) = T(1e-20);
+        Y = sin(X);
+        REQUIRE(Y(0, 0) == T(0));
+        REQUIRE(std::signbit(Y(0, 1)));
+        REQUIRE(std::isnan(Y(0, 2)));
+        REQUIRE(std::isnan(Y(0, 3)));
+        REQUIRE(Y(0, 4) == T(1e-20));
+        Y = cos(X);
+        REQUIRE(Y(0, 0) == T(1));
+        REQUIRE(Y(0, 1) == T(1));
+        REQUIRE(std::isnan(Y(0, 2)));
+        REQUIRE(std::isnan(Y(0, 3)));
+        REQUIRE(Y(0, 4) == T(1));
+    }
+
+    SECTION("atan2 quadrants, zeros and infinities")
+    {
+        const T vals[] = {T(0), T(-0.0), T(1), T(-1), T(3), T(-0.5), inf, -inf, nan};
+        constexpr my_size_t N = sizeof(vals) / sizeof(vals[0]);
+        FusedMatrix<T, N, N> Ys, Xs, A;
+        for (my_size_t i = 0; i < N; ++i)
+            for (my_size_t j = 0; j < N; ++j)
+            {
+                Ys(i, j) = vals[i];
+                Xs(i, j) = vals[j];
+            }
+        A = atan2(Ys, Xs);
+        for (my_size_t i = 0; i < N; ++i)
+            for (my_size_t j = 0; j < N; ++j)
+            {
+                const T ref = static_cast<T>(std::atan2(static_cast<long double>(vals[i]), static_cast<long double>(vals[j])));
+                if (std::isnan(ref))
+                    REQUIRE(std::isnan(A(i, j)));
+                else
+                {
+                    REQUIRE(std::signbit(A(i, j)) == std::signbit(ref));
+                    REQUIRE(ulp_error(A(i, j), std::atan2(static_cast<long double>(vals[i]), static_cast<long double>(vals[j]))) <= 3.5L);
+                }
+            }
+    }
+}
+
+// ============================================================================
+// EXPRESSIONS
+// ============================================================================
+
+TEMPLATE_TEST_CASE("elementwise math: fused expressions", "[vector_math][expressions]", double, float)
+{
+    using T = TestType;
+    const T tol = is_f32<T> ? T(1e-5) : T(1e-12);
+
+    FusedMatrix<T, 3, 13> X, Mu, E;
+    for (my_size_t i = 0; i < 3; ++i)
+        for (my_size_t j = 0; j < 13; ++j)
+        {
+            X(i, j) = static_cast<T>(0.25 * static_cast<double>(i * 13 + j) - 4.0);
+            Mu(i, j) = static_cast<T>(0.1 * static_cast<double>(j));
+        }
+
+    SECTION("Gaussian likelihood in one pass")
+    {
+        const T k = T(0.5);
+        E = exp(-(X - Mu) * (X - Mu) * k);
+        for (my_size_t i = 0; i < 3; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+            {
+                const T d = X(i, j) - Mu(i, j);
+                REQUIRE(E(i, j) == Approx(std::exp(-d * d * k)).epsilon(tol));
+            }
+    }
+
+    SECTION("nested functions and arithmetic")
+    {
+        E = log(sigmoid(X) + T(1)) * T(2) - sqrt(X * X + T(1));
+        for (my_size_t i = 0; i < 3; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+            {
+                const T x = X(i, j);
+                const T ref = std::log(T(1) / (T(1) + std::exp(-x)) + T(1)) * T(2) - std::sqrt(x * x + T(1));
+                REQUIRE(E(i, j) == Approx(ref).epsilon(tol).margin(tol));
+            }
+    }
+
+    SECTION("atan2 with scalar operands")
+    {
+        E = atan2(X, T(2));
+        for (my_size_t i = 0; i < 3; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+                REQUIRE(E(i, j) == Approx(std::atan2(X(i, j), T(2))).epsilon(tol).margin(tol));
+        E = atan2(T(-2), X);
+        for (my_size_t i = 0; i < 3; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+                REQUIRE(E(i, j) == Approx(std::atan2(T(-2), X(i, j))).epsilon(tol).margin(tol));
+    }
+
+    SECTION("transposed operand")
+    {
+        FusedMatrix<T, 13, 3> Et;
+        Et = cos(X.transpose_view()) * sin(Mu.transpose_view());
+        for (my_size_t i = 0; i < 13; ++i)
+            for (my_size_t j = 0; j < 3; ++j)
+                REQUIRE(Et(i, j) == Approx(std::cos(X(j, i)) * std::sin(Mu(j, i))).epsilon(tol).margin(tol));
+    }
+
+    SECTION("scalar operator() path")
+    {
+        for (my_size_t i = 0; i < 3; ++i)
+            for (my_size_t j = 0; j < 13; ++j)
+            {
+                my_size_t idx[2] = {i, j};
+                REQUIRE(tanh(X - Mu)(idx) == Approx(std::tanh(X(i, j) - Mu(i, j))).epsilon(tol).margin(tol));
+            }
+    }
+
+    SECTION("rank-3 tensor")
+    {
+        FusedTensorND<T, 2, 3, 5> A, B;
+        for (my_size_t i = 0; i < 2; ++i)
+            for (my_size_t j = 0; j < 3; ++j)
+                for (my_size_t l = 0; l < 5; ++l)
+                    A(i, j, l) = static_cast<T>(i + j + l) * T(0.3) + T(0.01);
+        B = log(A) + exp(A);
+        for (my_size_t i = 0; i < 2; ++i)
+            for (my_size_t j = 0; j < 3; ++j)
+                for (my_size_t l = 0; l < 5; ++l)
+                    REQUIRE(B(i, j, l) == Approx(std::log(A(i, j, l)) + std::exp(A(i, j, l))).epsilon(tol));
+    }
+}